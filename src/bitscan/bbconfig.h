@@ -147,6 +147,24 @@
 //#define BIT1_WORD0(p)   (((p - 1) / WORD_SIZE)
 
 
+////////////////////
+// Inline storage of sparse bitsets (small-buffer optimization)
+//
+// BITSCAN_SPARSE_INLINE_BLOCKS
+//   Number of (index, bitblock) pairs of a sparse bitset (BitsetSp, BBScanSp)
+//   stored in the object itself. Rows with at most that many non-empty
+//   bitblocks (e.g. low-degree vertices of large sparse graphs) do not
+//   allocate, and their blocks share the cache line of the object.
+//   Larger bitsets spill to the heap.
+//
+//   0 selects the plain std::vector storage (one heap block per bitset).
+//   Set by the CMake cache variable BITSCAN_SPARSE_INLINE_BLOCKS, which must
+//   be the same for the library and its users.
+//
+#ifndef BITSCAN_SPARSE_INLINE_BLOCKS
+	#define BITSCAN_SPARSE_INLINE_BLOCKS 2					// DEFAULT: 2 inline blocks
+#endif
+
 ////////////////////
 // Extended lookup support
 //
@@ -0,0 +1,826 @@
+/**
+* @file bbkernel.cpp
+* @brief Implementation of the SCALAR / AVX2 / AVX512 bulk bitblock kernels and
+*		 their run-time dispatch (CPUID)
+* @details: created 17/10/2026
+* @details: The SIMD kernels are compiled with function-level target attributes (GCC / Clang),
+*			so that the library does not require -mavx2 / -mavx512f and still runs on older CPUs.
+*			Define BBKERNEL_NO_SIMD to compile only the SCALAR kernels.
+* @author pss
+**/
+
+#include "bbkernel.h"
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(BBKERNEL_NO_SIMD)
+	#define BBKERNEL_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define BBKERNEL_TARGET_AVX2
+		#define BBKERNEL_TARGET_AVX512
+		#define BBKERNEL_TARGET_AVX512_VPOPCNT
+		#define BBKERNEL_TARGET_BMI2
+	#else
+		#include <cpuid.h>
+		#define BBKERNEL_TARGET_AVX2			__attribute__((target("avx2")))
+		#define BBKERNEL_TARGET_AVX512			__attribute__((target("avx2,avx512f,avx512bw")))
+		#define BBKERNEL_TARGET_AVX512_VPOPCNT	__attribute__((target("avx2,avx512f,avx512bw,avx512vpopcntdq")))
+		#define BBKERNEL_TARGET_BMI2			__attribute__((target("bmi,bmi2,popcnt")))
+	#endif
+#endif
+
+namespace bitgraph {
+
+	namespace bbkernel {
+
+		/////////////////////////////
+		// Bit stream kernels (compress / expand) parameterized by the 64-bit PEXT / PDEP
+
+#define BBKERNEL_COMPRESS(NAME, TARGET, PEXT)														\
+			TARGET																					\
+			int NAME(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst) {				\
+				int pos = 0;																		\
+				BITBOARD acc = ZERO;								/* bits of the current block of dst */	\
+				for (int i = 0; i < n; ++i) {														\
+					const BITBOARD m = mask[i];														\
+					if (m == ZERO) { continue; }													\
+					const BITBOARD r = PEXT(src[i], m);												\
+					const int k = bblock::popc64(m);												\
+					const int sh = WMOD(pos);														\
+					acc |= r << sh;																	\
+					if (sh + k >= WORD_SIZE) {							/* current block of dst is full */	\
+						dst[WDIV(pos)] = acc;														\
+						acc = (sh == 0) ? ZERO : (r >> (WORD_SIZE - sh));							\
+					}																				\
+					pos += k;																		\
+				}																					\
+				if (WMOD(pos)) { dst[WDIV(pos)] = acc; }											\
+				return pos;																			\
+			}
+
+#define BBKERNEL_EXPAND(NAME, TARGET, PDEP)															\
+			TARGET																					\
+			void NAME(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst) {				\
+				int pos = 0;																		\
+				for (int i = 0; i < n; ++i) {														\
+					const BITBOARD m = mask[i];														\
+					if (m == ZERO) { dst[i] = ZERO; continue; }										\
+					const int k = bblock::popc64(m);												\
+					const int w = WDIV(pos), sh = WMOD(pos);										\
+					BITBOARD bits = src[w] >> sh;													\
+					if (sh + k > WORD_SIZE) { bits |= src[w + 1] << (WORD_SIZE - sh); }				\
+					dst[i] = PDEP(bits, m);															\
+					pos += k;																		\
+				}																					\
+			}
+
+		/////////////////////////////
+		// SCALAR kernels (portable fallback)
+
+		namespace {
+
+			void and_assign_scalar(BITBOARD* dst, const BITBOARD* src, int n) {
+				for (int i = 0; i < n; ++i) { dst[i] &= src[i]; }
+			}
+
+			void or_assign_scalar(BITBOARD* dst, const BITBOARD* src, int n) {
+				for (int i = 0; i < n; ++i) { dst[i] |= src[i]; }
+			}
+
+			void xor_assign_scalar(BITBOARD* dst, const BITBOARD* src, int n) {
+				for (int i = 0; i < n; ++i) { dst[i] ^= src[i]; }
+			}
+
+			void andnot_assign_scalar(BITBOARD* dst, const BITBOARD* src, int n) {
+				for (int i = 0; i < n; ++i) { dst[i] &= ~src[i]; }
+			}
+
+			void and_to_scalar(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] & rhs[i]; }
+			}
+
+			void or_to_scalar(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] | rhs[i]; }
+			}
+
+			void andnot_to_scalar(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] & ~rhs[i]; }
+			}
+
+			int popcount_scalar(const BITBOARD* src, int n) {
+				int pc = 0;
+				for (int i = 0; i < n; ++i) { pc += bblock::popc64(src[i]); }
+				return pc;
+			}
+
+			int popcount_and_scalar(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				int pc = 0;
+				for (int i = 0; i < n; ++i) { pc += bblock::popc64(lhs[i] & rhs[i]); }
+				return pc;
+			}
+
+			int first_common_scalar(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				for (int i = 0; i < n; ++i) {
+					if (lhs[i] & rhs[i]) { return i; }
+				}
+				return n;
+			}
+
+			int decode_scalar(const BITBOARD* src, int n, int base, int* out) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					if (src[i]) { p += bblock::decode64(src[i], base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			int decode_and_scalar(const BITBOARD* lhs, const BITBOARD* rhs, int n, int base, int* out) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					const BITBOARD bb = lhs[i] & rhs[i];
+					if (bb) { p += bblock::decode64(bb, base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			BITBOARD pext_scalar(BITBOARD bb, BITBOARD mask) { return bblock::pext64(bb, mask); }
+			BITBOARD pdep_scalar(BITBOARD bb, BITBOARD mask) { return bblock::pdep64(bb, mask); }
+
+			BBKERNEL_COMPRESS(compress_scalar, , bblock::pext64)
+			BBKERNEL_EXPAND(expand_scalar, , bblock::pdep64)
+
+			BITBOARD hash_scalar(const BITBOARD* src, int n, int firstBlock) {
+				BITBOARD h = ZERO;
+				for (int i = 0; i < n; ++i) { h ^= hash_block(src[i], firstBlock + i); }
+				return h;
+			}
+
+			const kernel_table_t scalar_table = {
+				and_assign_scalar, or_assign_scalar, xor_assign_scalar, andnot_assign_scalar,
+				and_to_scalar, or_to_scalar, andnot_to_scalar,
+				popcount_scalar, popcount_and_scalar, first_common_scalar,
+				decode_scalar, decode_and_scalar,
+				compress_scalar, expand_scalar, pext_scalar, pdep_scalar,
+				hash_scalar
+			};
+
+		}//end anonymous namespace
+
+#ifdef BBKERNEL_X86
+
+		/////////////////////////////
+		// AVX2 kernels (4 bitblocks per iteration)
+
+		namespace {
+
+			/**
+			* @brief population count of each 64-bit lane of v (nibble lookup, W. Mula et al.)
+			**/
+			BBKERNEL_TARGET_AVX2
+			inline __m256i popcnt_lanes_avx2(__m256i v) {
+				const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+														0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+				const __m256i low_mask = _mm256_set1_epi8(0x0f);
+				const __m256i lo = _mm256_and_si256(v, low_mask);
+				const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+				const __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+				return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+			}
+
+			BBKERNEL_TARGET_AVX2
+			inline int hsum_avx2(__m256i acc) {
+				const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+				return static_cast<int>(_mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1));
+			}
+
+#define BBKERNEL_AVX2_ASSIGN(NAME, VOP, SOP)														\
+			BBKERNEL_TARGET_AVX2																	\
+			void NAME(BITBOARD* dst, const BITBOARD* src, int n) {									\
+				int i = 0;																			\
+				for (; i + 4 <= n; i += 4) {														\
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));	\
+					const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));	\
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), VOP);					\
+				}																					\
+				for (; i < n; ++i) { SOP; }															\
+			}
+
+#define BBKERNEL_AVX2_BINARY(NAME, VOP, SOP)														\
+			BBKERNEL_TARGET_AVX2																	\
+			void NAME(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {				\
+				int i = 0;																			\
+				for (; i + 4 <= n; i += 4) {														\
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));	\
+					const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));	\
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(res + i), VOP);					\
+				}																					\
+				for (; i < n; ++i) { SOP; }															\
+			}
+
+			BBKERNEL_AVX2_ASSIGN(and_assign_avx2, _mm256_and_si256(a, b), dst[i] &= src[i])
+			BBKERNEL_AVX2_ASSIGN(or_assign_avx2, _mm256_or_si256(a, b), dst[i] |= src[i])
+			BBKERNEL_AVX2_ASSIGN(xor_assign_avx2, _mm256_xor_si256(a, b), dst[i] ^= src[i])
+			BBKERNEL_AVX2_ASSIGN(andnot_assign_avx2, _mm256_andnot_si256(b, a), dst[i] &= ~src[i])
+			BBKERNEL_AVX2_BINARY(and_to_avx2, _mm256_and_si256(a, b), res[i] = lhs[i] & rhs[i])
+			BBKERNEL_AVX2_BINARY(or_to_avx2, _mm256_or_si256(a, b), res[i] = lhs[i] | rhs[i])
+			BBKERNEL_AVX2_BINARY(andnot_to_avx2, _mm256_andnot_si256(b, a), res[i] = lhs[i] & ~rhs[i])
+
+#undef BBKERNEL_AVX2_ASSIGN
+#undef BBKERNEL_AVX2_BINARY
+
+			BBKERNEL_TARGET_AVX2
+			int popcount_avx2(const BITBOARD* src, int n) {
+				__m256i acc = _mm256_setzero_si256();
+				int i = 0;
+				for (; i + 4 <= n; i += 4) {
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					acc = _mm256_add_epi64(acc, popcnt_lanes_avx2(a));
+				}
+				int pc = hsum_avx2(acc);
+				for (; i < n; ++i) { pc += bblock::popc64(src[i]); }
+				return pc;
+			}
+
+			BBKERNEL_TARGET_AVX2
+			int popcount_and_avx2(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				__m256i acc = _mm256_setzero_si256();
+				int i = 0;
+				for (; i + 4 <= n; i += 4) {
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+					const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+					acc = _mm256_add_epi64(acc, popcnt_lanes_avx2(_mm256_and_si256(a, b)));
+				}
+				int pc = hsum_avx2(acc);
+				for (; i < n; ++i) { pc += bblock::popc64(lhs[i] & rhs[i]); }
+				return pc;
+			}
+
+			BBKERNEL_TARGET_AVX2
+			int first_common_avx2(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				int i = 0;
+				for (; i + 4 <= n; i += 4) {
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+					const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+					if (!_mm256_testz_si256(a, b)) {
+						break;												//the common block is in [i, i + 4)
+					}
+				}
+				for (; i < n; ++i) {
+					if (lhs[i] & rhs[i]) { return i; }
+				}
+				return n;
+			}
+
+			/**
+			* @brief stores the positions of the 1-bits of bb (+ base) in p, 8 positions
+			*		 per non-empty byte (Tables::pos8 widened to 32 bits)
+			* @returns the end of the positions written
+			**/
+			BBKERNEL_TARGET_AVX2
+			inline int* decode64_avx2(BITBOARD bb, int base, int* p) {
+				__m256i vbase = _mm256_set1_epi32(base);
+				const __m256i v8 = _mm256_set1_epi32(8);
+				for (; bb != 0; bb >>= 8, vbase = _mm256_add_epi32(vbase, v8)) {
+					const unsigned int byte = static_cast<unsigned int>(bb & 0xFF);
+					if (byte) {
+						const __m256i pos = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Tables::pos8[byte].data())));
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_add_epi32(vbase, pos));
+						p += Tables::pc8[byte];
+					}
+				}
+				return p;
+			}
+
+			BBKERNEL_TARGET_AVX2
+			int decode_avx2(const BITBOARD* src, int n, int base, int* out) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					if (src[i]) { p = decode64_avx2(src[i], base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			BBKERNEL_TARGET_AVX2
+			int decode_and_avx2(const BITBOARD* lhs, const BITBOARD* rhs, int n, int base, int* out) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					const BITBOARD bb = lhs[i] & rhs[i];
+					if (bb) { p = decode64_avx2(bb, base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			/**
+			* @brief low 64 bits of x * (clo + 2^32 chi) in each 64-bit lane (3 x VPMULUDQ)
+			**/
+			BBKERNEL_TARGET_AVX2
+			inline __m256i mul64_avx2(__m256i x, __m256i clo, __m256i chi) {
+				const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), clo), _mm256_mul_epu32(x, chi));
+				return _mm256_add_epi64(_mm256_mul_epu32(x, clo), _mm256_slli_epi64(cross, 32));
+			}
+
+			BBKERNEL_TARGET_AVX2
+			BITBOARD hash_avx2(const BITBOARD* src, int n, int firstBlock) {
+				const __m256i clo = _mm256_set1_epi64x(static_cast<long long>(HASH_MUL & 0xFFFFFFFFULL));
+				const __m256i chi = _mm256_set1_epi64x(static_cast<long long>(HASH_MUL >> 32));
+				const __m256i step = _mm256_set1_epi64x(static_cast<long long>(4 * HASH_SALT));
+				const __m256i zero = _mm256_setzero_si256();
+				const BITBOARD salt0 = static_cast<BITBOARD>(firstBlock + 1) * HASH_SALT;
+				__m256i salt = _mm256_setr_epi64x(static_cast<long long>(salt0), static_cast<long long>(salt0 + HASH_SALT),
+					static_cast<long long>(salt0 + 2 * HASH_SALT), static_cast<long long>(salt0 + 3 * HASH_SALT));
+				__m256i acc = zero;
+				int i = 0;
+				for (; i + 4 <= n; i += 4) {
+					const __m256i bb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					__m256i x = _mm256_xor_si256(bb, salt);
+					x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+					x = mul64_avx2(x, clo, chi);
+					x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+					x = mul64_avx2(x, clo, chi);
+					x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+					acc = _mm256_xor_si256(acc, _mm256_andnot_si256(_mm256_cmpeq_epi64(bb, zero), x));		//empty blocks do not contribute
+					salt = _mm256_add_epi64(salt, step);
+				}
+				alignas(32) BITBOARD lanes[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+				BITBOARD h = lanes[0] ^ lanes[1] ^ lanes[2] ^ lanes[3];
+				for (; i < n; ++i) { h ^= hash_block(src[i], firstBlock + i); }
+				return h;
+			}
+
+			const kernel_table_t avx2_table = {
+				and_assign_avx2, or_assign_avx2, xor_assign_avx2, andnot_assign_avx2,
+				and_to_avx2, or_to_avx2, andnot_to_avx2,
+				popcount_avx2, popcount_and_avx2, first_common_avx2,
+				decode_avx2, decode_and_avx2,
+				compress_scalar, expand_scalar, pext_scalar, pdep_scalar,
+				hash_avx2
+			};
+
+		}//end anonymous namespace
+
+		/////////////////////////////
+		// AVX512 kernels (8 bitblocks per iteration, masked tails)
+
+		//GCC 12 reports the undefined upper halves built inside the avx512fintrin.h intrinsics
+		//(_mm512_mul_epu32, _mm512_srli_epi64...) as uninitialized - header false positive
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wuninitialized"
+	#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+		namespace {
+
+			inline __mmask8 tail_mask(int rem) { return static_cast<__mmask8>((1u << rem) - 1); }
+
+#define BBKERNEL_AVX512_ASSIGN(NAME, VOP)															\
+			BBKERNEL_TARGET_AVX512																	\
+			void NAME(BITBOARD* dst, const BITBOARD* src, int n) {									\
+				int i = 0;																			\
+				for (; i + 8 <= n; i += 8) {														\
+					const __m512i a = _mm512_loadu_si512(dst + i);									\
+					const __m512i b = _mm512_loadu_si512(src + i);									\
+					_mm512_storeu_si512(dst + i, VOP);												\
+				}																					\
+				if (i < n) {																		\
+					const __mmask8 m = tail_mask(n - i);											\
+					const __m512i a = _mm512_maskz_loadu_epi64(m, dst + i);							\
+					const __m512i b = _mm512_maskz_loadu_epi64(m, src + i);							\
+					_mm512_mask_storeu_epi64(dst + i, m, VOP);										\
+				}																					\
+			}
+
+#define BBKERNEL_AVX512_BINARY(NAME, VOP)															\
+			BBKERNEL_TARGET_AVX512																	\
+			void NAME(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {				\
+				int i = 0;																			\
+				for (; i + 8 <= n; i += 8) {														\
+					const __m512i a = _mm512_loadu_si512(lhs + i);									\
+					const __m512i b = _mm512_loadu_si512(rhs + i);									\
+					_mm512_storeu_si512(res + i, VOP);												\
+				}																					\
+				if (i < n) {																		\
+					const __mmask8 m = tail_mask(n - i);											\
+					const __m512i a = _mm512_maskz_loadu_epi64(m, lhs + i);							\
+					const __m512i b = _mm512_maskz_loadu_epi64(m, rhs + i);							\
+					_mm512_mask_storeu_epi64(res + i, m, VOP);										\
+				}																					\
+			}
+
+			BBKERNEL_AVX512_ASSIGN(and_assign_avx512, _mm512_and_si512(a, b))
+			BBKERNEL_AVX512_ASSIGN(or_assign_avx512, _mm512_or_si512(a, b))
+			BBKERNEL_AVX512_ASSIGN(xor_assign_avx512, _mm512_xor_si512(a, b))
+			BBKERNEL_AVX512_ASSIGN(andnot_assign_avx512, _mm512_andnot_si512(b, a))
+			BBKERNEL_AVX512_BINARY(and_to_avx512, _mm512_and_si512(a, b))
+			BBKERNEL_AVX512_BINARY(or_to_avx512, _mm512_or_si512(a, b))
+			BBKERNEL_AVX512_BINARY(andnot_to_avx512, _mm512_andnot_si512(b, a))
+
+#undef BBKERNEL_AVX512_ASSIGN
+#undef BBKERNEL_AVX512_BINARY
+
+			/**
+			* @brief population count of each 64-bit lane of v (nibble lookup, AVX512BW)
+			**/
+			BBKERNEL_TARGET_AVX512
+			inline __m512i popcnt_lanes_avx512bw(__m512i v) {
+				const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+				const __m512i low_mask = _mm512_set1_epi8(0x0f);
+				const __m512i lo = _mm512_and_si512(v, low_mask);
+				const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), low_mask);
+				const __m512i cnt = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, lo), _mm512_shuffle_epi8(lookup, hi));
+				return _mm512_sad_epu8(cnt, _mm512_setzero_si512());
+			}
+
+			BBKERNEL_TARGET_AVX512
+			int popcount_avx512(const BITBOARD* src, int n) {
+				__m512i acc = _mm512_setzero_si512();
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					acc = _mm512_add_epi64(acc, popcnt_lanes_avx512bw(_mm512_loadu_si512(src + i)));
+				}
+				if (i < n) {
+					acc = _mm512_add_epi64(acc, popcnt_lanes_avx512bw(_mm512_maskz_loadu_epi64(tail_mask(n - i), src + i)));
+				}
+				return static_cast<int>(_mm512_reduce_add_epi64(acc));
+			}
+
+			BBKERNEL_TARGET_AVX512
+			int popcount_and_avx512(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				__m512i acc = _mm512_setzero_si512();
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					const __m512i v = _mm512_and_si512(_mm512_loadu_si512(lhs + i), _mm512_loadu_si512(rhs + i));
+					acc = _mm512_add_epi64(acc, popcnt_lanes_avx512bw(v));
+				}
+				if (i < n) {
+					const __mmask8 m = tail_mask(n - i);
+					const __m512i v = _mm512_and_si512(_mm512_maskz_loadu_epi64(m, lhs + i), _mm512_maskz_loadu_epi64(m, rhs + i));
+					acc = _mm512_add_epi64(acc, popcnt_lanes_avx512bw(v));
+				}
+				return static_cast<int>(_mm512_reduce_add_epi64(acc));
+			}
+
+			BBKERNEL_TARGET_AVX512_VPOPCNT
+			int popcount_avx512_vpopcnt(const BITBOARD* src, int n) {
+				__m512i acc = _mm512_setzero_si512();
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_loadu_si512(src + i)));
+				}
+				if (i < n) {
+					acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(tail_mask(n - i), src + i)));
+				}
+				return static_cast<int>(_mm512_reduce_add_epi64(acc));
+			}
+
+			BBKERNEL_TARGET_AVX512_VPOPCNT
+			int popcount_and_avx512_vpopcnt(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				__m512i acc = _mm512_setzero_si512();
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					const __m512i v = _mm512_and_si512(_mm512_loadu_si512(lhs + i), _mm512_loadu_si512(rhs + i));
+					acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+				}
+				if (i < n) {
+					const __mmask8 m = tail_mask(n - i);
+					const __m512i v = _mm512_and_si512(_mm512_maskz_loadu_epi64(m, lhs + i), _mm512_maskz_loadu_epi64(m, rhs + i));
+					acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+				}
+				return static_cast<int>(_mm512_reduce_add_epi64(acc));
+			}
+
+			BBKERNEL_TARGET_AVX512
+			int first_common_avx512(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					const __mmask8 k = _mm512_test_epi64_mask(_mm512_loadu_si512(lhs + i), _mm512_loadu_si512(rhs + i));
+					if (k) { return i + bblock::lsb(k); }
+				}
+				if (i < n) {
+					const __mmask8 m = tail_mask(n - i);
+					const __mmask8 k = _mm512_test_epi64_mask(_mm512_maskz_loadu_epi64(m, lhs + i), _mm512_maskz_loadu_epi64(m, rhs + i));
+					if (k) { return i + bblock::lsb(k); }
+				}
+				return n;
+			}
+
+			/**
+			* @brief stores the positions of the 1-bits of bb (+ base) in p, 16 positions per
+			*		 non-empty 16-bit chunk (VPCOMPRESSD of the chunk positions under the chunk as mask)
+			* @returns the end of the positions written
+			**/
+			BBKERNEL_TARGET_AVX512
+			inline int* decode64_avx512(BITBOARD bb, int base, int* p) {
+				__m512i vpos = _mm512_add_epi32(_mm512_set1_epi32(base),
+					_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+				const __m512i v16 = _mm512_set1_epi32(16);
+				for (; bb != 0; bb >>= 16, vpos = _mm512_add_epi32(vpos, v16)) {
+					const __mmask16 k = static_cast<__mmask16>(bb & 0xFFFF);
+					if (k) {
+						_mm512_storeu_si512(p, _mm512_maskz_compress_epi32(k, vpos));
+						p += Tables::pc[k];
+					}
+				}
+				return p;
+			}
+
+			BBKERNEL_TARGET_AVX512
+			int decode_avx512(const BITBOARD* src, int n, int base, int* out) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					if (src[i]) { p = decode64_avx512(src[i], base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			BBKERNEL_TARGET_AVX512
+			int decode_and_avx512(const BITBOARD* lhs, const BITBOARD* rhs, int n, int base, int* out) {
+				int* p = out;
+				int i = 0;
+				for (; i + 8 <= n; i += 8) {
+					const __m512i v = _mm512_and_si512(_mm512_loadu_si512(lhs + i), _mm512_loadu_si512(rhs + i));
+					__mmask8 k = _mm512_test_epi64_mask(v, v);						//non-empty blocks
+					if (k == 0) { continue; }
+					alignas(64) BITBOARD bb[8];
+					_mm512_store_si512(bb, v);
+					for (; k; k &= k - 1) {
+						const int j = bblock::lsb(k);
+						p = decode64_avx512(bb[j], base + WMUL(i + j), p);
+					}
+				}
+				for (; i < n; ++i) {
+					const BITBOARD bb = lhs[i] & rhs[i];
+					if (bb) { p = decode64_avx512(bb, base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+
+			/**
+			* @brief low 64 bits of x * (clo + 2^32 chi) in each 64-bit lane (3 x VPMULUDQ, AVX512F - no AVX512DQ required)
+			**/
+			BBKERNEL_TARGET_AVX512
+			inline __m512i mul64_avx512(__m512i x, __m512i clo, __m512i chi) {
+				const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(x, 32), clo), _mm512_mul_epu32(x, chi));
+				return _mm512_add_epi64(_mm512_mul_epu32(x, clo), _mm512_slli_epi64(cross, 32));
+			}
+
+			BBKERNEL_TARGET_AVX512
+			BITBOARD hash_avx512(const BITBOARD* src, int n, int firstBlock) {
+				const __m512i clo = _mm512_set1_epi64(static_cast<long long>(HASH_MUL & 0xFFFFFFFFULL));
+				const __m512i chi = _mm512_set1_epi64(static_cast<long long>(HASH_MUL >> 32));
+				const __m512i step = _mm512_set1_epi64(static_cast<long long>(8 * HASH_SALT));
+				const __m512i lane = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+				__m512i salt = mul64_avx512(_mm512_add_epi64(_mm512_set1_epi64(static_cast<long long>(firstBlock) + 1), lane),
+											_mm512_set1_epi64(static_cast<long long>(HASH_SALT & 0xFFFFFFFFULL)),
+											_mm512_set1_epi64(static_cast<long long>(HASH_SALT >> 32)));
+				__m512i acc = _mm512_setzero_si512();
+				for (int i = 0; i < n; i += 8) {
+					const __m512i bb = (i + 8 <= n) ? _mm512_loadu_si512(src + i) : _mm512_maskz_loadu_epi64(tail_mask(n - i), src + i);
+					__m512i x = _mm512_xor_si512(bb, salt);
+					x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+					x = mul64_avx512(x, clo, chi);
+					x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+					x = mul64_avx512(x, clo, chi);
+					x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+					acc = _mm512_mask_xor_epi64(acc, _mm512_test_epi64_mask(bb, bb), acc, x);				//empty blocks do not contribute
+					salt = _mm512_add_epi64(salt, step);
+				}
+				alignas(64) BITBOARD lanes[8];
+				_mm512_store_si512(lanes, acc);
+				BITBOARD h = ZERO;
+				for (int j = 0; j < 8; ++j) { h ^= lanes[j]; }
+				return h;
+			}
+
+			const kernel_table_t avx512_table = {
+				and_assign_avx512, or_assign_avx512, xor_assign_avx512, andnot_assign_avx512,
+				and_to_avx512, or_to_avx512, andnot_to_avx512,
+				popcount_avx512, popcount_and_avx512, first_common_avx512,
+				decode_avx512, decode_and_avx512,
+				compress_scalar, expand_scalar, pext_scalar, pdep_scalar,
+				hash_avx512
+			};
+
+			const kernel_table_t avx512_vpopcnt_table = {
+				and_assign_avx512, or_assign_avx512, xor_assign_avx512, andnot_assign_avx512,
+				and_to_avx512, or_to_avx512, andnot_to_avx512,
+				popcount_avx512_vpopcnt, popcount_and_avx512_vpopcnt, first_common_avx512,
+				decode_avx512, decode_and_avx512,
+				compress_scalar, expand_scalar, pext_scalar, pdep_scalar,
+				hash_avx512
+			};
+
+		}//end anonymous namespace
+
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic pop
+#endif
+
+		/////////////////////////////
+		// BMI2 kernels (PEXT / PDEP)
+
+		namespace {
+
+			BBKERNEL_TARGET_BMI2 BITBOARD pext_bmi2(BITBOARD bb, BITBOARD mask) { return _pext_u64(bb, mask); }
+			BBKERNEL_TARGET_BMI2 BITBOARD pdep_bmi2(BITBOARD bb, BITBOARD mask) { return _pdep_u64(bb, mask); }
+
+			BBKERNEL_COMPRESS(compress_bmi2, BBKERNEL_TARGET_BMI2, pext_bmi2)
+			BBKERNEL_EXPAND(expand_bmi2, BBKERNEL_TARGET_BMI2, pdep_bmi2)
+
+		}//end anonymous namespace
+
+		/////////////////////////////
+		// CPUID
+
+		namespace {
+
+			void cpuid(unsigned leaf, unsigned subleaf, unsigned reg[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+				int r[4];
+				__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+				for (int i = 0; i < 4; ++i) { reg[i] = static_cast<unsigned>(r[i]); }
+#else
+				reg[0] = reg[1] = reg[2] = reg[3] = 0;
+				__get_cpuid_count(leaf, subleaf, &reg[0], &reg[1], &reg[2], &reg[3]);
+#endif
+			}
+
+			U64 xgetbv0() {
+#if defined(_MSC_VER) && !defined(__clang__)
+				return _xgetbv(0);
+#else
+				unsigned eax = 0, edx = 0;
+				__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return (static_cast<U64>(edx) << 32) | eax;
+#endif
+			}
+
+			cpu_features_t detect_cpu_features() {
+				cpu_features_t f;
+				unsigned reg[4];							//eax, ebx, ecx, edx
+
+				cpuid(0, 0, reg);
+				const unsigned max_leaf = reg[0];
+				const bool amd = (reg[1] == 0x68747541);					//"Auth" of AuthenticAMD
+
+				cpuid(1, 0, reg);
+				const unsigned family = ((reg[0] >> 8) & 0xF) + ((((reg[0] >> 8) & 0xF) == 0xF) ? ((reg[0] >> 20) & 0xFF) : 0);
+				f.popcnt = (reg[2] >> 23) & 1;
+				const bool osxsave = (reg[2] >> 27) & 1;
+				const bool avx = (reg[2] >> 28) & 1;
+
+				//OS support of the YMM (bits 1, 2) and ZMM (bits 5, 6, 7) registers
+				const U64 xcr0 = osxsave ? xgetbv0() : 0;
+				const bool os_ymm = (xcr0 & 0x06) == 0x06;
+				const bool os_zmm = (xcr0 & 0xE6) == 0xE6;
+
+				if (max_leaf >= 7) {
+					cpuid(7, 0, reg);
+					f.bmi1 = (reg[1] >> 3) & 1;
+					f.bmi2 = (reg[1] >> 8) & 1;
+					f.avx2 = avx && os_ymm && ((reg[1] >> 5) & 1);
+					f.avx512 = f.avx2 && os_zmm && ((reg[1] >> 16) & 1) /* F */ && ((reg[1] >> 30) & 1) /* BW */;
+					f.avx512_vpopcntdq = f.avx512 && ((reg[2] >> 14) & 1);
+					f.pext_fast = f.bmi2 && f.popcnt && !(amd && family < 0x19);		//microcoded before Zen 3
+				}
+
+				cpuid(0x80000000, 0, reg);
+				if (reg[0] >= 0x80000001) {
+					cpuid(0x80000001, 0, reg);
+					f.lzcnt = (reg[2] >> 5) & 1;
+				}
+
+				return f;
+			}
+
+		}//end anonymous namespace
+
+#endif //BBKERNEL_X86
+
+#undef BBKERNEL_COMPRESS
+#undef BBKERNEL_EXPAND
+
+		/////////////////////////////
+		// Dispatch
+
+		//statically initialized (constant initialization) - safe to use before the dynamic initialization below
+		kernel_table_t kernels = {
+			and_assign_scalar, or_assign_scalar, xor_assign_scalar, andnot_assign_scalar,
+			and_to_scalar, or_to_scalar, andnot_to_scalar,
+			popcount_scalar, popcount_and_scalar, first_common_scalar,
+			decode_scalar, decode_and_scalar,
+			compress_scalar, expand_scalar, pext_scalar, pdep_scalar,
+			hash_scalar
+		};
+
+		namespace {
+
+			const cpu_features_t& features_() {
+#ifdef BBKERNEL_X86
+				static const cpu_features_t f = detect_cpu_features();
+#else
+				static const cpu_features_t f{};
+#endif
+				return f;
+			}
+
+			isa_t current_isa = isa_t::SCALAR;
+
+		}//end anonymous namespace
+
+		const cpu_features_t& cpu_features() { return features_(); }
+
+		bool is_supported(isa_t level) {
+			switch (level) {
+			case isa_t::SCALAR:
+				return true;
+			case isa_t::AVX2:
+				return features_().avx2;
+			case isa_t::AVX512:
+				return features_().avx512;
+			}
+			return false;
+		}
+
+		isa_t best_isa() {
+			if (is_supported(isa_t::AVX512)) return isa_t::AVX512;
+			if (is_supported(isa_t::AVX2)) return isa_t::AVX2;
+			return isa_t::SCALAR;
+		}
+
+		isa_t isa() { return current_isa; }
+
+		const char* isa_name(isa_t level) {
+			switch (level) {
+			case isa_t::SCALAR:
+				return "scalar";
+			case isa_t::AVX2:
+				return "avx2";
+			case isa_t::AVX512:
+				return "avx512";
+			}
+			return "unknown";
+		}
+
+		const kernel_table_t& kernel_table(isa_t level) {
+#ifdef BBKERNEL_X86
+			if (level == isa_t::AVX512 && features_().avx512) {
+				return features_().avx512_vpopcntdq ? avx512_vpopcnt_table : avx512_table;
+			}
+			if (level == isa_t::AVX2 && features_().avx2) {
+				return avx2_table;
+			}
+#else
+			(void)level;
+#endif
+			return scalar_table;
+		}
+
+		bool set_isa(isa_t level) {
+			if (!is_supported(level)) {
+				return false;
+			}
+
+			kernels = kernel_table(level);
+			current_isa = level;
+
+#ifdef BBKERNEL_X86
+			//bit stream kernels with PEXT / PDEP if fast, independent of the vector ISA level
+			if (level != isa_t::SCALAR && features_().pext_fast) {
+				kernels.compress = compress_bmi2;
+				kernels.expand = expand_bmi2;
+				kernels.pext = pext_bmi2;
+				kernels.pdep = pdep_bmi2;
+			}
+#endif
+			return true;
+		}
+
+		namespace {
+
+			/**
+			* @brief selects the ISA level at startup: environment variable BITGRAPH_ISA if
+			*		 set to a supported level, otherwise the best level of the CPU
+			**/
+			struct InitKernels {
+				InitKernels() {
+					const char* env = std::getenv("BITGRAPH_ISA");
+					if (env != nullptr) {
+						for (auto level : { isa_t::SCALAR, isa_t::AVX2, isa_t::AVX512 }) {
+							if (std::strcmp(env, isa_name(level)) == 0 && set_isa(level)) {
+								return;
+							}
+						}
+					}
+					set_isa(best_isa());
+				}
+			} initKernels;
+
+		}//end anonymous namespace
+
+	}//end namespace bbkernel
+
+}//end namespace bitgraph
@@ -0,0 +1,328 @@
+/**
+ * @file bbkernel.h
+ * @brief Bulk bitblock kernels of the BITSCAN library, dispatched at run-time
+ *		  according to the instruction set (ISA) of the processor
+ * @details: created 17/10/2026
+ * @details: The kernels operate on raw arrays of bitblocks and are the backend of the bulk
+ *			 operations of the Bitset class (AND, OR, set difference, popcount, disjointness, decoding of the 1-bits...)
+ * @details: Three ISA levels are available: SCALAR (portable fallback), AVX2 and AVX512.
+ *			 The best level supported by the CPU is selected ONCE at startup (CPUID).
+ *			 The level may be forced (for testing / benchmarking) with set_isa(...)
+ *			 or with the environment variable BITGRAPH_ISA={scalar, avx2, avx512}
+ * @author pss
+ **/
+
+#ifndef __BBKERNEL_H__
+#define __BBKERNEL_H__
+
+#include "bbtypes.h"
+#include "bitblock.h"
+
+//////////////////////
+// Minimum number of bitblocks for which the bulk operations are dispatched to the
+// vectorized kernels. Bitsets with fewer blocks are processed inline (scalar loop),
+// since the indirect call does not pay off.
+
+#ifndef BBKERNEL_MIN_BLOCKS
+	#define BBKERNEL_MIN_BLOCKS 8
+#endif
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// namespace bbkernel
+	//
+	// (bulk operations on arrays of bitblocks - SCALAR / AVX2 / AVX512)
+	//
+	///////////////////////////////////
+
+	namespace bbkernel {
+
+		/**
+		* @brief instruction set levels of the kernels
+		**/
+		enum class isa_t { SCALAR = 0, AVX2, AVX512 };
+
+		/**
+		* @brief CPU features relevant to BITSCAN (filled by CPUID at startup)
+		**/
+		struct cpu_features_t {
+			bool popcnt = false;
+			bool lzcnt = false;
+			bool bmi1 = false;							//tzcnt
+			bool bmi2 = false;							//pext / pdep
+			bool avx2 = false;							//includes OS support (XCR0)
+			bool avx512 = false;						//AVX512F + AVX512BW (includes OS support)
+			bool avx512_vpopcntdq = false;				//VPOPCNTQ
+			bool pext_fast = false;						//BMI2 with a fast PEXT / PDEP (not microcoded, i.e. not AMD before Zen 3)
+		};
+
+		/**
+		* @brief table of kernels for a given ISA level
+		* @details: n is the number of bitblocks of the arrays
+		**/
+		struct kernel_table_t {
+			void (*and_assign)		(BITBOARD* dst, const BITBOARD* src, int n);						//dst &= src
+			void (*or_assign)		(BITBOARD* dst, const BITBOARD* src, int n);						//dst |= src
+			void (*xor_assign)		(BITBOARD* dst, const BITBOARD* src, int n);						//dst ^= src
+			void (*andnot_assign)	(BITBOARD* dst, const BITBOARD* src, int n);						//dst &= ~src
+			void (*and_to)			(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n);	//res = lhs & rhs
+			void (*or_to)			(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n);	//res = lhs | rhs
+			void (*andnot_to)		(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n);	//res = lhs & ~rhs
+			int	 (*popcount)		(const BITBOARD* src, int n);
+			int	 (*popcount_and)	(const BITBOARD* lhs, const BITBOARD* rhs, int n);					//|lhs & rhs|
+			int	 (*first_common)	(const BITBOARD* lhs, const BITBOARD* rhs, int n);					//first block i: lhs[i] & rhs[i] != 0, n if none
+			int	 (*decode)			(const BITBOARD* src, int n, int base, int* out);					//positions of the 1-bits of src (+ base) in out
+			int	 (*decode_and)		(const BITBOARD* lhs, const BITBOARD* rhs, int n, int base, int* out);	//positions of the 1-bits of lhs & rhs (+ base) in out
+			int	 (*compress)		(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst);	//PEXT of src under mask into the bit stream dst
+			void (*expand)			(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst);	//PDEP of the bit stream src under mask into dst
+			BITBOARD (*pext)		(BITBOARD bb, BITBOARD mask);										//64-bit PEXT
+			BITBOARD (*pdep)		(BITBOARD bb, BITBOARD mask);										//64-bit PDEP
+			BITBOARD (*hash)		(const BITBOARD* src, int n, int firstBlock);						//XOR of hash_block(src[i], firstBlock + i)
+		};
+
+		/**
+		* @brief number of extra ints required at the end of the output arrays of the decoders,
+		*		 which store a full vector of positions per step (16 in AVX512)
+		**/
+		constexpr int DECODE_PAD = 16;
+
+		/**
+		* @brief constants of the bitblock hash (see hash_block)
+		**/
+		constexpr BITBOARD HASH_SALT = 0x9E3779B97F4A7C15ULL;			//salt of bitblock i: (i + 1) * HASH_SALT
+		constexpr BITBOARD HASH_MUL = 0xD6E8FEB86659FD93ULL;
+
+		/**
+		* @brief active kernel table (statically initialized to the SCALAR kernels,
+		*		 updated at startup to the best available ISA level)
+		**/
+		extern kernel_table_t kernels;
+
+		//////////////////////
+		// ISA management
+
+		/**
+		* @brief CPU features detected by CPUID at startup
+		**/
+		const cpu_features_t& cpu_features();
+
+		/**
+		* @brief best ISA level supported by the CPU (and compiled in)
+		**/
+		isa_t best_isa();
+
+		/**
+		* @brief current ISA level of the active kernel table
+		**/
+		isa_t isa();
+
+		/**
+		* @brief TRUE if the ISA level can be executed in this machine
+		**/
+		bool is_supported(isa_t level);
+
+		/**
+		* @brief Forces the ISA level of the kernels (typically for testing and benchmarking)
+		* @param level: ISA level
+		* @returns TRUE if the level is supported, FALSE otherwise (the active level is not modified)
+		* @details: not thread-safe, call before launching threads that operate on bitsets
+		**/
+		bool set_isa(isa_t level);
+
+		/**
+		* @brief name of the ISA level ("scalar", "avx2", "avx512")
+		**/
+		const char* isa_name(isa_t level);
+
+		/**
+		* @brief kernel table of a given ISA level (the level must be supported)
+		**/
+		const kernel_table_t& kernel_table(isa_t level);
+
+		//////////////////////
+		// Inline entry points (small arrays are processed inline)
+
+		inline void and_assign(BITBOARD* dst, const BITBOARD* src, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { dst[i] &= src[i]; }
+			}
+			else { kernels.and_assign(dst, src, n); }
+		}
+
+		inline void or_assign(BITBOARD* dst, const BITBOARD* src, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { dst[i] |= src[i]; }
+			}
+			else { kernels.or_assign(dst, src, n); }
+		}
+
+		inline void xor_assign(BITBOARD* dst, const BITBOARD* src, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { dst[i] ^= src[i]; }
+			}
+			else { kernels.xor_assign(dst, src, n); }
+		}
+
+		inline void andnot_assign(BITBOARD* dst, const BITBOARD* src, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { dst[i] &= ~src[i]; }
+			}
+			else { kernels.andnot_assign(dst, src, n); }
+		}
+
+		inline void and_to(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] & rhs[i]; }
+			}
+			else { kernels.and_to(res, lhs, rhs, n); }
+		}
+
+		inline void or_to(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] | rhs[i]; }
+			}
+			else { kernels.or_to(res, lhs, rhs, n); }
+		}
+
+		inline void andnot_to(BITBOARD* res, const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) { res[i] = lhs[i] & ~rhs[i]; }
+			}
+			else { kernels.andnot_to(res, lhs, rhs, n); }
+		}
+
+		inline int popcount(const BITBOARD* src, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				int pc = 0;
+				for (int i = 0; i < n; ++i) { pc += bblock::popc64(src[i]); }
+				return pc;
+			}
+			return kernels.popcount(src, n);
+		}
+
+		inline int popcount_and(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				int pc = 0;
+				for (int i = 0; i < n; ++i) { pc += bblock::popc64(lhs[i] & rhs[i]); }
+				return pc;
+			}
+			return kernels.popcount_and(lhs, rhs, n);
+		}
+
+		/**
+		* @brief index of the first bitblock in common between lhs and rhs
+		* @returns the index of the first block i such that lhs[i] & rhs[i] != 0, n if disjoint
+		**/
+		inline int first_common(const BITBOARD* lhs, const BITBOARD* rhs, int n) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				for (int i = 0; i < n; ++i) {
+					if (lhs[i] & rhs[i]) { return i; }
+				}
+				return n;
+			}
+			return kernels.first_common(lhs, rhs, n);
+		}
+
+		/**
+		* @brief Writes the positions of the 1-bits of src in out, in ascending order (batched decoding)
+		* @param base: position of the first bit of src[0] (e.g. WMUL(index of the first block))
+		* @param out: output array with room for popcount(src, n) + DECODE_PAD ints (external ownership)
+		* @returns number of positions written
+		**/
+		inline int decode(const BITBOARD* src, int n, int base, int* out) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					if (src[i]) { p += bblock::decode64(src[i], base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+			return kernels.decode(src, n, base, out);
+		}
+
+		/**
+		* @brief Writes the positions of the 1-bits of lhs & rhs in out, in ascending order (batched decoding)
+		* @param base: position of the first bit of lhs[0] (e.g. WMUL(index of the first block))
+		* @param out: output array with room for popcount_and(lhs, rhs, n) + DECODE_PAD ints (external ownership)
+		* @returns number of positions written
+		**/
+		inline int decode_and(const BITBOARD* lhs, const BITBOARD* rhs, int n, int base, int* out) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				int* p = out;
+				for (int i = 0; i < n; ++i) {
+					const BITBOARD bb = lhs[i] & rhs[i];
+					if (bb) { p += bblock::decode64(bb, base + WMUL(i), p); }
+				}
+				return static_cast<int>(p - out);
+			}
+			return kernels.decode_and(lhs, rhs, n, base, out);
+		}
+
+		/**
+		* @brief 64-bit hash key of the bitblock bb at index blockID, 0 if bb is empty
+		* @details: finalizer of bb salted with the block index (xorshift-multiply, murmur-like). The shifts are
+		*			of 32 bits so that the SIMD kernels compute the same keys with 32 x 32 -> 64 bit products.
+		**/
+		inline BITBOARD hash_block(BITBOARD bb, int blockID) {
+			BITBOARD x = bb ^ (static_cast<BITBOARD>(blockID + 1) * HASH_SALT);
+			x ^= x >> 32;
+			x *= HASH_MUL;
+			x ^= x >> 32;
+			x *= HASH_MUL;
+			x ^= x >> 32;
+			return bb ? x : ZERO;
+		}
+
+		/**
+		* @brief 64-bit hash of the array of bitblocks src, whose first bitblock has index firstBlock
+		* @returns the XOR of hash_block(src[i], firstBlock + i) for every bitblock
+		* @details: empty bitblocks do not contribute, so the hash only depends on the 1-bits (equal for dense and
+		*			sparse bitsets, and for bitsets of different capacity with the same 1-bits).
+		*			A bitblock update from old to new changes the hash by hash_block(old, i) ^ hash_block(new, i).
+		**/
+		inline BITBOARD hash(const BITBOARD* src, int n, int firstBlock = 0) {
+			if (n < BBKERNEL_MIN_BLOCKS) {
+				BITBOARD h = ZERO;
+				for (int i = 0; i < n; ++i) { h ^= hash_block(src[i], firstBlock + i); }
+				return h;
+			}
+			return kernels.hash(src, n, firstBlock);
+		}
+
+		/**
+		* @brief 64-bit PEXT / PDEP (see bblock::pext64, bblock::pdep64), BMI2 under the same conditions as compress
+		**/
+		inline BITBOARD pext(BITBOARD bb, BITBOARD mask) { return kernels.pext(bb, mask); }
+		inline BITBOARD pdep(BITBOARD bb, BITBOARD mask) { return kernels.pdep(bb, mask); }
+
+		/**
+		* @brief Gathers the bits of src selected by mask into consecutive positions of dst (multi-word PEXT)
+		* @param src, mask: input arrays of n bitblocks
+		* @param dst: output bit stream, the first WDIV(k - 1) + 1 bitblocks are written (k = popcount(mask, n)),
+		*			  the remaining bits of the last block written are set to 0. dst may alias src.
+		* @returns k, the number of bits of the stream
+		* @details: BMI2 PEXT if the CPU has a fast implementation and the ISA level is not SCALAR,
+		*			portable loop otherwise (always dispatched, there is no inline path for small arrays)
+		**/
+		inline int compress(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst) {
+			return kernels.compress(src, mask, n, dst);
+		}
+
+		/**
+		* @brief Scatters the consecutive bits of the stream src to the positions of the 1-bits of mask (multi-word PDEP),
+		*		 inverse of compress
+		* @param src: input bit stream with at least popcount(mask, n) bits
+		* @param mask: input array of n bitblocks
+		* @param dst: output array of n bitblocks (a subset of mask), must not alias src
+		**/
+		inline void expand(const BITBOARD* src, const BITBOARD* mask, int n, BITBOARD* dst) {
+			kernels.expand(src, mask, n, dst);
+		}
+
+	}//end namespace bbkernel
+
+}//end namespace bitgraph
+
+#endif
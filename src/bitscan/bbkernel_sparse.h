@@ -0,0 +1,168 @@
+/**
+ * @file bbkernel_sparse.h
+ * @brief Intersection kernels for the block indices of sparse bitsets (merge, galloping and SIMD block merge)
+ * @details created 17/10/2026
+ * @details: A sparse bitset is a sorted sequence of (block index, bitblock) pairs. The kernels enumerate the pairs
+ *			 of positions (i, j) with the same block index in two such sequences, in increasing order:
+ *			 - for_each_common_block(a, na, b, nb, f): generic version, the indices are read with accessors
+ *			   idx(i) (e.g. the idx_ member of BitsetSp::SparseBlock)
+ *			 - for_each_common_block_u32(a, na, b, nb, f): packed uint32 index arrays (structure-of-arrays layout),
+ *			   compares blocks of 4 x 4 indices with SSE2 (baseline in x86-64)
+ *			 Both switch to galloping (exponential search) over the longer sequence when the sizes are skewed
+ *			 by more than BBKERNEL_GALLOP_RATIO.
+ * @details: The callable f(i, j) returns false to stop the enumeration (early exit), in which case the kernels return false.
+ * @author pss
+ **/
+
+#ifndef __BBKERNEL_SPARSE_H__
+#define __BBKERNEL_SPARSE_H__
+
+#include "bbtypes.h"
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define BBKERNEL_SPARSE_SSE2
+#endif
+
+//////////////////////
+// Size ratio of two sparse sequences from which the intersection gallops over the longer one
+
+#ifndef BBKERNEL_GALLOP_RATIO
+	#define BBKERNEL_GALLOP_RATIO 16
+#endif
+
+namespace bitgraph {
+
+	namespace bbkernel {
+
+		/**
+		* @brief galloping (exponential + binary) search of key in the sorted sequence idx(0..n)
+		* @param lo: first position of the search
+		* @returns the first position p in [lo, n) such that idx(p) >= key, n if none
+		**/
+		template<class IdxF>
+		inline
+		int gallop(const IdxF& idx, int lo, int n, int key) {
+			int hi = lo, step = 1;
+			while (hi < n && static_cast<int>(idx(hi)) < key) {
+				lo = hi + 1;
+				hi += step;
+				step <<= 1;
+			}
+			if (hi > n) { hi = n; }
+
+			//binary search in [lo, hi)
+			while (lo < hi) {
+				const int mid = (lo + hi) >> 1;
+				if (static_cast<int>(idx(mid)) < key) { lo = mid + 1; }
+				else { hi = mid; }
+			}
+			return lo;
+		}
+
+		namespace _impl {
+
+			//gallops over the longer sequence b for each index of a - f(i, j) or f(j, i) if swapped
+			template<bool Swapped, class IdxA, class IdxB, class Func>
+			inline
+			bool gallop_common_block(const IdxA& a, int na, const IdxB& b, int nb, Func& f) {
+				int j = 0;
+				for (int i = 0; i < na; ++i) {
+					const int key = static_cast<int>(a(i));
+					if ((j = gallop(b, j, nb, key)) == nb) { break; }
+					if (static_cast<int>(b(j)) == key) {
+						if (!(Swapped ? f(j, i) : f(i, j))) { return false; }
+						++j;
+					}
+				}
+				return true;
+			}
+
+			//merge from positions i, j
+			template<class IdxA, class IdxB, class Func>
+			inline
+			bool merge_common_block(const IdxA& a, int i, int na, const IdxB& b, int j, int nb, Func& f) {
+				while (i < na && j < nb) {
+					const auto ia = a(i), ib = b(j);
+					if (ia < ib) { ++i; }
+					else if (ib < ia) { ++j; }
+					else {
+						if (!f(i, j)) { return false; }
+						++i; ++j;
+					}
+				}
+				return true;
+			}
+		}
+
+		/**
+		* @brief enumerates the positions (i, j) with the same block index in the sorted sequences a(0..na) and b(0..nb)
+		* @param a, b: accessors to the block indices, e.g. [&](int i) { return vBB[i].idx_; }
+		* @param f: callable bool(int i, int j), returns false to stop
+		* @returns false if the enumeration was stopped by f
+		**/
+		template<class IdxA, class IdxB, class Func>
+		inline
+		bool for_each_common_block(const IdxA& a, int na, const IdxB& b, int nb, Func f) {
+			if (na == 0 || nb == 0) { return true; }
+			if (na * BBKERNEL_GALLOP_RATIO < nb) { return _impl::gallop_common_block<false>(a, na, b, nb, f); }
+			if (nb * BBKERNEL_GALLOP_RATIO < na) { return _impl::gallop_common_block<true>(b, nb, a, na, f); }
+			return _impl::merge_common_block(a, 0, na, b, 0, nb, f);
+		}
+
+		/**
+		* @brief enumerates the positions (i, j) with the same block index in the packed sorted index arrays a[0..na) and b[0..nb)
+		*		 Blocks of 4 x 4 indices are compared with SSE2 (all pairs), the remaining indices with a scalar merge.
+		* @param f: callable bool(int i, int j), returns false to stop
+		* @returns false if the enumeration was stopped by f
+		**/
+		template<class Func>
+		inline
+		bool for_each_common_block_u32(const std::uint32_t* a, int na, const std::uint32_t* b, int nb, Func f) {
+			auto ia = [a](int i) { return a[i]; };
+			auto ib = [b](int j) { return b[j]; };
+
+			if (na == 0 || nb == 0) { return true; }
+			if (na * BBKERNEL_GALLOP_RATIO < nb) { return _impl::gallop_common_block<false>(ia, na, ib, nb, f); }
+			if (nb * BBKERNEL_GALLOP_RATIO < na) { return _impl::gallop_common_block<true>(ib, nb, ia, na, f); }
+
+			int i = 0, j = 0;
+
+#ifdef BBKERNEL_SPARSE_SSE2
+			const int na4 = na & ~3, nb4 = nb & ~3;
+			while (i < na4 && j < nb4) {
+				const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+				const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+
+				//all pairs: a against the 4 rotations of b
+				const __m128i c0 = _mm_cmpeq_epi32(va, vb);
+				const __m128i c1 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)));
+				const __m128i c2 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+				const __m128i c3 = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)));
+				int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3))));
+
+				//matches in increasing order of a (the indices are unique in each array)
+				for (int p = 0; mask; ++p, mask >>= 1) {
+					if (mask & 1) {
+						const std::uint32_t key = a[i + p];
+						int q = 0;
+						while (b[j + q] != key) { ++q; }
+						if (!f(i + p, j + q)) { return false; }
+					}
+				}
+
+				const std::uint32_t amax = a[i + 3], bmax = b[j + 3];
+				i += (amax <= bmax) ? 4 : 0;
+				j += (bmax <= amax) ? 4 : 0;
+			}
+#endif
+
+			return _impl::merge_common_block(ia, i, na, ib, j, nb, f);
+		}
+
+	}//end namespace bbkernel
+
+}//end namespace bitgraph
+
+#endif
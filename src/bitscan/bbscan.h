@@ -56,6 +56,9 @@ namespace bitgraph{
 			//inherit constructors	
 			using Bitset::Bitset;
 
+			//assignment of bitset expressions (bbset_expr.h)
+			using Bitset::operator=;
+
 			//TODO...check copy and move assignments 
 
 			~BBScan() = default;
@@ -0,0 +1,451 @@
+/**
+ * @file bbscan_fused.h
+ * @brief Fused bitscanning and counting over set expressions of two or three bitsets
+ *		  (a & b, a & ~b, a & b & c), evaluated lazily block by block - no output bitset is built
+ * @details created 17/10/2026
+ * @details Replaces the idiom AND(a, b, tmp) + scan of tmp in the inner loops of the graph algorithms:
+ *			 - range-based for loops: for (int v : bits_and(a, b)) {...}, bits_andnot(a, b), bits_and(a, b, c)
+ *			 - functional form: for_each_bit_and(a, b, f), for_each_bit_andnot(a, b, f), for_each_bit_and(a, b, c, f)
+ *			 - counting: count_and(a, b), count_andnot(a, b), intersects_at_least(a, b, k) (early exit)
+ * @details Valid for Bitset, BitsetSp, FixedBitset<N> and their derived types. The operands must be of the same
+ *			kind (dense or sparse) and may have different capacities - the missing bitblocks are considered empty.
+ *			Sparse operands are merged by bitblock index, only the non-empty bitblocks are visited.
+ * @details The operands must not be modified during the scan.
+ * @author pss
+ **/
+
+#ifndef __BBSCAN_FUSED_H__
+#define __BBSCAN_FUSED_H__
+
+#include "bbscan_iter.h"
+#include "bbkernel.h"
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//////////////////
+		// binary operations between bitblocks
+
+		struct fused_and {
+			static constexpr bool rhs_optional = false;		//lhs bitblocks without a rhs counterpart are skipped
+			static BITBOARD apply(BITBOARD lhs, BITBOARD rhs) noexcept { return lhs & rhs; }
+		};
+
+		struct fused_andnot {
+			static constexpr bool rhs_optional = true;		//lhs bitblocks without a rhs counterpart are kept
+			static BITBOARD apply(BITBOARD lhs, BITBOARD rhs) noexcept { return lhs & ~rhs; }
+		};
+
+		/////////////////////////////////
+		//
+		// Cursors
+		//
+		// (produce the non-empty bitblocks of the expression in increasing order:
+		//	next(idx, bb) returns false when exhausted, else the index and the value of the next bitblock)
+		//
+		///////////////////////////////////
+
+		template<class OpT>
+		class FusedCursor2Dense {
+		public:
+			FusedCursor2Dense(const BITBOARD* lhs, int nl, const BITBOARD* rhs, int nr) noexcept :
+				lhs_(lhs), rhs_(rhs), i_(0), nc_(std::min(nl, nr)), nl_(nl)
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				for (; i_ < nc_; ++i_) {
+					if ((bb = OpT::apply(lhs_[i_], rhs_[i_]))) {
+						idx = i_++;
+						return true;
+					}
+				}
+				if (OpT::rhs_optional) {
+					for (; i_ < nl_; ++i_) {
+						if ((bb = lhs_[i_])) {
+							idx = i_++;
+							return true;
+						}
+					}
+				}
+				return false;
+			}
+
+		private:
+			const BITBOARD* lhs_;
+			const BITBOARD* rhs_;
+			int i_;									//current bitblock
+			int nc_;								//number of bitblocks in common
+			int nl_;
+		};
+
+		template<class OpT>
+		class FusedCursor2Sparse {
+		public:
+			using SparseBlock = BitsetSp::SparseBlock;
+
+			FusedCursor2Sparse(const SparseBlock* lhs, int nl, const SparseBlock* rhs, int nr) noexcept :
+				lhs_(lhs), rhs_(rhs), i_(0), j_(0), nl_(nl), nr_(nr)
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				while (i_ < nl_) {
+					const SparseBlock& l = lhs_[i_];
+
+					//merge - skips rhs bitblocks with lower index
+					while (j_ < nr_ && rhs_[j_].idx_ < l.idx_) { ++j_; }
+
+					if (j_ < nr_ && rhs_[j_].idx_ == l.idx_) {
+						bb = OpT::apply(l.bb_, rhs_[j_].bb_);
+					}
+					else if (OpT::rhs_optional) {
+						bb = l.bb_;
+					}
+					else if (j_ == nr_) {
+						i_ = nl_;							//rhs exhausted
+						return false;
+					}
+					else {
+						bb = 0;
+					}
+
+					++i_;
+					if (bb) {
+						idx = l.idx_;
+						return true;
+					}
+				}
+				return false;
+			}
+
+		private:
+			const SparseBlock* lhs_;
+			const SparseBlock* rhs_;
+			int i_, j_;								//current bitblocks
+			int nl_, nr_;
+		};
+
+		class FusedCursor3Dense {
+		public:
+			FusedCursor3Dense(const BITBOARD* a, int na, const BITBOARD* b, int nb, const BITBOARD* c, int nc) noexcept :
+				a_(a), b_(b), c_(c), i_(0), n_(std::min(na, std::min(nb, nc)))
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				for (; i_ < n_; ++i_) {
+					if ((bb = a_[i_] & b_[i_] & c_[i_])) {
+						idx = i_++;
+						return true;
+					}
+				}
+				return false;
+			}
+
+		private:
+			const BITBOARD* a_;
+			const BITBOARD* b_;
+			const BITBOARD* c_;
+			int i_;									//current bitblock
+			int n_;									//number of bitblocks in common
+		};
+
+		class FusedCursor3Sparse {
+		public:
+			using SparseBlock = BitsetSp::SparseBlock;
+
+			FusedCursor3Sparse(const SparseBlock* a, int na, const SparseBlock* b, int nb, const SparseBlock* c, int nc) noexcept :
+				a_(a), b_(b), c_(c), i_(0), j_(0), k_(0), na_(na), nb_(nb), nc_(nc)
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				while (i_ < na_ && j_ < nb_ && k_ < nc_) {
+					const int ia = a_[i_].idx_, ib = b_[j_].idx_, ic = c_[k_].idx_;
+					if (ia == ib && ib == ic) {
+						bb = a_[i_].bb_ & b_[j_].bb_ & c_[k_].bb_;
+						++i_; ++j_; ++k_;
+						if (bb) {
+							idx = ia;
+							return true;
+						}
+					}
+					else {
+
+						//advances the bitblocks behind the maximum index
+						const int imax = std::max(ia, std::max(ib, ic));
+						if (ia < imax) { ++i_; }
+						if (ib < imax) { ++j_; }
+						if (ic < imax) { ++k_; }
+					}
+				}
+				return false;
+			}
+
+		private:
+			const SparseBlock* a_;
+			const SparseBlock* b_;
+			const SparseBlock* c_;
+			int i_, j_, k_;							//current bitblocks
+			int na_, nb_, nc_;
+		};
+
+		//////////////////
+		// cursor factories (dense / sparse)
+
+		template<class OpT>
+		inline FusedCursor2Dense<OpT> make_cursor(block_span<const BITBOARD> a, block_span<const BITBOARD> b) {
+			return FusedCursor2Dense<OpT>(a.data_, a.size_, b.data_, b.size_);
+		}
+
+		template<class OpT>
+		inline FusedCursor2Sparse<OpT> make_cursor(block_span<const BitsetSp::SparseBlock> a, block_span<const BitsetSp::SparseBlock> b) {
+			return FusedCursor2Sparse<OpT>(a.data_, a.size_, b.data_, b.size_);
+		}
+
+		inline FusedCursor3Dense make_cursor(block_span<const BITBOARD> a, block_span<const BITBOARD> b, block_span<const BITBOARD> c) {
+			return FusedCursor3Dense(a.data_, a.size_, b.data_, b.size_, c.data_, c.size_);
+		}
+
+		inline FusedCursor3Sparse make_cursor(block_span<const BitsetSp::SparseBlock> a, block_span<const BitsetSp::SparseBlock> b,
+			block_span<const BitsetSp::SparseBlock> c) {
+			return FusedCursor3Sparse(a.data_, a.size_, b.data_, b.size_, c.data_, c.size_);
+		}
+
+		/////////////////////////////////
+		//
+		// FusedBitIterator
+		//
+		// (non-destructive scan of the 1-bits of the expression evaluated by the cursor,
+		//  the current bitblock of the expression is cached in the iterator)
+		//
+		///////////////////////////////////
+
+		template<class CursorT>
+		class FusedBitIterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = int;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const int*;
+			using reference = int;
+
+			FusedBitIterator(const CursorT& cursor, bool last) noexcept :
+				cursor_(cursor), idx_(0), bb_(0), end_(true)
+			{
+				if (!last) {
+					end_ = !cursor_.next(idx_, bb_);
+				}
+			}
+
+			int operator* () const noexcept { return bblock::lsb(bb_) + WMUL(idx_); }
+
+			FusedBitIterator& operator++ () noexcept {
+				bb_ &= bb_ - 1;
+				if (!bb_) {
+					end_ = !cursor_.next(idx_, bb_);
+				}
+				return *this;
+			}
+
+			bool operator == (const FusedBitIterator& rhs) const noexcept { return end_ == rhs.end_; }
+			bool operator != (const FusedBitIterator& rhs) const noexcept { return end_ != rhs.end_; }
+
+		private:
+			CursorT cursor_;
+			int idx_;								//index of the current bitblock
+			BITBOARD bb_;							//bits of the current bitblock not yet scanned
+			bool end_;
+		};
+
+		template<class CursorT>
+		class FusedBitRange {
+		public:
+			using iterator = FusedBitIterator<CursorT>;
+
+			explicit FusedBitRange(const CursorT& cursor) : cursor_(cursor) {}
+
+			iterator begin() const { return iterator(cursor_, false); }
+			iterator end() const { return iterator(cursor_, true); }
+
+		private:
+			CursorT cursor_;
+		};
+
+		template<class CursorT>
+		inline FusedBitRange<CursorT> make_fused_range(const CursorT& cursor) {
+			return FusedBitRange<CursorT>(cursor);
+		}
+
+		template<class CursorT, class Func>
+		inline void for_each_fused(CursorT cursor, Func& f) {
+			int idx = 0;
+			BITBOARD bb = 0;
+			while (cursor.next(idx, bb)) {
+				const int offset = WMUL(idx);
+				do {
+					f(bblock::lsb(bb) + offset);
+					bb &= bb - 1;
+				} while (bb);
+			}
+		}
+
+		//////////////////
+		// counting (dense / sparse)
+
+		inline int count_and(block_span<const BITBOARD> a, block_span<const BITBOARD> b) {
+			return bbkernel::popcount_and(a.data_, b.data_, std::min(a.size_, b.size_));
+		}
+
+		inline int count_and(block_span<const BitsetSp::SparseBlock> a, block_span<const BitsetSp::SparseBlock> b) {
+			const BitsetSp::SparseBlock* pa = a.data_;
+			const BitsetSp::SparseBlock* pb = b.data_;
+			int pc = 0;
+
+			//branchless merge or galloping (bbkernel_sparse.h)
+			bbkernel::for_each_common_block(
+				[pa](int i) { return pa[i].idx_; }, a.size_,
+				[pb](int j) { return pb[j].idx_; }, b.size_,
+				[pa, pb, &pc](int i, int j) { pc += bblock::popc64(pa[i].bb_ & pb[j].bb_); return true; });
+			return pc;
+		}
+
+		inline int count_andnot(block_span<const BITBOARD> a, block_span<const BITBOARD> b) {
+			return bbkernel::popcount(a.data_, a.size_) - bbkernel::popcount_and(a.data_, b.data_, std::min(a.size_, b.size_));
+		}
+
+		inline int count_andnot(block_span<const BitsetSp::SparseBlock> a, block_span<const BitsetSp::SparseBlock> b) {
+			int pc = 0;
+			int j = 0;
+			for (int i = 0; i < a.size_; ++i) {
+				while (j < b.size_ && b.data_[j].idx_ < a.data_[i].idx_) { ++j; }
+				if (j < b.size_ && b.data_[j].idx_ == a.data_[i].idx_) {
+					pc += bblock::popc64(a.data_[i].bb_ & ~b.data_[j].bb_);
+				}
+				else {
+					pc += bblock::popc64(a.data_[i].bb_);
+				}
+			}
+			return pc;
+		}
+
+	}//end namespace _impl
+
+	////////////////////////
+	//
+	// Fused bitscanning ranges
+	//
+	////////////////////////
+
+	/**
+	* @brief range of the 1-bits of a & b in increasing order, no bitset is built
+	*		 usage: for (int v : bits_and(a, b)) {...}
+	* @details: a and b must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_and(const BitsetT& a, const BitsetT& b) {
+		return _impl::make_fused_range(_impl::make_cursor<_impl::fused_and>(blocks(a), blocks(b)));
+	}
+
+	/**
+	* @brief range of the 1-bits of a & ~b in increasing order, no bitset is built
+	*		 usage: for (int v : bits_andnot(a, b)) {...}
+	* @details: a and b must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_andnot(const BitsetT& a, const BitsetT& b) {
+		return _impl::make_fused_range(_impl::make_cursor<_impl::fused_andnot>(blocks(a), blocks(b)));
+	}
+
+	/**
+	* @brief range of the 1-bits of a & b & c in increasing order, no bitset is built
+	*		 usage: for (int v : bits_and(a, b, c)) {...}
+	* @details: a, b and c must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_and(const BitsetT& a, const BitsetT& b, const BitsetT& c) {
+		return _impl::make_fused_range(_impl::make_cursor(blocks(a), blocks(b), blocks(c)));
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of a & b in increasing order
+	* @param f: callable with signature void(int bit)
+	**/
+	template<class BitsetT, class Func>
+	inline
+	void for_each_bit_and(const BitsetT& a, const BitsetT& b, Func f) {
+		_impl::for_each_fused(_impl::make_cursor<_impl::fused_and>(blocks(a), blocks(b)), f);
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of a & ~b in increasing order
+	* @param f: callable with signature void(int bit)
+	**/
+	template<class BitsetT, class Func>
+	inline
+	void for_each_bit_andnot(const BitsetT& a, const BitsetT& b, Func f) {
+		_impl::for_each_fused(_impl::make_cursor<_impl::fused_andnot>(blocks(a), blocks(b)), f);
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of a & b & c in increasing order
+	* @param f: callable with signature void(int bit)
+	**/
+	template<class BitsetT, class Func>
+	inline
+	void for_each_bit_and(const BitsetT& a, const BitsetT& b, const BitsetT& c, Func f) {
+		_impl::for_each_fused(_impl::make_cursor(blocks(a), blocks(b), blocks(c)), f);
+	}
+
+	////////////////////////
+	//
+	// Fused counting
+	//
+	////////////////////////
+
+	/**
+	* @brief number of 1-bits in a & b, no bitset is built
+	**/
+	template<class BitsetT>
+	inline
+	int count_and(const BitsetT& a, const BitsetT& b) {
+		return _impl::count_and(blocks(a), blocks(b));
+	}
+
+	/**
+	* @brief number of 1-bits in a & ~b, no bitset is built
+	**/
+	template<class BitsetT>
+	inline
+	int count_andnot(const BitsetT& a, const BitsetT& b) {
+		return _impl::count_andnot(blocks(a), blocks(b));
+	}
+
+	/**
+	* @brief determines if a & b has at least k 1-bits.
+	*		 The scan stops as soon as k common bits are found.
+	* @returns true if |a & b| >= k (always true for k <= 0)
+	**/
+	template<class BitsetT>
+	inline
+	bool intersects_at_least(const BitsetT& a, const BitsetT& b, int k) {
+		if (k <= 0) { return true; }
+
+		auto cursor = _impl::make_cursor<_impl::fused_and>(blocks(a), blocks(b));
+		int idx = 0, pc = 0;
+		BITBOARD bb = 0;
+		while (cursor.next(idx, bb)) {
+			if ((pc += bblock::popc64(bb)) >= k) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+}//end namespace bitgraph
+
+#endif
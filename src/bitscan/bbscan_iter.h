@@ -0,0 +1,317 @@
+/**
+ * @file bbscan_iter.h
+ * @brief Iterator-based bitscanning for the dense and sparse bitsets of the BITSCAN library
+ * @details created 17/10/2026
+ * @details Zero-overhead alternative to the stateful bitscanning of BBScan / BBScanSp
+ *			(virtual next_bit(), next_bit_del()... with the cursor cached in the bitset):
+ *			 - range-based for loops:  for (int v : bits(bb)) {...}
+ *			 - reverse and destructive variants: bits_rev(bb), bits_del(bb), bits_del_rev(bb)
+ *			 - functional form: for_each_bit(bb, f), for_each_bit_rev(bb, f)
+ *			No virtual calls, no state in the bitset, the loops compile to TZCNT / BLSR (LZCNT) sequences
+ * @details Valid for Bitset, BitsetSp, all their derived types and the views BitsetView / ConstBitsetView.
+ *			The dense row types get the read-only blocks(bb) from _impl::DenseBase (bbset_dense.h, found by ADL) and add
+ *			the writable overload or the ranges themselves at the end of their own header (bbset_fixed.h, bbset_hybrid.h...)
+ *			The bitset must outlive the range, e.g. for (int v : bits(AND(a, b))) is NOT valid.
+ * @author pss
+ **/
+
+#ifndef __BBSCAN_ITER_H__
+#define __BBSCAN_ITER_H__
+
+#include "bbset.h"
+#include "bbset_sparse.h"
+#include <iterator>
+#include <cstddef>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//bitblocks of a bitset - returned by the overloads of blocks(bb)
+		template<class BlockT>
+		struct block_span {
+			using block_type = BlockT;
+
+			BlockT* data_;
+			int size_;
+		};
+
+		inline BITBOARD word(const BITBOARD& bb) noexcept { return bb; }
+		inline BITBOARD& word(BITBOARD& bb) noexcept { return bb; }
+		inline BITBOARD word(const BitsetSp::SparseBlock& e) noexcept { return e.bb_; }
+		inline BITBOARD& word(BitsetSp::SparseBlock& e) noexcept { return e.bb_; }
+
+		//index of the i-th bitblock in the equivalent non-sparse bitset
+		inline int block_index(const BITBOARD*, int i) noexcept { return i; }
+		inline int block_index(const BitsetSp::SparseBlock* data, int i) noexcept { return data[i].idx_; }
+
+		/////////////////////////////////
+		//
+		// BitIterator
+		//
+		// (non-destructive scan, the current bitblock is cached in the iterator -
+		//  the bitset must not be modified during the scan)
+		//
+		///////////////////////////////////
+
+		template<class BlockT, bool Reverse>
+		class BitIterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = int;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const int*;
+			using reference = int;
+
+			BitIterator(const BlockT* data, int first, int last) noexcept :
+				data_(data), i_(first), end_(last), bb_(0)
+			{
+				if (i_ != end_) {
+					bb_ = word(data_[i_]);
+					seek();
+				}
+			}
+
+			int operator* () const noexcept {
+				return (Reverse ? bblock::msb(bb_) : bblock::lsb(bb_)) + WMUL(block_index(data_, i_));
+			}
+
+			BitIterator& operator++ () noexcept {
+				if (Reverse) { bb_ ^= (static_cast<BITBOARD>(1) << bblock::msb(bb_)); }
+				else { bb_ &= bb_ - 1; }
+				seek();
+				return *this;
+			}
+
+			bool operator == (const BitIterator& rhs) const noexcept { return i_ == rhs.i_; }
+			bool operator != (const BitIterator& rhs) const noexcept { return i_ != rhs.i_; }
+
+		private:
+
+			//skips empty bitblocks
+			void seek() noexcept {
+				while (!bb_) {
+					if (Reverse) { --i_; }
+					else { ++i_; }
+					if (i_ == end_) { return; }
+					bb_ = word(data_[i_]);
+				}
+			}
+
+			const BlockT* data_;
+			int i_;									//current bitblock
+			int end_;
+			BITBOARD bb_;							//bits of the current bitblock not yet scanned
+		};
+
+		/////////////////////////////////
+		//
+		// BitDelIterator
+		//
+		// (destructive scan, each bit is removed from the bitset when reached, as in BBScan::next_bit_del().
+		//  The bitblocks are read from the bitset at each step, so the bitset may be modified during the scan)
+		//
+		///////////////////////////////////
+
+		template<class BlockT, bool Reverse>
+		class BitDelIterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = int;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const int*;
+			using reference = int;
+
+			BitDelIterator(BlockT* data, int first, int last) noexcept :
+				data_(data), i_(first), end_(last), bit_(BBObject::noBit)
+			{
+				next();
+			}
+
+			int operator* () const noexcept { return bit_; }
+
+			BitDelIterator& operator++ () noexcept {
+				next();
+				return *this;
+			}
+
+			bool operator == (const BitDelIterator& rhs) const noexcept { return i_ == rhs.i_; }
+			bool operator != (const BitDelIterator& rhs) const noexcept { return i_ != rhs.i_; }
+
+		private:
+
+			//finds the next bit and removes it from the bitset
+			void next() noexcept {
+				for (; i_ != end_; Reverse ? --i_ : ++i_) {
+					BITBOARD& bb = word(data_[i_]);
+					if (bb) {
+						int pos;
+						if (Reverse) {
+							pos = bblock::msb(bb);
+							bb ^= (static_cast<BITBOARD>(1) << pos);
+						}
+						else {
+							pos = bblock::lsb(bb);
+							bb &= bb - 1;
+						}
+						bit_ = pos + WMUL(block_index(data_, i_));
+						return;
+					}
+				}
+			}
+
+			BlockT* data_;
+			int i_;									//current bitblock
+			int end_;
+			int bit_;								//current bit (already removed from the bitset)
+		};
+
+		template<class IterT>
+		class BitRange {
+		public:
+			BitRange(IterT first, IterT last) : first_(first), last_(last) {}
+
+			IterT begin() const { return first_; }
+			IterT end() const { return last_; }
+
+		private:
+			IterT first_;
+			IterT last_;
+		};
+
+	}//end namespace _impl
+
+	//////////////////
+	//
+	// uniform access to the bitblocks of dense and sparse bitsets
+	// (customization point: found by ADL in the ranges below, so that each row type
+	//  overloads blocks(bb) in its own header)
+	//
+	//////////////////
+
+	inline _impl::block_span<const BITBOARD> blocks(const Bitset& bb) {
+		return { bb.bitset().data(), static_cast<int>(bb.bitset().size()) };
+	}
+	inline _impl::block_span<BITBOARD> blocks(Bitset& bb) {
+		return { bb.bitset().data(), static_cast<int>(bb.bitset().size()) };
+	}
+
+	inline _impl::block_span<const BitsetSp::SparseBlock> blocks(const BitsetSp& bb) {
+		return { bb.bitset().data(), static_cast<int>(bb.bitset().size()) };
+	}
+	inline _impl::block_span<BitsetSp::SparseBlock> blocks(BitsetSp& bb) {
+		return { bb.bitset().data(), static_cast<int>(bb.bitset().size()) };
+	}
+
+	//views: bits(view) is non-destructive, bits_del(view) requires a writable view (lvalue)
+	inline _impl::block_span<const BITBOARD> blocks(const ConstBitsetView& bb) {
+		return { bb.data(), bb.num_blocks() };
+	}
+	inline _impl::block_span<BITBOARD> blocks(BitsetView& bb) {
+		return { bb.data(), bb.num_blocks() };
+	}
+
+	////////////////////////
+	//
+	// Bitscanning ranges
+	//
+	////////////////////////
+
+	/**
+	* @brief range of the 1-bits of bb in increasing order (non-destructive)
+	*		 usage: for (int v : bits(bb)) {...}
+	* @details: bb must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	auto bits(const BitsetT& bb) {
+		auto s = blocks(bb);
+		using IterT = _impl::BitIterator<typename decltype(s)::block_type, false>;
+		return _impl::BitRange<IterT>(IterT(s.data_, 0, s.size_), IterT(s.data_, s.size_, s.size_));
+	}
+
+	/**
+	* @brief range of the 1-bits of bb in decreasing order (non-destructive)
+	*		 usage: for (int v : bits_rev(bb)) {...}
+	* @details: bb must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_rev(const BitsetT& bb) {
+		auto s = blocks(bb);
+		using IterT = _impl::BitIterator<typename decltype(s)::block_type, true>;
+		return _impl::BitRange<IterT>(IterT(s.data_, s.size_ - 1, -1), IterT(s.data_, -1, -1));
+	}
+
+	/**
+	* @brief range of the 1-bits of bb in increasing order (destructive).
+	*		 Each bit is removed from bb when reached.
+	*		 usage: for (int v : bits_del(bb)) {...}
+	* @details: bb may be modified during the scan (e.g. bb &= N(v))
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_del(BitsetT& bb) {
+		auto s = blocks(bb);
+		using IterT = _impl::BitDelIterator<typename decltype(s)::block_type, false>;
+		return _impl::BitRange<IterT>(IterT(s.data_, 0, s.size_), IterT(s.data_, s.size_, s.size_));
+	}
+
+	/**
+	* @brief range of the 1-bits of bb in decreasing order (destructive).
+	*		 Each bit is removed from bb when reached.
+	*		 usage: for (int v : bits_del_rev(bb)) {...}
+	* @details: bb may be modified during the scan (e.g. bb &= N(v))
+	**/
+	template<class BitsetT>
+	inline
+	auto bits_del_rev(BitsetT& bb) {
+		auto s = blocks(bb);
+		using IterT = _impl::BitDelIterator<typename decltype(s)::block_type, true>;
+		return _impl::BitRange<IterT>(IterT(s.data_, s.size_ - 1, -1), IterT(s.data_, -1, -1));
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of bb in increasing order (non-destructive)
+	* @param f: callable with signature void(int bit)
+	**/
+	template<class BitsetT, class Func>
+	inline
+	void for_each_bit(const BitsetT& bb, Func f) {
+		auto s = blocks(bb);
+		for (int i = 0; i < s.size_; ++i) {
+			BITBOARD w = _impl::word(s.data_[i]);
+			if (w) {
+				const int offset = WMUL(_impl::block_index(s.data_, i));
+				do {
+					f(bblock::lsb(w) + offset);
+					w &= w - 1;
+				} while (w);
+			}
+		}
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of bb in decreasing order (non-destructive)
+	* @param f: callable with signature void(int bit)
+	**/
+	template<class BitsetT, class Func>
+	inline
+	void for_each_bit_rev(const BitsetT& bb, Func f) {
+		auto s = blocks(bb);
+		for (int i = s.size_ - 1; i >= 0; --i) {
+			BITBOARD w = _impl::word(s.data_[i]);
+			if (w) {
+				const int offset = WMUL(_impl::block_index(s.data_, i));
+				do {
+					const int pos = bblock::msb(w);
+					f(pos + offset);
+					w ^= (static_cast<BITBOARD>(1) << pos);
+				} while (w);
+			}
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
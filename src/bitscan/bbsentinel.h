@@ -9,7 +9,9 @@
   * 
   * @author pss
   *
-  * TODO- PENDING FULL REFACTORING, namespace _impl (13/02/2025)
+  * @details LEGACY (17/10/2026): the sentinels are maintained by hand (update_sentinels*, erase_bit does not update them).
+  *			 Superseded by SentinelBitset (bbset_sentinel.h), whose sentinels are kept exact by every operation
+  *			 and which is the type of the alias watched_bitarray (bitscan.h)
   **/
 
 #ifndef __BB_SENTINEL_H__
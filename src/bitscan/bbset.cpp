@@ -184,28 +184,19 @@ void Bitset::reset(std::size_t nPop, const bitpos_list& lv) noexcept {
 
 Bitset& Bitset::operator &=	(const Bitset& bbn){
 
-	for (auto i = 0; i < nBB_; ++i) {
-		vBB_[i] &= bbn.vBB_[i];
-	}
-				
+	bbkernel::and_assign(vBB_.data(), bbn.vBB_.data(), nBB_);
 	return *this;
 }
 
 Bitset& Bitset::operator |=	(const Bitset& bbn){
 	
-	for (auto i = 0; i < nBB_; ++i) {
-		vBB_[i] |= bbn.vBB_[i];
-	}
-
+	bbkernel::or_assign(vBB_.data(), bbn.vBB_.data(), nBB_);
 	return *this;
 }
 
 Bitset& Bitset::operator ^=	(const Bitset& bbn) {
 	
-	for (auto i = 0; i < nBB_; ++i) {
-		vBB_[i] ^= bbn.vBB_[i];
-	}
-
+	bbkernel::xor_assign(vBB_.data(), bbn.vBB_.data(), nBB_);
 	return *this;
 }
 
@@ -288,15 +279,12 @@ string Bitset::to_string ()
 void Bitset::extract (bitpos_list& lv ) const {
 
 	lv.clear();
-	const int pc = this->count();
+	const int pc = bbkernel::popcount(vBB_.data(), nBB_);			//all the bitblocks, as decode (count() may be restricted in derived classes)
 	if (pc == 0) return;				
-	lv.reserve(pc);		
-
 
-	int v = BBObject::noBit;
-	while( (v = next_bit(v)) != BBObject::noBit){
-		lv.emplace_back(v);
-	}
+	//batched decoding, the padding of the decoders is trimmed afterwards
+	lv.resize(pc + bbkernel::DECODE_PAD);
+	lv.resize(decode(lv.data()));
 }
 
 void Bitset::extract_set(bitpos_set& ls) const
@@ -381,19 +369,13 @@ namespace bitgraph {
 
 	Bitset& AND(const Bitset& lhs, const Bitset& rhs, Bitset& res) {
 
-		for (auto i = 0; i < lhs.nBB_; ++i) {
-			res.vBB_[i] = lhs.vBB_[i] & rhs.vBB_[i];
-		}
-
+		bbkernel::and_to(res.vBB_.data(), lhs.vBB_.data(), rhs.vBB_.data(), lhs.nBB_);
 		return res;
 	}
 
 	Bitset& OR(const Bitset& lhs, const Bitset& rhs, Bitset& res) {
 
-		for (auto i = 0; i < lhs.nBB_; ++i) {
-			res.vBB_[i] = lhs.vBB_[i] | rhs.vBB_[i];
-		}
-
+		bbkernel::or_to(res.vBB_.data(), lhs.vBB_.data(), rhs.vBB_.data(), lhs.nBB_);
 		return res;
 	}
 
@@ -427,9 +409,37 @@ namespace bitgraph {
 
 	Bitset& erase_bit(const Bitset& lhs, const Bitset& rhs, Bitset& res) {
 
+		bbkernel::andnot_to(res.vBB_.data(), lhs.vBB_.data(), rhs.vBB_.data(), lhs.nBB_);
+		return res;
+	}
+
+	Bitset& compress(const Bitset& src, const Bitset& mask, Bitset& res) {
+
+		///////////////////////////////////////////////////
+		assert(src.nBB_ == mask.nBB_);
+		assert(mask.count() <= WMUL(res.nBB_));
+		///////////////////////////////////////////////////
 
-		for (auto i = 0; i < lhs.nBB_; ++i) {
-			res.vBB_[i] = lhs.vBB_[i] & ~rhs.vBB_[i];
+		//bit stream in the first blocks of res, the remaining blocks are set to 0
+		const int k = bbkernel::compress(src.vBB_.data(), mask.vBB_.data(), mask.nBB_, res.vBB_.data());
+		for (int i = WDIV(k + WORD_SIZE - 1); i < res.nBB_; ++i) {
+			res.vBB_[i] = ZERO;
+		}
+
+		return res;
+	}
+
+	Bitset& expand(const Bitset& src, const Bitset& mask, Bitset& res) {
+
+		///////////////////////////////////////////////////
+		assert(&src != &res);
+		assert(mask.nBB_ <= res.nBB_);
+		assert(mask.count() <= WMUL(src.nBB_));
+		///////////////////////////////////////////////////
+
+		bbkernel::expand(src.vBB_.data(), mask.vBB_.data(), mask.nBB_, res.vBB_.data());
+		for (int i = mask.nBB_; i < res.nBB_; ++i) {
+			res.vBB_[i] = ZERO;
 		}
 
 		return res;
@@ -437,11 +447,9 @@ namespace bitgraph {
 
 	int find_first_common(const Bitset& lhs, const Bitset& rhs) {
 
-		for (auto i = 0; i < lhs.nBB_; ++i) {
-			BITBOARD bb = lhs.vBB_[i] & rhs.vBB_[i];
-			if (bb) {
-				return bblock::lsb(bb) + static_cast<int>(WMUL(i));
-			}
+		const int i = bbkernel::first_common(lhs.vBB_.data(), rhs.vBB_.data(), lhs.nBB_);
+		if (i < lhs.nBB_) {
+			return bblock::lsb(lhs.vBB_[i] & rhs.vBB_[i]) + static_cast<int>(WMUL(i));
 		}
 
 		return BBObject::noBit;		//disjoint
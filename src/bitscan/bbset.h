@@ -15,6 +15,8 @@
 
 #include "bbobject.h"
 #include "bitblock.h"	
+#include "bbkernel.h"				//bulk operations (SCALAR / AVX2 / AVX512)
+#include "bbset_view.h"				//non-owning views (BitsetView, ConstBitsetView)
 #include "utils/common.h"			//for the primitive FixedStack type
 #include <vector>	
 #include <set>
@@ -22,13 +24,18 @@
 #include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
 
 namespace bitgraph {
+
+	template<class E>
+	class BitsetExpr;						//expression templates (bbset_expr.h)
 		
 	/////////////////////////////////
 	//
 	// Bitset class 
 	//
 	// Manages bit strings greater than WORD_SIZE 
-	// @details Does not use HW dependent instructions (intrinsics), nor does it cache information for very fast bitscanning
+	// @details Does not cache information for very fast bitscanning
+	// @details Bulk operations (AND, OR, set difference, popcount...) are delegated to the
+	//			bbkernel layer (SCALAR / AVX2 / AVX512, selected at run-time)
 	//
 	///////////////////////////////////
 	class Bitset : public BBObject {
@@ -177,6 +184,28 @@ namespace bitgraph {
 		**/
 		friend int find_first_common_block(index_t firstBlock, index_t lastBlock, const Bitset& lhs, const Bitset& rhs);
 
+		/**
+		* @brief Gathers the bits of src selected by mask into the consecutive positions [0, mask.count()) of res
+		*		 (multi-word PEXT, e.g. projection of a set of vertices onto a subset renumbered from 0).
+		*		 The remaining bits of res are set to 0.
+		* @param src, mask: input bitsets (same number of blocks)
+		* @param res: output bitset with capacity for at least mask.count() bits, may be src
+		* @returns reference to the resulting bitstring res
+		* @details: O(num_blocks), BMI2 PEXT if available (see bbkernel::compress)
+		**/
+		friend Bitset& compress(const Bitset& src, const Bitset& mask, Bitset& res);
+
+		/**
+		* @brief Scatters the bits [0, mask.count()) of src to the positions of the 1-bits of mask
+		*		 (multi-word PDEP, inverse of compress). The remaining bits of res are set to 0.
+		* @param src: input bitset with capacity for at least mask.count() bits
+		* @param mask: input bitset
+		* @param res: output bitset with at least the number of blocks of mask, must not be src
+		* @returns reference to the resulting bitstring res
+		* @details: O(num_blocks), BMI2 PDEP if available (see bbkernel::expand)
+		**/
+		friend Bitset& expand(const Bitset& src, const Bitset& mask, Bitset& res);
+
 		////////////
 		//construction / destruction 
 
@@ -290,6 +319,14 @@ namespace bitgraph {
 			return vBB_[blockID];
 		}
 
+		/**
+		* @brief non-owning view of the bitblocks of the bitset (bbset_view.h)
+		* @details: invalidated when the bitset is reallocated (e.g. reset)
+		**/
+		BitsetView view()				noexcept { return BitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView view()	const	noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView cview()	const	noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+
 		//////////////////////////////
 		// Bitscanning (no HW operations)
 
@@ -578,6 +615,26 @@ namespace bitgraph {
 		**/
 		Bitset& operator ^=				(const Bitset& bbn);
 
+		/**
+		* @brief Evaluates the bitset expression e, e.g. (a & b) | (c & ~d), in a single pass over the bitblocks.
+		*		 operator= resizes this bitstring to the number of bitblocks of e.
+		* @details defined in bbset_expr.h
+		**/
+		template<class E>
+		Bitset& operator =				(const BitsetExpr<E>& e);
+		template<class E>
+		Bitset& operator &=				(const BitsetExpr<E>& e);
+		template<class E>
+		Bitset& operator |=				(const BitsetExpr<E>& e);
+
+		/**
+		* @brief Overwrites the bitblocks in the closed range [firstBlock, lastBlock] with those of
+		*		 the bitset expression e. If lastBlock = npos, the range is [firstBlock, nBB_)
+		* @details defined in bbset_expr.h
+		**/
+		template<class E>
+		Bitset& assign_block(index_t firstBlock, index_t lastBlock, const BitsetExpr<E>& e);
+
 		friend bool operator ==			(const Bitset& lhs, const Bitset& rhs);
 		friend bool operator !=			(const Bitset& lhs, const Bitset& rhs);
 
@@ -777,8 +834,7 @@ namespace bitgraph {
 		/**
 		* @brief Fills std::vector lb with the 1-bits of the bitset.
 		* @param lb: output vector of integers (external ownership)
-		*
-		* TODO - loop unrolling for efficiency (18/11/2025)
+		* @details batched decoding (see decode), 17/10/2026
 		**/
 		void extract(bitpos_list& lb)							const;
 		void extract_set(bitpos_set& lb)							const;
@@ -804,6 +860,39 @@ namespace bitgraph {
 		**/
 		void extract_array(int* lv, std::size_t& size, bool rev = false);
 
+		/**
+		* @brief Writes the 1-bits of the bitset in out, in ascending order (batched decoding,
+		*		 several positions per step, see bbkernel::decode)
+		* @param out: output array with room for count() + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		int decode(int* out)													const;
+
+		/**
+		* @brief Writes the 1-bits of the bitset in the closed range [firstBit, lastBit] in out, in ascending order.
+		*		 If lastBit == -1, the range is [firstBit, endOfBitset)
+		* @param out: output array with room for count(firstBit, lastBit) + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		int decode(int firstBit, int lastBit, int* out)							const;
+
+		/**
+		* @brief Writes the 1-bits of the intersection with rhs in out, in ascending order (batched decoding)
+		* @param rhs: input bitset (same number of blocks)
+		* @param out: output array with room for |this & rhs| + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		int decode_and(const Bitset& rhs, int* out)								const;
+
+		/**
+		* @brief Writes the 1-bits of the intersection with rhs in the closed range [firstBit, lastBit] in out,
+		*		 in ascending order. If lastBit == -1, the range is [firstBit, endOfBitset)
+		* @param rhs: input bitset (same number of blocks)
+		* @param out: output array with room for |this & rhs| + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		int decode_and(int firstBit, int lastBit, const Bitset& rhs, int* out)	const;
+
 
 		////////////////////////
 		//data members
@@ -874,13 +963,12 @@ namespace bitgraph{
 	
 		inline int Bitset::find_first_common(const Bitset& rhs) const {
 
-			BITBOARD bb = 0;
-			for (auto i = 0; i < nBB_; ++i) {
-				if ((bb = (vBB_[i] & rhs.vBB_[i]))) {
-					return bblock::lsb64_intrinsic(bb) + WMUL(i);
-				}
+			const int i = bbkernel::first_common(vBB_.data(), rhs.vBB_.data(), nBB_);
+			if (i == nBB_) {
+				return BBObject::noBit;
 			}
-			return BBObject::noBit;
+
+			return bblock::lsb64_intrinsic(vBB_[i] & rhs.vBB_[i]) + WMUL(i);
 		}
 
 		inline int Bitset::msbn64_lup() const {
@@ -894,10 +982,10 @@ namespace bitgraph{
 			for (int i = nBB_ - 1 ; i >= 0; i--) {
 				val.b = vBB_[i];
 				if (val.b) {
-					if (val.c[3]) return (Tables::msba[3][val.c[3]] + WMUL(i));
-					if (val.c[2]) return (Tables::msba[2][val.c[2]] + WMUL(i));
-					if (val.c[1]) return (Tables::msba[1][val.c[1]] + WMUL(i));
-					if (val.c[0]) return (Tables::msba[0][val.c[0]] + WMUL(i));
+					if (val.c[3]) return (Tables::msb[val.c[3]] + 48 + WMUL(i));
+					if (val.c[2]) return (Tables::msb[val.c[2]] + 32 + WMUL(i));
+					if (val.c[1]) return (Tables::msb[val.c[1]] + 16 + WMUL(i));
+					if (val.c[0]) return (Tables::msb[val.c[0]] + WMUL(i));
 				}
 			}
 
@@ -976,10 +1064,10 @@ namespace bitgraph{
 			{
 				val.b = vBB_[i];
 				if (val.b) {
-					if (val.c[3]) return (Tables::msba[3][val.c[3]] + WMUL(i));
-					if (val.c[2]) return (Tables::msba[2][val.c[2]] + WMUL(i));
-					if (val.c[1]) return (Tables::msba[1][val.c[1]] + WMUL(i));
-					if (val.c[0]) return (Tables::msba[0][val.c[0]] + WMUL(i));
+					if (val.c[3]) return (Tables::msb[val.c[3]] + 48 + WMUL(i));
+					if (val.c[2]) return (Tables::msb[val.c[2]] + 32 + WMUL(i));
+					if (val.c[1]) return (Tables::msb[val.c[1]] + 16 + WMUL(i));
+					if (val.c[0]) return (Tables::msb[val.c[0]] + WMUL(i));
 				}
 			}
 
@@ -1025,12 +1113,7 @@ namespace bitgraph{
 
 		inline bool Bitset::is_disjoint(const Bitset& rhs) const
 		{
-			for (auto i = 0; i < nBB_; ++i) {
-				if (vBB_[i] & rhs.vBB_[i]) {
-					return false;
-				}
-			}
-			return true;
+			return (bbkernel::first_common(vBB_.data(), rhs.vBB_.data(), nBB_) == nBB_);
 		}
 
 
@@ -1054,12 +1137,8 @@ namespace bitgraph{
 			///////////////////////////////////////////////////////////////////////////////
 
 
-			for (auto i = firstBlock; i <= last_block; ++i) {
-				if (vBB_[i] & rhs.vBB_[i]) {
-					return false;
-				}
-			}
-			return true;
+			const int nBB = last_block - firstBlock + 1;
+			return (bbkernel::first_common(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, nBB) == nBB);
 		}
 
 
@@ -1370,10 +1449,10 @@ namespace bitgraph{
 			for (int i = 0; i < nBB_; i++) {
 				val.b = vBB_[i];
 				if (val.b) {
-					if (val.c[0]) return (Tables::lsba[0][val.c[0]] + WMUL(i));
-					if (val.c[1]) return (Tables::lsba[1][val.c[1]] + WMUL(i));
-					if (val.c[2]) return (Tables::lsba[2][val.c[2]] + WMUL(i));
-					if (val.c[3]) return (Tables::lsba[3][val.c[3]] + WMUL(i));
+					if (val.c[0]) return (Tables::lsb[val.c[0]] + WMUL(i));
+					if (val.c[1]) return (Tables::lsb[val.c[1]] + 16 + WMUL(i));
+					if (val.c[2]) return (Tables::lsb[val.c[2]] + 32 + WMUL(i));
+					if (val.c[3]) return (Tables::lsb[val.c[3]] + 48 + WMUL(i));
 				}
 			}
 
@@ -1439,13 +1518,7 @@ namespace bitgraph{
 
 		inline int Bitset::popcn64() const {
 
-			int pc = 0;
-
-			for (auto i = 0; i < nBB_ /*vBB_.size()*/; ++i) {
-				pc += bblock::popc64(vBB_[i]);
-			}
-
-			return pc;
+			return bbkernel::popcount(vBB_.data(), nBB_);
 		}
 
 
@@ -1483,28 +1556,77 @@ namespace bitgraph{
 			return pc;
 		}
 
-		inline int Bitset::find_common_singleton(const Bitset& rhs, int& bit) const {
+		inline int Bitset::decode(int* out) const {
 
-			int pc = 0;
-			bool is_first_vertex = true;
-			bit = BBObject::noBit;
+			return bbkernel::decode(vBB_.data(), nBB_, 0, out);
+		}
 
-			//main loop
-			for (auto i = 0; i < nBB_; ++i) {
-				pc += bblock::popc64(vBB_[i] & rhs.vBB_[i]);
-				if (pc > 1) {
-					bit = BBObject::noBit;
-					return -1;
-				}
-				else if (is_first_vertex && pc == 1) { //stores bit the first time pc == 1 
+		inline int Bitset::decode(int firstBit, int lastBit, int* out) const
+		{
+			/////////////////////////////////////////////////////////////////
+			assert(firstBit >= 0 && ((firstBit <= lastBit) || (lastBit == -1)));
+			////////////////////////////////////////////////////////////////
 
-					bit = bblock::lsb64_intrinsic(vBB_[i] & rhs.vBB_[i]) + WMUL(i);
-					is_first_vertex = false;
-				}
+			const int blockL = WDIV(firstBit);
+			const int blockH = (lastBit == -1) ? nBB_ - 1 : WDIV(lastBit);
+			if (blockL > blockH) {
+				return 0;
 			}
 
-			//disjoint - pc = 0
-			return pc;
+			const BITBOARD maskH = (lastBit == -1) ? ONE : bblock::MASK_1_LOW(WMOD(lastBit));
+			if (blockL == blockH) {
+				return bblock::decode64(vBB_[blockL] & bblock::MASK_1_HIGH(WMOD(firstBit)) & maskH, WMUL(blockL), out);
+			}
+
+			//first block, intermediate blocks and last block
+			int n = bblock::decode64(vBB_[blockL] & bblock::MASK_1_HIGH(WMOD(firstBit)), WMUL(blockL), out);
+			n += bbkernel::decode(vBB_.data() + blockL + 1, blockH - blockL - 1, WMUL(blockL + 1), out + n);
+			n += bblock::decode64(vBB_[blockH] & maskH, WMUL(blockH), out + n);
+			return n;
+		}
+
+		inline int Bitset::decode_and(const Bitset& rhs, int* out) const {
+
+			////////////////////////////////
+			assert(nBB_ == rhs.nBB_);
+			////////////////////////////////
+
+			return bbkernel::decode_and(vBB_.data(), rhs.vBB_.data(), nBB_, 0, out);
+		}
+
+		inline int Bitset::decode_and(int firstBit, int lastBit, const Bitset& rhs, int* out) const
+		{
+			/////////////////////////////////////////////////////////////////
+			assert(firstBit >= 0 && ((firstBit <= lastBit) || (lastBit == -1)));
+			assert(nBB_ == rhs.nBB_);
+			////////////////////////////////////////////////////////////////
+
+			const int blockL = WDIV(firstBit);
+			const int blockH = (lastBit == -1) ? nBB_ - 1 : WDIV(lastBit);
+			if (blockL > blockH) {
+				return 0;
+			}
+
+			const BITBOARD maskH = (lastBit == -1) ? ONE : bblock::MASK_1_LOW(WMOD(lastBit));
+			if (blockL == blockH) {
+				return bblock::decode64(vBB_[blockL] & rhs.vBB_[blockL] & bblock::MASK_1_HIGH(WMOD(firstBit)) & maskH, WMUL(blockL), out);
+			}
+
+			//first block, intermediate blocks and last block
+			int n = bblock::decode64(vBB_[blockL] & rhs.vBB_[blockL] & bblock::MASK_1_HIGH(WMOD(firstBit)), WMUL(blockL), out);
+			n += bbkernel::decode_and(vBB_.data() + blockL + 1, rhs.vBB_.data() + blockL + 1, blockH - blockL - 1, WMUL(blockL + 1), out + n);
+			n += bblock::decode64(vBB_[blockH] & rhs.vBB_[blockH] & maskH, WMUL(blockH), out + n);
+			return n;
+		}
+
+		inline int Bitset::find_common_singleton(const Bitset& rhs, int& bit) const {
+
+			if (nBB_ == 0) {
+				bit = BBObject::noBit;
+				return 0;
+			}
+
+			return find_common_singleton_block(0, nBB_ - 1, rhs, bit);
 		}
 
 		inline	int	Bitset::find_common_singleton_block(index_t firstBlock, index_t lastBlock, const Bitset& rhs, int& bit) const 
@@ -1516,25 +1638,30 @@ namespace bitgraph{
 			///////////////////////////////////////////////////////////////////////////////
 
 
-			int pc = 0;
 			bit = BBObject::noBit;
-			bool is_first_vertex = true;
 
-			for (index_t i = firstBlock; i <= last_block; ++i) {
-				pc += bblock::popc64(vBB_[i] & rhs.vBB_[i]);
-				if (pc > 1) {
-					bit = BBObject::noBit;
-					return -1;
-				}
-				else if (is_first_vertex && pc == 1) {	//stores bit the first time pc == 1 
+			//first block in common (vectorized search)
+			const BITBOARD* pl = vBB_.data();
+			const BITBOARD* pr = rhs.vBB_.data();
+			const int end = last_block + 1;
+			const int i = firstBlock + bbkernel::first_common(pl + firstBlock, pr + firstBlock, end - firstBlock);
+			if (i == end) {
+				return 0;											//disjoint
+			}
 
-					bit = bblock::lsb64_intrinsic(vBB_[i] & rhs.vBB_[i]) + WMUL(i);
-					is_first_vertex = false;
-				}
+			const BITBOARD bb = pl[i] & pr[i];
+			if (bblock::popc64(bb) > 1) {
+				return -1;
 			}
 
-			//pc = 0 (disjoint) /pc = 1 (intersection between *this and rhs a single bit)	
-			return pc;
+			//the remaining blocks must be disjoint
+			if (bbkernel::first_common(pl + i + 1, pr + i + 1, end - i - 1) != end - i - 1) {
+				return -1;
+			}
+
+			//intersection between *this and rhs is a single bit
+			bit = bblock::lsb64_intrinsic(bb) + WMUL(i);
+			return 1;
 		}
 
 
@@ -1619,10 +1746,7 @@ namespace bitgraph{
 
 		inline Bitset& Bitset::erase_bit(const Bitset& bbn) {
 
-			for (auto i = 0; i < nBB_; ++i) {
-				vBB_[i] &= ~bbn.vBB_[i];
-			}
-
+			bbkernel::andnot_assign(vBB_.data(), bbn.vBB_.data(), nBB_);
 			return *this;
 		}
 
@@ -1703,10 +1827,7 @@ namespace bitgraph{
 			assert((firstBlock>=0) && (last_block < bb_del.num_blocks()) && (firstBlock <= last_block));
 			///////////////////////////////////////////////////////////////////////////////
 
-			for (auto i = firstBlock; i <= last_block; ++i) {
-				vBB_[i] &= ~bb_del.vBB_[i];
-			}
-
+			bbkernel::andnot_assign(vBB_.data() + firstBlock, bb_del.vBB_.data() + firstBlock, last_block - firstBlock + 1);
 			return *this;
 		}
 
@@ -1721,9 +1842,7 @@ namespace bitgraph{
 			/////////////////////////////////////////////////////////////////////////////////
 
 
-			for (auto i = firstBlock; i <= last_block; ++i) {
-				this->vBB_[i] &= rhs.vBB_[i];
-			}
+			bbkernel::and_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, last_block - firstBlock + 1);
 
 			//set bits to 0 outside the range if required
 			if (Erase) {
@@ -1748,9 +1867,7 @@ namespace bitgraph{
 			assert(firstBlock <= last_block && last_block < rhs.num_blocks());
 			/////////////////////////////////////////////////////////////////////////////////
 
-			for (index_t i = firstBlock; i <= last_block; ++i) {
-				vBB_[i] |= rhs.vBB_[i];
-			}
+			bbkernel::or_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, last_block - firstBlock + 1);
 
 			//set bits to 0 outside the range if required
 			if (Erase) {
@@ -1908,9 +2025,8 @@ namespace bitgraph {
 
 
 			//AND mask in the range
-			for (auto i = firstBlock; i <= last_block; ++i) {
-				res.vBB_[i] = rhs.vBB_[i] & lhs.vBB_[i];
-			}
+			bbkernel::and_to(res.vBB_.data() + firstBlock, lhs.vBB_.data() + firstBlock,
+								rhs.vBB_.data() + firstBlock, last_block - firstBlock + 1);
 
 			//set bits to 0 outside the range if required
 			if (Erase) {
@@ -2013,10 +2129,9 @@ namespace bitgraph {
 			//////////////////////////////////////////////////////////////////
 
 		
-			//AND mask in the range
-			for (Bitset::index_t i = firstBlock; i <= last_block; ++i) {
-				res.vBB_[i] = rhs.vBB_[i] | lhs.vBB_[i];
-			}
+			//OR mask in the range
+			bbkernel::or_to(res.vBB_.data() + firstBlock, lhs.vBB_.data() + firstBlock,
+								rhs.vBB_.data() + firstBlock, last_block - firstBlock + 1);
 
 			//set bits to 0 outside the range if required
 			if (Erase) {
@@ -2036,6 +2151,8 @@ namespace bitgraph {
 		Bitset& erase_bit(const Bitset& lhs, const Bitset& rhs, Bitset& res);
 		int find_first_common(const Bitset& lhs, const Bitset& rhs);
 		int find_first_common_block(Bitset::index_t firstBlock, Bitset::index_t lastBlock, const Bitset& lhs, const Bitset& rhs);
+		Bitset& compress(const Bitset& src, const Bitset& mask, Bitset& res);
+		Bitset& expand(const Bitset& src, const Bitset& mask, Bitset& res);
 				
 		
 	////friend functions of Bitset
@@ -0,0 +1,364 @@
+/**
+ * @file bbset_arena.h
+ * @brief header file of the BitsetArena and BitsetPool classes from the BITSCAN library.
+ *		  Stack-like (per recursion depth) allocation of bitsets for search algorithms
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: BitsetArena - one contiguous slab of bitblocks carved into rows of a fixed number of bitblocks.
+ *			 Rows are 64-byte aligned (the stride is rounded up to 8 bitblocks) and handed out as raw BITBOARD*,
+ *			 to be operated with the bbkernel / bblock primitives.
+ * @details: BitsetPool<BitsetT> - stack of bitset objects (e.g. BBScan) which keep their storage between uses,
+ *			 so that acquiring a bitset in a hot path does not call malloc once the pool is warm.
+ * @details: Both are released stack-like: mark() at the beginning of a recursion level and release(mark) at the end
+ *			 (or use a Frame, which does both). local() returns a thread-local instance for parallel use.
+ **/
+
+#ifndef __BBSET_ARENA_H__
+#define __BBSET_ARENA_H__
+
+#include "bbset.h"
+#include "bitblock.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/**
+		* @brief RAII scope of an arena / pool: takes a mark on construction and releases it on destruction
+		**/
+		template<class ArenaT>
+		class ArenaFrame {
+		public:
+			explicit ArenaFrame(ArenaT& arena) noexcept : arena_(arena), mark_(arena.mark()) {}
+			~ArenaFrame() { arena_.release(mark_); }
+
+			ArenaFrame(const ArenaFrame&) = delete;
+			ArenaFrame& operator = (const ArenaFrame&) = delete;
+
+		private:
+			ArenaT& arena_;
+			int mark_;
+		};
+	}
+
+	/////////////////////////////////
+	//
+	// BitsetArena class
+	//
+	// (contiguous slab of bitset rows with a fixed number of bitblocks, stack-like allocation)
+	//
+	///////////////////////////////////
+
+	class BitsetArena {
+
+	public:
+
+		using Frame = _impl::ArenaFrame<BitsetArena>;
+
+		enum : int {
+			ALIGN_BLOCKS = 8,								//rows aligned to 64 bytes (cache line)
+			DEFAULT_ROWS = 64								//rows of the first slab
+		};
+
+		////////////
+		//construction / destruction
+
+		BitsetArena() noexcept : nBB_(0), stride_(0), top_(0), cap_(0), cur_(0), used_(0) {}
+
+		/**
+		* @brief Creates an arena for bitsets of population size nPop with room for nRows rows
+		*		 (more slabs are added on demand, rows already handed out are not moved)
+		**/
+		explicit BitsetArena(std::size_t nPop, int nRows = DEFAULT_ROWS) : BitsetArena() { reset(nPop, nRows); }
+
+		//rows are handed out as raw pointers - no copies
+		BitsetArena(const BitsetArena&) = delete;
+		BitsetArena& operator = (const BitsetArena&) = delete;
+		BitsetArena(BitsetArena&&) noexcept = default;
+		BitsetArena& operator = (BitsetArena&&) noexcept = default;
+
+		~BitsetArena() = default;
+
+		/**
+		* @brief Reallocates the arena for bitsets of population size nPop, all rows are released
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void reset(std::size_t nPop, int nRows = DEFAULT_ROWS) noexcept;
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks()	const noexcept { return nBB_; }
+		int stride()		const noexcept { return stride_; }
+
+		/**
+		* @brief number of rows in use
+		**/
+		int size()			const noexcept { return top_; }
+
+		/**
+		* @brief number of rows allocated (in use or free)
+		**/
+		int capacity()		const noexcept { return cap_; }
+
+		/////////////////////
+		// Allocation
+
+		/**
+		* @brief returns a new row with num_blocks() bitblocks set to 0
+		**/
+		BITBOARD* alloc() {
+			BITBOARD* row = next();
+			std::fill(row, row + nBB_, ZERO);
+			return row;
+		}
+
+		/**
+		* @brief returns a new row with a copy of the first num_blocks() bitblocks of src
+		**/
+		BITBOARD* alloc(const BITBOARD* src) {
+			BITBOARD* row = next();
+			std::memcpy(row, src, nBB_ * sizeof(BITBOARD));
+			return row;
+		}
+
+		/**
+		* @brief returns a new row with a copy of bb, the remaining bitblocks are set to 0
+		*		 (bb must have num_blocks() bitblocks or less)
+		**/
+		BITBOARD* alloc(const Bitset& bb) {
+			const int nBB = bb.num_blocks();
+			assert(nBB <= nBB_);
+			BITBOARD* row = next();
+			std::copy(bb.bitset().begin(), bb.bitset().begin() + nBB, row);
+			std::fill(row + nBB, row + nBB_, ZERO);
+			return row;
+		}
+
+		/**
+		* @brief returns a new row with num_blocks() bitblocks set to 0, as a writable view
+		**/
+		BitsetView alloc_view() { return BitsetView(alloc(), nBB_); }
+
+		/**
+		* @brief current top of the stack of rows, to be passed to release
+		**/
+		int mark()			const noexcept { return top_; }
+
+		/**
+		* @brief releases all the rows allocated after mark was taken
+		**/
+		void release(int mark) noexcept;
+
+		/**
+		* @brief releases all the rows (memory is kept)
+		**/
+		void clear() noexcept { release(0); }
+
+		/**
+		* @brief thread-local arena for bitsets of population size nPop
+		* @details: the arena is reallocated if its rows are too small and no row is in use,
+		*			 the program exits if rows in use are too small (fail-fast policy)
+		**/
+		static BitsetArena& local(std::size_t nPop);
+
+		/////////////////
+		// data members
+	private:
+
+		struct Slab {
+			std::unique_ptr<BITBOARD[]> mem;				//owned memory (with padding for alignment)
+			BITBOARD* rows;									//first row, 64-byte aligned
+			int nRows;
+		};
+
+		//returns the next row - not initialized
+		BITBOARD* next() {
+			if (top_ == cap_) { add_slab(std::max<int>(cap_, DEFAULT_ROWS)); }
+			if (used_ == slabs_[cur_].nRows) { ++cur_; used_ = 0; }
+			++top_;
+			return slabs_[cur_].rows + static_cast<std::size_t>(used_++) * stride_;
+		}
+
+		void add_slab(int nRows) noexcept;
+
+		std::vector<Slab> slabs_;							//slabs, each one contiguous
+		int nBB_;											//number of bitblocks of each row
+		int stride_;										//distance between rows (in bitblocks)
+		int top_;											//number of rows in use
+		int cap_;											//number of rows of all the slabs
+		int cur_;											//slab of the top of the stack
+		int used_;											//rows in use of slab cur_
+	};
+
+	/////////////////////////////////
+	//
+	// BitsetPool class
+	//
+	// (stack of bitset objects which keep their storage between uses)
+	//
+	///////////////////////////////////
+
+	template<class BitsetT>
+	class BitsetPool {
+
+	public:
+
+		using Frame = _impl::ArenaFrame<BitsetPool>;
+
+		BitsetPool() = default;
+
+		//objects are handed out by reference - no copies
+		BitsetPool(const BitsetPool&) = delete;
+		BitsetPool& operator = (const BitsetPool&) = delete;
+		BitsetPool(BitsetPool&&) = default;
+		BitsetPool& operator = (BitsetPool&&) = default;
+
+		~BitsetPool() = default;
+
+		/////////////////////
+		//setters and getters
+
+		int size()			const noexcept { return top_; }
+		int capacity()		const noexcept { return static_cast<int>(pool_.size()); }
+
+		/////////////////////
+		// Allocation
+
+		/**
+		* @brief returns an empty bitset of population size nPop
+		* @details: no memory allocation if the object has already held a bitset of this size
+		**/
+		BitsetT& acquire(std::size_t nPop) {
+			BitsetT& bb = next();
+			bb.reset(nPop);
+			return bb;
+		}
+
+		/**
+		* @brief returns a copy of bb
+		* @details: no memory allocation if the object has already held a bitset of this size
+		**/
+		BitsetT& acquire(const BitsetT& bb) {
+			BitsetT& res = next();
+			res = bb;
+			return res;
+		}
+
+		int mark()			const noexcept { return top_; }
+
+		/**
+		* @brief releases all the bitsets acquired after mark was taken (the objects are kept)
+		**/
+		void release(int mark) noexcept {
+			assert(mark >= 0 && mark <= top_);
+			top_ = mark;
+		}
+
+		void clear() noexcept { top_ = 0; }
+
+		/**
+		* @brief thread-local pool
+		**/
+		static BitsetPool& local() {
+			static thread_local BitsetPool pool;
+			return pool;
+		}
+
+		/////////////////
+		// data members
+	private:
+
+		BitsetT& next() {
+			if (top_ == static_cast<int>(pool_.size())) { pool_.emplace_back(); }
+			return pool_[top_++];
+		}
+
+		std::deque<BitsetT> pool_;							//references remain valid when the pool grows
+		int top_ = 0;										//number of bitsets in use
+	};
+
+	///////////////////////
+	// BitsetArena - implementation
+
+	inline
+	void BitsetArena::reset(std::size_t nPop, int nRows) noexcept {
+
+		slabs_.clear();
+		top_ = cap_ = cur_ = used_ = 0;
+
+		nBB_ = static_cast<int>(INDEX_1TO1(nPop));
+		stride_ = ((nBB_ + ALIGN_BLOCKS - 1) / ALIGN_BLOCKS) * ALIGN_BLOCKS;
+
+		if (nRows > 0) { add_slab(nRows); }
+	}
+
+	inline
+	void BitsetArena::add_slab(int nRows) noexcept {
+
+		Slab s;
+		try {
+			s.mem.reset(new BITBOARD[static_cast<std::size_t>(nRows) * stride_ + ALIGN_BLOCKS]);
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - BitsetArena::add_slab");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		//aligns the first row to 64 bytes
+		const auto addr = reinterpret_cast<std::uintptr_t>(s.mem.get());
+		const auto align = static_cast<std::uintptr_t>(ALIGN_BLOCKS * sizeof(BITBOARD));
+		s.rows = reinterpret_cast<BITBOARD*>((addr + align - 1) & ~(align - 1));
+		s.nRows = nRows;
+
+		slabs_.push_back(std::move(s));
+		cap_ += nRows;
+	}
+
+	inline
+	void BitsetArena::release(int mark) noexcept {
+
+		assert(mark >= 0 && mark <= top_);
+		top_ = mark;
+
+		//locates the slab of the new top (a full slab remains current)
+		cur_ = 0;
+		used_ = mark;
+		while (cur_ + 1 < static_cast<int>(slabs_.size()) && used_ > slabs_[cur_].nRows) {
+			used_ -= slabs_[cur_].nRows;
+			++cur_;
+		}
+	}
+
+	inline
+	BitsetArena& BitsetArena::local(std::size_t nPop) {
+
+		static thread_local BitsetArena arena;
+
+		const int nBB = static_cast<int>(INDEX_1TO1(nPop));
+		if (arena.nBB_ < nBB) {
+			if (arena.top_ != 0) {
+				LOG_ERROR("rows in use are smaller than requested - BitsetArena::local");
+				LOG_ERROR("exiting...");
+				std::exit(EXIT_FAILURE);
+			}
+			arena.reset(nPop);
+		}
+
+		return arena;
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_ARENA_H__
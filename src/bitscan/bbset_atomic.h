@@ -0,0 +1,249 @@
+/**
+ * @file bbset_atomic.h
+ * @brief header file of the AtomicBitset class from the BITSCAN library.
+ *		  Bitset safe under concurrent mutation (lock-free, one std::atomic word per bitblock)
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: Same block layout as Bitset (bit i in bitblock WDIV(i), position WMOD(i)), for parallel construction
+ *			 (e.g. graph loading), visited sets of parallel traversals and shared candidate pools.
+ *			 - set_bit / erase_bit / test_and_set / test_and_erase: fetch_or / fetch_and on the bitblock of the bit
+ *			 - merge(bb): bulk OR of a (thread-private) Bitset, only the non-empty bitblocks are written
+ *			 - to_bitset(): plain Bitset copy, once the writers have finished
+ * @details: Memory order is relaxed by default (only the bits themselves are published), pass
+ *			 std::memory_order_acq_rel / acquire if the bits guard other data.
+ * @details: reset / resizing is NOT thread-safe.
+ **/
+
+#ifndef __BBSET_ATOMIC_H__
+#define __BBSET_ATOMIC_H__
+
+#include "bbset.h"
+#include "bitblock.h"
+#include "utils/logger.h"
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// AtomicBitset class
+	//
+	// (concurrent set / erase / test_and_set of bits, not derived from Bitset)
+	//
+	///////////////////////////////////
+
+	class AtomicBitset {
+
+	public:
+
+		using atomic_block = std::atomic<BITBOARD>;
+
+		////////////
+		//construction / destruction
+
+		AtomicBitset() noexcept : nBB_(0) {}
+
+		/**
+		* @brief Creates an empty bitset of population size nPop
+		**/
+		explicit AtomicBitset(std::size_t nPop) : nBB_(0) { reset(nPop); }
+
+		/**
+		* @brief Creates a copy of bb
+		**/
+		explicit AtomicBitset(const Bitset& bb) : nBB_(0) { assign(bb); }
+
+		//atomics are not copyable - use assign / to_bitset
+		AtomicBitset(const AtomicBitset&) = delete;
+		AtomicBitset& operator = (const AtomicBitset&) = delete;
+		AtomicBitset(AtomicBitset&&) noexcept = default;
+		AtomicBitset& operator = (AtomicBitset&&) noexcept = default;
+
+		~AtomicBitset() = default;
+
+		/**
+		* @brief Reallocates an empty bitset of population size nPop (not thread-safe)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void reset(std::size_t nPop) noexcept;
+
+		/**
+		* @brief Reallocates the bitset as a copy of bb (not thread-safe)
+		**/
+		void assign(const Bitset& bb) noexcept;
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks()			const noexcept { return nBB_; }
+
+		/**
+		* @brief current value of bitblock blockID
+		**/
+		BITBOARD block(int blockID, std::memory_order mo = std::memory_order_relaxed) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID].load(mo);
+		}
+
+		/////////////////////
+		// Bit updates (thread-safe)
+
+		void set_bit(int bit, std::memory_order mo = std::memory_order_relaxed) {
+			word(bit).fetch_or(bblock::MASK_BIT(WMOD(bit)), mo);
+		}
+
+		void erase_bit(int bit, std::memory_order mo = std::memory_order_relaxed) {
+			word(bit).fetch_and(~bblock::MASK_BIT(WMOD(bit)), mo);
+		}
+
+		/**
+		* @brief sets bit
+		* @returns TRUE if the bit was already set - exactly one of the concurrent callers gets FALSE
+		**/
+		bool test_and_set(int bit, std::memory_order mo = std::memory_order_relaxed) {
+			const BITBOARD mask = bblock::MASK_BIT(WMOD(bit));
+			return (word(bit).fetch_or(mask, mo) & mask) != 0;
+		}
+
+		/**
+		* @brief erases bit
+		* @returns TRUE if the bit was set - exactly one of the concurrent callers gets TRUE
+		**/
+		bool test_and_erase(int bit, std::memory_order mo = std::memory_order_relaxed) {
+			const BITBOARD mask = bblock::MASK_BIT(WMOD(bit));
+			return (word(bit).fetch_and(~mask, mo) & mask) != 0;
+		}
+
+		/**
+		* @brief bulk OR of bb (same number of bitblocks or less), only its non-empty bitblocks are written
+		**/
+		AtomicBitset& merge(const Bitset& bb, std::memory_order mo = std::memory_order_relaxed);
+
+		/**
+		* @brief bulk erase of the 1-bits of bb (same number of bitblocks or less)
+		**/
+		AtomicBitset& erase_bit(const Bitset& bb, std::memory_order mo = std::memory_order_relaxed);
+
+		/**
+		* @brief sets all bits to 0 (thread-safe, but not atomic as a whole)
+		**/
+		void erase_bit(std::memory_order mo = std::memory_order_relaxed) {
+			for (int i = 0; i < nBB_; ++i) { vBB_[i].store(ZERO, mo); }
+		}
+
+		/////////////////////
+		// Queries (thread-safe, each bitblock is read atomically - not a snapshot of the whole bitset)
+
+		bool is_bit(int bit, std::memory_order mo = std::memory_order_relaxed) const {
+			return (word(bit).load(mo) & bblock::MASK_BIT(WMOD(bit))) != 0;
+		}
+
+		int count(std::memory_order mo = std::memory_order_relaxed) const {
+			int pc = 0;
+			for (int i = 0; i < nBB_; ++i) { pc += bblock::popc64(vBB_[i].load(mo)); }
+			return pc;
+		}
+
+		bool is_empty(std::memory_order mo = std::memory_order_relaxed) const {
+			for (int i = 0; i < nBB_; ++i) {
+				if (vBB_[i].load(mo)) { return false; }
+			}
+			return true;
+		}
+
+		/////////////////////
+		// Conversions (once the writers have finished)
+
+		/**
+		* @brief copies the bitset to res, which is resized to the number of bitblocks of this bitset
+		* @returns reference to res
+		**/
+		template<class BitsetT>
+		BitsetT& to_bitset(BitsetT& res, std::memory_order mo = std::memory_order_acquire) const {
+			if (res.num_blocks() != nBB_) { res.reset(WMUL(nBB_)); }
+			for (int i = 0; i < nBB_; ++i) { res.block(i) = vBB_[i].load(mo); }
+			return res;
+		}
+
+		Bitset to_bitset(std::memory_order mo = std::memory_order_acquire) const {
+			Bitset res(WMUL(nBB_));
+			return to_bitset(res, mo);
+		}
+
+		explicit operator Bitset() const { return to_bitset(); }
+
+		/////////////////
+		// data members
+	private:
+
+		atomic_block& word(int bit) {
+			assert(bit >= 0 && WDIV(bit) < nBB_);
+			return vBB_[WDIV(bit)];
+		}
+		const atomic_block& word(int bit) const {
+			assert(bit >= 0 && WDIV(bit) < nBB_);
+			return vBB_[WDIV(bit)];
+		}
+
+		std::unique_ptr<atomic_block[]> vBB_;				//bitblocks
+		int nBB_;											//number of bitblocks
+	};
+
+	///////////////////////
+	// AtomicBitset - implementation
+
+	inline
+	void AtomicBitset::reset(std::size_t nPop) noexcept {
+
+		const int nBB = static_cast<int>(INDEX_1TO1(nPop));
+		try {
+			if (nBB != nBB_) {
+				vBB_.reset(new atomic_block[nBB]);
+				nBB_ = nBB;
+			}
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - AtomicBitset::reset");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		for (int i = 0; i < nBB_; ++i) { vBB_[i].store(ZERO, std::memory_order_relaxed); }
+	}
+
+	inline
+	void AtomicBitset::assign(const Bitset& bb) noexcept {
+
+		reset(WMUL(bb.num_blocks()));
+		for (int i = 0; i < nBB_; ++i) { vBB_[i].store(bb.block(i), std::memory_order_relaxed); }
+	}
+
+	inline
+	AtomicBitset& AtomicBitset::merge(const Bitset& bb, std::memory_order mo) {
+
+		assert(bb.num_blocks() <= nBB_);
+		for (int i = 0; i < bb.num_blocks(); ++i) {
+			const BITBOARD w = bb.block(i);
+			if (w) { vBB_[i].fetch_or(w, mo); }
+		}
+		return *this;
+	}
+
+	inline
+	AtomicBitset& AtomicBitset::erase_bit(const Bitset& bb, std::memory_order mo) {
+
+		assert(bb.num_blocks() <= nBB_);
+		for (int i = 0; i < bb.num_blocks(); ++i) {
+			const BITBOARD w = bb.block(i);
+			if (w) { vBB_[i].fetch_and(~w, mo); }
+		}
+		return *this;
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_ATOMIC_H__
@@ -0,0 +1,422 @@
+/**
+ * @file bbset_counted.h
+ * @brief header file of the CountedBitset class from the BITSCAN library.
+ *		  Dense bitset with an incrementally maintained population count
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The bit layout is that of Bitset (bit i in bitblock WDIV(i), position WMOD(i)). The number of 1-bits
+ *			 is kept exact under ALL the mutating operations, so that count(), is_empty() and is_singleton() are O(1):
+ *			 - single bit updates (set_bit, erase_bit, destructive bitscanning...): +-1, only if the bit changes
+ *			 - range and block operations (set_bit(first, last), set_block, AND_EQUAL_block...): the change of the popcount of the range
+ *			 - full-row operations (&=, |=, ^=, erase_bit(rhs), AND / OR / erase_bit into res...): vectorized kernels
+ *			   (bbkernel.h), followed by a vectorized recount of the row
+ * @details: Optionally (enable_superblocks()) the counts of superblocks of SBLOCK bitblocks (512 bits) are maintained
+ *			 as well, so that range counts count(firstBit, lastBit) only popcount the partial superblocks at the ends.
+ * @details: The BBScan interface is inherited from _impl::DenseBase (bbset_dense.h), which writes the bitblocks
+ *			 through the hooks of this class. Unlike BitSetWithPC (bbutils.h), the bitblocks are read-only
+ *			 (block(i) is const, writes go through set_block), so that the count cannot be bypassed.
+ **/
+
+#ifndef __BBSET_COUNTED_H__
+#define __BBSET_COUNTED_H__
+
+#include "bbset_dense.h"
+#include "bbset_view.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <vector>
+#include <initializer_list>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// CountedBitset class
+	//
+	// (dense bitset with O(1) popcount, and optional superblock counts)
+	// @details Binary operations require bitsets of the same population size
+	//
+	///////////////////////////////////
+
+	class CountedBitset : public _impl::DenseBase<CountedBitset> {
+
+		using base_type = _impl::DenseBase<CountedBitset>;
+		friend base_type;
+
+	public:
+
+		enum : int {
+			SBLOCK = 8										//bitblocks of a superblock (512 bits)
+		};
+
+		////////////
+		//construction / destruction
+
+		CountedBitset() noexcept : nBB_(0), pc_(0), sb_(false) {}
+
+		/**
+		* @brief Constructor of a bitset given a population size nPop
+		* @param nPop : population size
+		* @param val: initial value (TRUE, FALSE) of every bit in the range [0, nPop)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		explicit CountedBitset(std::size_t nPop, bool val = false) noexcept : CountedBitset() { init(nPop, val); }
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		**/
+		template<class ColT>
+		explicit CountedBitset(std::size_t nPop, const ColT& lv) noexcept : CountedBitset() { init(nPop, lv); }
+
+		explicit CountedBitset(std::size_t nPop, std::initializer_list<int> lv) noexcept : CountedBitset() { init(nPop, lv); }
+
+		/**
+		* @brief Creates a copy of the non-sparse bitset bb (e.g. a row of a ugraph)
+		**/
+		explicit CountedBitset(ConstBitsetView bb) noexcept : CountedBitset() {
+			init(WMUL(bb.num_blocks()), false);
+			std::copy(bb.data(), bb.data() + bb.num_blocks(), vBB_.begin());
+			recount();
+		}
+
+		//Move and copy semantics allowed
+		CountedBitset(const CountedBitset&) = default;
+		CountedBitset(CountedBitset&&) noexcept = default;
+		CountedBitset& operator = (const CountedBitset&) = default;
+		CountedBitset& operator = (CountedBitset&&) noexcept = default;
+
+		~CountedBitset() = default;
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Resets the bitset to nPop bits with value val (superblock counts are kept if enabled)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void init(std::size_t nPop, bool val = false) noexcept;
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		**/
+		template<class ColT>
+		void init(std::size_t nPop, const ColT& lv) noexcept;
+
+		void reset(std::size_t nPop) noexcept { init(nPop, false); }
+		void reset(std::size_t nPop, const bitpos_list& lv) noexcept { init(nPop, lv); }
+
+		void shrink_to_fit() {
+			vBB_.shrink_to_fit();
+			spc_.shrink_to_fit();
+		}
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks() const noexcept { return nBB_; }
+		std::size_t size() const noexcept { return vBB_.size(); }
+
+		const BITBOARD* data() const noexcept { return vBB_.data(); }
+
+		BITBOARD block(index_t blockID) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID];
+		}
+
+		/**
+		* @brief sets bitblock blockID to bb (the counts are updated)
+		**/
+		CountedBitset& set_block(index_t blockID, BITBOARD bb) {
+			assert(blockID >= 0 && blockID < nBB_);
+			add_count(blockID, bblock::popc64(bb) - bblock::popc64(vBB_[blockID]));
+			vBB_[blockID] = bb;
+			return *this;
+		}
+
+		/**
+		* @brief read-only views of the bitblocks (bbset_view.h)
+		**/
+		ConstBitsetView view() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView cview() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+
+		/////////////////////
+		// Superblock counts
+
+		/**
+		* @brief enables (or disables) the counts of the superblocks of SBLOCK bitblocks, O(n/64) when enabled
+		**/
+		void enable_superblocks(bool on = true);
+
+		bool has_superblocks() const noexcept { return sb_; }
+
+		int num_superblocks() const noexcept { return (nBB_ + SBLOCK - 1) / SBLOCK; }
+
+		/**
+		* @brief number of 1-bits of superblock s (bitblocks [s * SBLOCK, (s + 1) * SBLOCK)), superblocks enabled
+		**/
+		int superblock_count(int s) const {
+			assert(sb_ && s >= 0 && s < num_superblocks());
+			return spc_[s];
+		}
+
+		//////////////////////////////
+		// Bitscanning (stateless) - O(1) if empty
+
+		int lsb() const { return (pc_ == 0) ? BBObject::noBit : base_type::lsb(); }
+		int msb() const { return (pc_ == 0) ? BBObject::noBit : base_type::msb(); }
+
+		/////////////////////
+		// Block operations (closed range of bitblocks [firstBlock, lastBlock], the rest is not modified)
+
+		/**
+		* @brief copies the bitblocks of rhs in the range
+		**/
+		CountedBitset& assign_block(int firstBlock, int lastBlock, const CountedBitset& rhs);
+
+		/**
+		* @brief adds the 1-bits of rhs in the range
+		**/
+		CountedBitset& set_block(int firstBlock, int lastBlock, const CountedBitset& rhs);
+
+		/**
+		* @brief removes the 1-bits of rhs in the range
+		**/
+		CountedBitset& erase_block(int firstBlock, int lastBlock, const CountedBitset& rhs);
+
+		/**
+		* @brief AND with rhs in the range
+		**/
+		CountedBitset& AND_EQUAL_block(int firstBlock, int lastBlock, const CountedBitset& rhs);
+
+		/////////////////////////////
+		//Boolean functions - O(1)
+
+		bool is_empty() const noexcept { return pc_ == 0; }
+
+		/**
+		* @brief TRUE if the bitset has a single 1-bit
+		**/
+		bool is_singleton() const noexcept { return pc_ == 1; }
+
+		/////////////////
+		// hooks of _impl::DenseBase (the counts are updated)
+
+	private:
+
+		BITBOARD* wblocks() noexcept { return vBB_.data(); }
+		void refresh() noexcept { recount(); }
+
+		void set_bits(int i, BITBOARD mask) noexcept {
+			add_count(i, bblock::popc64(mask & ~vBB_[i]));
+			vBB_[i] |= mask;
+		}
+
+		void erase_bits(int i, BITBOARD mask) noexcept {
+			add_count(i, -bblock::popc64(mask & vBB_[i]));
+			vBB_[i] &= ~mask;
+		}
+
+		void clear_blocks() noexcept {
+			std::fill(vBB_.begin(), vBB_.end(), ZERO);
+			std::fill(spc_.begin(), spc_.end(), 0);
+			pc_ = 0;
+		}
+
+		//popcount of the closed range of bitblocks [firstBlock, lastBlock] (reads whole superblocks from the cache)
+		int count_blocks(int firstBlock, int lastBlock) const noexcept;
+
+		//adds delta to the count of the bitset and of the superblock of bitblock blockID
+		void add_count(int blockID, int delta) noexcept {
+			pc_ += delta;
+			if (sb_) { spc_[blockID / SBLOCK] += delta; }
+		}
+
+		//popcount of the closed range of bitblocks [firstBlock, lastBlock] (not cached)
+		int popc_blocks(int firstBlock, int lastBlock) const noexcept {
+			return (firstBlock > lastBlock) ? 0 : bbkernel::popcount(vBB_.data() + firstBlock, lastBlock - firstBlock + 1);
+		}
+
+		//updates the counts after the range of bitblocks [firstBlock, lastBlock] has been modified,
+		//pcOld is the popcount of the range before the modification
+		void update_count(int firstBlock, int lastBlock, int pcOld) noexcept;
+
+		//recomputes all the counts
+		void recount() noexcept;
+
+		/////////////////
+		// data members
+
+		std::vector<BITBOARD> vBB_;							//bitblocks
+		std::vector<int> spc_;								//popcount of each superblock (empty if disabled)
+		int nBB_;											//number of bitblocks
+		int pc_;											//popcount of the bitset
+		bool sb_;											//TRUE if the superblock counts are maintained
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation (header-only)
+
+namespace bitgraph {
+
+	inline
+	void CountedBitset::init(std::size_t nPop, bool val) noexcept {
+
+		nBB_ = static_cast<int>(INDEX_1TO1(nPop));
+
+		try {
+			vBB_.assign(nBB_, ZERO);
+			if (sb_) { spc_.assign(num_superblocks(), 0); }
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - CountedBitset::init");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		pc_ = 0;
+		if (val && nPop > 0) {
+			set_bit(0, static_cast<int>(nPop) - 1);
+		}
+	}
+
+	template<class ColT>
+	inline
+	void CountedBitset::init(std::size_t nPop, const ColT& lv) noexcept {
+
+		init(nPop, false);
+
+		//sets bit conveniently
+		for (auto& bit : lv) {
+
+			//////////////////
+			assert(bit >= 0 && bit < static_cast<int>(nPop));
+			/////////////////
+
+			set_bit(bit);
+		}
+	}
+
+	inline
+	void CountedBitset::enable_superblocks(bool on) {
+
+		sb_ = on;
+		if (sb_) {
+			spc_.assign(num_superblocks(), 0);
+			recount();
+		}
+		else {
+			spc_.clear();
+		}
+	}
+
+	inline
+	void CountedBitset::recount() noexcept {
+
+		if (!sb_) {
+			pc_ = bbkernel::popcount(vBB_.data(), nBB_);
+			return;
+		}
+
+		pc_ = 0;
+		for (int s = 0; s < num_superblocks(); ++s) {
+			spc_[s] = popc_blocks(s * SBLOCK, std::min(nBB_, (s + 1) * SBLOCK) - 1);
+			pc_ += spc_[s];
+		}
+	}
+
+	inline
+	void CountedBitset::update_count(int firstBlock, int lastBlock, int pcOld) noexcept {
+
+		if (!sb_) {
+			pc_ += popc_blocks(firstBlock, lastBlock) - pcOld;
+			return;
+		}
+
+		//recounts the superblocks which overlap the range
+		for (int s = firstBlock / SBLOCK; s <= lastBlock / SBLOCK; ++s) {
+			const int pc = popc_blocks(s * SBLOCK, std::min(nBB_, (s + 1) * SBLOCK) - 1);
+			pc_ += pc - spc_[s];
+			spc_[s] = pc;
+		}
+	}
+
+	inline
+	int CountedBitset::count_blocks(int firstBlock, int lastBlock) const noexcept {
+
+		if (firstBlock > lastBlock) { return 0; }
+		if (firstBlock == 0 && lastBlock == nBB_ - 1) { return pc_; }
+		if (!sb_ || lastBlock - firstBlock + 1 < 2 * SBLOCK) { return popc_blocks(firstBlock, lastBlock); }
+
+		//whole superblocks [sFirst, sLast) from the cache, partial superblocks at both ends
+		const int sFirst = (firstBlock + SBLOCK - 1) / SBLOCK;
+		const int sLast = (lastBlock + 1) / SBLOCK;
+
+		int pc = popc_blocks(firstBlock, sFirst * SBLOCK - 1);
+		for (int s = sFirst; s < sLast; ++s) {
+			pc += spc_[s];
+		}
+		pc += popc_blocks(sLast * SBLOCK, lastBlock);
+
+		return pc;
+	}
+
+	inline
+	CountedBitset& CountedBitset::assign_block(int firstBlock, int lastBlock, const CountedBitset& rhs) {
+
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+		if (firstBlock <= lastBlock) {
+			const int pcOld = popc_blocks(firstBlock, lastBlock);
+			std::copy(rhs.vBB_.begin() + firstBlock, rhs.vBB_.begin() + lastBlock + 1, vBB_.begin() + firstBlock);
+			update_count(firstBlock, lastBlock, pcOld);
+		}
+		return *this;
+	}
+
+	inline
+	CountedBitset& CountedBitset::set_block(int firstBlock, int lastBlock, const CountedBitset& rhs) {
+
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+		if (firstBlock <= lastBlock) {
+			const int pcOld = popc_blocks(firstBlock, lastBlock);
+			bbkernel::or_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, lastBlock - firstBlock + 1);
+			update_count(firstBlock, lastBlock, pcOld);
+		}
+		return *this;
+	}
+
+	inline
+	CountedBitset& CountedBitset::erase_block(int firstBlock, int lastBlock, const CountedBitset& rhs) {
+
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+		if (firstBlock <= lastBlock) {
+			const int pcOld = popc_blocks(firstBlock, lastBlock);
+			bbkernel::andnot_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, lastBlock - firstBlock + 1);
+			update_count(firstBlock, lastBlock, pcOld);
+		}
+		return *this;
+	}
+
+	inline
+	CountedBitset& CountedBitset::AND_EQUAL_block(int firstBlock, int lastBlock, const CountedBitset& rhs) {
+
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+		if (firstBlock <= lastBlock) {
+			const int pcOld = popc_blocks(firstBlock, lastBlock);
+			bbkernel::and_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, lastBlock - firstBlock + 1);
+			update_count(firstBlock, lastBlock, pcOld);
+		}
+		return *this;
+	}
+
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_COUNTED_H__
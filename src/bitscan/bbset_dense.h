@@ -0,0 +1,922 @@
+/**
+ * @file bbset_dense.h
+ * @brief CRTP base classes of the row types of the BITSCAN library outside the BBObject hierarchy
+ *		  (FixedBitset, WideBitset, CountedBitset, SentinelBitset, SummaryBitset, HybridBitset)
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: _impl::ScanBase<Derived> is the part of the BBScan interface common to every row type: type aliases,
+ *			 the bitscanning cache (scan_) used by BBObject::Scan, ScanRev..., and the conversions and I/O,
+ *			 written on Derived::next_bit(int) and Derived::count().
+ * @details: _impl::DenseBase<Derived> is the rest of the BBScan interface (bitscanning, popcount, bit updates and
+ *			 set operations) for the row types with the bit layout of Bitset (bit i in bitblock WDIV(i), position
+ *			 WMOD(i)). Derived provides data() and num_blocks(); every other operation is written on the hooks below,
+ *			 and a row type only redefines the hooks in which it differs (befriending its base):
+ *			 - next_block(i) / prev_block(i): first / last non-empty bitblock in [i, num_blocks()) / [0, i], -1 if none
+ *			 - set_bits(i, mask) / erase_bits(i, mask): writes of single bitblocks
+ *			 - count_blocks(first, last): popcount of a closed range of bitblocks
+ *			 - assign_and / assign_or / assign_andnot (lhs, rhs), first_common(rhs), equal_blocks(rhs), clear_blocks():
+ *			   set operations, find_first_common, equality and erase_bit()
+ *			 - wblocks() / refresh(): writable bitblocks for the default full-row kernels (bbkernel.h), and the update
+ *			   of the cached state (counts, sentinels...) after them
+ **/
+
+#ifndef __BBSET_DENSE_H__
+#define __BBSET_DENSE_H__
+
+#include "bbobject.h"
+#include "bitblock.h"
+#include "bbkernel.h"
+#include "bbscan_iter.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <sstream>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////////////////
+		//
+		// ScanBase class
+		//
+		// (aliases, bitscanning cache, conversions and I/O of a row type Derived)
+		// @details Not part of the BBObject hierarchy (no vptr), but shares its scan types and
+		//			nested bitscanning classes (Scan, ScanRev, ScanDest, ScanDestRev)
+		//
+		///////////////////////////////////
+
+		template<class Derived>
+		class ScanBase {
+
+			template <class U>
+			friend struct BBObject::Scan;
+			template <class U>
+			friend struct BBObject::ScanDest;
+			template <class U>
+			friend struct BBObject::ScanRev;
+			template <class U>
+			friend struct BBObject::ScanDestRev;
+
+		public:
+
+			using index_t = BBObject::index_t;
+			using scan_types = BBObject::scan_types;
+			using scan_t = BBObject::scan_t;
+			using bitpos_list = bitgraph::bitpos_list;
+			using bitpos_set = bitgraph::bitpos_set;
+
+			//aliases for bitscanning
+			using scan = BBObject::Scan<Derived>;
+			using scanR = BBObject::ScanRev<Derived>;
+			using scanD = BBObject::ScanDest<Derived>;
+			using scanDR = BBObject::ScanDestRev<Derived>;
+
+			friend bool operator != (const Derived& lhs, const Derived& rhs) { return !(lhs == rhs); }
+
+			void scan_block(int bbindex) { scan_.bbi_ = bbindex; }
+			void scan_bit(int posbit) { scan_.pos_ = posbit; }
+
+			int scan_block() const { return scan_.bbi_; }
+			int scan_bit() const { return scan_.pos_; }
+
+			/////////////////////
+			// Conversions and I/O
+
+			/**
+			* @brief streams the 1-bits of the bitset (and its popcount if show_pc is TRUE) - format [1 3 5 (3)]
+			**/
+			std::ostream& print(std::ostream& o = std::cout, bool show_pc = true, bool endl = true) const;
+
+			std::string to_string() const;
+
+			friend std::ostream& operator<< (std::ostream& o, const Derived& bb) { return bb.print(o, true, false); }
+
+			/**
+			* @brief converts the bitset to a vector of 1-bit elements (in increasing order)
+			**/
+			void extract(bitpos_list& lb) const;
+			void extract_set(bitpos_set& lb) const;
+
+			operator bitpos_list() const {
+				bitpos_list lb;
+				derived().extract(lb);
+				return lb;
+			}
+
+		protected:
+
+			const Derived& derived() const noexcept { return static_cast<const Derived&>(*this); }
+			Derived& derived() noexcept { return static_cast<Derived&>(*this); }
+
+			scan_t scan_;									//cache for bitscanning
+		};
+
+		/////////////////////////////////
+		//
+		// DenseBase class
+		//
+		// (BBScan interface of a row type Derived with the bit layout of Bitset, on the hooks of the file header)
+		// @details Binary operations require bitsets of the same number of bitblocks
+		//
+		///////////////////////////////////
+
+		template<class Derived>
+		class DenseBase : public ScanBase<Derived> {
+
+			using base_type = ScanBase<Derived>;
+
+		public:
+
+			using typename base_type::scan_types;
+			using base_type::scan_block;
+			using base_type::scan_bit;
+
+			/////////////////////////////
+			// Independent operators / masks
+			// comment: do not modify lhs or rhs
+
+			/**
+			* @brief AND between lhs and rhs bitsets, stores the result in an existing bitset res
+			* @returns reference to the resulting bitstring res
+			**/
+			friend Derived& AND(const Derived& lhs, const Derived& rhs, Derived& res) { return DenseBase::and_to(lhs, rhs, res); }
+
+			/**
+			* @brief AND between lhs and rhs bitsets
+			* @returns resulting bitset
+			**/
+			friend Derived AND(Derived lhs, const Derived& rhs) { return lhs &= rhs; }
+
+			/**
+			* @brief OR between lhs and rhs bitsets, stores the result in an existing bitset res
+			* @returns reference to the resulting bitstring res
+			**/
+			friend Derived& OR(const Derived& lhs, const Derived& rhs, Derived& res) { return DenseBase::or_to(lhs, rhs, res); }
+
+			friend Derived OR(Derived lhs, const Derived& rhs) { return lhs |= rhs; }
+
+			/**
+			* @brief Removes the 1-bits in the bitstring rhs from the bitstring lhs. Stores
+			*		 the result in res.
+			* @returns reference to the resulting bitstring res
+			**/
+			friend Derived& erase_bit(const Derived& lhs, const Derived& rhs, Derived& res) { return DenseBase::andnot_to(lhs, rhs, res); }
+
+			/**
+			* @brief Determines the first bit of the itersection between bitsets lhs and rhs
+			* @returns the first BIT of the intersection or BBObject::noBit if the sets are disjoint
+			**/
+			friend int find_first_common(const Derived& lhs, const Derived& rhs) { return DenseBase::first_common_of(lhs, rhs); }
+
+			friend bool operator == (const Derived& lhs, const Derived& rhs) noexcept { return DenseBase::equal(lhs, rhs); }
+
+			/**
+			* @brief bitblocks of the bitset for the bitscanning ranges (read-only, overload of bbscan_iter.h)
+			**/
+			friend block_span<const BITBOARD> blocks(const Derived& bb) { return { bb.data(), bb.num_blocks() }; }
+
+			/////////////////////
+			// Non-empty bitblocks
+
+			/**
+			* @brief index of the first non-empty bitblock in [i, num_blocks()), -1 if there is none
+			**/
+			int next_block(int i) const noexcept {
+				for (; i < nblocks(); ++i) {
+					if (cblocks()[i]) { return i; }
+				}
+				return -1;
+			}
+
+			/**
+			* @brief index of the last non-empty bitblock in [0, i], -1 if there is none
+			**/
+			int prev_block(int i) const noexcept {
+				for (; i >= 0; --i) {
+					if (cblocks()[i]) { return i; }
+				}
+				return -1;
+			}
+
+			//////////////////////////////
+			// Bitscanning (stateless)
+
+			/**
+			* @brief returns the index of the least significant bit in the bitstring, BBObject::noBit if empty
+			**/
+			int lsb() const {
+				const int i = this->derived().next_block(0);
+				return (i == -1) ? BBObject::noBit : bblock::lsb(cblocks()[i]) + WMUL(i);
+			}
+
+			/**
+			* @brief returns the index of the most significant bit in the bitstring, BBObject::noBit if empty
+			**/
+			int msb() const {
+				const int i = this->derived().prev_block(nblocks() - 1);
+				return (i == -1) ? BBObject::noBit : bblock::msb(cblocks()[i]) + WMUL(i);
+			}
+
+			/**
+			* @brief Computes the next least significant 1-bit in the bitstring after bit
+			*		 If bit == BBObject::noBit, returns the lest significant bit in the bitstring.
+			* @returns the next 1-bit in the bitstring after bit, BBObject::noBit if there are no more bits
+			**/
+			int next_bit(int bit) const;
+
+			/**
+			* @brief Computes the next most significant 1-bit in the bitstring before bit
+			*		 If bit == BBObject::noBit, returns the most significant bit in the bitstring.
+			* @returns the next 1-bit in the bitstring before bit, BBObject::noBit if there are no more bits
+			**/
+			int prev_bit(int bit) const;
+
+			//////////////////////////////
+			// Bitscanning (with cached info - same semantics as BBScan)
+
+			/**
+			* @brief Configures the initial block and bit position for bitscanning
+			*		 according to one of the 4 scan types passed as argument
+			* @returns 0
+			**/
+			int init_scan(scan_types sct) noexcept;
+
+			/**
+			* @brief Configures the initial block and bit position for bitscanning
+			*		 starting from the bit 'firstBit' onwards, excluding 'firstBit'.
+			*		 If firstBit is -1 (BBObject::noBit), the scan starts from the beginning.
+			* @returns 0
+			**/
+			int init_scan(int firstBit, scan_types sct) noexcept;
+
+			int next_bit();
+			int next_bit(Derived& bitset);
+			int next_bit_del();
+			int next_bit_del(Derived& bitset);
+			int prev_bit();
+			int prev_bit(Derived& bitset);
+			int prev_bit_del();
+			int prev_bit_del(Derived& bitset);
+
+			/////////////////
+			// Popcount
+
+			/**
+			* @brief returns the number of 1-bits in the bitstring
+			**/
+			int count() const noexcept { return this->derived().count_blocks(0, nblocks() - 1); }
+			int popcn64() const noexcept { return count(); }
+
+			/**
+			* @brief returns the number of 1-bits in the bitstring in the closed range [firstBit, lastBit]
+			*		 If lastBit == -1, the range is [firstBit, end of the bitset)
+			**/
+			int count(int firstBit, int lastBit = -1) const { return popcn64(firstBit, lastBit); }
+			int popcn64(int firstBit, int lastBit = -1) const;
+
+			/////////////////////
+			//Setting / Erasing bits
+
+			Derived& set_bit(int bit) {
+				assert(bit >= 0 && WDIV(bit) < nblocks());
+				this->derived().set_bits(WDIV(bit), bblock::MASK_BIT(WMOD(bit)));
+				return this->derived();
+			}
+
+			/**
+			* @brief sets the bits in the closed range [firstBit, lastBit]
+			**/
+			Derived& set_bit(int firstBit, int lastBit);
+
+			/**
+			* @brief adds the 1-bits of rhs to this bitset (same as operator |=)
+			**/
+			Derived& set_bit(const Derived& rhs) { return this->derived() |= rhs; }
+
+			Derived& erase_bit(int bit) {
+				assert(bit >= 0 && WDIV(bit) < nblocks());
+				this->derived().erase_bits(WDIV(bit), bblock::MASK_BIT(WMOD(bit)));
+				return this->derived();
+			}
+
+			/**
+			* @brief erases the bits in the closed range [firstBit, lastBit]
+			*		 If lastBit == -1, the range is [firstBit, end of the bitset)
+			**/
+			Derived& erase_bit(int firstBit, int lastBit);
+
+			/**
+			* @brief erases all bits of the bitset
+			**/
+			Derived& erase_bit() noexcept {
+				this->derived().clear_blocks();
+				return this->derived();
+			}
+
+			/**
+			* @brief Removes the 1-bits of rhs from this bitset
+			**/
+			Derived& erase_bit(const Derived& rhs) noexcept { return this->derived().assign_andnot(this->derived(), rhs); }
+
+			/**
+			* @brief deletes the bit and returns TRUE if it was set, FALSE otherwise
+			**/
+			bool erase_bit_if(int bit) {
+				const bool isbit = is_bit(bit);
+				erase_bit(bit);
+				return isbit;
+			}
+
+			////////////////////////
+			//Operators
+
+			Derived& operator &= (const Derived& rhs) noexcept { return this->derived().assign_and(this->derived(), rhs); }
+			Derived& operator |= (const Derived& rhs) noexcept { return this->derived().assign_or(this->derived(), rhs); }
+
+			Derived& operator ^= (const Derived& rhs) noexcept {
+				assert(rhs.num_blocks() == nblocks());
+				bbkernel::xor_assign(this->derived().wblocks(), rhs.data(), nblocks());
+				this->derived().refresh();
+				return this->derived();
+			}
+
+			/**
+			* @brief flips all the bits of the bitset (including the bits beyond the population size)
+			**/
+			Derived& flip() noexcept {
+				BITBOARD* p = this->derived().wblocks();
+				for (int i = 0; i < nblocks(); ++i) { p[i] = ~p[i]; }
+				this->derived().refresh();
+				return this->derived();
+			}
+
+			/////////////////////////////
+			//Boolean functions
+
+			bool is_bit(int bit) const {
+				assert(bit >= 0 && WDIV(bit) < nblocks());
+				return (cblocks()[WDIV(bit)] & bblock::MASK_BIT(WMOD(bit)));
+			}
+
+			bool is_empty() const noexcept { return this->derived().next_block(0) == -1; }
+
+			/**
+			* @brief TRUE if the bitset has a single 1-bit
+			**/
+			bool is_singleton() const noexcept {
+				const int i = this->derived().next_block(0);
+				return (i != -1) && bblock::popc64(cblocks()[i]) == 1 && this->derived().next_block(i + 1) == -1;
+			}
+
+			/**
+			* @brief TRUE if this bitset and rhs have no 1-bits in common
+			**/
+			bool is_disjoint(const Derived& rhs) const noexcept { return this->derived().first_common(rhs) == BBObject::noBit; }
+
+			/**
+			* @brief TRUE if this bitset, lhs and rhs have no 1-bits in common (only the non-empty bitblocks of this bitset are visited)
+			**/
+			bool is_disjoint(const Derived& lhs, const Derived& rhs) const noexcept;
+
+			/**
+			* @brief Determines if this bitset and rhs have a single 1-bit in common
+			* @param bit: output common 1-bit if the intersection is a singleton, BBObject::noBit otherwise
+			* @returns 0 if disjoint, 1 if the intersection is a singleton, -1 otherwise
+			**/
+			int find_common_singleton(const Derived& rhs, int& bit) const;
+
+			/////////////////////
+			// Conversions
+
+			/**
+			* @brief converts the bitset to a vector of 1-bit elements (in increasing order)
+			* @details: vectorized decoding (bbkernel.h) from the first to the last non-empty bitblock
+			**/
+			void extract(bitpos_list& lb) const;
+
+			/////////////////////
+			// hooks - default implementation
+
+		protected:
+
+			BITBOARD* wblocks() noexcept { return this->derived().data(); }
+			void refresh() noexcept {}
+
+			void set_bits(int i, BITBOARD mask) noexcept { this->derived().wblocks()[i] |= mask; }
+			void erase_bits(int i, BITBOARD mask) noexcept { this->derived().wblocks()[i] &= ~mask; }
+
+			int count_blocks(int firstBlock, int lastBlock) const noexcept {
+				return (firstBlock > lastBlock) ? 0 : bbkernel::popcount(cblocks() + firstBlock, lastBlock - firstBlock + 1);
+			}
+
+			void clear_blocks() noexcept {
+				std::fill(this->derived().wblocks(), this->derived().wblocks() + nblocks(), ZERO);
+				this->derived().refresh();
+			}
+
+			Derived& assign_and(const Derived& lhs, const Derived& rhs) noexcept;
+			Derived& assign_or(const Derived& lhs, const Derived& rhs) noexcept;
+			Derived& assign_andnot(const Derived& lhs, const Derived& rhs) noexcept;
+
+			int first_common(const Derived& rhs) const noexcept;
+
+			bool equal_blocks(const Derived& rhs) const noexcept {
+				return rhs.num_blocks() == nblocks() && std::equal(cblocks(), cblocks() + nblocks(), rhs.data());
+			}
+
+		private:
+
+			const BITBOARD* cblocks() const noexcept { return this->derived().data(); }
+			int nblocks() const noexcept { return this->derived().num_blocks(); }
+
+			//friends of DenseBase call the hooks of Derived through them
+			static Derived& and_to(const Derived& lhs, const Derived& rhs, Derived& res) noexcept { return res.assign_and(lhs, rhs); }
+			static Derived& or_to(const Derived& lhs, const Derived& rhs, Derived& res) noexcept { return res.assign_or(lhs, rhs); }
+			static Derived& andnot_to(const Derived& lhs, const Derived& rhs, Derived& res) noexcept { return res.assign_andnot(lhs, rhs); }
+			static int first_common_of(const Derived& lhs, const Derived& rhs) noexcept { return lhs.first_common(rhs); }
+			static bool equal(const Derived& lhs, const Derived& rhs) noexcept { return lhs.equal_blocks(rhs); }
+		};
+
+	}//end namespace _impl
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation, must be in header file
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////
+		// ScanBase
+
+		template<class Derived>
+		inline
+		std::ostream& ScanBase<Derived>::print(std::ostream& o, bool show_pc, bool endl) const {
+
+			o << "[";
+
+			//scans de bitstring and serializes it to the output stream
+			int nBit = BBObject::noBit;
+			while ((nBit = derived().next_bit(nBit)) != BBObject::noBit) {
+				o << nBit << " ";
+			}
+
+			//adds popcount if required
+			if (show_pc) {
+				int pc = derived().count();
+				if (pc) {
+					o << "(" << pc << ")";
+				}
+			}
+
+			o << "]";
+
+			if (endl) { o << std::endl; }
+			return o;
+		}
+
+		template<class Derived>
+		inline
+		std::string ScanBase<Derived>::to_string() const {
+			std::ostringstream sstr;
+			derived().print(sstr, true, false);
+			return sstr.str();
+		}
+
+		template<class Derived>
+		inline
+		void ScanBase<Derived>::extract(bitpos_list& lb) const {
+
+			lb.clear();
+			lb.reserve(derived().count());
+
+			int nBit = BBObject::noBit;
+			while ((nBit = derived().next_bit(nBit)) != BBObject::noBit) {
+				lb.emplace_back(nBit);
+			}
+		}
+
+		template<class Derived>
+		inline
+		void ScanBase<Derived>::extract_set(bitpos_set& lb) const {
+
+			lb.clear();
+
+			int nBit = BBObject::noBit;
+			while ((nBit = derived().next_bit(nBit)) != BBObject::noBit) {
+				lb.emplace_hint(lb.end(), nBit);
+			}
+		}
+
+		/////////////////////
+		// DenseBase - bitscanning
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::next_bit(int bit) const {
+
+			//special case - first bitscan
+			if (bit == BBObject::noBit) {
+				return this->derived().lsb();
+			}
+
+			const int bbh = WDIV(bit);
+
+			//looks for the next bit in the current block
+			BITBOARD bb = cblocks()[bbh] & Tables::mask_high[bit - WMUL(bbh)];
+			if (bb) {
+				return bblock::lsb(bb) + WMUL(bbh);
+			}
+
+			//looks for the next bit in the remaining blocks
+			const int i = this->derived().next_block(bbh + 1);
+			return (i == -1) ? BBObject::noBit : bblock::lsb(cblocks()[i]) + WMUL(i);
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::prev_bit(int bit) const {
+
+			//special case - first bitscan
+			if (bit == BBObject::noBit) {
+				return this->derived().msb();
+			}
+
+			const int bbh = WDIV(bit);
+
+			//looks for the previous bit in the current block
+			BITBOARD bb = cblocks()[bbh] & Tables::mask_low[bit - WMUL(bbh)];
+			if (bb) {
+				return bblock::msb(bb) + WMUL(bbh);
+			}
+
+			//looks for the previous bit in the remaining blocks
+			const int i = this->derived().prev_block(bbh - 1);
+			return (i == -1) ? BBObject::noBit : bblock::msb(cblocks()[i]) + WMUL(i);
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::init_scan(scan_types sct) noexcept {
+
+			switch (sct) {
+			case BBObject::NON_DESTRUCTIVE:
+				scan_block(0);
+				scan_bit(MASK_LIM);
+				break;
+			case BBObject::NON_DESTRUCTIVE_REVERSE:
+				scan_block(nblocks() - 1);
+				scan_bit(WORD_SIZE);		//mask_low[WORD_SIZE] = ONE
+				break;
+			case BBObject::DESTRUCTIVE:
+				scan_block(0);
+				break;
+			case BBObject::DESTRUCTIVE_REVERSE:
+				scan_block(nblocks() - 1);
+				break;
+			default:
+				assert(false && "unknown scan type - DenseBase::init_scan");
+			}
+
+			return 0;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::init_scan(int firstBit, scan_types sct) noexcept {
+
+			//special case - first bitscan
+			if (firstBit == BBObject::noBit) {
+				return init_scan(sct);
+			}
+
+			const int bbh = WDIV(firstBit);
+			switch (sct) {
+			case BBObject::NON_DESTRUCTIVE:
+			case BBObject::NON_DESTRUCTIVE_REVERSE:
+				scan_block(bbh);
+				scan_bit(firstBit - WMUL(bbh) /* WMOD(firstBit) */);
+				break;
+			case BBObject::DESTRUCTIVE:
+			case BBObject::DESTRUCTIVE_REVERSE:
+				scan_block(bbh);
+				break;
+			default:
+				assert(false && "unknown scan type - DenseBase::init_scan");
+			}
+
+			return 0;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::next_bit() {
+
+			auto& scan = this->scan_;
+
+			//Search for next bit in the last scanned block
+			BITBOARD bb = cblocks()[scan.bbi_] & Tables::mask_high[scan.pos_];
+			if (bb) {
+				scan.pos_ = bblock::lsb(bb);
+				return (scan.pos_ + WMUL(scan.bbi_));
+			}
+
+			//Searches for next bit in the remaining blocks
+			const int i = this->derived().next_block(scan.bbi_ + 1);
+			if (i != -1) {
+				scan.bbi_ = i;
+				scan.pos_ = bblock::lsb(cblocks()[i]);
+				return (scan.pos_ + WMUL(i));
+			}
+
+			return BBObject::noBit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::next_bit(Derived& bitset) {
+
+			const int bit = next_bit();
+			if (bit != BBObject::noBit) {
+				bitset.erase_bits(this->scan_.bbi_, bblock::MASK_BIT(this->scan_.pos_));
+			}
+			return bit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::next_bit_del() {
+
+			const int i = this->derived().next_block(this->scan_.bbi_);
+			if (i != -1) {
+				this->scan_.bbi_ = i;
+				const BITBOARD bb = cblocks()[i];
+				const int pos = bblock::lsb(bb);
+				this->derived().erase_bits(i, bb & ~(bb - 1));					//lowest 1-bit
+				return (pos + WMUL(i));
+			}
+
+			return BBObject::noBit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::next_bit_del(Derived& bitset) {
+
+			const int bit = next_bit_del();
+			if (bit != BBObject::noBit) {
+				bitset.erase_bits(this->scan_.bbi_, bblock::MASK_BIT(WMOD(bit)));
+			}
+			return bit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::prev_bit() {
+
+			auto& scan = this->scan_;
+
+			//Searches for previous bit in the last scanned block
+			BITBOARD bb = cblocks()[scan.bbi_] & Tables::mask_low[scan.pos_];
+			if (bb) {
+				scan.pos_ = bblock::msb(bb);
+				return (scan.pos_ + WMUL(scan.bbi_));
+			}
+
+			//Searches for previous bit in the remaining blocks
+			const int i = this->derived().prev_block(scan.bbi_ - 1);
+			if (i != -1) {
+				scan.bbi_ = i;
+				scan.pos_ = bblock::msb(cblocks()[i]);
+				return (scan.pos_ + WMUL(i));
+			}
+
+			return BBObject::noBit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::prev_bit(Derived& bitset) {
+
+			const int bit = prev_bit();
+			if (bit != BBObject::noBit) {
+				bitset.erase_bits(this->scan_.bbi_, bblock::MASK_BIT(this->scan_.pos_));
+			}
+			return bit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::prev_bit_del() {
+
+			const int i = this->derived().prev_block(this->scan_.bbi_);
+			if (i != -1) {
+				this->scan_.bbi_ = i;
+				const int pos = bblock::msb(cblocks()[i]);
+				this->derived().erase_bits(i, static_cast<BITBOARD>(1) << pos);
+				return (pos + WMUL(i));
+			}
+
+			return BBObject::noBit;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::prev_bit_del(Derived& bitset) {
+
+			const int bit = prev_bit_del();
+			if (bit != BBObject::noBit) {
+				bitset.erase_bits(this->scan_.bbi_, bblock::MASK_BIT(WMOD(bit)));
+			}
+			return bit;
+		}
+
+		/////////////////////
+		// DenseBase - popcount and bit updates
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::popcn64(int firstBit, int lastBit) const {
+
+			if (lastBit == -1) {
+				lastBit = WMUL(nblocks()) - 1;
+			}
+
+			//////////////////////////////
+			assert(firstBit >= 0 && firstBit <= lastBit && WDIV(lastBit) < nblocks());
+			//////////////////////////////
+
+			const int bbl = WDIV(firstBit);
+			const int bbh = WDIV(lastBit);
+
+			if (bbl == bbh) {
+				return bblock::popc64(cblocks()[bbl] & bblock::MASK_1(firstBit - WMUL(bbl), lastBit - WMUL(bbh)));
+			}
+
+			int pc = bblock::popc64(cblocks()[bbl] & bblock::MASK_1_HIGH(firstBit - WMUL(bbl)));
+			pc += this->derived().count_blocks(bbl + 1, bbh - 1);
+			pc += bblock::popc64(cblocks()[bbh] & bblock::MASK_1_LOW(lastBit - WMUL(bbh)));
+
+			return pc;
+		}
+
+		template<class Derived>
+		inline
+		Derived& DenseBase<Derived>::set_bit(int firstBit, int lastBit) {
+
+			//////////////////////////////
+			assert(firstBit >= 0 && firstBit <= lastBit && WDIV(lastBit) < nblocks());
+			//////////////////////////////
+
+			const int bbl = WDIV(firstBit);
+			const int bbh = WDIV(lastBit);
+			Derived& bb = this->derived();
+
+			if (bbl == bbh) {
+				bb.set_bits(bbh, bblock::MASK_1(firstBit - WMUL(bbl), lastBit - WMUL(bbh)));
+			}
+			else {
+				bb.set_bits(bbl, bblock::MASK_1_HIGH(firstBit - WMUL(bbl)));
+				for (int i = bbl + 1; i < bbh; ++i) {
+					bb.set_bits(i, ONE);
+				}
+				bb.set_bits(bbh, bblock::MASK_1_LOW(lastBit - WMUL(bbh)));
+			}
+
+			return bb;
+		}
+
+		template<class Derived>
+		inline
+		Derived& DenseBase<Derived>::erase_bit(int firstBit, int lastBit) {
+
+			if (lastBit == -1) {
+				lastBit = WMUL(nblocks()) - 1;
+			}
+
+			//////////////////////////////
+			assert(firstBit >= 0 && firstBit <= lastBit && WDIV(lastBit) < nblocks());
+			//////////////////////////////
+
+			const int bbl = WDIV(firstBit);
+			const int bbh = WDIV(lastBit);
+			Derived& bb = this->derived();
+
+			if (bbl == bbh) {
+				bb.erase_bits(bbh, ~bblock::MASK_0(firstBit - WMUL(bbl), lastBit - WMUL(bbh)));
+			}
+			else {
+				bb.erase_bits(bbl, ~bblock::MASK_0_HIGH(firstBit - WMUL(bbl)));
+
+				//only the non-empty inner bitblocks
+				for (int i = bb.next_block(bbl + 1); i != -1 && i < bbh; i = bb.next_block(i + 1)) {
+					bb.erase_bits(i, ONE);
+				}
+				bb.erase_bits(bbh, ~bblock::MASK_0_LOW(lastBit - WMUL(bbh)));
+			}
+
+			return bb;
+		}
+
+		/////////////////////
+		// DenseBase - set operations
+
+		template<class Derived>
+		inline
+		Derived& DenseBase<Derived>::assign_and(const Derived& lhs, const Derived& rhs) noexcept {
+			assert(lhs.num_blocks() == nblocks() && rhs.num_blocks() == nblocks());
+			bbkernel::and_to(this->derived().wblocks(), lhs.data(), rhs.data(), nblocks());
+			this->derived().refresh();
+			return this->derived();
+		}
+
+		template<class Derived>
+		inline
+		Derived& DenseBase<Derived>::assign_or(const Derived& lhs, const Derived& rhs) noexcept {
+			assert(lhs.num_blocks() == nblocks() && rhs.num_blocks() == nblocks());
+			bbkernel::or_to(this->derived().wblocks(), lhs.data(), rhs.data(), nblocks());
+			this->derived().refresh();
+			return this->derived();
+		}
+
+		template<class Derived>
+		inline
+		Derived& DenseBase<Derived>::assign_andnot(const Derived& lhs, const Derived& rhs) noexcept {
+			assert(lhs.num_blocks() == nblocks() && rhs.num_blocks() == nblocks());
+			bbkernel::andnot_to(this->derived().wblocks(), lhs.data(), rhs.data(), nblocks());
+			this->derived().refresh();
+			return this->derived();
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::first_common(const Derived& rhs) const noexcept {
+			assert(rhs.num_blocks() == nblocks());
+			const int i = bbkernel::first_common(cblocks(), rhs.data(), nblocks());
+			return (i == nblocks()) ? BBObject::noBit : bblock::lsb(cblocks()[i] & rhs.data()[i]) + WMUL(i);
+		}
+
+		template<class Derived>
+		inline
+		bool DenseBase<Derived>::is_disjoint(const Derived& lhs, const Derived& rhs) const noexcept {
+
+			assert(lhs.num_blocks() == nblocks() && rhs.num_blocks() == nblocks());
+
+			const Derived& bb = this->derived();
+			for (int i = bb.next_block(0); i != -1; i = bb.next_block(i + 1)) {
+				if (cblocks()[i] & lhs.data()[i] & rhs.data()[i]) { return false; }
+			}
+			return true;
+		}
+
+		template<class Derived>
+		inline
+		int DenseBase<Derived>::find_common_singleton(const Derived& rhs, int& bit) const {
+
+			assert(rhs.num_blocks() == nblocks());
+
+			bit = BBObject::noBit;
+			int pc = 0;
+
+			const Derived& bb = this->derived();
+			for (int i = bb.next_block(0); i != -1; i = bb.next_block(i + 1)) {
+				BITBOARD bbc = cblocks()[i] & rhs.data()[i];
+				if (bbc) {
+					pc += bblock::popc64(bbc);
+					if (pc > 1) {
+						bit = BBObject::noBit;
+						return -1;
+					}
+					bit = bblock::lsb(bbc) + WMUL(i);
+				}
+			}
+
+			return pc;
+		}
+
+		template<class Derived>
+		inline
+		void DenseBase<Derived>::extract(bitpos_list& lb) const {
+
+			lb.clear();
+
+			const Derived& bb = this->derived();
+			const int lo = bb.next_block(0);
+			if (lo == -1) { return; }
+			const int hi = bb.prev_block(nblocks() - 1);
+
+			lb.resize(bb.count() + bbkernel::DECODE_PAD);
+			lb.resize(bbkernel::decode(cblocks() + lo, hi - lo + 1, WMUL(lo), lb.data()));
+		}
+
+	}//end namespace _impl
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_DENSE_H__
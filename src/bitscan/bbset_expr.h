@@ -0,0 +1,327 @@
+/**
+ * @file bbset_expr.h
+ * @brief Expression templates for the set algebra of the Bitset class and derived types (BBScan...)
+ * @details created 17/10/2026
+ * @details Bitset operands may be combined with the operators &, |, ^ and ~ in expressions of any depth, e.g.
+ *			 res = (a & b) | (c & ~d)
+ *			The expression is a lightweight object (no bitset is built) evaluated in a single pass over the
+ *			bitblocks when it is:
+ *			 - assigned to a bitset: res = e, res &= e, res |= e, res.assign_block(firstBlock, lastBlock, e)
+ *			 - reduced: e.count(), e.is_empty(), e.lsb() and their block range versions count_block(...),
+ *			   is_empty_block(...), lsb_block(...), with no output bitset
+ * @details The operands should have the same number of bitblocks (the expression has the minimum number of
+ *			bitblocks of its operands). The complement ~a is computed over whole bitblocks, as Bitset::flip().
+ * @details The expression keeps pointers to the bitblocks of its operands - they must outlive the expression and
+ *			must not be resized while it is alive. The result bitset may be one of the operands (e.g. a = a & ~b).
+ * @author pss
+ **/
+
+#ifndef __BBSET_EXPR_H__
+#define __BBSET_EXPR_H__
+
+#include "bbset.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace bitgraph {
+
+	//number of bitblocks of the stack buffer used in the population count of expressions
+	constexpr int EXPR_CHUNK_BLOCKS = 32;
+
+	/////////////////////////////////
+	//
+	// BitsetExpr
+	//
+	// (CRTP base of all the expression nodes, provides the reductions.
+	//  Derived types E implement block(i) and num_blocks())
+	//
+	///////////////////////////////////
+
+	template<class E>
+	class BitsetExpr {
+	public:
+
+		const E& self() const noexcept { return static_cast<const E&>(*this); }
+
+		BITBOARD block(int i) const noexcept { return self().block(i); }
+		int num_blocks() const noexcept { return self().num_blocks(); }
+
+		/**
+		* @brief number of 1-bits of the expression
+		**/
+		int count() const noexcept { return count_block(0, BBObject::npos); }
+
+		/**
+		* @brief number of 1-bits of the expression in the closed block range [firstBlock, lastBlock]
+		*		 If lastBlock = npos, the range is [firstBlock, num_blocks())
+		**/
+		int count_block(int firstBlock, int lastBlock) const noexcept;
+
+		/**
+		* @brief TRUE if the expression has no 1-bits (stops at the first non-empty bitblock)
+		**/
+		bool is_empty() const noexcept { return is_empty_block(0, BBObject::npos); }
+
+		/**
+		* @brief TRUE if the expression has no 1-bits in the closed block range [firstBlock, lastBlock]
+		*		 If lastBlock = npos, the range is [firstBlock, num_blocks())
+		**/
+		bool is_empty_block(int firstBlock, int lastBlock) const noexcept;
+
+		/**
+		* @brief first (least significant) 1-bit of the expression, noBit if empty
+		**/
+		int lsb() const noexcept { return lsb_block(0, BBObject::npos); }
+
+		/**
+		* @brief first (least significant) 1-bit of the expression in the closed block range [firstBlock, lastBlock],
+		*		 noBit if empty. If lastBlock = npos, the range is [firstBlock, num_blocks())
+		**/
+		int lsb_block(int firstBlock, int lastBlock) const noexcept;
+
+	protected:
+		int last_block(int lastBlock) const noexcept { return (lastBlock == BBObject::npos) ? num_blocks() - 1 : lastBlock; }
+	};
+
+	/////////////////////////////////
+	//
+	// Expression nodes
+	//
+	///////////////////////////////////
+
+	//leaf - bitblocks of a Bitset (by pointer)
+	class BitsetTerm : public BitsetExpr<BitsetTerm> {
+	public:
+		explicit BitsetTerm(const Bitset& bb) noexcept :
+			data_(bb.bitset().data()), nBB_(bb.num_blocks())
+		{}
+
+		BITBOARD block(int i) const noexcept { return data_[i]; }
+		int num_blocks() const noexcept { return nBB_; }
+
+	private:
+		const BITBOARD* data_;
+		int nBB_;
+	};
+
+	namespace _impl {
+		struct expr_and { static BITBOARD apply(BITBOARD lhs, BITBOARD rhs) noexcept { return lhs & rhs; } };
+		struct expr_or { static BITBOARD apply(BITBOARD lhs, BITBOARD rhs) noexcept { return lhs | rhs; } };
+		struct expr_xor { static BITBOARD apply(BITBOARD lhs, BITBOARD rhs) noexcept { return lhs ^ rhs; } };
+	}
+
+	//binary operation - operands stored by value (the nodes are small)
+	template<class L, class R, class OpT>
+	class BitsetBinExpr : public BitsetExpr<BitsetBinExpr<L, R, OpT>> {
+	public:
+		BitsetBinExpr(const L& lhs, const R& rhs) noexcept : lhs_(lhs), rhs_(rhs) {}
+
+		BITBOARD block(int i) const noexcept { return OpT::apply(lhs_.block(i), rhs_.block(i)); }
+		int num_blocks() const noexcept { return std::min(lhs_.num_blocks(), rhs_.num_blocks()); }
+
+	private:
+		L lhs_;
+		R rhs_;
+	};
+
+	//complement
+	template<class E>
+	class BitsetNotExpr : public BitsetExpr<BitsetNotExpr<E>> {
+	public:
+		explicit BitsetNotExpr(const E& e) noexcept : e_(e) {}
+
+		BITBOARD block(int i) const noexcept { return ~e_.block(i); }
+		int num_blocks() const noexcept { return e_.num_blocks(); }
+
+	private:
+		E e_;
+	};
+
+	namespace _impl {
+
+		//////////////////
+		// operands of the expressions: Bitset (and derived types) or expressions
+
+		template<class T>
+		struct is_bitset_expr : std::is_base_of<BitsetExpr<T>, T> {};
+
+		template<class T>
+		struct is_expr_operand : std::integral_constant<bool, std::is_base_of<Bitset, T>::value || is_bitset_expr<T>::value> {};
+
+		inline BitsetTerm as_expr(const Bitset& bb) noexcept { return BitsetTerm(bb); }
+
+		template<class E>
+		inline const E& as_expr(const BitsetExpr<E>& e) noexcept { return e.self(); }
+
+		template<class T>
+		using expr_t = typename std::decay<decltype(as_expr(std::declval<const T&>()))>::type;
+
+		template<class L, class R>
+		using enable_if_expr_t = typename std::enable_if<is_expr_operand<L>::value && is_expr_operand<R>::value>::type;
+	}
+
+	////////////////////////
+	//
+	// Operators
+	//
+	////////////////////////
+
+	template<class L, class R, class = _impl::enable_if_expr_t<L, R>>
+	inline
+	BitsetBinExpr<_impl::expr_t<L>, _impl::expr_t<R>, _impl::expr_and> operator & (const L& lhs, const R& rhs) noexcept {
+		return { _impl::as_expr(lhs), _impl::as_expr(rhs) };
+	}
+
+	template<class L, class R, class = _impl::enable_if_expr_t<L, R>>
+	inline
+	BitsetBinExpr<_impl::expr_t<L>, _impl::expr_t<R>, _impl::expr_or> operator | (const L& lhs, const R& rhs) noexcept {
+		return { _impl::as_expr(lhs), _impl::as_expr(rhs) };
+	}
+
+	template<class L, class R, class = _impl::enable_if_expr_t<L, R>>
+	inline
+	BitsetBinExpr<_impl::expr_t<L>, _impl::expr_t<R>, _impl::expr_xor> operator ^ (const L& lhs, const R& rhs) noexcept {
+		return { _impl::as_expr(lhs), _impl::as_expr(rhs) };
+	}
+
+	template<class T, class = _impl::enable_if_expr_t<T, T>>
+	inline
+	BitsetNotExpr<_impl::expr_t<T>> operator ~ (const T& bb) noexcept {
+		return BitsetNotExpr<_impl::expr_t<T>>(_impl::as_expr(bb));
+	}
+
+	////////////////////////
+	//
+	// Reductions
+	//
+	////////////////////////
+
+	template<class E>
+	inline
+	int BitsetExpr<E>::count_block(int firstBlock, int lastBlock) const noexcept {
+		const E& e = self();
+		const int last = last_block(lastBlock);
+
+		//////////////////////////////////////////////////////////
+		assert(firstBlock >= 0 && last < e.num_blocks());
+		//////////////////////////////////////////////////////////
+
+		//the expression is evaluated in chunks in a stack buffer and counted by the bbkernel layer
+		BITBOARD buf[EXPR_CHUNK_BLOCKS];
+		int pc = 0;
+		for (int i = firstBlock; i <= last; i += EXPR_CHUNK_BLOCKS) {
+			const int n = std::min(EXPR_CHUNK_BLOCKS, last - i + 1);
+			for (int j = 0; j < n; ++j) {
+				buf[j] = e.block(i + j);
+			}
+			pc += bbkernel::popcount(buf, n);
+		}
+		return pc;
+	}
+
+	template<class E>
+	inline
+	bool BitsetExpr<E>::is_empty_block(int firstBlock, int lastBlock) const noexcept {
+		const E& e = self();
+		const int last = last_block(lastBlock);
+
+		//////////////////////////////////////////////////////////
+		assert(firstBlock >= 0 && last < e.num_blocks());
+		//////////////////////////////////////////////////////////
+
+		for (int i = firstBlock; i <= last; ++i) {
+			if (e.block(i)) { return false; }
+		}
+		return true;
+	}
+
+	template<class E>
+	inline
+	int BitsetExpr<E>::lsb_block(int firstBlock, int lastBlock) const noexcept {
+		const E& e = self();
+		const int last = last_block(lastBlock);
+
+		//////////////////////////////////////////////////////////
+		assert(firstBlock >= 0 && last < e.num_blocks());
+		//////////////////////////////////////////////////////////
+
+		for (int i = firstBlock; i <= last; ++i) {
+			const BITBOARD bb = e.block(i);
+			if (bb) { return bblock::lsb(bb) + WMUL(i); }
+		}
+		return BBObject::noBit;
+	}
+
+	////////////////////////
+	//
+	// Evaluation (members of Bitset)
+	//
+	////////////////////////
+
+	template<class E>
+	inline
+	Bitset& Bitset::operator = (const BitsetExpr<E>& e) {
+		const E& ex = e.self();
+		const int nBB = ex.num_blocks();
+
+		//resizes (only shrinks when *this is one of the operands)
+		if (nBB != nBB_) {
+			vBB_.resize(nBB);
+			nBB_ = nBB;
+		}
+
+		for (int i = 0; i < nBB; ++i) {
+			vBB_[i] = ex.block(i);
+		}
+		return *this;
+	}
+
+	template<class E>
+	inline
+	Bitset& Bitset::operator &= (const BitsetExpr<E>& e) {
+		const E& ex = e.self();
+
+		//////////////////////////////////////////////////////////
+		assert(ex.num_blocks() >= nBB_);
+		//////////////////////////////////////////////////////////
+
+		for (int i = 0; i < nBB_; ++i) {
+			vBB_[i] &= ex.block(i);
+		}
+		return *this;
+	}
+
+	template<class E>
+	inline
+	Bitset& Bitset::operator |= (const BitsetExpr<E>& e) {
+		const E& ex = e.self();
+
+		//////////////////////////////////////////////////////////
+		assert(ex.num_blocks() >= nBB_);
+		//////////////////////////////////////////////////////////
+
+		for (int i = 0; i < nBB_; ++i) {
+			vBB_[i] |= ex.block(i);
+		}
+		return *this;
+	}
+
+	template<class E>
+	inline
+	Bitset& Bitset::assign_block(index_t firstBlock, index_t lastBlock, const BitsetExpr<E>& e) {
+		const E& ex = e.self();
+		const index_t last = (lastBlock == npos) ? nBB_ - 1 : lastBlock;
+
+		//////////////////////////////////////////////////////////
+		assert(firstBlock >= 0 && last < nBB_ && last < ex.num_blocks());
+		//////////////////////////////////////////////////////////
+
+		for (index_t i = firstBlock; i <= last; ++i) {
+			vBB_[i] = ex.block(i);
+		}
+		return *this;
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file bbset_fixed.h
+ * @brief header file of the FixedBitset class from the BITSCAN library.
+ *		  Manages bitstrings of a fixed maximum size NBITS, known at compile time
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The bitblocks are stored inline (std::array-like storage, no heap allocation)
+ *			 and the class has no virtual functions (no vptr), so a vector of FixedBitset
+ *			 objects is a contiguous adjacency matrix and all the bulk loops have compile-time
+ *			 bounds (unrolled / vectorized by the compiler).
+ * @details: The BBScan interface is inherited from _impl::DenseBase (bbset_dense.h), so that
+ *			 Graph<FixedBitset<N>>, Ugraph<FixedBitset<N>> and KCore can be instantiated unchanged.
+ * @details: Intended for small graphs (|V| <= NBITS, typically a few hundred vertices)
+ **/
+
+#ifndef __BBSET_FIXED_H__
+#define __BBSET_FIXED_H__
+
+#include "bbset_dense.h"
+#include "utils/logger.h"
+#include <initializer_list>
+#include <cstdlib>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// FixedBitset class
+	//
+	// Bitstrings of at most NBITS bits with inline storage (no heap, no vptr)
+	// @details The population size of the constructors is only checked against NBITS (fail-fast),
+	//			all operations run over the NBB() bitblocks of the bitset
+	//
+	///////////////////////////////////
+
+	template<std::size_t NBITS>
+	class FixedBitset : public _impl::DenseBase<FixedBitset<NBITS>> {
+
+		static_assert(NBITS > 0, "FixedBitset requires NBITS > 0");
+
+		using base_type = _impl::DenseBase<FixedBitset<NBITS>>;
+
+	public:
+
+		using typename base_type::index_t;
+		using typename base_type::bitpos_list;
+
+		/**
+		* @brief number of bitblocks of the bitset (compile-time)
+		**/
+		static constexpr int NBB() { return static_cast<int>(INDEX_1TO1(NBITS)); }
+
+		/**
+		* @brief maximum population size of the bitset (compile-time)
+		**/
+		static constexpr std::size_t capacity() { return NBITS; }
+
+		////////////
+		//construction / destruction
+
+		FixedBitset() noexcept { this->erase_bit(); }
+
+		/**
+		* @brief Constructor of a bitset given a population size nPop
+		* @param nPop : population size (nPop <= NBITS)
+		* @param val: initial value (TRUE, FALSE) of every bit in the range [0, nPop)
+		* @details: Fail-fast policy: program exits if nPop > NBITS
+		**/
+		explicit FixedBitset(std::size_t nPop, bool val = false) noexcept { init(nPop, val); }
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param nPop: population size (nPop <= NBITS)
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		* @details: Fail-fast policy: program exits if nPop > NBITS
+		**/
+		template<class ColT>
+		explicit FixedBitset(std::size_t nPop, const ColT& lv) noexcept { init(nPop, lv); }
+
+		explicit FixedBitset(std::size_t nPop, std::initializer_list<int> lv) noexcept { init(nPop, lv); }
+
+		//Move and copy semantics allowed (trivial)
+		FixedBitset(const FixedBitset&) = default;
+		FixedBitset& operator = (const FixedBitset&) = default;
+
+		~FixedBitset() = default;
+
+		////////////
+		//Reset / init (no memory allocation)
+
+		/**
+		* @brief Resets the bitset to nPop bits with value val
+		* @details: Fail-fast policy: program exits if nPop > NBITS
+		**/
+		void init(std::size_t nPop, bool val = false) noexcept;
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		* @details: Fail-fast policy: program exits if nPop > NBITS
+		**/
+		template<class ColT>
+		void init(std::size_t nPop, const ColT& lv) noexcept;
+
+		void reset(std::size_t nPop) noexcept { init(nPop, false); }
+		void reset(std::size_t nPop, const bitpos_list& lv) noexcept { init(nPop, lv); }
+
+		/**
+		* @brief no-op (storage is inline) - for compatibility with the Bitset interface
+		**/
+		void shrink_to_fit() noexcept {}
+
+		/////////////////////
+		//setters and getters
+
+		/**
+		* @brief returns the number of blocks of the bitset (NBB())
+		**/
+		int num_blocks() const noexcept { return NBB(); }
+
+		/**
+		* @brief returns the number of blocks of the bitset (NBB()) - std::size_t type
+		**/
+		std::size_t size() const noexcept { return static_cast<std::size_t>(NBB()); }
+
+		BITBOARD* data() noexcept { return vBB_; }
+		const BITBOARD* data() const noexcept { return vBB_; }
+
+		BITBOARD block(index_t blockID) const {
+			assert(blockID >= 0 && blockID < NBB());
+			return vBB_[blockID];
+		}
+		BITBOARD& block(index_t blockID) {
+			assert(blockID >= 0 && blockID < NBB());
+			return vBB_[blockID];
+		}
+
+		/////////////////
+		// data members
+
+	protected:
+		BITBOARD vBB_[NBB()];								//inline bitblocks
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation for generic code, must be in header file
+
+namespace bitgraph {
+
+	template<std::size_t NBITS>
+	inline
+	void FixedBitset<NBITS>::init(std::size_t nPop, bool val) noexcept {
+
+		if (nPop > NBITS) {
+			LOGG_ERROR("population size ", nPop, " exceeds the capacity ", NBITS, " - FixedBitset::init");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		this->erase_bit();
+		if (val && nPop > 0) {
+			this->set_bit(0, static_cast<int>(nPop) - 1);
+		}
+	}
+
+	template<std::size_t NBITS>
+	template<class ColT>
+	inline
+	void FixedBitset<NBITS>::init(std::size_t nPop, const ColT& lv) noexcept {
+
+		init(nPop, false);
+
+		//sets bit conveniently
+		for (auto& bit : lv) {
+
+			//////////////////
+			assert(bit >= 0 && bit < static_cast<int>(nPop));
+			/////////////////
+
+			this->set_bit(bit);
+		}
+	}
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// Bitblocks of FixedBitset for the bitscanning ranges
+// (overload of bbscan_iter.h and bbscan_fused.h, the read-only one is in _impl::DenseBase)
+//
+///////////////////////
+
+namespace bitgraph {
+
+	template<std::size_t NBITS>
+	inline
+	_impl::block_span<BITBOARD> blocks(FixedBitset<NBITS>& bb) {
+		return { bb.data(), FixedBitset<NBITS>::NBB() };
+	}
+
+}//end namespace bitgraph
+
+#endif
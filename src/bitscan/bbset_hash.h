@@ -0,0 +1,424 @@
+/**
+ * @file bbset_hash.h
+ * @brief Hashing and content equality of bitsets, and the TranspositionTable class from the BITSCAN library.
+ *		  Memoization of subproblems keyed by sets of vertices (e.g. candidate sets of a branch and bound search)
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: bitset_hash(bb) - 64-bit hash of the 1-bits of dense (Bitset, FixedBitset, WideBitset, CountedBitset, views)
+ *			 and sparse (BitsetSp) bitsets: XOR of a key per non-empty bitblock (bbkernel::hash_block), computed by
+ *			 the vectorized kernels (bbkernel::hash). Bitsets with the same 1-bits have the same hash, whatever
+ *			 their type or capacity.
+ * @details: Zobrist-style incremental update: the hash changes by hash_block(old, i) ^ hash_block(new, i) when
+ *			 bitblock i changes, e.g. h = bitset_hash_flip(h, bb.block(WDIV(v)), v) BEFORE flipping bit v in bb.
+ * @details: TranspositionTable<ValueT> - fixed-memory, lock-free table of (bitset, value) pairs:
+ *			 - buckets of WAYS slots selected by the hash, the keys are stored in full and verified on lookup
+ *			 - every slot is guarded by a sequence number (seqlock): readers never block and discard torn reads,
+ *			   a writer which finds the slot busy gives up (the table is a cache, an insertion may be lost)
+ *			 - replacement: the slot with the same key, otherwise an empty slot, otherwise a slot of the bucket
+ *			   chosen by the hash (always replace)
+ **/
+
+#ifndef __BBSET_HASH_H__
+#define __BBSET_HASH_H__
+
+#include "bbset.h"
+#include "bbset_sparse.h"
+#include "bbset_view.h"
+#include "bbkernel.h"
+#include "bitblock.h"
+#include "utils/logger.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	//////////////////////////
+	//
+	// Hashing
+	//
+	//////////////////////////
+
+	/**
+	* @brief 64-bit hash of the 1-bits of a dense bitset
+	**/
+	inline std::uint64_t bitset_hash(ConstBitsetView bb) {
+		return bbkernel::hash(bb.data(), bb.num_blocks(), 0);
+	}
+
+	/**
+	* @brief 64-bit hash of the 1-bits of a dense bitset type with read-only views (Bitset, FixedBitset, WideBitset...)
+	**/
+	template<class BitsetT>
+	inline auto bitset_hash(const BitsetT& bb) -> decltype(bb.cview(), std::uint64_t()) {
+		return bitset_hash(bb.cview());
+	}
+
+	/**
+	* @brief 64-bit hash of the 1-bits of a sparse bitset (same value as a dense bitset with the same 1-bits)
+	**/
+	inline std::uint64_t bitset_hash(const BitsetSp& bb) {
+		std::uint64_t h = 0;
+		for (const auto& blk : bb.bitset()) {
+			h ^= bbkernel::hash_block(blk.bb_, blk.idx_);
+		}
+		return h;
+	}
+
+	/**
+	* @brief incremental update of the hash h when bitblock blockID changes from oldBB to newBB
+	**/
+	inline std::uint64_t bitset_hash_update(std::uint64_t h, int blockID, BITBOARD oldBB, BITBOARD newBB) {
+		return h ^ bbkernel::hash_block(oldBB, blockID) ^ bbkernel::hash_block(newBB, blockID);
+	}
+
+	/**
+	* @brief incremental update of the hash h when bit is flipped (set or erased)
+	* @param block: bitblock WDIV(bit) BEFORE the flip
+	**/
+	inline std::uint64_t bitset_hash_flip(std::uint64_t h, BITBOARD block, int bit) {
+		return bitset_hash_update(h, WDIV(bit), block, block ^ bblock::MASK_BIT(WMOD(bit)));
+	}
+
+	//////////////////////////
+	//
+	// Content equality (the capacity is not taken into account)
+	//
+	//////////////////////////
+
+	/**
+	* @brief TRUE if lhs and rhs have the same 1-bits (their number of bitblocks may differ)
+	**/
+	inline bool same_bits(ConstBitsetView lhs, ConstBitsetView rhs) {
+		if (lhs.num_blocks() > rhs.num_blocks()) { std::swap(lhs, rhs); }
+		const int n = lhs.num_blocks();
+		if (n && std::memcmp(lhs.data(), rhs.data(), n * sizeof(BITBOARD)) != 0) { return false; }
+		return rhs.num_blocks() == n || rhs.subview(n, rhs.num_blocks() - 1).is_empty();
+	}
+
+	template<class BitsetT>
+	inline auto same_bits(const BitsetT& lhs, const BitsetT& rhs) -> decltype(lhs.cview(), bool()) {
+		return same_bits(lhs.cview(), rhs.cview());
+	}
+
+	/**
+	* @brief TRUE if lhs and rhs have the same 1-bits (empty bitblocks are skipped)
+	**/
+	inline bool same_bits(const BitsetSp& lhs, const BitsetSp& rhs) {
+		auto itl = lhs.bitset().begin(), itr = rhs.bitset().begin();
+		const auto endl = lhs.bitset().end(), endr = rhs.bitset().end();
+		while (true) {
+			while (itl != endl && !itl->bb_) { ++itl; }
+			while (itr != endr && !itr->bb_) { ++itr; }
+			if (itl == endl || itr == endr) { return itl == endl && itr == endr; }
+			if (itl->idx_ != itr->idx_ || itl->bb_ != itr->bb_) { return false; }
+			++itl;
+			++itr;
+		}
+	}
+
+	/**
+	* @brief hash and equality functors for unordered containers keyed by bitsets,
+	*		 e.g. std::unordered_set<Bitset, BitsetHash, BitsetEqual>
+	**/
+	struct BitsetHash {
+		template<class BitsetT>
+		std::size_t operator()(const BitsetT& bb) const { return static_cast<std::size_t>(bitset_hash(bb)); }
+	};
+
+	struct BitsetEqual {
+		template<class BitsetT>
+		bool operator()(const BitsetT& lhs, const BitsetT& rhs) const { return same_bits(lhs, rhs); }
+	};
+
+	/////////////////////////////////
+	//
+	// TranspositionTable class
+	//
+	// (fixed-memory, lock-free table of values keyed by bitsets of a given population size)
+	// @details ValueT must be trivially copyable and fit in 64 bits (e.g. a bound, a color count, a packed pair)
+	//
+	///////////////////////////////////
+
+	template<class ValueT>
+	class TranspositionTable {
+
+		static_assert(std::is_trivially_copyable<ValueT>::value && sizeof(ValueT) <= sizeof(std::uint64_t),
+						"TranspositionTable requires trivially copyable values of 64 bits or less");
+
+	public:
+
+		using value_type = ValueT;
+
+		enum : int {
+			WAYS = 4										//slots of a bucket
+		};
+
+		////////////
+		//construction / destruction
+
+		TranspositionTable() noexcept : nBB_(0), cap_(0) {}
+
+		/**
+		* @brief Creates an empty table for keys of population size nPop, with (at least) capacity slots
+		**/
+		TranspositionTable(std::size_t nPop, std::size_t capacity) : TranspositionTable() { reset(nPop, capacity); }
+
+		//atomics are not copyable
+		TranspositionTable(const TranspositionTable&) = delete;
+		TranspositionTable& operator = (const TranspositionTable&) = delete;
+		TranspositionTable(TranspositionTable&&) noexcept = default;
+		TranspositionTable& operator = (TranspositionTable&&) noexcept = default;
+
+		~TranspositionTable() = default;
+
+		/**
+		* @brief Reallocates an empty table for keys of population size nPop (not thread-safe)
+		* @param capacity: number of slots, rounded up to a power of 2 (WAYS at least)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void reset(std::size_t nPop, std::size_t capacity) noexcept;
+
+		/**
+		* @brief removes all the entries (not thread-safe)
+		**/
+		void clear() noexcept {
+			for (std::size_t i = 0; i < cap_; ++i) { slots_[i].seq.store(0, std::memory_order_relaxed); }
+		}
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks()			const noexcept { return nBB_; }
+		std::size_t capacity()		const noexcept { return cap_; }
+
+		/**
+		* @brief number of occupied slots, O(capacity) (approximate under concurrent insertion)
+		**/
+		std::size_t size() const noexcept;
+
+		/////////////////////
+		// Lookup (thread-safe)
+
+		/**
+		* @brief looks up the value of key
+		* @param h: bitset_hash(key), e.g. maintained incrementally by the caller
+		* @returns TRUE if found (val is set), FALSE otherwise
+		**/
+		bool find(ConstBitsetView key, std::uint64_t h, ValueT& val) const { return find_(key, h, val); }
+		bool find(ConstBitsetView key, ValueT& val) const { return find_(key, bitset_hash(key), val); }
+		bool find(const BitsetSp& key, std::uint64_t h, ValueT& val) const { return find_(key, h, val); }
+		bool find(const BitsetSp& key, ValueT& val) const { return find_(key, bitset_hash(key), val); }
+
+		/////////////////////
+		// Insertion (thread-safe, lossy)
+
+		/**
+		* @brief stores the value of key, replacing the previous value of key if any
+		* @param h: bitset_hash(key), e.g. maintained incrementally by the caller
+		* @returns TRUE if stored, FALSE if the slot was being written by another thread
+		**/
+		bool insert(ConstBitsetView key, std::uint64_t h, const ValueT& val) { return insert_(key, h, val); }
+		bool insert(ConstBitsetView key, const ValueT& val) { return insert_(key, bitset_hash(key), val); }
+		bool insert(const BitsetSp& key, std::uint64_t h, const ValueT& val) { return insert_(key, h, val); }
+		bool insert(const BitsetSp& key, const ValueT& val) { return insert_(key, bitset_hash(key), val); }
+
+		/////////////////
+		// data members
+	private:
+
+		using atomic_block = std::atomic<BITBOARD>;
+
+		struct slot_t {
+			std::atomic<std::uint64_t> seq{ 0 };			//0: empty, odd: being written, even: valid
+			std::atomic<std::uint64_t> hash{ 0 };
+			std::atomic<std::uint64_t> val{ 0 };
+		};
+
+		template<class KeyT>
+		bool find_(const KeyT& key, std::uint64_t h, ValueT& val) const;
+
+		template<class KeyT>
+		bool insert_(const KeyT& key, std::uint64_t h, const ValueT& val);
+
+		//first slot of the bucket of h
+		std::size_t bucket(std::uint64_t h) const noexcept {
+			return static_cast<std::size_t>(h) & (cap_ - 1) & ~static_cast<std::size_t>(WAYS - 1);
+		}
+
+		atomic_block* row(std::size_t slot) const noexcept { return keys_.get() + slot * nBB_; }
+
+		//key stored in row (relaxed loads, validated by the sequence number)
+		bool equal_key(const atomic_block* row, ConstBitsetView key) const noexcept;
+		bool equal_key(const atomic_block* row, const BitsetSp& key) const noexcept;
+		void store_key(atomic_block* row, ConstBitsetView key) noexcept;
+		void store_key(atomic_block* row, const BitsetSp& key) noexcept;
+
+		std::unique_ptr<slot_t[]> slots_;
+		std::unique_ptr<atomic_block[]> keys_;				//key of slot i: nBB_ bitblocks from i * nBB_
+		int nBB_;											//number of bitblocks of the keys
+		std::size_t cap_;									//number of slots (power of 2)
+	};
+
+	///////////////////////
+	// TranspositionTable - implementation
+
+	template<class ValueT>
+	inline
+	void TranspositionTable<ValueT>::reset(std::size_t nPop, std::size_t capacity) noexcept {
+
+		std::size_t cap = WAYS;
+		while (cap < capacity) { cap <<= 1; }
+
+		nBB_ = static_cast<int>(INDEX_1TO1(nPop));
+		cap_ = cap;
+
+		try {
+			slots_.reset(new slot_t[cap_]);
+			keys_.reset(new atomic_block[cap_ * nBB_]);
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - TranspositionTable::reset");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		for (std::size_t i = 0; i < cap_ * nBB_; ++i) { keys_[i].store(ZERO, std::memory_order_relaxed); }
+	}
+
+	template<class ValueT>
+	inline
+	std::size_t TranspositionTable<ValueT>::size() const noexcept {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < cap_; ++i) {
+			if (slots_[i].seq.load(std::memory_order_relaxed) != 0) { ++n; }
+		}
+		return n;
+	}
+
+	template<class ValueT>
+	template<class KeyT>
+	inline
+	bool TranspositionTable<ValueT>::find_(const KeyT& key, std::uint64_t h, ValueT& val) const {
+
+		const std::size_t first = bucket(h);
+		for (std::size_t i = first; i < first + WAYS; ++i) {
+			const slot_t& s = slots_[i];
+
+			const std::uint64_t seq = s.seq.load(std::memory_order_acquire);
+			if (seq == 0 || (seq & 1)) { continue; }
+			if (s.hash.load(std::memory_order_relaxed) != h || !equal_key(row(i), key)) { continue; }
+			const std::uint64_t v = s.val.load(std::memory_order_relaxed);
+
+			//discards the read if a writer has modified the slot meanwhile
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (s.seq.load(std::memory_order_relaxed) != seq) { continue; }
+
+			std::memcpy(&val, &v, sizeof(ValueT));
+			return true;
+		}
+
+		return false;
+	}
+
+	template<class ValueT>
+	template<class KeyT>
+	inline
+	bool TranspositionTable<ValueT>::insert_(const KeyT& key, std::uint64_t h, const ValueT& val) {
+
+		const std::size_t first = bucket(h);
+
+		//slot with the same key, otherwise the first empty slot, otherwise a slot chosen by the hash
+		std::size_t target = first + static_cast<std::size_t>((h >> 32) & (WAYS - 1));
+		bool empty = false;
+		for (std::size_t i = first; i < first + WAYS; ++i) {
+			const std::uint64_t seq = slots_[i].seq.load(std::memory_order_acquire);
+			if (seq == 0) {
+				if (!empty) { target = i; empty = true; }
+				continue;
+			}
+			if (!(seq & 1) && slots_[i].hash.load(std::memory_order_relaxed) == h && equal_key(row(i), key)) {
+				target = i;
+				break;
+			}
+		}
+
+		//acquires the slot (odd sequence number)
+		slot_t& s = slots_[target];
+		std::uint64_t seq = s.seq.load(std::memory_order_relaxed);
+		if ((seq & 1) || !s.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+			return false;
+		}
+		std::atomic_thread_fence(std::memory_order_release);
+
+		std::uint64_t v = 0;
+		std::memcpy(&v, &val, sizeof(ValueT));
+		s.hash.store(h, std::memory_order_relaxed);
+		store_key(row(target), key);
+		s.val.store(v, std::memory_order_relaxed);
+
+		//publishes the slot (even sequence number)
+		s.seq.store(seq + 2, std::memory_order_release);
+		return true;
+	}
+
+	template<class ValueT>
+	inline
+	bool TranspositionTable<ValueT>::equal_key(const atomic_block* row, ConstBitsetView key) const noexcept {
+		assert(key.num_blocks() <= nBB_);
+		int i = 0;
+		for (; i < key.num_blocks(); ++i) {
+			if (row[i].load(std::memory_order_relaxed) != key.block(i)) { return false; }
+		}
+		for (; i < nBB_; ++i) {
+			if (row[i].load(std::memory_order_relaxed) != ZERO) { return false; }
+		}
+		return true;
+	}
+
+	template<class ValueT>
+	inline
+	bool TranspositionTable<ValueT>::equal_key(const atomic_block* row, const BitsetSp& key) const noexcept {
+		int i = 0;
+		for (const auto& blk : key.bitset()) {
+			assert(blk.idx_ < nBB_);
+			for (; i < blk.idx_; ++i) {
+				if (row[i].load(std::memory_order_relaxed) != ZERO) { return false; }
+			}
+			if (row[i++].load(std::memory_order_relaxed) != blk.bb_) { return false; }
+		}
+		for (; i < nBB_; ++i) {
+			if (row[i].load(std::memory_order_relaxed) != ZERO) { return false; }
+		}
+		return true;
+	}
+
+	template<class ValueT>
+	inline
+	void TranspositionTable<ValueT>::store_key(atomic_block* row, ConstBitsetView key) noexcept {
+		assert(key.num_blocks() <= nBB_);
+		int i = 0;
+		for (; i < key.num_blocks(); ++i) { row[i].store(key.block(i), std::memory_order_relaxed); }
+		for (; i < nBB_; ++i) { row[i].store(ZERO, std::memory_order_relaxed); }
+	}
+
+	template<class ValueT>
+	inline
+	void TranspositionTable<ValueT>::store_key(atomic_block* row, const BitsetSp& key) noexcept {
+		int i = 0;
+		for (const auto& blk : key.bitset()) {
+			assert(blk.idx_ < nBB_);
+			for (; i < blk.idx_; ++i) { row[i].store(ZERO, std::memory_order_relaxed); }
+			row[i++].store(blk.bb_, std::memory_order_relaxed);
+		}
+		for (; i < nBB_; ++i) { row[i].store(ZERO, std::memory_order_relaxed); }
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_HASH_H__
@@ -0,0 +1,1844 @@
+/**
+ * @file bbset_hybrid.h
+ * @brief header file of the HybridBitset class from the BITSCAN library.
+ *		  Adaptive (roaring-style) bitset: the population is split in chunks of CHUNK_BITS = 4096 bits and every
+ *		  non-empty chunk is stored as a sorted array of 16-bit offsets (ARRAY), 64 bitblocks (DENSE) or runs of 1-bits (RUN)
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The representation of each chunk is chosen automatically:
+ *			 - ARRAY chunks become DENSE when they exceed ARRAY_MAX = 256 elements (512 bytes, the size of a DENSE chunk)
+ *			 - DENSE chunks become ARRAY when they drop to ARRAY_MAX / 2 elements (hysteresis)
+ *			 - range operations (set_bit(first, last)...), the set operations (AND, OR, erase_bit) and shrink_to_fit()
+ *			   encode every chunk they write in its smallest representation, RUN included (e.g. set_bit(0, N - 1))
+ *			 Intended for the rows of large graphs with heavy-tailed degrees: leaves take a few bytes per neighbor,
+ *			 hubs take dense bitblocks.
+ * @details: The payloads of the chunks are packed in two pools (16-bit values for ARRAY / RUN, bitblocks for DENSE)
+ *			 in chunk order - 16 bytes of header per chunk, no allocation per chunk.
+ * @details: The chunks have no bitblock layout, so only the aliases, the bitscanning cache and the I/O of BBScan are
+ *			 inherited (_impl::ScanBase, bbset_dense.h); the rest of the interface is implemented on the chunks
+ *			 (see graph/simple_hybrid_ugraph.h). Bitscanning ranges and fused operations (bits(bb), bits_and(a, b),
+ *			 count_and(a, b)...) are overloaded at the end of the file.
+ **/
+
+#ifndef __BBSET_HYBRID_H__
+#define __BBSET_HYBRID_H__
+
+#include "bbset_dense.h"
+#include "bbscan_fused.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <initializer_list>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// HybridBitset class
+	//
+	// (adaptive bitset: ARRAY, DENSE or RUN chunks of 4096 bits)
+	//
+	///////////////////////////////////
+
+	class HybridBitset : public _impl::ScanBase<HybridBitset> {
+
+	public:
+
+		//representations of a chunk
+		enum chunk_types : std::uint8_t { ARRAY = 0, DENSE, RUN };
+
+		enum : int {
+			CHUNK_SHIFT = 12,
+			CHUNK_BITS = 1 << CHUNK_SHIFT,					//bits per chunk (4096)
+			CHUNK_MASK = CHUNK_BITS - 1,
+			CHUNK_BLOCKS = CHUNK_BITS / WORD_SIZE,			//bitblocks of a DENSE chunk (64)
+			ARRAY_MAX = 256,								//maximum number of elements of an ARRAY chunk
+			RUN_MAX = 128									//maximum number of runs of a RUN chunk
+		};
+
+		struct Chunk {
+			std::uint32_t key_;								//chunk index (bit / CHUNK_BITS)
+			std::uint32_t off_;								//offset of the payload in the pool of values (ARRAY, RUN) or bitblocks (DENSE)
+			std::uint16_t card_;							//number of 1-bits [1, CHUNK_BITS]
+			std::uint16_t n_;								//number of values: elements (ARRAY), 2 x runs (RUN), 0 (DENSE)
+			chunk_types type_;
+		};
+
+		/////////////////////////////
+		// Independent operators / masks
+		// comment: do not modify this bitset
+
+		/**
+		* @brief AND between lhs and rhs bitsets, stores the result in res (the capacity of res is set to that of lhs)
+		* @details: ARRAY chunks are merged or filtered, the rest are intersected bitblock by bitblock
+		* @returns reference to the resulting bitstring res
+		**/
+		friend HybridBitset& AND(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+
+		/**
+		* @brief AND between lhs and rhs bitsets
+		* @returns resulting bitset
+		**/
+		friend HybridBitset AND(const HybridBitset& lhs, const HybridBitset& rhs) {
+			HybridBitset res;
+			AND(lhs, rhs, res);
+			return res;
+		}
+
+		/**
+		* @brief OR between lhs and rhs bitsets, stores the result in res (the capacity of res is set to that of lhs)
+		* @returns reference to the resulting bitstring res
+		**/
+		friend HybridBitset& OR(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+
+		/**
+		* @brief Removes the 1-bits in the bitstring rhs from the bitstring lhs. Stores
+		*		 the result in res (the capacity of res is set to that of lhs)
+		* @returns reference to the resulting bitstring res
+		**/
+		friend HybridBitset& erase_bit(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+
+		/**
+		* @brief number of 1-bits in lhs & rhs, no bitset is built
+		**/
+		friend int count_and(const HybridBitset& lhs, const HybridBitset& rhs);
+
+		/**
+		* @brief Determines the first bit of the itersection between bitsets lhs and rhs
+		* @returns the first BIT of the intersection or BBObject::noBit if the sets are disjoint
+		**/
+		friend int find_first_common(const HybridBitset& lhs, const HybridBitset& rhs);
+
+		/**
+		* @brief equality of the 1-bits (the chunks may have different representations)
+		**/
+		friend bool operator == (const HybridBitset& lhs, const HybridBitset& rhs);
+
+		////////////
+		//construction / destruction
+
+		HybridBitset() noexcept : nBB_(0) {}
+
+		/**
+		* @brief Creates an EMPTY bitset given a population size nPop
+		**/
+		explicit HybridBitset(int nPop) : nBB_(INDEX_1TO1(nPop)) {}
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		**/
+		template<class ColT>
+		explicit HybridBitset(int nPop, const ColT& lv) : nBB_(INDEX_1TO1(nPop)) { set_bit(lv); }
+
+		explicit HybridBitset(int nPop, std::initializer_list<int> lv) : nBB_(INDEX_1TO1(nPop)) { set_bit(lv); }
+
+		//Move and copy semantics allowed
+		HybridBitset(const HybridBitset&) = default;
+		HybridBitset(HybridBitset&&) noexcept = default;
+		HybridBitset& operator = (const HybridBitset&) = default;
+		HybridBitset& operator = (HybridBitset&&) noexcept = default;
+
+		~HybridBitset() = default;
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Resets the bitset to an EMPTY bitset of population size nPop
+		**/
+		void reset(int nPop) {
+			erase_bit();
+			nBB_ = INDEX_1TO1(nPop);
+		}
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		**/
+		void reset(int nPop, const bitpos_list& lv) {
+			reset(nPop);
+			set_bit(lv);
+		}
+
+		/**
+		* @brief encodes every chunk in its smallest representation and releases the unused capacity of the pools
+		**/
+		void shrink_to_fit();
+
+		/////////////////////
+		//setters and getters
+
+		/**
+		* @brief maximum number of bitblocks of the bitset (capacity)
+		**/
+		int num_blocks() const noexcept { return nBB_; }
+
+		/**
+		* @brief number of non-empty chunks
+		**/
+		std::size_t size() const noexcept { return chunks_.size(); }
+
+		const std::vector<Chunk>& chunks() const noexcept { return chunks_; }
+
+		/**
+		* @brief payload of an ARRAY (sorted offsets) or RUN (pairs first, last - closed range) chunk
+		**/
+		const std::uint16_t* chunk_values(const Chunk& c) const noexcept { return vals_.data() + c.off_; }
+
+		/**
+		* @brief payload of a DENSE chunk (CHUNK_BLOCKS bitblocks)
+		**/
+		const BITBOARD* chunk_blocks(const Chunk& c) const noexcept { return words_.data() + c.off_; }
+
+		/**
+		* @brief number of bytes of the chunk headers and payloads (unused capacity excluded)
+		**/
+		std::size_t num_bytes() const noexcept {
+			return chunks_.size() * sizeof(Chunk) + vals_.size() * sizeof(std::uint16_t) + words_.size() * sizeof(BITBOARD);
+		}
+
+		/**
+		* @brief returns the bitblock of index blockID (the chunk is searched - O(log) access)
+		**/
+		BITBOARD block(index_t blockID) const;
+
+		//////////////////////////////
+		// Bitscanning (stateless)
+
+		/**
+		* @brief returns the index of the least significant bit in the bitstring, BBObject::noBit if empty
+		**/
+		int lsb() const;
+
+		/**
+		* @brief returns the index of the most significant bit in the bitstring, BBObject::noBit if empty
+		**/
+		int msb() const;
+
+		/**
+		* @brief Computes the next least significant 1-bit in the bitstring after bit
+		*		 If bit == BBObject::noBit, returns the lest significant bit in the bitstring.
+		* @returns the next 1-bit in the bitstring after bit, BBObject::noBit if there are no more bits
+		**/
+		int next_bit(int bit) const;
+
+		/**
+		* @brief Computes the next most significant 1-bit in the bitstring before bit
+		*		 If bit == BBObject::noBit, returns the most significant bit in the bitstring.
+		* @returns the next 1-bit in the bitstring before bit, BBObject::noBit if there are no more bits
+		**/
+		int prev_bit(int bit) const;
+
+		//////////////////////////////
+		// Bitscanning (with cached info - same semantics as BBScan)
+
+		/**
+		* @brief Configures the initial block and bit position for bitscanning
+		*		 according to one of the 4 scan types passed as argument
+		* @returns -1 if the bitset is empty, 0 otherwise
+		**/
+		int init_scan(scan_types sct) noexcept;
+
+		/**
+		* @brief Configures the initial block and bit position for bitscanning
+		*		 starting from firstBit (not included in non-destructive scans)
+		* @returns -1 if the bitset is empty, 0 otherwise
+		**/
+		int init_scan(int firstBit, scan_types sct) noexcept;
+
+		int next_bit();
+		int next_bit(HybridBitset& bitset);
+		int next_bit_del();
+		int next_bit_del(HybridBitset& bitset);
+		int prev_bit();
+		int prev_bit(HybridBitset& bitset);
+		int prev_bit_del();
+		int prev_bit_del(HybridBitset& bitset);
+
+		/////////////////
+		// Popcount
+
+		/**
+		* @brief number of 1-bits in the bitset (sum of the cardinalities of the chunks)
+		**/
+		int count() const noexcept;
+		int popcn64() const noexcept { return count(); }
+
+		/**
+		* @brief number of 1-bits in the closed range [firstBit, lastBit]
+		*		 If lastBit == -1, the range is [firstBit, end of the bitset)
+		**/
+		int count(int firstBit, int lastBit = -1) const;
+		int popcn64(int firstBit, int lastBit = -1) const { return count(firstBit, lastBit); }
+
+		/////////////////////
+		// Setting / Erasing bits
+
+		HybridBitset& set_bit(int bit);
+
+		/**
+		* @brief sets the bits in the closed range [firstBit, lastBit]
+		**/
+		HybridBitset& set_bit(int firstBit, int lastBit);
+
+		/**
+		* @brief sets the bits of a collection of 1-bit elements
+		**/
+		template<class ColT>
+		HybridBitset& set_bit(const ColT& lv) {
+			for (auto bit : lv) {
+				set_bit(static_cast<int>(bit));
+			}
+			return *this;
+		}
+
+		HybridBitset& set_bit(std::initializer_list<int> lv) {
+			for (auto bit : lv) {
+				set_bit(bit);
+			}
+			return *this;
+		}
+
+		HybridBitset& set_bit(const HybridBitset& rhs) { return *this |= rhs; }
+
+		HybridBitset& erase_bit(int bit);
+
+		/**
+		* @brief erases the bits in the closed range [firstBit, lastBit]
+		*		 If lastBit == -1, the range is [firstBit, end of the bitset)
+		**/
+		HybridBitset& erase_bit(int firstBit, int lastBit);
+
+		/**
+		* @brief erases all the bits (the capacity of the pools is kept)
+		**/
+		HybridBitset& erase_bit() noexcept {
+			chunks_.clear();
+			vals_.clear();
+			words_.clear();
+			return *this;
+		}
+
+		/**
+		* @brief erases the 1-bits of rhs
+		**/
+		HybridBitset& erase_bit(const HybridBitset& rhs);
+
+		HybridBitset& operator &= (const HybridBitset& rhs);
+		HybridBitset& operator |= (const HybridBitset& rhs);
+
+		/////////////////////
+		// Boolean functions
+
+		bool is_bit(int bit) const;
+
+		bool is_empty() const noexcept { return chunks_.empty(); }
+
+		bool is_singleton() const noexcept { return (chunks_.size() == 1 && chunks_[0].card_ == 1); }
+
+		/**
+		* @brief TRUE if this bitset and rhs have no common 1-bits
+		**/
+		bool is_disjoint(const HybridBitset& rhs) const { return (find_first_common(*this, rhs) == BBObject::noBit); }
+
+		/////////////////////
+		// Conversions
+
+		/**
+		* @brief converts the bitset to a vector of 1-bit elements (in increasing order), chunk by chunk
+		**/
+		void extract(bitpos_list& lb) const;
+
+		/////////////////////
+		// Chunk level operations (the local bit of a chunk is in [0, CHUNK_BITS))
+
+		/**
+		* @brief copies the content of chunk c in the CHUNK_BLOCKS bitblocks w
+		**/
+		void chunk_to_blocks(const Chunk& c, BITBOARD* w) const noexcept;
+
+		bool chunk_contains(const Chunk& c, int local) const noexcept;
+
+		/**
+		* @brief smallest element of chunk c >= local, -1 if none
+		**/
+		int chunk_next(const Chunk& c, int local) const noexcept;
+
+		/**
+		* @brief greatest element of chunk c <= local, -1 if none
+		**/
+		int chunk_prev(const Chunk& c, int local) const noexcept;
+
+		int chunk_min(const Chunk& c) const noexcept;
+		int chunk_max(const Chunk& c) const noexcept;
+
+		/**
+		* @brief smallest representation of the chunk given by the CHUNK_BLOCKS bitblocks w
+		* @param buf: values of the ARRAY / RUN representation (capacity >= ARRAY_MAX)
+		* @param n: number of values in buf
+		* @returns the number of 1-bits of the chunk (0 if empty)
+		**/
+		static int encode(const BITBOARD* w, std::uint16_t* buf, int& n, chunk_types& type) noexcept;
+
+		/////////////////////
+		// private helpers
+
+	private:
+
+		/**
+		* @brief position of the first chunk with key >= key (lower bound)
+		**/
+		int find_chunk_pos(std::uint32_t key) const noexcept;
+
+		/**
+		* @brief first 1-bit >= start, searching from the chunk at position pos (the lower bound of the chunk of start)
+		*		 On output pos is the position of the chunk of the 1-bit found
+		**/
+		int next_from(int& pos, int start) const noexcept;
+
+		//offset in the pool (dense or not) of the payload of the first chunk from position pos in that pool
+		std::uint32_t payload_offset(int pos, bool dense) const noexcept;
+		void shift_offsets(int pos, bool dense, int delta) noexcept;
+
+		//removes the payload of the chunk at pos from its pool
+		void erase_payload(int pos);
+
+		//sets the payload of the chunk at pos (without payload)
+		void insert_payload(int pos, chunk_types type, const std::uint16_t* v, int n, const BITBOARD* w);
+
+		//replaces the chunk at pos by the bitblocks w in their smallest representation - removes the chunk if empty
+		void store_chunk(int pos, const BITBOARD* w);
+
+		//appends a new last chunk
+		void append_chunk(std::uint32_t key, chunk_types type, int card, const std::uint16_t* v, int n, const BITBOARD* w);
+		void append_chunk(std::uint32_t key, const BITBOARD* w);
+		void append_chunk(const HybridBitset& src, const Chunk& c);
+
+		//sets the 1-bits of the closed range [first, last] of a chunk in the bitblocks w
+		static void set_range(BITBOARD* w, int first, int last) noexcept;
+
+		//scratch bitset of the in-place set operations
+		static HybridBitset& scratch() {
+			static thread_local HybridBitset bbs;
+			return bbs;
+		}
+
+		/////////////////
+		// data members
+
+		std::vector<Chunk> chunks_;							//non-empty chunks, sorted by key
+		std::vector<std::uint16_t> vals_;					//payloads of the ARRAY and RUN chunks (in chunk order)
+		std::vector<BITBOARD> words_;						//payloads of the DENSE chunks (in chunk order)
+		int nBB_;											//maximum number of bitblocks
+
+		int scanBit_ = BBObject::noBit;						//last bit scanned
+		int scanPos_ = 0;									//chunk of the last bit scanned (forward scans)
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation, must be in header file
+
+namespace bitgraph {
+
+	//set operations (used by the in-place operators)
+	HybridBitset& AND(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+	HybridBitset& OR(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+	HybridBitset& erase_bit(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res);
+
+	/////////////////////
+	// Chunk level operations
+
+	inline
+	void HybridBitset::set_range(BITBOARD* w, int first, int last) noexcept {
+
+		const int bbl = WDIV(first);
+		const int bbh = WDIV(last);
+
+		if (bbl == bbh) {
+			w[bbl] |= bblock::MASK_1(first - WMUL(bbl), last - WMUL(bbh));
+			return;
+		}
+
+		w[bbl] |= bblock::MASK_1(first - WMUL(bbl), WORD_SIZE_MINUS_ONE);
+		for (int i = bbl + 1; i < bbh; ++i) {
+			w[i] = ONE;
+		}
+		w[bbh] |= bblock::MASK_1(0, last - WMUL(bbh));
+	}
+
+	inline
+	void HybridBitset::chunk_to_blocks(const Chunk& c, BITBOARD* w) const noexcept {
+
+		if (c.type_ == DENSE) {
+			std::copy(chunk_blocks(c), chunk_blocks(c) + CHUNK_BLOCKS, w);
+			return;
+		}
+
+		std::fill(w, w + CHUNK_BLOCKS, ZERO);
+		const std::uint16_t* p = chunk_values(c);
+		if (c.type_ == ARRAY) {
+			for (int i = 0; i < c.n_; ++i) {
+				w[p[i] >> 6] |= (static_cast<BITBOARD>(1) << (p[i] & 63));
+			}
+		}
+		else {
+			for (int i = 0; i < c.n_; i += 2) {
+				set_range(w, p[i], p[i + 1]);
+			}
+		}
+	}
+
+	inline
+	bool HybridBitset::chunk_contains(const Chunk& c, int local) const noexcept {
+
+		switch (c.type_) {
+		case DENSE:
+			return (chunk_blocks(c)[local >> 6] & (static_cast<BITBOARD>(1) << (local & 63)));
+		case ARRAY:
+			return std::binary_search(chunk_values(c), chunk_values(c) + c.n_, static_cast<std::uint16_t>(local));
+		default:
+		{
+			//last run which starts at or before local
+			const std::uint16_t* p = chunk_values(c);
+			int lo = 0, hi = c.n_ / 2;
+			while (lo < hi) {
+				const int mid = (lo + hi) >> 1;
+				if (p[2 * mid] <= local) { lo = mid + 1; }
+				else { hi = mid; }
+			}
+			return (lo > 0 && local <= p[2 * lo - 1]);
+		}
+		}
+	}
+
+	inline
+	int HybridBitset::chunk_next(const Chunk& c, int local) const noexcept {
+
+		switch (c.type_) {
+		case DENSE:
+		{
+			const BITBOARD* w = chunk_blocks(c);
+			int i = local >> 6;
+			BITBOARD bb = w[i] & (ONE << (local & 63));
+			while (!bb) {
+				if (++i == CHUNK_BLOCKS) { return -1; }
+				bb = w[i];
+			}
+			return bblock::lsb(bb) + WMUL(i);
+		}
+		case ARRAY:
+		{
+			const std::uint16_t* p = chunk_values(c);
+			const std::uint16_t* it = std::lower_bound(p, p + c.n_, static_cast<std::uint16_t>(local));
+			return (it == p + c.n_) ? -1 : *it;
+		}
+		default:
+		{
+			const std::uint16_t* p = chunk_values(c);
+			const int nRuns = c.n_ / 2;
+			int lo = 0, hi = nRuns;
+			while (lo < hi) {
+				const int mid = (lo + hi) >> 1;
+				if (p[2 * mid] <= local) { lo = mid + 1; }
+				else { hi = mid; }
+			}
+			if (lo > 0 && local <= p[2 * lo - 1]) { return local; }		//inside the run lo - 1
+			return (lo < nRuns) ? p[2 * lo] : -1;
+		}
+		}
+	}
+
+	inline
+	int HybridBitset::chunk_prev(const Chunk& c, int local) const noexcept {
+
+		switch (c.type_) {
+		case DENSE:
+		{
+			const BITBOARD* w = chunk_blocks(c);
+			int i = local >> 6;
+			BITBOARD bb = w[i] & (ONE >> (63 - (local & 63)));
+			while (!bb) {
+				if (--i < 0) { return -1; }
+				bb = w[i];
+			}
+			return bblock::msb(bb) + WMUL(i);
+		}
+		case ARRAY:
+		{
+			const std::uint16_t* p = chunk_values(c);
+			const std::uint16_t* it = std::upper_bound(p, p + c.n_, static_cast<std::uint16_t>(local));
+			return (it == p) ? -1 : *(it - 1);
+		}
+		default:
+		{
+			const std::uint16_t* p = chunk_values(c);
+			int lo = 0, hi = c.n_ / 2;
+			while (lo < hi) {
+				const int mid = (lo + hi) >> 1;
+				if (p[2 * mid] <= local) { lo = mid + 1; }
+				else { hi = mid; }
+			}
+			return (lo == 0) ? -1 : std::min<int>(local, p[2 * lo - 1]);
+		}
+		}
+	}
+
+	inline
+	int HybridBitset::chunk_min(const Chunk& c) const noexcept {
+		return (c.type_ == DENSE) ? chunk_next(c, 0) : chunk_values(c)[0];
+	}
+
+	inline
+	int HybridBitset::chunk_max(const Chunk& c) const noexcept {
+		return (c.type_ == DENSE) ? chunk_prev(c, CHUNK_MASK) : chunk_values(c)[c.n_ - 1];
+	}
+
+	inline
+	int HybridBitset::encode(const BITBOARD* w, std::uint16_t* buf, int& n, chunk_types& type) noexcept {
+
+		n = 0;
+		type = DENSE;
+		const int card = bbkernel::popcount(w, CHUNK_BLOCKS);
+		if (card == 0) {
+			return 0;
+		}
+
+		//number of runs (1-bits preceded by a 0-bit)
+		int nRuns = 0;
+		BITBOARD carry = ZERO;
+		for (int i = 0; i < CHUNK_BLOCKS; ++i) {
+			nRuns += bblock::popc64(w[i] & ~((w[i] << 1) | carry));
+			carry = w[i] >> 63;
+		}
+
+		//sizes in 16-bit values (DENSE = 4 x CHUNK_BLOCKS)
+		const int szDense = 4 * CHUNK_BLOCKS;
+		const int szArray = (card <= ARRAY_MAX) ? card : szDense + 1;
+		const int szRun = (nRuns <= RUN_MAX) ? 2 * nRuns : szDense + 1;
+
+		if (szRun < szArray && szRun < szDense) {
+
+			//runs: k-th start paired with the k-th end
+			type = RUN;
+			int ns = 0, ne = 0;
+			carry = ZERO;
+			for (int i = 0; i < CHUNK_BLOCKS; ++i) {
+				const BITBOARD next = (i + 1 < CHUNK_BLOCKS) ? (w[i + 1] << 63) : ZERO;
+				BITBOARD starts = w[i] & ~((w[i] << 1) | carry);
+				BITBOARD ends = w[i] & ~((w[i] >> 1) | next);
+				carry = w[i] >> 63;
+				while (starts) {
+					buf[2 * ns++] = static_cast<std::uint16_t>(bblock::lsb(starts) + WMUL(i));
+					starts &= starts - 1;
+				}
+				while (ends) {
+					buf[2 * ne++ + 1] = static_cast<std::uint16_t>(bblock::lsb(ends) + WMUL(i));
+					ends &= ends - 1;
+				}
+			}
+			n = 2 * nRuns;
+		}
+		else if (card <= ARRAY_MAX) {
+			type = ARRAY;
+			for (int i = 0; i < CHUNK_BLOCKS; ++i) {
+				BITBOARD bb = w[i];
+				while (bb) {
+					buf[n++] = static_cast<std::uint16_t>(bblock::lsb(bb) + WMUL(i));
+					bb &= bb - 1;
+				}
+			}
+		}
+
+		return card;
+	}
+
+	/////////////////////
+	// Pools
+
+	inline
+	int HybridBitset::find_chunk_pos(std::uint32_t key) const noexcept {
+		auto it = std::lower_bound(chunks_.begin(), chunks_.end(), key,
+			[](const Chunk& c, std::uint32_t k) { return c.key_ < k; });
+		return static_cast<int>(it - chunks_.begin());
+	}
+
+	inline
+	std::uint32_t HybridBitset::payload_offset(int pos, bool dense) const noexcept {
+		for (int i = pos; i < static_cast<int>(chunks_.size()); ++i) {
+			if ((chunks_[i].type_ == DENSE) == dense) {
+				return chunks_[i].off_;
+			}
+		}
+		return static_cast<std::uint32_t>(dense ? words_.size() : vals_.size());
+	}
+
+	inline
+	void HybridBitset::shift_offsets(int pos, bool dense, int delta) noexcept {
+		for (int i = pos; i < static_cast<int>(chunks_.size()); ++i) {
+			if ((chunks_[i].type_ == DENSE) == dense) {
+				chunks_[i].off_ += delta;
+			}
+		}
+	}
+
+	inline
+	void HybridBitset::erase_payload(int pos) {
+
+		Chunk& c = chunks_[pos];
+		if (c.type_ == DENSE) {
+			words_.erase(words_.begin() + c.off_, words_.begin() + c.off_ + CHUNK_BLOCKS);
+			shift_offsets(pos + 1, true, -CHUNK_BLOCKS);
+		}
+		else {
+			vals_.erase(vals_.begin() + c.off_, vals_.begin() + c.off_ + c.n_);
+			shift_offsets(pos + 1, false, -static_cast<int>(c.n_));
+		}
+		c.type_ = ARRAY;
+		c.n_ = 0;
+	}
+
+	inline
+	void HybridBitset::insert_payload(int pos, chunk_types type, const std::uint16_t* v, int n, const BITBOARD* w) {
+
+		const bool dense = (type == DENSE);
+		const std::uint32_t off = payload_offset(pos + 1, dense);
+		if (dense) {
+			words_.insert(words_.begin() + off, w, w + CHUNK_BLOCKS);
+			shift_offsets(pos + 1, true, CHUNK_BLOCKS);
+		}
+		else {
+			vals_.insert(vals_.begin() + off, v, v + n);
+			shift_offsets(pos + 1, false, n);
+		}
+
+		Chunk& c = chunks_[pos];
+		c.type_ = type;
+		c.off_ = off;
+		c.n_ = static_cast<std::uint16_t>(dense ? 0 : n);
+	}
+
+	inline
+	void HybridBitset::store_chunk(int pos, const BITBOARD* w) {
+
+		std::uint16_t buf[ARRAY_MAX];
+		int n = 0;
+		chunk_types type;
+		const int card = encode(w, buf, n, type);
+
+		//DENSE to DENSE - in place
+		if (card && type == DENSE && chunks_[pos].type_ == DENSE) {
+			std::copy(w, w + CHUNK_BLOCKS, words_.begin() + chunks_[pos].off_);
+			chunks_[pos].card_ = static_cast<std::uint16_t>(card);
+			return;
+		}
+
+		erase_payload(pos);
+		if (card == 0) {
+			chunks_.erase(chunks_.begin() + pos);
+			return;
+		}
+		insert_payload(pos, type, buf, n, w);
+		chunks_[pos].card_ = static_cast<std::uint16_t>(card);
+	}
+
+	inline
+	void HybridBitset::append_chunk(std::uint32_t key, chunk_types type, int card, const std::uint16_t* v, int n, const BITBOARD* w) {
+
+		Chunk c;
+		c.key_ = key;
+		c.card_ = static_cast<std::uint16_t>(card);
+		c.type_ = type;
+		if (type == DENSE) {
+			c.off_ = static_cast<std::uint32_t>(words_.size());
+			c.n_ = 0;
+			words_.insert(words_.end(), w, w + CHUNK_BLOCKS);
+		}
+		else {
+			c.off_ = static_cast<std::uint32_t>(vals_.size());
+			c.n_ = static_cast<std::uint16_t>(n);
+			vals_.insert(vals_.end(), v, v + n);
+		}
+		chunks_.push_back(c);
+	}
+
+	inline
+	void HybridBitset::append_chunk(std::uint32_t key, const BITBOARD* w) {
+
+		std::uint16_t buf[ARRAY_MAX];
+		int n = 0;
+		chunk_types type;
+		const int card = encode(w, buf, n, type);
+		if (card) {
+			append_chunk(key, type, card, buf, n, w);
+		}
+	}
+
+	inline
+	void HybridBitset::append_chunk(const HybridBitset& src, const Chunk& c) {
+		append_chunk(c.key_, c.type_, c.card_, src.chunk_values(c), c.n_, src.chunk_blocks(c));
+	}
+
+	inline
+	void HybridBitset::shrink_to_fit() {
+
+		HybridBitset& tmp = scratch();
+		tmp.erase_bit();
+		tmp.nBB_ = nBB_;
+
+		BITBOARD w[CHUNK_BLOCKS];
+		for (const auto& c : chunks_) {
+			chunk_to_blocks(c, w);
+			tmp.append_chunk(c.key_, w);
+		}
+
+		chunks_.assign(tmp.chunks_.begin(), tmp.chunks_.end());
+		vals_.assign(tmp.vals_.begin(), tmp.vals_.end());
+		words_.assign(tmp.words_.begin(), tmp.words_.end());
+		chunks_.shrink_to_fit();
+		vals_.shrink_to_fit();
+		words_.shrink_to_fit();
+	}
+
+	/////////////////////
+	// Bitscanning
+
+	inline
+	BITBOARD HybridBitset::block(index_t blockID) const {
+
+		const std::uint32_t key = blockID / CHUNK_BLOCKS;
+		const int pos = find_chunk_pos(key);
+		if (pos == static_cast<int>(chunks_.size()) || chunks_[pos].key_ != key) {
+			return ZERO;
+		}
+
+		const Chunk& c = chunks_[pos];
+		const int i = blockID % CHUNK_BLOCKS;
+		if (c.type_ == DENSE) {
+			return chunk_blocks(c)[i];
+		}
+
+		//elements in [64 * i, 64 * i + 63]
+		BITBOARD bb = ZERO;
+		int local = WMUL(i) - 1;
+		while ((local = chunk_next(c, local + 1)) != -1 && local < WMUL(i + 1)) {
+			bb |= (static_cast<BITBOARD>(1) << (local & 63));
+		}
+		return bb;
+	}
+
+	inline
+	int HybridBitset::lsb() const {
+		if (chunks_.empty()) {
+			return BBObject::noBit;
+		}
+		return static_cast<int>(chunks_.front().key_ << CHUNK_SHIFT) + chunk_min(chunks_.front());
+	}
+
+	inline
+	int HybridBitset::msb() const {
+		if (chunks_.empty()) {
+			return BBObject::noBit;
+		}
+		return static_cast<int>(chunks_.back().key_ << CHUNK_SHIFT) + chunk_max(chunks_.back());
+	}
+
+	inline
+	int HybridBitset::next_from(int& pos, int start) const noexcept {
+
+		const int nChunks = static_cast<int>(chunks_.size());
+		if (pos < nChunks && chunks_[pos].key_ == static_cast<std::uint32_t>(start >> CHUNK_SHIFT)) {
+			const int local = chunk_next(chunks_[pos], start & CHUNK_MASK);
+			if (local != -1) {
+				return (start & ~CHUNK_MASK) + local;
+			}
+			++pos;
+		}
+
+		if (pos < nChunks) {
+			return static_cast<int>(chunks_[pos].key_ << CHUNK_SHIFT) + chunk_min(chunks_[pos]);
+		}
+
+		return BBObject::noBit;
+	}
+
+	inline
+	int HybridBitset::next_bit(int bit) const {
+
+		//special case - first bitscan
+		if (bit == BBObject::noBit) {
+			return lsb();
+		}
+
+		int pos = find_chunk_pos((bit + 1) >> CHUNK_SHIFT);
+		return next_from(pos, bit + 1);
+	}
+
+	inline
+	int HybridBitset::prev_bit(int bit) const {
+
+		//special case - first bitscan
+		if (bit == BBObject::noBit) {
+			return msb();
+		}
+
+		const int last = bit - 1;
+		if (last < 0) {
+			return BBObject::noBit;
+		}
+
+		//last chunk with key <= key of last
+		const std::uint32_t key = last >> CHUNK_SHIFT;
+		int pos = find_chunk_pos(key + 1) - 1;
+		if (pos >= 0 && chunks_[pos].key_ == key) {
+			const int local = chunk_prev(chunks_[pos], last & CHUNK_MASK);
+			if (local != -1) {
+				return (last & ~CHUNK_MASK) + local;
+			}
+			--pos;
+		}
+
+		if (pos >= 0) {
+			return static_cast<int>(chunks_[pos].key_ << CHUNK_SHIFT) + chunk_max(chunks_[pos]);
+		}
+
+		return BBObject::noBit;
+	}
+
+	inline
+	int HybridBitset::init_scan(scan_types sct) noexcept {
+		return init_scan(BBObject::noBit, sct);
+	}
+
+	inline
+	int HybridBitset::init_scan(int firstBit, scan_types sct) noexcept {
+
+		scanPos_ = 0;
+		scan_ = scan_t();
+
+		if (firstBit == BBObject::noBit) {
+			scanBit_ = BBObject::noBit;
+		}
+		else {
+			switch (sct) {
+			case BBObject::NON_DESTRUCTIVE:
+			case BBObject::NON_DESTRUCTIVE_REVERSE:
+				scanBit_ = firstBit;
+				break;
+			case BBObject::DESTRUCTIVE:
+				scanBit_ = WMUL(WDIV(firstBit)) - 1;					//from the bitblock of firstBit (as BBScan)
+				break;
+			case BBObject::DESTRUCTIVE_REVERSE:
+				scanBit_ = WMUL(WDIV(firstBit) + 1);
+				break;
+			default:
+				assert(false && "unknown scan type - HybridBitset::init_scan");
+			}
+		}
+
+		return (chunks_.empty() ? -1 : 0);
+	}
+
+	inline
+	int HybridBitset::next_bit() {
+
+		const int start = scanBit_ + 1;
+		const std::uint32_t key = start >> CHUNK_SHIFT;
+		const int nChunks = static_cast<int>(chunks_.size());
+
+		//the chunk of the last scanned bit is the hint (forward scans are monotone)
+		int pos = scanPos_;
+		if (pos > nChunks || (pos > 0 && chunks_[pos - 1].key_ >= key)) {
+			pos = find_chunk_pos(key);
+		}
+		else {
+			while (pos < nChunks && chunks_[pos].key_ < key) { ++pos; }
+		}
+
+		const int bit = next_from(pos, start);
+		scanPos_ = pos;
+		if (bit != BBObject::noBit) {
+			scanBit_ = bit;
+			scan_.set_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::next_bit(HybridBitset& bitset) {
+
+		const int bit = next_bit();
+		if (bit != BBObject::noBit) {
+			bitset.erase_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::next_bit_del() {
+
+		const int bit = next_bit(scanBit_);
+		if (bit != BBObject::noBit) {
+			erase_bit(bit);
+			scanBit_ = bit;
+			scan_.set_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::next_bit_del(HybridBitset& bitset) {
+
+		const int bit = next_bit_del();
+		if (bit != BBObject::noBit) {
+			bitset.erase_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::prev_bit() {
+
+		//the scan has reached bit 0
+		if (scanBit_ == 0) {
+			return BBObject::noBit;
+		}
+
+		const int bit = prev_bit(scanBit_);
+		if (bit != BBObject::noBit) {
+			scanBit_ = bit;
+			scan_.set_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::prev_bit(HybridBitset& bitset) {
+
+		const int bit = prev_bit();
+		if (bit != BBObject::noBit) {
+			bitset.erase_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::prev_bit_del() {
+
+		const int bit = (scanBit_ == 0) ? BBObject::noBit : prev_bit(scanBit_);
+		if (bit != BBObject::noBit) {
+			erase_bit(bit);
+			scanBit_ = bit;
+			scan_.set_bit(bit);
+		}
+		return bit;
+	}
+
+	inline
+	int HybridBitset::prev_bit_del(HybridBitset& bitset) {
+
+		const int bit = prev_bit_del();
+		if (bit != BBObject::noBit) {
+			bitset.erase_bit(bit);
+		}
+		return bit;
+	}
+
+	/////////////////////
+	// Popcount
+
+	inline
+	int HybridBitset::count() const noexcept {
+		int pc = 0;
+		for (const auto& c : chunks_) {
+			pc += c.card_;
+		}
+		return pc;
+	}
+
+	inline
+	int HybridBitset::count(int firstBit, int lastBit) const {
+
+		if (lastBit == -1) {
+			lastBit = WMUL(nBB_) - 1;
+		}
+		if (firstBit > lastBit) {
+			return 0;
+		}
+
+		const std::uint32_t kl = firstBit >> CHUNK_SHIFT;
+		const std::uint32_t kh = lastBit >> CHUNK_SHIFT;
+		BITBOARD w[CHUNK_BLOCKS];
+		int pc = 0;
+
+		for (int pos = find_chunk_pos(kl); pos < static_cast<int>(chunks_.size()) && chunks_[pos].key_ <= kh; ++pos) {
+			const Chunk& c = chunks_[pos];
+			const int lo = (c.key_ == kl) ? (firstBit & CHUNK_MASK) : 0;
+			const int hi = (c.key_ == kh) ? (lastBit & CHUNK_MASK) : CHUNK_MASK;
+			if (lo == 0 && hi == CHUNK_MASK) {
+				pc += c.card_;
+				continue;
+			}
+
+			//partial chunk
+			BITBOARD mask[CHUNK_BLOCKS] = { ZERO };
+			set_range(mask, lo, hi);
+			chunk_to_blocks(c, w);
+			pc += bbkernel::popcount_and(w, mask, CHUNK_BLOCKS);
+		}
+
+		return pc;
+	}
+
+	/////////////////////
+	// Setting / Erasing bits
+
+	inline
+	HybridBitset& HybridBitset::set_bit(int bit) {
+
+		const std::uint32_t key = bit >> CHUNK_SHIFT;
+		const std::uint16_t local = static_cast<std::uint16_t>(bit & CHUNK_MASK);
+		const int pos = find_chunk_pos(key);
+
+		//new ARRAY chunk
+		if (pos == static_cast<int>(chunks_.size()) || chunks_[pos].key_ != key) {
+			Chunk c = { key, 0, 1, 0, ARRAY };
+			chunks_.insert(chunks_.begin() + pos, c);
+			insert_payload(pos, ARRAY, &local, 1, nullptr);
+			return *this;
+		}
+
+		Chunk& c = chunks_[pos];
+		switch (c.type_) {
+		case DENSE:
+		{
+			BITBOARD& bb = words_[c.off_ + (local >> 6)];
+			const BITBOARD mask = static_cast<BITBOARD>(1) << (local & 63);
+			if (!(bb & mask)) {
+				bb |= mask;
+				++c.card_;
+			}
+			break;
+		}
+		case ARRAY:
+		{
+			auto first = vals_.begin() + c.off_, last = first + c.n_;
+			auto it = std::lower_bound(first, last, local);
+			if (it != last && *it == local) {
+				break;
+			}
+			if (c.n_ < ARRAY_MAX) {
+				vals_.insert(it, local);
+				++c.n_;
+				++c.card_;
+				shift_offsets(pos + 1, false, 1);
+				break;
+			}
+
+			//full ARRAY chunk - re-encoded as in the default case
+		}
+		// fall through
+		default:
+		{
+			if (chunk_contains(c, local)) {
+				break;
+			}
+			BITBOARD w[CHUNK_BLOCKS];
+			chunk_to_blocks(c, w);
+			w[local >> 6] |= (static_cast<BITBOARD>(1) << (local & 63));
+			store_chunk(pos, w);
+		}
+		}
+
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::erase_bit(int bit) {
+
+		const std::uint32_t key = bit >> CHUNK_SHIFT;
+		const std::uint16_t local = static_cast<std::uint16_t>(bit & CHUNK_MASK);
+		const int pos = find_chunk_pos(key);
+		if (pos == static_cast<int>(chunks_.size()) || chunks_[pos].key_ != key) {
+			return *this;
+		}
+
+		Chunk& c = chunks_[pos];
+		switch (c.type_) {
+		case DENSE:
+		{
+			BITBOARD& bb = words_[c.off_ + (local >> 6)];
+			const BITBOARD mask = static_cast<BITBOARD>(1) << (local & 63);
+			if (bb & mask) {
+				bb &= ~mask;
+
+				//DENSE to ARRAY (RUN) with hysteresis
+				if (--c.card_ <= ARRAY_MAX / 2) {
+					BITBOARD w[CHUNK_BLOCKS];
+					chunk_to_blocks(c, w);
+					store_chunk(pos, w);
+				}
+			}
+			break;
+		}
+		case ARRAY:
+		{
+			auto first = vals_.begin() + c.off_, last = first + c.n_;
+			auto it = std::lower_bound(first, last, local);
+			if (it == last || *it != local) {
+				break;
+			}
+			if (c.n_ == 1) {
+				erase_payload(pos);
+				chunks_.erase(chunks_.begin() + pos);
+				break;
+			}
+			vals_.erase(it);
+			--c.n_;
+			--c.card_;
+			shift_offsets(pos + 1, false, -1);
+			break;
+		}
+		default:
+		{
+			if (!chunk_contains(c, local)) {
+				break;
+			}
+			BITBOARD w[CHUNK_BLOCKS];
+			chunk_to_blocks(c, w);
+			w[local >> 6] &= ~(static_cast<BITBOARD>(1) << (local & 63));
+			store_chunk(pos, w);
+		}
+		}
+
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::set_bit(int firstBit, int lastBit) {
+
+		assert(firstBit >= 0 && firstBit <= lastBit);
+
+		const std::uint32_t kl = firstBit >> CHUNK_SHIFT;
+		const std::uint32_t kh = lastBit >> CHUNK_SHIFT;
+		BITBOARD w[CHUNK_BLOCKS];
+
+		for (std::uint32_t key = kl; key <= kh; ++key) {
+			const int lo = (key == kl) ? (firstBit & CHUNK_MASK) : 0;
+			const int hi = (key == kh) ? (lastBit & CHUNK_MASK) : CHUNK_MASK;
+
+			int pos = find_chunk_pos(key);
+			if (pos == static_cast<int>(chunks_.size()) || chunks_[pos].key_ != key) {
+				Chunk c = { key, 0, 0, 0, ARRAY };
+				chunks_.insert(chunks_.begin() + pos, c);
+				insert_payload(pos, ARRAY, nullptr, 0, nullptr);
+				std::fill(w, w + CHUNK_BLOCKS, ZERO);
+			}
+			else {
+				chunk_to_blocks(chunks_[pos], w);
+			}
+
+			set_range(w, lo, hi);
+			store_chunk(pos, w);
+		}
+
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::erase_bit(int firstBit, int lastBit) {
+
+		//erases up to the end of the bitset
+		if (lastBit == -1) {
+			if ((lastBit = msb()) < firstBit) { return *this; }
+		}
+
+		assert(firstBit >= 0 && firstBit <= lastBit);
+
+		const std::uint32_t kl = firstBit >> CHUNK_SHIFT;
+		const std::uint32_t kh = lastBit >> CHUNK_SHIFT;
+		BITBOARD w[CHUNK_BLOCKS];
+
+		int pos = find_chunk_pos(kl);
+		while (pos < static_cast<int>(chunks_.size()) && chunks_[pos].key_ <= kh) {
+			const Chunk& c = chunks_[pos];
+			const int lo = (c.key_ == kl) ? (firstBit & CHUNK_MASK) : 0;
+			const int hi = (c.key_ == kh) ? (lastBit & CHUNK_MASK) : CHUNK_MASK;
+
+			BITBOARD mask[CHUNK_BLOCKS] = { ZERO };
+			set_range(mask, lo, hi);
+			chunk_to_blocks(c, w);
+			for (int i = 0; i < CHUNK_BLOCKS; ++i) {
+				w[i] &= ~mask[i];
+			}
+
+			const std::size_t nChunks = chunks_.size();
+			store_chunk(pos, w);
+			if (chunks_.size() == nChunks) { ++pos; }			//the chunk was not removed
+		}
+
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::erase_bit(const HybridBitset& rhs) {
+		HybridBitset& tmp = scratch();
+		bitgraph::erase_bit(*this, rhs, tmp);
+		std::swap(chunks_, tmp.chunks_);
+		std::swap(vals_, tmp.vals_);
+		std::swap(words_, tmp.words_);
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::operator &= (const HybridBitset& rhs) {
+		HybridBitset& tmp = scratch();
+		AND(*this, rhs, tmp);
+		std::swap(chunks_, tmp.chunks_);
+		std::swap(vals_, tmp.vals_);
+		std::swap(words_, tmp.words_);
+		return *this;
+	}
+
+	inline
+	HybridBitset& HybridBitset::operator |= (const HybridBitset& rhs) {
+		HybridBitset& tmp = scratch();
+		OR(*this, rhs, tmp);
+		std::swap(chunks_, tmp.chunks_);
+		std::swap(vals_, tmp.vals_);
+		std::swap(words_, tmp.words_);
+		return *this;
+	}
+
+	inline
+	bool HybridBitset::is_bit(int bit) const {
+		const std::uint32_t key = bit >> CHUNK_SHIFT;
+		const int pos = find_chunk_pos(key);
+		return (pos < static_cast<int>(chunks_.size()) && chunks_[pos].key_ == key &&
+				chunk_contains(chunks_[pos], bit & CHUNK_MASK));
+	}
+
+	/////////////////////
+	// Set operations
+
+	inline
+	HybridBitset& AND(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res) {
+
+		using HB = HybridBitset;
+
+		///////////////////////////////////////
+		assert(&res != &lhs && &res != &rhs);
+		///////////////////////////////////////
+
+		res.erase_bit();
+		res.nBB_ = lhs.nBB_;
+
+		std::uint16_t buf[HB::ARRAY_MAX];
+		BITBOARD wl[HB::CHUNK_BLOCKS], wr[HB::CHUNK_BLOCKS];
+		std::size_t i = 0, j = 0;
+		while (i < lhs.chunks_.size() && j < rhs.chunks_.size()) {
+			const HB::Chunk& cl = lhs.chunks_[i];
+			const HB::Chunk& cr = rhs.chunks_[j];
+			if (cl.key_ < cr.key_) { ++i; continue; }
+			if (cr.key_ < cl.key_) { ++j; continue; }
+
+			if (cl.type_ == HB::ARRAY && cr.type_ == HB::ARRAY) {
+
+				//merge
+				const std::uint16_t* pl = lhs.chunk_values(cl);
+				const std::uint16_t* pr = rhs.chunk_values(cr);
+				int n = 0, k = 0, l = 0;
+				while (k < cl.n_ && l < cr.n_) {
+					if (pl[k] < pr[l]) { ++k; }
+					else if (pr[l] < pl[k]) { ++l; }
+					else { buf[n++] = pl[k]; ++k; ++l; }
+				}
+				if (n) { res.append_chunk(cl.key_, HB::ARRAY, n, buf, n, nullptr); }
+			}
+			else if (cl.type_ == HB::ARRAY || cr.type_ == HB::ARRAY) {
+
+				//filters the ARRAY chunk
+				const bool left = (cl.type_ == HB::ARRAY);
+				const HB& src = left ? lhs : rhs;
+				const HB& other = left ? rhs : lhs;
+				const HB::Chunk& ca = left ? cl : cr;
+				const HB::Chunk& co = left ? cr : cl;
+				const std::uint16_t* p = src.chunk_values(ca);
+				int n = 0;
+				for (int k = 0; k < ca.n_; ++k) {
+					if (other.chunk_contains(co, p[k])) { buf[n++] = p[k]; }
+				}
+				if (n) { res.append_chunk(cl.key_, HB::ARRAY, n, buf, n, nullptr); }
+			}
+			else {
+				lhs.chunk_to_blocks(cl, wl);
+				if (cr.type_ == HB::DENSE) {
+					const BITBOARD* p = rhs.chunk_blocks(cr);
+					for (int k = 0; k < HB::CHUNK_BLOCKS; ++k) { wl[k] &= p[k]; }
+				}
+				else {
+					rhs.chunk_to_blocks(cr, wr);
+					for (int k = 0; k < HB::CHUNK_BLOCKS; ++k) { wl[k] &= wr[k]; }
+				}
+				res.append_chunk(cl.key_, wl);
+			}
+			++i; ++j;
+		}
+
+		return res;
+	}
+
+	inline
+	HybridBitset& OR(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res) {
+
+		using HB = HybridBitset;
+
+		///////////////////////////////////////
+		assert(&res != &lhs && &res != &rhs);
+		///////////////////////////////////////
+
+		res.erase_bit();
+		res.nBB_ = lhs.nBB_;
+
+		std::uint16_t buf[HB::ARRAY_MAX];
+		BITBOARD wl[HB::CHUNK_BLOCKS], wr[HB::CHUNK_BLOCKS];
+		std::size_t i = 0, j = 0;
+		while (i < lhs.chunks_.size() || j < rhs.chunks_.size()) {
+			if (j == rhs.chunks_.size() || (i < lhs.chunks_.size() && lhs.chunks_[i].key_ < rhs.chunks_[j].key_)) {
+				res.append_chunk(lhs, lhs.chunks_[i++]);
+				continue;
+			}
+			if (i == lhs.chunks_.size() || rhs.chunks_[j].key_ < lhs.chunks_[i].key_) {
+				res.append_chunk(rhs, rhs.chunks_[j++]);
+				continue;
+			}
+
+			const HB::Chunk& cl = lhs.chunks_[i];
+			const HB::Chunk& cr = rhs.chunks_[j];
+			if (cl.type_ == HB::ARRAY && cr.type_ == HB::ARRAY && cl.n_ + cr.n_ <= HB::ARRAY_MAX) {
+
+				//merge
+				const std::uint16_t* pl = lhs.chunk_values(cl);
+				const std::uint16_t* pr = rhs.chunk_values(cr);
+				const int n = static_cast<int>(std::set_union(pl, pl + cl.n_, pr, pr + cr.n_, buf) - buf);
+				res.append_chunk(cl.key_, HB::ARRAY, n, buf, n, nullptr);
+			}
+			else {
+				lhs.chunk_to_blocks(cl, wl);
+				rhs.chunk_to_blocks(cr, wr);
+				for (int k = 0; k < HB::CHUNK_BLOCKS; ++k) { wl[k] |= wr[k]; }
+				res.append_chunk(cl.key_, wl);
+			}
+			++i; ++j;
+		}
+
+		return res;
+	}
+
+	inline
+	HybridBitset& erase_bit(const HybridBitset& lhs, const HybridBitset& rhs, HybridBitset& res) {
+
+		using HB = HybridBitset;
+
+		///////////////////////////////////////
+		assert(&res != &lhs && &res != &rhs);
+		///////////////////////////////////////
+
+		res.erase_bit();
+		res.nBB_ = lhs.nBB_;
+
+		std::uint16_t buf[HB::ARRAY_MAX];
+		BITBOARD wl[HB::CHUNK_BLOCKS], wr[HB::CHUNK_BLOCKS];
+		std::size_t j = 0;
+		for (const auto& cl : lhs.chunks_) {
+			while (j < rhs.chunks_.size() && rhs.chunks_[j].key_ < cl.key_) { ++j; }
+			if (j == rhs.chunks_.size() || rhs.chunks_[j].key_ != cl.key_) {
+				res.append_chunk(lhs, cl);
+				continue;
+			}
+
+			const HB::Chunk& cr = rhs.chunks_[j];
+			if (cl.type_ == HB::ARRAY) {
+				const std::uint16_t* p = lhs.chunk_values(cl);
+				int n = 0;
+				for (int k = 0; k < cl.n_; ++k) {
+					if (!rhs.chunk_contains(cr, p[k])) { buf[n++] = p[k]; }
+				}
+				if (n) { res.append_chunk(cl.key_, HB::ARRAY, n, buf, n, nullptr); }
+			}
+			else {
+				lhs.chunk_to_blocks(cl, wl);
+				rhs.chunk_to_blocks(cr, wr);
+				for (int k = 0; k < HB::CHUNK_BLOCKS; ++k) { wl[k] &= ~wr[k]; }
+				res.append_chunk(cl.key_, wl);
+			}
+		}
+
+		return res;
+	}
+
+	inline
+	int count_and(const HybridBitset& lhs, const HybridBitset& rhs) {
+
+		using HB = HybridBitset;
+
+		BITBOARD wl[HB::CHUNK_BLOCKS], wr[HB::CHUNK_BLOCKS];
+		int pc = 0;
+		std::size_t i = 0, j = 0;
+		while (i < lhs.chunks_.size() && j < rhs.chunks_.size()) {
+			const HB::Chunk& cl = lhs.chunks_[i];
+			const HB::Chunk& cr = rhs.chunks_[j];
+			if (cl.key_ < cr.key_) { ++i; continue; }
+			if (cr.key_ < cl.key_) { ++j; continue; }
+
+			if (cl.type_ == HB::ARRAY && cr.type_ == HB::ARRAY) {
+				const std::uint16_t* pl = lhs.chunk_values(cl);
+				const std::uint16_t* pr = rhs.chunk_values(cr);
+				int k = 0, l = 0;
+				while (k < cl.n_ && l < cr.n_) {
+					if (pl[k] < pr[l]) { ++k; }
+					else if (pr[l] < pl[k]) { ++l; }
+					else { ++pc; ++k; ++l; }
+				}
+			}
+			else if (cl.type_ == HB::ARRAY || cr.type_ == HB::ARRAY) {
+				const bool left = (cl.type_ == HB::ARRAY);
+				const HB& other = left ? rhs : lhs;
+				const HB::Chunk& ca = left ? cl : cr;
+				const HB::Chunk& co = left ? cr : cl;
+				const std::uint16_t* p = (left ? lhs : rhs).chunk_values(ca);
+				for (int k = 0; k < ca.n_; ++k) {
+					pc += other.chunk_contains(co, p[k]);
+				}
+			}
+			else if (cl.type_ == HB::DENSE && cr.type_ == HB::DENSE) {
+				pc += bbkernel::popcount_and(lhs.chunk_blocks(cl), rhs.chunk_blocks(cr), HB::CHUNK_BLOCKS);
+			}
+			else {
+				lhs.chunk_to_blocks(cl, wl);
+				rhs.chunk_to_blocks(cr, wr);
+				pc += bbkernel::popcount_and(wl, wr, HB::CHUNK_BLOCKS);
+			}
+			++i; ++j;
+		}
+
+		return pc;
+	}
+
+	inline
+	bool operator == (const HybridBitset& lhs, const HybridBitset& rhs) {
+
+		using HB = HybridBitset;
+
+		if (lhs.chunks_.size() != rhs.chunks_.size()) {
+			return false;
+		}
+
+		BITBOARD wl[HB::CHUNK_BLOCKS], wr[HB::CHUNK_BLOCKS];
+		for (std::size_t i = 0; i < lhs.chunks_.size(); ++i) {
+			const HB::Chunk& cl = lhs.chunks_[i];
+			const HB::Chunk& cr = rhs.chunks_[i];
+			if (cl.key_ != cr.key_ || cl.card_ != cr.card_) {
+				return false;
+			}
+			if (cl.type_ == cr.type_ && cl.type_ != HB::DENSE) {
+				if (cl.n_ != cr.n_ || !std::equal(lhs.chunk_values(cl), lhs.chunk_values(cl) + cl.n_, rhs.chunk_values(cr))) {
+					return false;
+				}
+				continue;
+			}
+			lhs.chunk_to_blocks(cl, wl);
+			rhs.chunk_to_blocks(cr, wr);
+			if (!std::equal(wl, wl + HB::CHUNK_BLOCKS, wr)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// Bitscanning ranges and fused operations for HybridBitset
+// (overloads of bbscan_iter.h and bbscan_fused.h)
+//
+///////////////////////
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////////////////
+		//
+		// HybridBlockCursor
+		//
+		// (non-empty bitblocks of a chunk in increasing order: next(i, bb) returns false when exhausted,
+		//  else the local index of the bitblock [0, CHUNK_BLOCKS) and its value)
+		//
+		///////////////////////////////////
+
+		class HybridBlockCursor {
+		public:
+			using HB = HybridBitset;
+
+			HybridBlockCursor() noexcept : type_(HB::ARRAY), p_(nullptr), w_(nullptr), i_(0), n_(0), next_(0) {}
+
+			void reset(const HB& bb, const HB::Chunk& c) noexcept {
+				type_ = c.type_;
+				p_ = bb.chunk_values(c);
+				w_ = bb.chunk_blocks(c);
+				i_ = 0;
+				n_ = (c.type_ == HB::RUN) ? c.n_ / 2 : c.n_;
+				next_ = 0;
+			}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				switch (type_) {
+				case HB::DENSE:
+					for (; i_ < HB::CHUNK_BLOCKS; ++i_) {
+						if ((bb = w_[i_])) {
+							idx = i_++;
+							return true;
+						}
+					}
+					return false;
+				case HB::ARRAY:
+					if (i_ == n_) { return false; }
+					idx = p_[i_] >> 6;
+					bb = ZERO;
+					do {
+						bb |= (static_cast<BITBOARD>(1) << (p_[i_] & 63));
+					} while (++i_ < n_ && (p_[i_] >> 6) == idx);
+					return true;
+				default:
+				{
+					//runs which intersect the bitblock idx (i_ is the first run not yet completed)
+					if (i_ == n_) { return false; }
+					idx = std::max(next_, p_[2 * i_] >> 6);
+					const int lo = WMUL(idx), hi = lo + WORD_SIZE_MINUS_ONE;
+					bb = ZERO;
+					while (i_ < n_ && p_[2 * i_] <= hi) {
+						bb |= bblock::MASK_1(std::max<int>(p_[2 * i_], lo) - lo, std::min<int>(p_[2 * i_ + 1], hi) - lo);
+						if (p_[2 * i_ + 1] > hi) { break; }					//the run continues in the next bitblock
+						++i_;
+					}
+					next_ = idx + 1;
+					return true;
+				}
+				}
+			}
+
+		private:
+			HB::chunk_types type_;
+			const std::uint16_t* p_;
+			const BITBOARD* w_;
+			int i_;									//current bitblock (DENSE), element (ARRAY) or run (RUN)
+			int n_;									//number of elements (ARRAY) or runs (RUN)
+			int next_;								//next bitblock (RUN)
+		};
+
+		/////////////////////////////////
+		//
+		// Cursors of HybridBitset
+		//
+		// (produce the non-empty bitblocks of bb, a & b or a & ~b in increasing order - same protocol
+		//  as the cursors of bbscan_fused.h)
+		//
+		///////////////////////////////////
+
+		class HybridCursor {
+		public:
+			explicit HybridCursor(const HybridBitset& bb) noexcept : bb_(&bb), c_(0) { open(); }
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				const int nChunks = static_cast<int>(bb_->chunks().size());
+				while (c_ < nChunks) {
+					if (cur_.next(idx, bb)) {
+						idx += bb_->chunks()[c_].key_ * HybridBitset::CHUNK_BLOCKS;
+						return true;
+					}
+					++c_;
+					open();
+				}
+				return false;
+			}
+
+		private:
+			void open() noexcept {
+				if (c_ < static_cast<int>(bb_->chunks().size())) {
+					cur_.reset(*bb_, bb_->chunks()[c_]);
+				}
+			}
+
+			const HybridBitset* bb_;
+			int c_;									//current chunk
+			HybridBlockCursor cur_;
+		};
+
+		template<class OpT>
+		class HybridFusedCursor2 {
+		public:
+			HybridFusedCursor2(const HybridBitset& lhs, const HybridBitset& rhs) noexcept :
+				lhs_(&lhs), rhs_(&rhs), i_(0), j_(0), inR_(false), hasR_(false), idxR_(0), bbR_(ZERO)
+			{
+				open();
+			}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				const int nl = static_cast<int>(lhs_->chunks().size());
+				while (i_ < nl) {
+					BITBOARD bbl;
+					if (!curL_.next(idx, bbl) || (!OpT::rhs_optional && !hasR_)) {
+						++i_;
+						open();
+						continue;
+					}
+
+					//merge with the bitblocks of the rhs chunk
+					BITBOARD bbr = ZERO;
+					if (inR_) {
+						while (hasR_ && idxR_ < idx) { hasR_ = curR_.next(idxR_, bbR_); }
+						if (hasR_ && idxR_ == idx) { bbr = bbR_; }
+					}
+
+					if ((bb = OpT::apply(bbl, bbr))) {
+						idx += lhs_->chunks()[i_].key_ * HybridBitset::CHUNK_BLOCKS;
+						return true;
+					}
+				}
+				return false;
+			}
+
+		private:
+
+			//first chunk of lhs from i_ to be scanned, with its rhs counterpart (if any)
+			void open() noexcept {
+				const auto& cl = lhs_->chunks();
+				const auto& cr = rhs_->chunks();
+				for (; i_ < static_cast<int>(cl.size()); ++i_) {
+					while (j_ < static_cast<int>(cr.size()) && cr[j_].key_ < cl[i_].key_) { ++j_; }
+					inR_ = (j_ < static_cast<int>(cr.size()) && cr[j_].key_ == cl[i_].key_);
+					if (inR_ || OpT::rhs_optional) {
+						curL_.reset(*lhs_, cl[i_]);
+						hasR_ = false;
+						if (inR_) {
+							curR_.reset(*rhs_, cr[j_]);
+							hasR_ = curR_.next(idxR_, bbR_);
+						}
+						return;
+					}
+				}
+			}
+
+			const HybridBitset* lhs_;
+			const HybridBitset* rhs_;
+			int i_, j_;								//current chunks
+			bool inR_;								//the current lhs chunk is in rhs
+			bool hasR_;								//pending rhs bitblock
+			int idxR_;
+			BITBOARD bbR_;
+			HybridBlockCursor curL_, curR_;
+		};
+
+	}//end namespace _impl
+
+	/**
+	* @brief range of the 1-bits of bb in increasing order (non-destructive)
+	*		 usage: for (int v : bits(bb)) {...}
+	* @details: bb must not be modified during the scan
+	**/
+	inline
+	auto bits(const HybridBitset& bb) {
+		return _impl::make_fused_range(_impl::HybridCursor(bb));
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of bb in increasing order (non-destructive)
+	**/
+	template<class Func>
+	inline
+	void for_each_bit(const HybridBitset& bb, Func f) {
+		_impl::for_each_fused(_impl::HybridCursor(bb), f);
+	}
+
+	/**
+	* @brief range of the 1-bits of a & b in increasing order, no bitset is built
+	**/
+	inline
+	auto bits_and(const HybridBitset& a, const HybridBitset& b) {
+		return _impl::make_fused_range(_impl::HybridFusedCursor2<_impl::fused_and>(a, b));
+	}
+
+	/**
+	* @brief range of the 1-bits of a & ~b in increasing order, no bitset is built
+	**/
+	inline
+	auto bits_andnot(const HybridBitset& a, const HybridBitset& b) {
+		return _impl::make_fused_range(_impl::HybridFusedCursor2<_impl::fused_andnot>(a, b));
+	}
+
+	template<class Func>
+	inline
+	void for_each_bit_and(const HybridBitset& a, const HybridBitset& b, Func f) {
+		_impl::for_each_fused(_impl::HybridFusedCursor2<_impl::fused_and>(a, b), f);
+	}
+
+	template<class Func>
+	inline
+	void for_each_bit_andnot(const HybridBitset& a, const HybridBitset& b, Func f) {
+		_impl::for_each_fused(_impl::HybridFusedCursor2<_impl::fused_andnot>(a, b), f);
+	}
+
+	/**
+	* @brief number of 1-bits in a & ~b, no bitset is built
+	**/
+	inline
+	int count_andnot(const HybridBitset& a, const HybridBitset& b) {
+		return a.count() - count_and(a, b);
+	}
+
+	/**
+	* @brief determines if a & b has at least k 1-bits (early exit)
+	**/
+	inline
+	bool intersects_at_least(const HybridBitset& a, const HybridBitset& b, int k) {
+		if (k <= 0) { return true; }
+
+		_impl::HybridFusedCursor2<_impl::fused_and> cursor(a, b);
+		int idx = 0, pc = 0;
+		BITBOARD bb = 0;
+		while (cursor.next(idx, bb)) {
+			if ((pc += bblock::popc64(bb)) >= k) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	inline
+	int find_first_common(const HybridBitset& lhs, const HybridBitset& rhs) {
+		_impl::HybridFusedCursor2<_impl::fused_and> cursor(lhs, rhs);
+		int idx = 0;
+		BITBOARD bb = 0;
+		return cursor.next(idx, bb) ? (bblock::lsb(bb) + WMUL(idx)) : BBObject::noBit;
+	}
+
+	inline
+	void HybridBitset::extract(bitpos_list& lb) const {
+		lb.clear();
+		lb.reserve(count());
+		for_each_bit(*this, [&lb](int bit) { lb.emplace_back(bit); });
+	}
+
+}//end namespace bitgraph
+
+#endif
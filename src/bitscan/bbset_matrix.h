@@ -0,0 +1,284 @@
+/**
+ * @file bbset_matrix.h
+ * @brief header file of the BitsetMatrix class from the BITSCAN library.
+ *		  Dense bit matrix stored in one contiguous, 64-byte aligned slab
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: BitsetMatrix<RowT> - nRows rows of the same number of bitblocks in a single allocation of
+ *			 nRows * stride() bitblocks, where the stride is rounded up to whole cache lines (8 bitblocks).
+ *			 The rows are RowT objects (currently WideBitset<W>) bound to the slab, handed out by reference
+ *			 with the interface of std::vector<RowT> used by Graph (operator[], assign, resize, clear...).
+ * @details: compared to std::vector<RowT>: one allocation instead of one per row, rows adjacent in memory
+ *			 (hardware prefetch from row to row, fewer TLB misses), every row aligned to a cache line, and
+ *			 the slab is zero pages of the OS (calloc) until it is written, so reset does not write the bitblocks.
+ *			 Reset is not O(1) though: the nRows row objects are rebuilt and bound to the new slab (O(nRows)).
+ * @details: Assigning a bitset of the same size to a row writes its bitblocks in the slab. A row assigned
+ *			 a bitset of a different size (e.g. row.reset(n)) leaves the slab and owns its bitblocks.
+ **/
+
+#ifndef __BBSET_MATRIX_H__
+#define __BBSET_MATRIX_H__
+
+#include "bbset_wide.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// BitsetMatrix class
+	//
+	// (rows of a fixed number of bitblocks in one contiguous slab, rows aligned to 64 bytes)
+	//
+	///////////////////////////////////
+
+	template<class RowT>
+	class BitsetMatrix {
+
+	public:
+
+		using value_type = RowT;
+		using reference = RowT&;
+		using const_reference = const RowT&;
+		using iterator = typename std::vector<RowT>::iterator;
+		using const_iterator = typename std::vector<RowT>::const_iterator;
+		using size_type = std::size_t;
+
+		enum : int {
+			ALIGN_BLOCKS = 8								//rows aligned to 64 bytes (cache line)
+		};
+
+		////////////
+		//construction / destruction
+
+		BitsetMatrix() noexcept : mem_(nullptr), slab_(nullptr), nBB_(0), stride_(0) {}
+
+		/**
+		* @brief Creates a matrix of nRows empty rows of population size nPop
+		**/
+		BitsetMatrix(std::size_t nRows, std::size_t nPop) noexcept : BitsetMatrix() { reset(nRows, nPop); }
+
+		/**
+		* @brief Creates a matrix of nRows copies of row
+		**/
+		BitsetMatrix(std::size_t nRows, const RowT& row) noexcept : BitsetMatrix() { assign(nRows, row); }
+
+		//copies are deep (a new slab)
+		BitsetMatrix(const BitsetMatrix& rhs) noexcept : BitsetMatrix() { copy_from(rhs); }
+
+		//moves keep the slab (the rows remain bound to it)
+		BitsetMatrix(BitsetMatrix&& rhs) noexcept : BitsetMatrix() { steal(rhs); }
+
+		BitsetMatrix& operator = (const BitsetMatrix& rhs) noexcept {
+			if (this != &rhs) { copy_from(rhs); }
+			return *this;
+		}
+
+		BitsetMatrix& operator = (BitsetMatrix&& rhs) noexcept {
+			if (this != &rhs) {
+				release();
+				steal(rhs);
+			}
+			return *this;
+		}
+
+		~BitsetMatrix() { release(); }
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Reallocates the matrix with nRows empty rows of population size nPop
+		* @details: one allocation, the rows are not written
+		* @details: Fail-fast policy: the program exits if the allocation fails
+		**/
+		void reset(std::size_t nRows, std::size_t nPop) noexcept { assign(nRows, RowT(nPop)); }
+
+		/**
+		* @brief Reallocates the matrix with nRows copies of row (std::vector interface)
+		* @details: Fail-fast policy: the program exits if the allocation fails
+		**/
+		void assign(std::size_t nRows, const RowT& row) noexcept;
+
+		/**
+		* @brief Changes the number of rows to nRows (std::vector interface)
+		* @details: removing rows keeps the slab, adding rows (empty, of the current number of bitblocks)
+		*			 reallocates the slab
+		**/
+		void resize(std::size_t nRows) noexcept;
+
+		/**
+		* @brief removes all the rows and releases the slab
+		**/
+		void clear() noexcept { release(); }
+
+		/////////////////////
+		//setters and getters
+
+		std::size_t size()		const noexcept { return rows_.size(); }
+		bool empty()			const noexcept { return rows_.empty(); }
+
+		/**
+		* @brief number of bitblocks of each row
+		**/
+		int num_blocks()		const noexcept { return nBB_; }
+
+		/**
+		* @brief distance between consecutive rows in the slab (in bitblocks, a multiple of ALIGN_BLOCKS)
+		**/
+		int stride()			const noexcept { return stride_; }
+
+		/**
+		* @brief first bitblock of the slab (row 0)
+		**/
+		BITBOARD* data() noexcept { return slab_; }
+		const BITBOARD* data() const noexcept { return slab_; }
+
+		/**
+		* @brief slot of row v in the slab (the bitblocks of row v unless the row has left the slab)
+		**/
+		BITBOARD* row_data(int v) noexcept { return slab_ + static_cast<std::size_t>(v) * stride_; }
+		const BITBOARD* row_data(int v) const noexcept { return slab_ + static_cast<std::size_t>(v) * stride_; }
+
+		/**
+		* @brief TRUE if row v is stored in the slab
+		**/
+		bool is_in_slab(int v) const noexcept { return rows_[v].data() == row_data(v); }
+
+		RowT& operator[] (std::size_t v) noexcept { return rows_[v]; }
+		const RowT& operator[] (std::size_t v) const noexcept { return rows_[v]; }
+
+		iterator begin() noexcept { return rows_.begin(); }
+		iterator end() noexcept { return rows_.end(); }
+		const_iterator begin() const noexcept { return rows_.begin(); }
+		const_iterator end() const noexcept { return rows_.end(); }
+		const_iterator cbegin() const noexcept { return rows_.cbegin(); }
+		const_iterator cend() const noexcept { return rows_.cend(); }
+
+		friend bool operator == (const BitsetMatrix& lhs, const BitsetMatrix& rhs) noexcept { return lhs.rows_ == rhs.rows_; }
+		friend bool operator != (const BitsetMatrix& lhs, const BitsetMatrix& rhs) noexcept { return !(lhs == rhs); }
+
+		/////////////////
+		// data members
+	private:
+
+		//allocates a slab of nRows rows of nBB bitblocks (set to 0 if zero is TRUE) and binds the rows to it
+		void allocate(std::size_t nRows, int nBB, bool zero = true) noexcept;
+
+		void copy_from(const BitsetMatrix& rhs) noexcept;
+		void steal(BitsetMatrix& rhs) noexcept;
+		void release() noexcept;
+
+		void* mem_;											//owned memory (with padding for alignment)
+		BITBOARD* slab_;									//first row, 64-byte aligned
+		int nBB_;											//number of bitblocks of each row
+		int stride_;										//distance between rows (in bitblocks)
+		std::vector<RowT> rows_;							//rows, bound to the slab
+	};
+
+	///////////////////////
+	// BitsetMatrix - implementation
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::allocate(std::size_t nRows, int nBB, bool zero) noexcept {
+
+		release();
+		nBB_ = nBB;
+		stride_ = ((nBB + ALIGN_BLOCKS - 1) / ALIGN_BLOCKS) * ALIGN_BLOCKS;
+
+		if (nRows == 0) { return; }
+		slab_ = _impl::alloc_aligned_blocks(nRows * stride_, mem_, zero);
+
+		try {
+			rows_.resize(nRows);
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - BitsetMatrix::allocate");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		for (std::size_t v = 0; v < nRows; ++v) {
+			rows_[v].bind(slab_ + v * stride_, nBB_);
+		}
+	}
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::assign(std::size_t nRows, const RowT& row) noexcept {
+
+		allocate(nRows, row.num_blocks());
+
+		//the slab is zero
+		if (row.is_empty()) { return; }
+		for (auto& r : rows_) { r = row; }
+	}
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::resize(std::size_t nRows) noexcept {
+
+		if (nRows <= rows_.size()) {
+			rows_.erase(rows_.begin() + nRows, rows_.end());
+			return;
+		}
+
+		BitsetMatrix m;
+		m.allocate(nRows, nBB_);
+		for (std::size_t v = 0; v < rows_.size(); ++v) {
+			m.rows_[v] = rows_[v];
+		}
+		*this = std::move(m);
+	}
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::copy_from(const BitsetMatrix& rhs) noexcept {
+
+		allocate(rhs.size(), rhs.nBB_, false);
+		if (rhs.empty()) { return; }
+
+		//one copy of the slab, then the rows which left the slab of rhs
+		std::memcpy(slab_, rhs.slab_, rhs.size() * stride_ * sizeof(BITBOARD));
+		for (std::size_t v = 0; v < rows_.size(); ++v) {
+			if (!rhs.is_in_slab(static_cast<int>(v))) { rows_[v] = rhs.rows_[v]; }
+		}
+	}
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::steal(BitsetMatrix& rhs) noexcept {
+
+		mem_ = rhs.mem_;
+		slab_ = rhs.slab_;
+		nBB_ = rhs.nBB_;
+		stride_ = rhs.stride_;
+		rows_ = std::move(rhs.rows_);				//the vector buffer is moved, the rows are not
+
+		rhs.mem_ = nullptr;
+		rhs.slab_ = nullptr;
+		rhs.nBB_ = rhs.stride_ = 0;
+		rhs.rows_.clear();
+	}
+
+	template<class RowT>
+	inline
+	void BitsetMatrix<RowT>::release() noexcept {
+
+		rows_.clear();
+		std::free(mem_);
+		mem_ = nullptr;
+		slab_ = nullptr;
+		nBB_ = stride_ = 0;
+	}
+
+}//end namespace bitgraph
+
+#endif
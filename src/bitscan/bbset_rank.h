@@ -0,0 +1,271 @@
+/**
+ * @file bbset_rank.h
+ * @brief header file of the BitsetRank class from the BITSCAN library.
+ *		  Rank / select directory over a (non-sparse) bitset
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The directory is attached to a Bitset (or any derived type, e.g. BBScan rows of a Graph) and answers
+ *			 - rank(bit): number of 1-bits before bit, O(1)
+ *			 - select(k): k-th 1-bit, O(log(n / 512)) + in-word select (PDEP with BMI2, see bblock::select64)
+ *			 - random_bit(rng): uniform random 1-bit
+ *			 - count(firstBit, lastBit): number of 1-bits in a closed range, O(1)
+ * @details: Layout (rank9): one pair of words per superblock of 8 bitblocks (512 bits), the absolute number of 1-bits
+ *			 before the superblock and the 7 relative counts of its bitblocks 1..7, packed in 9-bit fields.
+ *			 Extra space is 1/4 of the bitset.
+ * @details: The directory is rebuilt lazily by the first query after invalidate() is called, or after the bitset has been
+ *			 reallocated / resized. Changes of the bitset contents are NOT detected, call invalidate() after mutation.
+ **/
+
+#ifndef __BBSET_RANK_H__
+#define __BBSET_RANK_H__
+
+#include "bbset.h"
+#include "bitblock.h"
+#include <random>
+#include <vector>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// BitsetRank class
+	//
+	// (rank / select directory attached to a Bitset - does not own the bitset)
+	//
+	///////////////////////////////////
+
+	class BitsetRank {
+
+	public:
+
+		enum : int {
+			SUPERBLOCK_SIZE = 8,						//bitblocks per superblock (512 bits)
+			SUB_BITS = 9,								//bits of the packed relative counts
+			SUB_MASK = 0x1FF
+		};
+
+		////////////
+		//construction / destruction
+
+		BitsetRank() noexcept : bb_(nullptr), data_(nullptr), nBB_(0), dirty_(true) {}
+
+		/**
+		* @brief Creates a directory attached to the bitset bb (built lazily by the first query)
+		**/
+		explicit BitsetRank(const Bitset& bb) noexcept : bb_(&bb), data_(nullptr), nBB_(0), dirty_(true) {}
+
+		//Move and copy semantics allowed (the copies are attached to the same bitset)
+		BitsetRank(const BitsetRank&) = default;
+		BitsetRank(BitsetRank&&) noexcept = default;
+		BitsetRank& operator = (const BitsetRank&) = default;
+		BitsetRank& operator = (BitsetRank&&) noexcept = default;
+
+		~BitsetRank() = default;
+
+		/////////////////////
+		//setters and getters
+
+		/**
+		* @brief attaches the directory to the bitset bb (built lazily by the first query)
+		**/
+		void attach(const Bitset& bb) noexcept {
+			bb_ = &bb;
+			dirty_ = true;
+		}
+
+		const Bitset* bitset() const noexcept { return bb_; }
+
+		/**
+		* @brief marks the directory for rebuild (to be called after the bitset has been modified)
+		**/
+		void invalidate() noexcept { dirty_ = true; }
+
+		/**
+		* @brief TRUE if the directory has to be rebuilt (invalidated, or the bitset has been reallocated / resized)
+		**/
+		bool is_stale() const noexcept {
+			return (dirty_ || bb_->bitset().data() != data_ || bb_->num_blocks() != nBB_);
+		}
+
+		/**
+		* @brief builds the directory for the current contents of the bitset, O(n)
+		* @details: called lazily by the queries, may be called explicitly to build it eagerly
+		**/
+		void build();
+
+		/////////////////////
+		// Queries (rebuild the directory if stale)
+
+		/**
+		* @brief number of 1-bits of the bitset
+		**/
+		int count() {
+			refresh();
+			return static_cast<int>(dir_[2 * nSuper()]);
+		}
+
+		/**
+		* @brief number of 1-bits in the range [0, bit) - rank of bit if it is a 1-bit
+		* @param bit: in the range [0, num_blocks() * 64]
+		**/
+		int rank(int bit) {
+			refresh();
+			return rank_fast(bit);
+		}
+
+		/**
+		* @brief number of 1-bits in the closed range [firstBit, lastBit]
+		**/
+		int count(int firstBit, int lastBit) {
+			refresh();
+			return rank_fast(lastBit + 1) - rank_fast(firstBit);
+		}
+
+		/**
+		* @brief index of the k-th 1-bit (0-based) of the bitset
+		* @returns the k-th 1-bit or BBObject::noBit if the bitset has k or less 1-bits
+		**/
+		int select(int k);
+
+		/**
+		* @brief uniform random 1-bit of the bitset
+		* @param rng: uniform random bit generator (e.g. std::mt19937)
+		* @returns a random 1-bit or BBObject::noBit if the bitset is empty
+		**/
+		template<class RNG>
+		int random_bit(RNG& rng) {
+			const int pc = count();
+			if (pc == 0) {
+				return BBObject::noBit;
+			}
+			std::uniform_int_distribution<int> dist(0, pc - 1);
+			return select(dist(rng));
+		}
+
+		/////////////////////
+		// private helpers
+
+	private:
+
+		int nSuper() const noexcept { return (nBB_ + SUPERBLOCK_SIZE - 1) / SUPERBLOCK_SIZE; }
+
+		void refresh() {
+			assert(bb_ != nullptr);
+			if (is_stale()) { build(); }
+		}
+
+		//rank with an up-to-date directory
+		int rank_fast(int bit) const;
+
+		/////////////////
+		// data members
+
+		const Bitset* bb_;									//attached bitset
+		const BITBOARD* data_;								//bitblocks of bb_ when the directory was built
+		int nBB_;											//number of bitblocks of bb_ when the directory was built
+		bool dirty_;										//TRUE if the directory has to be rebuilt
+		std::vector<BITBOARD> dir_;							//pairs (absolute count, packed relative counts) per superblock
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation, must be in header file
+
+namespace bitgraph {
+
+	inline
+	void BitsetRank::build() {
+
+		assert(bb_ != nullptr);
+
+		data_ = bb_->bitset().data();
+		nBB_ = bb_->num_blocks();
+		const int nS = nSuper();
+		dir_.assign(2 * nS + 2, ZERO);
+
+		BITBOARD pc = 0;
+		for (int s = 0; s < nS; ++s) {
+			dir_[2 * s] = pc;
+
+			//relative counts of bitblocks 1..7 (saturated for the bitblocks beyond the end)
+			BITBOARD sub = 0;
+			int rel = 0;
+			for (int j = 0; j < SUPERBLOCK_SIZE; ++j) {
+				const int i = s * SUPERBLOCK_SIZE + j;
+				if (j > 0) {
+					sub |= static_cast<BITBOARD>((i < nBB_) ? rel : SUB_MASK) << (SUB_BITS * (j - 1));
+				}
+				if (i < nBB_) {
+					rel += bblock::popc64(data_[i]);
+				}
+			}
+			dir_[2 * s + 1] = sub;
+			pc += rel;
+		}
+		dir_[2 * nS] = pc;
+
+		dirty_ = false;
+	}
+
+	inline
+	int BitsetRank::rank_fast(int bit) const {
+
+		//////////////////////////////
+		assert(bit >= 0 && bit <= WMUL(nBB_));
+		//////////////////////////////
+
+		if (bit == WMUL(nBB_)) {
+			return static_cast<int>(dir_[2 * nSuper()]);
+		}
+
+		const int w = WDIV(bit);
+		const int s = w / SUPERBLOCK_SIZE;
+		const int j = w - s * SUPERBLOCK_SIZE;
+
+		int r = static_cast<int>(dir_[2 * s]);
+		if (j > 0) {
+			r += static_cast<int>((dir_[2 * s + 1] >> (SUB_BITS * (j - 1))) & SUB_MASK);
+		}
+		return r + bblock::popc64(data_[w] & Tables::mask_low[bit - WMUL(w)]);
+	}
+
+	inline
+	int BitsetRank::select(int k) {
+
+		refresh();
+
+		const int nS = nSuper();
+		if (k < 0 || k >= static_cast<int>(dir_[2 * nS])) {
+			return BBObject::noBit;
+		}
+
+		//superblock: last s with count(s) <= k
+		int lo = 0, hi = nS;
+		while (hi - lo > 1) {
+			const int mid = (lo + hi) / 2;
+			if (static_cast<int>(dir_[2 * mid]) <= k) { lo = mid; }
+			else { hi = mid; }
+		}
+
+		//bitblock in the superblock: last j with rel(j) <= r
+		int r = k - static_cast<int>(dir_[2 * lo]);
+		const BITBOARD sub = dir_[2 * lo + 1];
+		int j = 0, rel = 0;
+		for (int jj = 1; jj < SUPERBLOCK_SIZE; ++jj) {
+			const int relj = static_cast<int>((sub >> (SUB_BITS * (jj - 1))) & SUB_MASK);
+			if (relj > r) { break; }
+			j = jj;
+			rel = relj;
+		}
+
+		const int w = lo * SUPERBLOCK_SIZE + j;
+		return WMUL(w) + bblock::select64(data_[w], r - rel);
+	}
+
+}//end namespace bitgraph
+
+#endif
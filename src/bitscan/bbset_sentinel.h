@@ -0,0 +1,683 @@
+/**
+ * @file bbset_sentinel.h
+ * @brief header file of the SentinelBitset class from the BITSCAN library.
+ *		  Dense bitset which circumscribes its operations to the range of its non-empty bitblocks
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The bit layout is that of Bitset (bit i in bitblock WDIV(i), position WMOD(i)). The low and high sentinels
+ *			 are the indexes of the first and last non-empty bitblocks, and are kept exact under ALL the mutating
+ *			 operations (unlike _impl::BBSentinel in bbsentinel.h, whose sentinels are maintained by hand):
+ *			 - operations which add bits (set_bit, |=, set_block...) widen the range, O(1)
+ *			 - operations which remove bits (erase_bit, &=, destructive bitscanning...) only visit the range and then
+ *			   move the sentinels inwards past the bitblocks which have become empty
+ * @details: Read operations are restricted to the range (to the intersection of ranges for binary operations):
+ *			 lsb(), msb(), is_empty() and is_singleton() are O(1), count(), bitscanning, AND, is_disjoint... are
+ *			 O(high - low). Intended for candidate sets which shrink during a search (e.g. clique heuristics).
+ * @details: The BBScan interface is inherited from _impl::DenseBase (bbset_dense.h), on the range-restricted
+ *			 hooks of this class. As in CountedBitset, the bitblocks are read-only (block(i) is const,
+ *			 writes go through set_block), so that the sentinels cannot be bypassed.
+ **/
+
+#ifndef __BBSET_SENTINEL_H__
+#define __BBSET_SENTINEL_H__
+
+#include "bbset_dense.h"
+#include "bbset_view.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <vector>
+#include <initializer_list>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// SentinelBitset class
+	//
+	// (dense bitset with exact low / high sentinels - first and last non-empty bitblocks)
+	// @details Binary operations require bitsets of the same population size
+	// @details The empty bitset has sentinels low = num_blocks(), high = -1, so that loops
+	//			for (int i = low; i <= high; ++i) do nothing
+	//
+	///////////////////////////////////
+
+	class SentinelBitset : public _impl::DenseBase<SentinelBitset> {
+
+		using base_type = _impl::DenseBase<SentinelBitset>;
+		friend base_type;
+
+	public:
+
+		/////////////////////////////
+		// Independent operators / masks
+		// comment: do not modify lhs or rhs
+
+		/**
+		* @brief AND between lhs and rhs bitsets in the closed range [firstBit, lastBit], stores the result in res.
+		*		 The bits of res outside the range are set to 0 if the template parameter Erase is true,
+		*		 otherwise they are not modified.
+		* @returns reference to the resulting bitstring res
+		* @details: GCC does not allow default template parameters in friend functions
+		**/
+		template<bool Erase>
+		friend SentinelBitset& AND(int firstBit, int lastBit, const SentinelBitset& lhs, const SentinelBitset& rhs, SentinelBitset& res);
+
+		/**
+		* @brief number of 1-bits in common between lhs and rhs (intersection of their ranges)
+		**/
+		friend int count_and(const SentinelBitset& lhs, const SentinelBitset& rhs) {
+			assert(lhs.nBB_ == rhs.nBB_);
+			const int lo = std::max(lhs.bbl_, rhs.bbl_);
+			const int hi = std::min(lhs.bbh_, rhs.bbh_);
+			return (lo > hi) ? 0 : bbkernel::popcount_and(lhs.vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+		}
+
+		////////////
+		//construction / destruction
+
+		SentinelBitset() noexcept : nBB_(0), bbl_(0), bbh_(-1) {}
+
+		/**
+		* @brief Constructor of a bitset given a population size nPop
+		* @param nPop : population size
+		* @param val: initial value (TRUE, FALSE) of every bit in the range [0, nPop)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		explicit SentinelBitset(std::size_t nPop, bool val = false) noexcept : SentinelBitset() { init(nPop, val); }
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		**/
+		template<class ColT>
+		explicit SentinelBitset(std::size_t nPop, const ColT& lv) noexcept : SentinelBitset() { init(nPop, lv); }
+
+		explicit SentinelBitset(std::size_t nPop, std::initializer_list<int> lv) noexcept : SentinelBitset() { init(nPop, lv); }
+
+		/**
+		* @brief Creates a copy of the non-sparse bitset bb (e.g. a row of a ugraph)
+		**/
+		explicit SentinelBitset(ConstBitsetView bb) noexcept : SentinelBitset() {
+			init(WMUL(bb.num_blocks()), false);
+			std::copy(bb.data(), bb.data() + bb.num_blocks(), vBB_.begin());
+			set_sentinels(0, nBB_ - 1);
+		}
+
+		//Move and copy semantics allowed
+		SentinelBitset(const SentinelBitset&) = default;
+		SentinelBitset(SentinelBitset&&) noexcept = default;
+		SentinelBitset& operator = (const SentinelBitset&) = default;
+		SentinelBitset& operator = (SentinelBitset&&) noexcept = default;
+
+		~SentinelBitset() = default;
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Resets the bitset to nPop bits with value val
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void init(std::size_t nPop, bool val = false) noexcept;
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		**/
+		template<class ColT>
+		void init(std::size_t nPop, const ColT& lv) noexcept;
+
+		void reset(std::size_t nPop) noexcept { init(nPop, false); }
+		void reset(std::size_t nPop, const bitpos_list& lv) noexcept { init(nPop, lv); }
+
+		void shrink_to_fit() { vBB_.shrink_to_fit(); }
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks() const noexcept { return nBB_; }
+		std::size_t size() const noexcept { return vBB_.size(); }
+
+		const BITBOARD* data() const noexcept { return vBB_.data(); }
+
+		BITBOARD block(index_t blockID) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID];
+		}
+
+		/**
+		* @brief sets bitblock blockID to bb (the sentinels are updated)
+		**/
+		SentinelBitset& set_block(index_t blockID, BITBOARD bb) {
+			assert(blockID >= 0 && blockID < nBB_);
+			vBB_[blockID] = bb;
+			if (bb) { widen(blockID, blockID); }
+			else if (blockID == bbl_ || blockID == bbh_) { tighten(); }
+			return *this;
+		}
+
+		/**
+		* @brief first non-empty bitblock, num_blocks() if the bitset is empty
+		**/
+		int sentinel_low() const noexcept { return bbl_; }
+
+		/**
+		* @brief last non-empty bitblock, -1 if the bitset is empty
+		**/
+		int sentinel_high() const noexcept { return bbh_; }
+
+		/**
+		* @brief read-only views of the bitblocks (bbset_view.h)
+		**/
+		ConstBitsetView view() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView cview() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+
+		/**
+		* @brief index of the first non-empty bitblock in [i, num_blocks()), -1 if there is none
+		**/
+		int next_block(int i) const noexcept {
+			for (i = std::max(i, bbl_); i <= bbh_; ++i) {
+				if (vBB_[i]) { return i; }
+			}
+			return -1;
+		}
+
+		/**
+		* @brief index of the last non-empty bitblock in [0, i], -1 if there is none
+		**/
+		int prev_block(int i) const noexcept {
+			for (i = std::min(i, bbh_); i >= bbl_; --i) {
+				if (vBB_[i]) { return i; }
+			}
+			return -1;
+		}
+
+		//////////////////////////////
+		// Bitscanning (stateless) - O(1)
+
+		int lsb() const noexcept {
+			return (bbl_ > bbh_) ? BBObject::noBit : bblock::lsb(vBB_[bbl_]) + WMUL(bbl_);
+		}
+
+		int msb() const noexcept {
+			return (bbl_ > bbh_) ? BBObject::noBit : bblock::msb(vBB_[bbh_]) + WMUL(bbh_);
+		}
+
+		/////////////////////
+		// Block operations (closed range of bitblocks [firstBlock, lastBlock], the rest is not modified)
+		// If lastBlock == -1, the range is [firstBlock, num_blocks())
+
+		/**
+		* @brief copies the bitblocks of rhs in the range
+		**/
+		SentinelBitset& assign_block(int firstBlock, int lastBlock, const SentinelBitset& rhs);
+
+		/**
+		* @brief adds the 1-bits of rhs in the range
+		**/
+		SentinelBitset& set_block(int firstBlock, int lastBlock, const SentinelBitset& rhs);
+
+		/**
+		* @brief removes the 1-bits of rhs in the range
+		**/
+		SentinelBitset& erase_block(int firstBlock, int lastBlock, const SentinelBitset& rhs);
+
+		/**
+		* @brief AND with rhs in the range
+		**/
+		SentinelBitset& AND_EQUAL_block(int firstBlock, int lastBlock, const SentinelBitset& rhs);
+
+		////////////////////////
+		//Operators
+
+		/**
+		* @brief XOR with rhs, only the range of rhs is visited
+		**/
+		SentinelBitset& operator ^= (const SentinelBitset& rhs) noexcept;
+
+		/////////////////////////////
+		//Boolean functions - O(1)
+
+		bool is_empty() const noexcept { return bbl_ > bbh_; }
+
+		/**
+		* @brief TRUE if the bitset has a single 1-bit
+		**/
+		bool is_singleton() const noexcept { return bbl_ == bbh_ && bblock::popc64(vBB_[bbl_]) == 1; }
+
+		/////////////////
+		// hooks of _impl::DenseBase (restricted to the range of the sentinels, which are updated)
+
+	private:
+
+		BITBOARD* wblocks() noexcept { return vBB_.data(); }
+		void refresh() noexcept { set_sentinels(0, nBB_ - 1); }
+
+		void set_bits(int i, BITBOARD mask) noexcept {
+			vBB_[i] |= mask;
+			if (mask) { widen(i, i); }
+		}
+
+		void erase_bits(int i, BITBOARD mask) noexcept {
+			vBB_[i] &= ~mask;
+			if (!vBB_[i] && (i == bbl_ || i == bbh_)) { tighten(); }
+		}
+
+		int count_blocks(int firstBlock, int lastBlock) const noexcept {
+			const int lo = std::max(firstBlock, bbl_);
+			const int hi = std::min(lastBlock, bbh_);
+			return (lo > hi) ? 0 : bbkernel::popcount(vBB_.data() + lo, hi - lo + 1);
+		}
+
+		void clear_blocks() noexcept {
+			if (bbl_ <= bbh_) { std::fill(vBB_.begin() + bbl_, vBB_.begin() + bbh_ + 1, ZERO); }
+			set_empty();
+		}
+
+		//only the intersection of the ranges of lhs and rhs is computed
+		SentinelBitset& assign_and(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept;
+
+		//only the union of the ranges of lhs and rhs is computed
+		SentinelBitset& assign_or(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept;
+
+		//only the range of lhs is computed, and the intersection with the range of rhs is erased
+		SentinelBitset& assign_andnot(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept;
+
+		int first_common(const SentinelBitset& rhs) const noexcept {
+			assert(rhs.nBB_ == nBB_);
+			const int lo = std::max(bbl_, rhs.bbl_);
+			const int hi = std::min(bbh_, rhs.bbh_);
+			if (lo > hi) { return BBObject::noBit; }
+			const int i = lo + bbkernel::first_common(vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+			return (i > hi) ? BBObject::noBit : bblock::lsb(vBB_[i] & rhs.vBB_[i]) + WMUL(i);
+		}
+
+		bool equal_blocks(const SentinelBitset& rhs) const noexcept {
+			return bbl_ == rhs.bbl_ && bbh_ == rhs.bbh_ && vBB_ == rhs.vBB_;
+		}
+
+		/////////////////
+		// sentinels
+
+		void set_empty() noexcept {
+			bbl_ = nBB_;
+			bbh_ = -1;
+		}
+
+		//extends the range to the (non-empty) bitblocks [lo, hi]
+		void widen(int lo, int hi) noexcept {
+			bbl_ = std::min(bbl_, lo);
+			bbh_ = std::max(bbh_, hi);
+		}
+
+		//moves the sentinels inwards past empty bitblocks
+		void tighten() noexcept {
+			while (bbl_ <= bbh_ && !vBB_[bbl_]) { ++bbl_; }
+			if (bbl_ > bbh_) {
+				set_empty();
+				return;
+			}
+			while (!vBB_[bbh_]) { --bbh_; }
+		}
+
+		//sets the sentinels to [lo, hi] (all the 1-bits are in the range), and tightens them
+		void set_sentinels(int lo, int hi) noexcept {
+			bbl_ = lo;
+			bbh_ = hi;
+			tighten();
+		}
+
+		//sets to 0 the bitblocks of the range which are outside [lo, hi] (the sentinels are not updated)
+		void erase_outside(int lo, int hi) noexcept {
+			for (int i = bbl_; i <= bbh_ && i < lo; ++i) { vBB_[i] = ZERO; }
+			for (int i = std::max(bbl_, hi + 1); i <= bbh_; ++i) { vBB_[i] = ZERO; }
+		}
+
+		//last bitblock of a block range (-1 is the last bitblock of the bitset)
+		int last_block(int lastBlock) const noexcept { return (lastBlock == -1) ? nBB_ - 1 : lastBlock; }
+
+		/////////////////
+		// data members
+
+		std::vector<BITBOARD> vBB_;							//bitblocks
+		int nBB_;											//number of bitblocks
+		int bbl_;											//low sentinel - first non-empty bitblock (nBB_ if empty)
+		int bbh_;											//high sentinel - last non-empty bitblock (-1 if empty)
+	};
+
+	//visible to qualified calls (e.g. bitgraph::count_and in generic code)
+	int count_and(const SentinelBitset& lhs, const SentinelBitset& rhs);
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation (header-only)
+
+namespace bitgraph {
+
+	inline
+	void SentinelBitset::init(std::size_t nPop, bool val) noexcept {
+
+		nBB_ = static_cast<int>(INDEX_1TO1(nPop));
+
+		try {
+			vBB_.assign(nBB_, ZERO);
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - SentinelBitset::init");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		set_empty();
+		if (val && nPop > 0) {
+			set_bit(0, static_cast<int>(nPop) - 1);
+		}
+	}
+
+	template<class ColT>
+	inline
+	void SentinelBitset::init(std::size_t nPop, const ColT& lv) noexcept {
+
+		init(nPop, false);
+
+		//sets bit conveniently
+		for (auto& bit : lv) {
+
+			//////////////////
+			assert(bit >= 0 && bit < static_cast<int>(nPop));
+			/////////////////
+
+			set_bit(bit);
+		}
+	}
+
+	template<bool Erase>
+	inline
+	SentinelBitset& AND(int firstBit, int lastBit, const SentinelBitset& lhs, const SentinelBitset& rhs, SentinelBitset& res) {
+
+		//////////////////////////////////////////////
+		assert(firstBit >= 0 && firstBit <= lastBit && WDIV(lastBit) < res.nBB_);
+		assert(lhs.nBB_ == rhs.nBB_ && lhs.nBB_ == res.nBB_);
+		/////////////////////////////////////////////
+
+		const int bbl = WDIV(firstBit);
+		const int bbh = WDIV(lastBit);
+
+		if (Erase) { res.erase_bit(); }
+
+		//bitblocks of the range which may be non-empty in the result
+		const int lo = std::max({ bbl, lhs.bbl_, rhs.bbl_ });
+		const int hi = std::min({ bbh, lhs.bbh_, rhs.bbh_ });
+
+		//range mask of bitblock i
+		auto mask = [&](int i) {
+			BITBOARD m = ONE;
+			if (i == bbl) { m &= bblock::MASK_1_HIGH(firstBit - WMUL(bbl)); }
+			if (i == bbh) { m &= bblock::MASK_1_LOW(lastBit - WMUL(bbh)); }
+			return m;
+		};
+
+		if (!Erase) {
+
+			//bitblocks of the range outside [lo, hi] - the result is 0 in the range
+			for (int i = std::max(bbl, res.bbl_); i <= std::min(bbh, res.bbh_); ++i) {
+				if (i < lo || i > hi) { res.vBB_[i] &= ~mask(i); }
+			}
+		}
+
+		for (int i = lo; i <= hi; ++i) {
+			const BITBOARD m = mask(i);
+			res.vBB_[i] = (res.vBB_[i] & ~m) | (lhs.vBB_[i] & rhs.vBB_[i] & m);
+		}
+
+		//all the 1-bits of res are in the union of its old range and [lo, hi]
+		if (lo <= hi) { res.widen(lo, hi); }
+		if (!res.is_empty()) { res.tighten(); }
+
+		return res;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::assign_and(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept {
+
+		assert(lhs.nBB_ == rhs.nBB_ && lhs.nBB_ == nBB_);
+		const int lo = std::max(lhs.bbl_, rhs.bbl_);
+		const int hi = std::min(lhs.bbh_, rhs.bbh_);
+		erase_outside(lo, hi);
+		if (lo <= hi) {
+			bbkernel::and_to(vBB_.data() + lo, lhs.vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+		}
+		set_sentinels(lo, hi);
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::assign_or(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept {
+
+		assert(lhs.nBB_ == rhs.nBB_ && lhs.nBB_ == nBB_);
+		const int lo = std::min(lhs.bbl_, rhs.bbl_);
+		const int hi = std::max(lhs.bbh_, rhs.bbh_);
+		erase_outside(lo, hi);
+		if (lo <= hi) {
+			bbkernel::or_to(vBB_.data() + lo, lhs.vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+		}
+		bbl_ = lo;
+		bbh_ = hi;
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::assign_andnot(const SentinelBitset& lhs, const SentinelBitset& rhs) noexcept {
+
+		assert(lhs.nBB_ == rhs.nBB_ && lhs.nBB_ == nBB_);
+		const int lo = lhs.bbl_, hi = lhs.bbh_;
+		erase_outside(lo, hi);
+		if (lo <= hi) {
+			if (&lhs != this) {
+				std::copy(lhs.vBB_.begin() + lo, lhs.vBB_.begin() + hi + 1, vBB_.begin() + lo);
+			}
+
+			//rhs is empty outside its range
+			const int lo2 = std::max(lo, rhs.bbl_);
+			const int hi2 = std::min(hi, rhs.bbh_);
+			if (lo2 <= hi2) {
+				bbkernel::andnot_assign(vBB_.data() + lo2, rhs.vBB_.data() + lo2, hi2 - lo2 + 1);
+			}
+		}
+		set_sentinels(lo, hi);
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::assign_block(int firstBlock, int lastBlock, const SentinelBitset& rhs) {
+
+		lastBlock = last_block(lastBlock);
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+
+		//clears the range, then copies the non-empty bitblocks of rhs in the range
+		for (int i = std::max(firstBlock, bbl_); i <= std::min(lastBlock, bbh_); ++i) { vBB_[i] = ZERO; }
+		const int lo = std::max(firstBlock, rhs.bbl_);
+		const int hi = std::min(lastBlock, rhs.bbh_);
+		if (lo <= hi) {
+			std::copy(rhs.vBB_.begin() + lo, rhs.vBB_.begin() + hi + 1, vBB_.begin() + lo);
+			widen(lo, hi);
+		}
+
+		if (!is_empty()) { tighten(); }
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::set_block(int firstBlock, int lastBlock, const SentinelBitset& rhs) {
+
+		lastBlock = last_block(lastBlock);
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+
+		//only the non-empty bitblocks of rhs in the range
+		const int lo = std::max(firstBlock, rhs.bbl_);
+		const int hi = std::min(lastBlock, rhs.bbh_);
+		if (lo <= hi) {
+			bbkernel::or_assign(vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+
+			//the bitblocks of rhs at the ends of [lo, hi] may be empty (inner sentinels of a subrange)
+			widen(lo, hi);
+			tighten();
+		}
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::erase_block(int firstBlock, int lastBlock, const SentinelBitset& rhs) {
+
+		lastBlock = last_block(lastBlock);
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+
+		const int lo = std::max({ firstBlock, bbl_, rhs.bbl_ });
+		const int hi = std::min({ lastBlock, bbh_, rhs.bbh_ });
+		if (lo <= hi) {
+			bbkernel::andnot_assign(vBB_.data() + lo, rhs.vBB_.data() + lo, hi - lo + 1);
+			tighten();
+		}
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::AND_EQUAL_block(int firstBlock, int lastBlock, const SentinelBitset& rhs) {
+
+		lastBlock = last_block(lastBlock);
+		assert(firstBlock >= 0 && lastBlock < nBB_ && lastBlock < rhs.nBB_);
+
+		//bitblocks of the range within the sentinels
+		const int lo = std::max(firstBlock, bbl_);
+		const int hi = std::min(lastBlock, bbh_);
+		if (lo > hi) { return *this; }
+
+		//rhs is empty outside [rhs.bbl_, rhs.bbh_]
+		const int lo2 = std::max(lo, rhs.bbl_);
+		const int hi2 = std::min(hi, rhs.bbh_);
+		if (lo2 > hi2) {
+			std::fill(vBB_.begin() + lo, vBB_.begin() + hi + 1, ZERO);
+		}
+		else {
+			for (int i = lo; i < lo2; ++i) { vBB_[i] = ZERO; }
+			bbkernel::and_assign(vBB_.data() + lo2, rhs.vBB_.data() + lo2, hi2 - lo2 + 1);
+			for (int i = hi2 + 1; i <= hi; ++i) { vBB_[i] = ZERO; }
+		}
+
+		tighten();
+		return *this;
+	}
+
+	inline
+	SentinelBitset& SentinelBitset::operator ^= (const SentinelBitset& rhs) noexcept {
+
+		assert(rhs.nBB_ == nBB_);
+		if (rhs.bbl_ <= rhs.bbh_) {
+			bbkernel::xor_assign(vBB_.data() + rhs.bbl_, rhs.vBB_.data() + rhs.bbl_, rhs.bbh_ - rhs.bbl_ + 1);
+			widen(rhs.bbl_, rhs.bbh_);
+			tighten();
+		}
+		return *this;
+	}
+
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// Bitscanning ranges for SentinelBitset
+// (overloads of bbscan_iter.h and bbscan_fused.h, restricted to the range of the sentinels)
+//
+///////////////////////
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////////////////
+		//
+		// SentinelDelIterator
+		//
+		// (destructive scan of a SentinelBitset through its members next_bit_del / prev_bit_del,
+		//  so that the sentinels are updated at each step)
+		//
+		///////////////////////////////////
+
+		template<bool Reverse>
+		class SentinelDelIterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = int;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const int*;
+			using reference = int;
+
+			//nullptr: end of the scan
+			explicit SentinelDelIterator(SentinelBitset* bb) noexcept : bb_(bb), bit_(BBObject::noBit)
+			{
+				if (bb_) {
+					bb_->init_scan(Reverse ? BBObject::DESTRUCTIVE_REVERSE : BBObject::DESTRUCTIVE);
+					next();
+				}
+			}
+
+			int operator* () const noexcept { return bit_; }
+
+			SentinelDelIterator& operator++ () noexcept {
+				next();
+				return *this;
+			}
+
+			bool operator == (const SentinelDelIterator& rhs) const noexcept { return bit_ == rhs.bit_; }
+			bool operator != (const SentinelDelIterator& rhs) const noexcept { return bit_ != rhs.bit_; }
+
+		private:
+
+			void next() noexcept { bit_ = Reverse ? bb_->prev_bit_del() : bb_->next_bit_del(); }
+
+			SentinelBitset* bb_;
+			int bit_;								//current bit (already removed from the bitset)
+		};
+
+	}//end namespace _impl
+
+	/**
+	* @brief bitscanning ranges of a SentinelBitset, restricted to the range of its sentinels
+	*		 (the destructive ranges update the sentinels at each step)
+	**/
+	inline
+	auto bits(const SentinelBitset& bb) {
+		using IterT = _impl::BitIterator<BITBOARD, false>;
+		const int first = bb.is_empty() ? 0 : bb.sentinel_low();
+		const int last = bb.sentinel_high() + 1;
+		return _impl::BitRange<IterT>(IterT(bb.data(), first, last), IterT(bb.data(), last, last));
+	}
+
+	inline
+	auto bits_rev(const SentinelBitset& bb) {
+		using IterT = _impl::BitIterator<BITBOARD, true>;
+		const int first = bb.sentinel_high();
+		const int last = bb.is_empty() ? first : bb.sentinel_low() - 1;
+		return _impl::BitRange<IterT>(IterT(bb.data(), first, last), IterT(bb.data(), last, last));
+	}
+
+	inline
+	auto bits_del(SentinelBitset& bb) {
+		using IterT = _impl::SentinelDelIterator<false>;
+		return _impl::BitRange<IterT>(IterT(&bb), IterT(nullptr));
+	}
+
+	inline
+	auto bits_del_rev(SentinelBitset& bb) {
+		using IterT = _impl::SentinelDelIterator<true>;
+		return _impl::BitRange<IterT>(IterT(&bb), IterT(nullptr));
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_SENTINEL_H__
@@ -187,12 +187,12 @@ BitsetSp& BitsetSp::set_bit(int firstBit, int lastBit)
 		}
 		else {
 
-			//add blocks trimming both ends 
+			//add blocks trimming both ends (in order, no sorting required)
 			vBB_.emplace_back(SparseBlock(bbl, bblock::MASK_1_HIGH(offsetl)));
-			vBB_.emplace_back(SparseBlock(bbh, bblock::MASK_1_LOW(offseth)));
 			for (int i = bbl + 1; i < bbh; i++) {
 				vBB_.emplace_back(SparseBlock(i, ONE));
 			}
+			vBB_.emplace_back(SparseBlock(bbh, bblock::MASK_1_LOW(offseth)));
 		}
 		
 		return *this;
@@ -895,11 +895,12 @@ string BitsetSp::to_string ()  const{
 void BitsetSp::extract (bitpos_list& lb) const{
 
 	lb.clear();
+	const int pc = count();
+	if (pc == 0) return;
 
-	int nBit = BBObject::noBit;
-	while((nBit = next_bit(nBit)) != BBObject::noBit ){
-		lb.push_back(nBit);
-	}
+	//batched decoding, the padding of the decoder is trimmed afterwards
+	lb.resize(pc + bbkernel::DECODE_PAD);
+	lb.resize(decode(lb.data()));
 }
 
 BitsetSp::operator bitpos_list() const
@@ -13,8 +13,11 @@
 
 #include "bitscan/bbobject.h"
 #include "bitscan/bitblock.h"
+#include "bitscan/bbkernel_sparse.h"		//intersection of block indices (merge / galloping)
+#include "bitscan/bbkernel.h"				//padding of the batched decoders (DECODE_PAD)
 #include "utils/logger.h"
 #include "utils/common.h"
+#include "utils/common_types.h"			//SmallVector (inline storage of the bitblocks)
 #include <vector>	
 #include <algorithm>
 #include <iterator>
@@ -37,7 +40,8 @@ namespace bitgraph {
 		using BaseT = BBObject;
 		using BaseT::bitpos_list;
 
-		static constexpr int DEFAULT_CAPACITY = 2;		//initial allocation of bit blocks for any new sparse bitstring - CHECK efficiency (17/02/2025)
+		//initial heap allocation of bit blocks for any new sparse bitstring (none with inline storage, see SparseBlockVec)
+		static constexpr int DEFAULT_CAPACITY = (BITSCAN_SPARSE_INLINE_BLOCKS > 0) ? 0 : 2;
 
 	public:
 		
@@ -62,9 +66,14 @@ namespace bitgraph {
 		};
 
 		//aliases
+		//storage of the bitblocks: the first BITSCAN_SPARSE_INLINE_BLOCKS are in the object (bbconfig.h)
+#if BITSCAN_SPARSE_INLINE_BLOCKS > 0
+		using SparseBlockVec  = com::SmallVector<SparseBlock, BITSCAN_SPARSE_INLINE_BLOCKS>;
+#else
 		using SparseBlockVec  = std::vector<SparseBlock>;
-		using SparseBlockVecIt  = typename std::vector<SparseBlock>::iterator;
-		using SparseBlockVecConstIt = typename std::vector<SparseBlock>::const_iterator;
+#endif
+		using SparseBlockVecIt  = typename SparseBlockVec::iterator;
+		using SparseBlockVecConstIt = typename SparseBlockVec::const_iterator;
 				 
 
 		//functor for sorting -
@@ -140,6 +149,27 @@ namespace bitgraph {
 		**/
 		friend BitsetSp& erase_bit(const BitsetSp& lhs, const BitsetSp& rhs, BitsetSp& res);
 
+		/**
+		* @brief Gathers the bits of src selected by mask into the consecutive positions [0, mask.count()) of res
+		*		 (multi-word PEXT, see Bitset). res is rebuilt with capacity for the population of its current num_blocks.
+		* @param src, mask: input bitsets
+		* @param res: output bitset with capacity for at least mask.count() bits, must not be src
+		* @returns reference to the resulting bitstring res
+		* @details: O(|src| + |mask|) non-empty blocks, BMI2 PEXT if available (see bbkernel::pext)
+		**/
+		friend BitsetSp& compress(const BitsetSp& src, const BitsetSp& mask, BitsetSp& res);
+
+		/**
+		* @brief Scatters the bits [0, mask.count()) of src to the positions of the 1-bits of mask
+		*		 (multi-word PDEP, inverse of compress)
+		* @param src: input bitset
+		* @param mask: input bitset
+		* @param res: output bitset with at least the number of blocks of mask, must not be src
+		* @returns reference to the resulting bitstring res
+		* @details: O(|src| + |mask|) non-empty blocks, BMI2 PDEP if available (see bbkernel::pdep)
+		**/
+		friend BitsetSp& expand(const BitsetSp& src, const BitsetSp& mask, BitsetSp& res);
+
 
 		//TODO - add same interface as BitSet (25/02/2025)
 
@@ -744,6 +774,7 @@ namespace bitgraph {
 		* @brief Converts the bitstring to a std::vector of non-negative integers.
 		*		 The size of the vector is the number of bits in the bitstring.
 		* @param lb: output vector
+		* @details batched decoding (see decode), 17/10/2026
 		**/
 		void extract(bitpos_list& lb) const;
 
@@ -754,6 +785,30 @@ namespace bitgraph {
 		**/
 		operator bitpos_list () const;
 
+		/**
+		* @brief Writes the 1-bits of the bitstring in out, in ascending order
+		*		 (batched decoding, see bblock::decode64)
+		* @param out: output array with room for count() + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		inline int decode(int* out) const;
+
+		/**
+		* @brief Writes the 1-bits of the bitstring in the closed range [firstBit, lastBit] in out,
+		*		 in ascending order. If lastBit == -1, the range is [firstBit, endOfBitset)
+		* @param out: output array with room for the number of 1-bits in the range + bbkernel::DECODE_PAD ints
+		* @returns number of 1-bits written
+		**/
+		inline int decode(int firstBit, int lastBit, int* out) const;
+
+		/**
+		* @brief Writes the 1-bits of the intersection with rhs in out, in ascending order
+		*		 (merge / galloping of the block indices, see bbkernel_sparse.h)
+		* @param out: output array with room for |this & rhs| + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of 1-bits written
+		**/
+		inline int decode_and(const BitsetSp& rhs, int* out) const;
+
 		/////////////////////
 		//data members
 
@@ -779,7 +834,7 @@ namespace bitgraph {
 		int bb = WDIV(bit);
 
 		/////////////////////////////////////////////////////////////////////////////////////
-		auto it = lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(bb), pBlock_less());
+		auto it = std::lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(bb), pBlock_less());
 		/////////////////////////////////////////////////////////////////////////////////////
 
 		return (it != vBB_.cend() &&
@@ -806,28 +861,65 @@ namespace bitgraph {
 
 	bool BitsetSp::is_disjoint(const BitsetSp& rhs) const {
 
-		auto itL = vBB_.begin();
-		auto itR = rhs.vBB_.begin();
+		//merge of the block indices, stops at the first bits in common (bbkernel_sparse.h)
+		const SparseBlock* pL = vBB_.data();
+		const SparseBlock* pR = rhs.vBB_.data();
+		return bbkernel::for_each_common_block(
+			[pL](int i) { return pL[i].idx_; }, static_cast<int>(vBB_.size()),
+			[pR](int j) { return pR[j].idx_; }, static_cast<int>(rhs.vBB_.size()),
+			[pL, pR](int i, int j) { return !(pL[i].bb_ & pR[j].bb_); });
+	}
 
-		//main loop
-		while (itL != vBB_.end() && itR != rhs.vBB_.end())
-		{
-			if (itL->idx_ < itR->idx_) {
-				itL++;
-			}
-			else if (itL->idx_ > itR->idx_) {
-				itR++;
+
+	int BitsetSp::decode(int* out) const {
+
+		int* p = out;
+		for (const auto& b : vBB_) {
+			p += bblock::decode64(b.bb_, WMUL(b.idx_), p);
+		}
+		return static_cast<int>(p - out);
+	}
+
+
+	int BitsetSp::decode(int firstBit, int lastBit, int* out) const {
+
+		/////////////////////////////////////////////////////////////////
+		assert(firstBit >= 0 && ((firstBit <= lastBit) || (lastBit == -1)));
+		////////////////////////////////////////////////////////////////
+
+		const index_t bbL = WDIV(firstBit);
+		const index_t bbH = (lastBit == -1) ? static_cast<index_t>(nBB_ - 1) : WDIV(lastBit);
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbL), pBlock_less());
+
+		int* p = out;
+		for (; it != vBB_.end() && it->idx_ <= bbH; ++it) {
+			BITBOARD bb = it->bb_;
+			if (it->idx_ == bbL) {
+				bb &= bblock::MASK_1_HIGH(WMOD(firstBit));
 			}
-			else {
-				if (itL->bb_ & itR->bb_) {
-					return false;				//bits in common	
-				}
-				++itL;
-				++itR;
+			if (it->idx_ == bbH && lastBit != -1) {
+				bb &= bblock::MASK_1_LOW(WMOD(lastBit));
 			}
+			p += bblock::decode64(bb, WMUL(it->idx_), p);
 		}
+		return static_cast<int>(p - out);
+	}
 
-		return true;
+
+	int BitsetSp::decode_and(const BitsetSp& rhs, int* out) const {
+
+		//merge of the block indices, decodes the common bitblocks (bbkernel_sparse.h)
+		const SparseBlock* pL = vBB_.data();
+		const SparseBlock* pR = rhs.vBB_.data();
+		int* p = out;
+		bbkernel::for_each_common_block(
+			[pL](int i) { return pL[i].idx_; }, static_cast<int>(vBB_.size()),
+			[pR](int j) { return pR[j].idx_; }, static_cast<int>(rhs.vBB_.size()),
+			[pL, pR, &p](int i, int j) {
+				p += bblock::decode64(pL[i].bb_ & pR[j].bb_, WMUL(pL[i].idx_), p);
+				return true;
+			});
+		return static_cast<int>(p - out);
 	}
 
 
@@ -883,7 +975,7 @@ namespace bitgraph {
 		auto bb = WDIV(bit);
 
 		//find closest block to blockID greater or equal
-		auto it = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bb), pBlock_less());
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bb), pBlock_less());
 
 		if (it != vBB_.end() && it->idx_ == bb) {
 
@@ -901,7 +993,7 @@ namespace bitgraph {
 		int bb = WDIV(bit);
 
 		//iterator to the block of the bit if it exists or the closest non-empty block with greater index
-		auto it = lower_bound(from_it, vBB_.end(), SparseBlock(bb), pBlock_less());
+		auto it = std::lower_bound(from_it, vBB_.end(), SparseBlock(bb), pBlock_less());
 
 		if (it != vBB_.end() && it->idx_ == bb) {
 
@@ -1054,10 +1146,10 @@ namespace bitgraph {
 			val.b = vBB_[i].bb_;
 			if(val.b){
 				block = i;
-				if(val.c[3]) return (Tables::msba[3][val.c[3]] + WMUL(vBB_[i].idx_));
-				if(val.c[2]) return (Tables::msba[2][val.c[2]] + WMUL(vBB_[i].idx_));
-				if(val.c[1]) return (Tables::msba[1][val.c[1]] + WMUL(vBB_[i].idx_));
-				if(val.c[0]) return (Tables::msba[0][val.c[0]] + WMUL(vBB_[i].idx_));
+				if(val.c[3]) return (Tables::msb[val.c[3]] + 48 + WMUL(vBB_[i].idx_));
+				if(val.c[2]) return (Tables::msb[val.c[2]] + 32 + WMUL(vBB_[i].idx_));
+				if(val.c[1]) return (Tables::msb[val.c[1]] + 16 + WMUL(vBB_[i].idx_));
+				if(val.c[0]) return (Tables::msb[val.c[0]] + WMUL(vBB_[i].idx_));
 			}
 		}*/
 
@@ -1076,10 +1168,10 @@ namespace bitgraph {
 		for (int i = size; i >= 0; --i) {
 			val.b = vBB_[i].bb_;
 			if (val.b) {
-				if (val.c[3]) return (Tables::msba[3][val.c[3]] + static_cast<int>(WMUL(vBB_[i].idx_)));
-				if (val.c[2]) return (Tables::msba[2][val.c[2]] + static_cast<int>(WMUL(vBB_[i].idx_)));
-				if (val.c[1]) return (Tables::msba[1][val.c[1]] + static_cast<int>(WMUL(vBB_[i].idx_)));
-				if (val.c[0]) return (Tables::msba[0][val.c[0]] + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[3]) return (Tables::msb[val.c[3]] + 48 + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[2]) return (Tables::msb[val.c[2]] + 32 + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[1]) return (Tables::msb[val.c[1]] + 16 + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[0]) return (Tables::msb[val.c[0]] + static_cast<int>(WMUL(vBB_[i].idx_)));
 			}
 		}
 
@@ -1137,10 +1229,10 @@ namespace bitgraph {
 	//		val.b = vBB_[i].bb_;
 	//		block = i;
 	//		if(val.b){
-	//			if(val.c[0]) return (Tables::lsba[0][val.c[0]] + WMUL(vBB_[i].idx_));
-	//			if(val.c[1]) return (Tables::lsba[1][val.c[1]] + WMUL(vBB_[i].idx_));
-	//			if(val.c[2]) return (Tables::lsba[2][val.c[2]] + WMUL(vBB_[i].idx_));
-	//			if(val.c[3]) return (Tables::lsba[3][val.c[3]] + WMUL(vBB_[i].idx_));
+	//			if(val.c[0]) return (Tables::lsb[val.c[0]] + WMUL(vBB_[i].idx_));
+	//			if(val.c[1]) return (Tables::lsb[val.c[1]] + 16 + WMUL(vBB_[i].idx_));
+	//			if(val.c[2]) return (Tables::lsb[val.c[2]] + 32 + WMUL(vBB_[i].idx_));
+	//			if(val.c[3]) return (Tables::lsb[val.c[3]] + 48 + WMUL(vBB_[i].idx_));
 	//		}
 	//	}
 	//
@@ -1172,10 +1264,10 @@ namespace bitgraph {
 		for (int i = 0; i < vBB_.size(); ++i) {
 			val.b = vBB_[i].bb_;
 			if (val.b) {
-				if (val.c[0]) return (Tables::lsba[0][val.c[0]] + static_cast<int>(WMUL(vBB_[i].idx_)));
-				if (val.c[1]) return (Tables::lsba[1][val.c[1]] + static_cast<int>(WMUL(vBB_[i].idx_)));
-				if (val.c[2]) return (Tables::lsba[2][val.c[2]] + static_cast<int>(WMUL(vBB_[i].idx_))));
-				if (val.c[3]) return (Tables::lsba[3][val.c[3]] + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[0]) return (Tables::lsb[val.c[0]] + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[1]) return (Tables::lsb[val.c[1]] + 16 + static_cast<int>(WMUL(vBB_[i].idx_)));
+				if (val.c[2]) return (Tables::lsb[val.c[2]] + 32 + static_cast<int>(WMUL(vBB_[i].idx_))));
+				if (val.c[3]) return (Tables::lsb[val.c[3]] + 48 + static_cast<int>(WMUL(vBB_[i].idx_)));
 			}
 		}
 
@@ -1212,7 +1304,7 @@ namespace bitgraph {
 	int BitsetSp::popcn64(int firstBit) const {
 
 		auto bbL = WDIV(firstBit);
-		auto it = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbL), pBlock_less());
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbL), pBlock_less());
 		BITBOARD pc = 0;
 
 		if (it != vBB_.end()) {
@@ -1241,7 +1333,7 @@ namespace bitgraph {
 		/////////////////////////////////
 
 		auto bbL = WDIV(firstBit);
-		auto it = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbL), pBlock_less());
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbL), pBlock_less());
 		BITBOARD pc = 0;
 
 		if (it != vBB_.end()) {
@@ -1463,7 +1555,7 @@ namespace bitgraph {
 		auto offseth = WMOD(lastBit);
 
 		//determines the block in bbl or the closest one with greater index 
-		auto it = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbl), pBlock_less());
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(bbl), pBlock_less());
 
 		//special case - no bits to erase in the closed range
 		if (it == vBB_.end()) {
@@ -1574,7 +1666,7 @@ namespace bitgraph {
 		vBB_.clear();
 
 		//finds bbl or closest block with greater indx
-		auto it = lower_bound(rhs.cbegin(), rhs.cend(), SparseBlock(bbl), pBlock_less());
+		auto it = std::lower_bound(rhs.cbegin(), rhs.cend(), SparseBlock(bbl), pBlock_less());
 
 		//special case - no bits to set in the closed range
 		if (it == rhs.cend()) {
@@ -1628,7 +1720,7 @@ namespace bitgraph {
 	{
 
 		////////////////////////////////////////////////////////////////////////////////////////////
-		auto it = lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
+		auto it = std::lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
 		////////////////////////////////////////////////////////////////////////////////////////////
 
 		if (it != vBB_.end() && (it->idx_ == blockID || ReturnInsertPos)) {
@@ -1648,7 +1740,7 @@ namespace bitgraph {
 	{
 
 		////////////////////////////////////////////////////////////////////////////////////////////
-		auto it = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
+		auto it = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
 		////////////////////////////////////////////////////////////////////////////////////////////
 
 		if (it != vBB_.end() && (it->idx_ == blockID || ReturnInsertPos)) {
@@ -1669,14 +1761,14 @@ namespace bitgraph {
 
 		if (UseLowerBound) {
 			////////////////////////////////////////////////////////////////////////////////////////////
-			res.second = lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
+			res.second = std::lower_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
 			////////////////////////////////////////////////////////////////////////////////////////////
 
 			res.first = (res.second != vBB_.end()) && (res.second->idx_ == blockID);
 		}
 		else {
 			////////////////////////////////////////////////////////////////////////////////////////////
-			res.second = upper_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
+			res.second = std::upper_bound(vBB_.begin(), vBB_.end(), SparseBlock(blockID), pBlock_less());
 			////////////////////////////////////////////////////////////////////////////////////////////
 
 			res.first = false;			//the same block cannot be found with upper_bound, only the closest with greater index
@@ -1693,14 +1785,14 @@ namespace bitgraph {
 
 		if (UseLowerBound) {
 			////////////////////////////////////////////////////////////////////////////////////////////
-			res.second = lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
+			res.second = std::lower_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
 			////////////////////////////////////////////////////////////////////////////////////////////
 
 			res.first = (res.second != vBB_.end()) && (res.second->idx_ == blockID);
 		}
 		else {
 			////////////////////////////////////////////////////////////////////////////////////////////
-			res.second = upper_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
+			res.second = std::upper_bound(vBB_.cbegin(), vBB_.cend(), SparseBlock(blockID), pBlock_less());
 			////////////////////////////////////////////////////////////////////////////////////////////
 
 			res.first = false;			//the same block cannot be found with upper_bound, only the closest with greater index
@@ -1741,45 +1833,18 @@ namespace bitgraph {
 			return res;
 		}
 
-		auto itR = rhs.cbegin();
-		auto itL = lhs.cbegin();
-
-		//////////////////
-		//A) General purpose code assuming no a priori knowledge about population size in lhs and rhs
-		do {
-			if (itL->idx_ < itR->idx_) {
-				itL++;
-			}
-			else if (itL->idx_ > itR->idx_) {
-				itR++;
-			}
-			else {
+		//merge of the block indices - gallops over the longer bitset if the sizes are skewed (bbkernel_sparse.h)
+		const BitsetSp::SparseBlock* pL = lhs.vBB_.data();
+		const BitsetSp::SparseBlock* pR = rhs.vBB_.data();
+		bbkernel::for_each_common_block(
+			[pL](int i) { return pL[i].idx_; }, static_cast<int>(lhs.vBB_.size()),
+			[pR](int j) { return pR[j].idx_; }, static_cast<int>(rhs.vBB_.size()),
+			[pL, pR, &res](int i, int j) {
 				////////////////////////////////////////////////////////////////////////
-				res.vBB_.push_back(BitsetSp::SparseBlock(itL->idx_, itL->bb_ & itR->bb_));
+				res.vBB_.push_back(BitsetSp::SparseBlock(pL[i].idx_, pL[i].bb_ & pR[j].bb_));
 				/////////////////////////////////////////////////////////////////////////
-				itL++;
-				itR++;
-			}
-		} while (itL != lhs.vBB_.end() && itR != rhs.vBB_.end());
-
-
-		/////////////////	
-		//B) Optimization for the case lhs has less 1-bits than rhs
-
-		//for (auto& blockL : lhs.vBB_) {
-
-		//	//finds closest
-		//	while (itR != rhs.vBB_.end() && itR->idx_ < blockL.idx_) { itR++; }
-
-		//	//exit condition - rhs has been examined
-		//	if (itR == rhs.vBB_.end()) { break;	}
-
-		//	//blocks remain to be examined in both bitsets
-		//	if (blockL.idx_ == itR->idx_) {
-		//		res.vBB_.push_back(BitsetSp::SparseBlock(blockL.idx_, blockL.bb_ & itR->bb_));
-		//	}
-		//	
-		//}
+				return true;
+			});
 
 		return res;
 	}
@@ -1884,6 +1949,78 @@ namespace bitgraph {
 		return res;
 	}
 
+	inline
+		BitsetSp& compress(const BitsetSp& src, const BitsetSp& mask, BitsetSp& res) {
+
+		///////////////////////////////////////////////////
+		assert(&src != &res);
+		assert(mask.count() <= WMUL(res.nBB_));
+		///////////////////////////////////////////////////
+
+		res.erase_bit();
+
+		//bit stream appended to res block by block (only non-empty blocks are stored)
+		int pos = 0;
+		BITBOARD acc = ZERO;
+		auto itS = src.vBB_.cbegin();
+		for (const auto& m : mask.vBB_) {
+
+			//block of src with the same index as the mask block (0 if empty)
+			while (itS != src.vBB_.cend() && itS->idx_ < m.idx_) { ++itS; }
+			const BITBOARD bb = (itS != src.vBB_.cend() && itS->idx_ == m.idx_) ? itS->bb_ : ZERO;
+
+			const BITBOARD r = bbkernel::pext(bb, m.bb_);
+			const int k = bblock::popc64(m.bb_);
+			const int sh = WMOD(pos);
+			acc |= r << sh;
+			if (sh + k >= WORD_SIZE) {
+				if (acc) { res.vBB_.emplace_back(BitsetSp::SparseBlock(WDIV(pos), acc)); }
+				acc = (sh == 0) ? ZERO : (r >> (WORD_SIZE - sh));
+			}
+			pos += k;
+		}
+		if (WMOD(pos) && acc) {
+			res.vBB_.emplace_back(BitsetSp::SparseBlock(WDIV(pos), acc));
+		}
+
+		return res;
+	}
+
+	inline
+		BitsetSp& expand(const BitsetSp& src, const BitsetSp& mask, BitsetSp& res) {
+
+		///////////////////////////////////////////////////
+		assert(&src != &res);
+		assert(mask.nBB_ <= res.nBB_);
+		///////////////////////////////////////////////////
+
+		res.erase_bit();
+
+		int pos = 0;
+		auto itS = src.vBB_.cbegin();
+		const auto itE = src.vBB_.cend();
+		for (const auto& m : mask.vBB_) {
+
+			//k bits of the stream src from pos (blocks w and w + 1 of src, 0 if empty)
+			const int k = bblock::popc64(m.bb_);
+			const BitsetSp::index_t w = WDIV(pos);
+			const int sh = WMOD(pos);
+			while (itS != itE && itS->idx_ < w) { ++itS; }
+			const bool found = (itS != itE && itS->idx_ == w);
+			BITBOARD bits = found ? (itS->bb_ >> sh) : ZERO;
+			if (sh + k > WORD_SIZE) {
+				auto itN = found ? itS + 1 : itS;
+				if (itN != itE && itN->idx_ == w + 1) { bits |= itN->bb_ << (WORD_SIZE - sh); }
+			}
+			pos += k;
+
+			const BITBOARD bb = bbkernel::pdep(bits, m.bb_);
+			if (bb) { res.vBB_.emplace_back(BitsetSp::SparseBlock(m.idx_, bb)); }
+		}
+
+		return res;
+	}
+
 	inline
 		BitsetSp& erase_bit(const BitsetSp& lhs, const BitsetSp& rhs, BitsetSp& res) {
 
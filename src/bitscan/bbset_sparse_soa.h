@@ -0,0 +1,415 @@
+/**
+ * @file bbset_sparse_soa.h
+ * @brief header of the BitsetSpSoA class from the BITSCAN library.
+ *		  Sparse bitset with a structure-of-arrays layout: a packed array of uint32 block indices
+ *		  and a parallel array of bitblocks
+ * @details created 17/10/2026
+ * @details: BitsetSp stores a vector of SparseBlock {int idx_; BITBOARD bb_;}, i.e. 16 bytes per bitblock
+ *			 (4 bytes of padding). BitsetSpSoA takes 12 bytes per bitblock (25% less memory) and the searches
+ *			 (lower_bound, galloping) and intersections run over the dense index array (16 indices per cache line).
+ *			 The intersections (AND, is_disjoint, count_and) use the SIMD block merge of bbkernel_sparse.h
+ *			 and the population count the bbkernel layer.
+ * @details: Non-polymorphic (no vptr), conversions from / to BitsetSp are explicit.
+ * @author pss
+ **/
+
+#ifndef __BBSET_SPARSE_SOA_H__
+#define __BBSET_SPARSE_SOA_H__
+
+#include "bbset_sparse.h"
+#include "bbkernel.h"
+#include "bbkernel_sparse.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// BitsetSpSoA class
+	//
+	// (sparse bitset, structure-of-arrays layout)
+	//
+	///////////////////////////////////
+
+	class BitsetSpSoA {
+
+		friend bool operator ==			(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs);
+		friend bool operator !=			(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs);
+
+		/**
+		* @brief AND between lhs and rhs sparse bitsets - stores the result in res (only non-empty bitblocks)
+		*		 The capacity of res is set to the capacity of lhs.
+		* @returns reference to res
+		**/
+		friend BitsetSpSoA& AND(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs, BitsetSpSoA& res);
+
+		/**
+		* @brief number of 1-bits in lhs & rhs, no bitset is built
+		**/
+		friend int count_and(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs);
+
+	public:
+
+		using index_t = std::uint32_t;
+		using IndexVec = std::vector<index_t>;
+		using BlockVec = std::vector<BITBOARD>;
+
+		/////////////////////////////
+		// construction / destruction
+
+		BitsetSpSoA() : nBB_(0) {}
+
+		/**
+		* @brief Creates an EMPTY bitset given a population size nPop
+		**/
+		explicit BitsetSpSoA(int nPop) : nBB_(INDEX_1TO1(nPop)) {}
+
+		/**
+		* @brief Creates a bitset with population size nPop and the 1-bits in lv
+		* @details: fast-fail policy, bits out of range exit the program
+		**/
+		BitsetSpSoA(int nPop, const std::vector<int>& lv) : nBB_(INDEX_1TO1(nPop)) { set_bits(lv.begin(), lv.end()); }
+		BitsetSpSoA(int nPop, std::initializer_list<int> lv) : nBB_(INDEX_1TO1(nPop)) { set_bits(lv.begin(), lv.end()); }
+
+		/**
+		* @brief Converts a BitsetSp (array-of-structs layout), the empty bitblocks are not copied
+		**/
+		explicit BitsetSpSoA(const BitsetSp& bbs);
+
+		/**
+		* @brief Converts to a BitsetSp with the same number of bitblocks
+		**/
+		explicit operator BitsetSp() const;
+
+		/**
+		* @brief resets to an empty bitset with population size nPop
+		**/
+		void reset(int nPop) {
+			vIdx_.clear();
+			vBB_.clear();
+			nBB_ = INDEX_1TO1(nPop);
+		}
+
+		/**
+		* @brief reallocates memory to the number of bitblocks of the bitset
+		**/
+		void shrink_to_fit() {
+			vIdx_.shrink_to_fit();
+			vBB_.shrink_to_fit();
+		}
+
+		/////////////////////
+		// setters and getters
+
+		/**
+		* @brief maximum number of bitblocks (determined by the population size)
+		**/
+		int num_blocks() const noexcept { return nBB_; }
+
+		/**
+		* @brief number of bitblocks stored (may contain empty bitblocks after erasing bits)
+		**/
+		std::size_t size() const noexcept { return vBB_.size(); }
+
+		/**
+		* @brief bitblock at position pos, not the pos-th bitblock of the equivalent non-sparse bitset
+		**/
+		BITBOARD block(int pos) const { return vBB_[pos]; }
+
+		/**
+		* @brief index (in the equivalent non-sparse bitset) of the bitblock at position pos
+		**/
+		int block_index(int pos) const { return static_cast<int>(vIdx_[pos]); }
+
+		const IndexVec& indices() const noexcept { return vIdx_; }
+		const BlockVec& blocks() const noexcept { return vBB_; }
+
+		/**
+		* @brief position of the bitblock with index blockID, npos if it does not exist
+		**/
+		int find_block_pos(int blockID) const;
+
+		/**
+		* @brief bitblock with index blockID in the equivalent non-sparse bitset, 0 if it does not exist
+		**/
+		BITBOARD find_block(int blockID) const {
+			const int pos = find_block_pos(blockID);
+			return (pos == BBObject::npos) ? 0 : vBB_[pos];
+		}
+
+		/////////////////////
+		// bit updates
+
+		BitsetSpSoA& set_bit(int bit);
+		BitsetSpSoA& erase_bit(int bit);
+
+		/**
+		* @brief removes all the 1-bits (the memory is kept)
+		**/
+		BitsetSpSoA& erase_bit() {
+			vIdx_.clear();
+			vBB_.clear();
+			return *this;
+		}
+
+		/////////////////////
+		// queries
+
+		bool is_bit(int bit) const { return find_block(WDIV(bit)) & bblock::MASK_BIT(WMOD(bit)); }
+
+		bool is_empty() const noexcept {
+			for (auto bb : vBB_) {
+				if (bb) { return false; }
+			}
+			return true;
+		}
+
+		/**
+		* @brief determines if this bitset and rhs have no 1-bits in common (early exit)
+		**/
+		bool is_disjoint(const BitsetSpSoA& rhs) const;
+
+		/**
+		* @brief number of 1-bits (population count of the bitblock array)
+		**/
+		int count() const { return bbkernel::popcount(vBB_.data(), static_cast<int>(vBB_.size())); }
+
+		/**
+		* @brief first (least significant) 1-bit, noBit if empty
+		**/
+		int lsb() const;
+
+		/////////////////////
+		// conversions and I/O
+
+		/**
+		* @brief 1-bits of the bitset in increasing order
+		**/
+		std::vector<int> to_vector() const;
+
+		std::ostream& print(std::ostream& o = std::cout, bool show_pc = true, bool endl = true) const;
+		std::string to_string() const;
+
+	private:
+
+		template<class InputIt>
+		void set_bits(InputIt first, InputIt last);
+
+		/////////////////////
+		// data members
+
+		IndexVec vIdx_;						//sorted indices of the bitblocks
+		BlockVec vBB_;						//bitblocks, parallel to vIdx_
+		int nBB_;							//maximum number of bitblocks
+	};
+
+	///////////////////
+	//
+	// Inline definitions
+	//
+	///////////////////
+
+	inline
+	BitsetSpSoA::BitsetSpSoA(const BitsetSp& bbs) :
+		nBB_(static_cast<int>(bbs.num_blocks()))
+	{
+		vIdx_.reserve(bbs.size());
+		vBB_.reserve(bbs.size());
+		for (const auto& e : bbs.bitset()) {
+			if (e.bb_) {
+				vIdx_.push_back(static_cast<index_t>(e.idx_));
+				vBB_.push_back(e.bb_);
+			}
+		}
+	}
+
+	inline
+	BitsetSpSoA::operator BitsetSp() const {
+		BitsetSp res = BitsetSp::from_num_blocks(nBB_);
+		auto& v = res.bitset();
+		v.reserve(vBB_.size());
+		for (std::size_t i = 0; i < vBB_.size(); ++i) {
+			v.emplace_back(static_cast<int>(vIdx_[i]), vBB_[i]);
+		}
+		return res;
+	}
+
+	template<class InputIt>
+	inline
+	void BitsetSpSoA::set_bits(InputIt first, InputIt last) {
+		for (; first != last; ++first) {
+			if (*first < 0 || WDIV(*first) >= nBB_) {
+				LOGG_ERROR("bit ", *first, " out of range - BitsetSpSoA::BitsetSpSoA");
+				LOG_ERROR("exiting...");
+				std::exit(EXIT_FAILURE);
+			}
+			set_bit(*first);
+		}
+	}
+
+	inline
+	int BitsetSpSoA::find_block_pos(int blockID) const {
+		auto it = std::lower_bound(vIdx_.cbegin(), vIdx_.cend(), static_cast<index_t>(blockID));
+		if (it != vIdx_.cend() && *it == static_cast<index_t>(blockID)) {
+			return static_cast<int>(it - vIdx_.cbegin());
+		}
+		return BBObject::npos;
+	}
+
+	inline
+	BitsetSpSoA& BitsetSpSoA::set_bit(int bit) {
+
+		//////////////////////////////
+		assert(bit >= 0 && WDIV(bit) < nBB_);
+		//////////////////////////////
+
+		const index_t blockID = WDIV(bit);
+		auto it = std::lower_bound(vIdx_.begin(), vIdx_.end(), blockID);
+		const auto pos = it - vIdx_.begin();
+
+		if (it != vIdx_.end() && *it == blockID) {
+			vBB_[pos] |= bblock::MASK_BIT(WMOD(bit));
+		}
+		else {
+			vIdx_.insert(it, blockID);
+			vBB_.insert(vBB_.begin() + pos, bblock::MASK_BIT(WMOD(bit)));
+		}
+		return *this;
+	}
+
+	inline
+	BitsetSpSoA& BitsetSpSoA::erase_bit(int bit) {
+		const int pos = find_block_pos(WDIV(bit));
+		if (pos != BBObject::npos) {
+			vBB_[pos] &= ~bblock::MASK_BIT(WMOD(bit));
+		}
+		return *this;
+	}
+
+	inline
+	bool BitsetSpSoA::is_disjoint(const BitsetSpSoA& rhs) const {
+		const BITBOARD* bbL = vBB_.data();
+		const BITBOARD* bbR = rhs.vBB_.data();
+		return bbkernel::for_each_common_block_u32(vIdx_.data(), static_cast<int>(vIdx_.size()),
+			rhs.vIdx_.data(), static_cast<int>(rhs.vIdx_.size()),
+			[bbL, bbR](int i, int j) { return !(bbL[i] & bbR[j]); });
+	}
+
+	inline
+	int BitsetSpSoA::lsb() const {
+		for (std::size_t i = 0; i < vBB_.size(); ++i) {
+			if (vBB_[i]) {
+				return bblock::lsb(vBB_[i]) + WMUL(vIdx_[i]);
+			}
+		}
+		return BBObject::noBit;
+	}
+
+	inline
+	std::vector<int> BitsetSpSoA::to_vector() const {
+		std::vector<int> lv;
+		for (std::size_t i = 0; i < vBB_.size(); ++i) {
+			BITBOARD bb = vBB_[i];
+			while (bb) {
+				lv.push_back(bblock::lsb(bb) + WMUL(vIdx_[i]));
+				bb &= bb - 1;
+			}
+		}
+		return lv;
+	}
+
+	inline
+	std::ostream& BitsetSpSoA::print(std::ostream& o, bool show_pc, bool endl) const {
+		o << "[";
+		for (int v : to_vector()) {
+			o << v << " ";
+		}
+		if (show_pc) {
+			o << "(" << count() << ")";
+		}
+		o << "]";
+		if (endl) { o << std::endl; }
+		return o;
+	}
+
+	inline
+	std::string BitsetSpSoA::to_string() const {
+		std::ostringstream sstr;
+		print(sstr, true, false);
+		return sstr.str();
+	}
+
+	///////////////////
+	//
+	// friend functions of BitsetSpSoA
+	//
+	///////////////////
+
+	inline
+	bool operator == (const BitsetSpSoA& lhs, const BitsetSpSoA& rhs) {
+		return (lhs.nBB_ == rhs.nBB_ && lhs.vIdx_ == rhs.vIdx_ && lhs.vBB_ == rhs.vBB_);
+	}
+
+	inline
+	bool operator != (const BitsetSpSoA& lhs, const BitsetSpSoA& rhs) { return !(lhs == rhs); }
+
+	inline
+	BitsetSpSoA& AND(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs, BitsetSpSoA& res) {
+
+		//////////////////////////////
+		assert(&res != &lhs && &res != &rhs);
+		//////////////////////////////
+
+		res.vIdx_.clear();
+		res.vBB_.clear();
+		res.nBB_ = lhs.nBB_;
+
+		const auto n = std::min(lhs.vBB_.size(), rhs.vBB_.size());
+		res.vIdx_.reserve(n);
+		res.vBB_.reserve(n);
+
+		bbkernel::for_each_common_block_u32(lhs.vIdx_.data(), static_cast<int>(lhs.vIdx_.size()),
+			rhs.vIdx_.data(), static_cast<int>(rhs.vIdx_.size()),
+			[&](int i, int j) {
+				const BITBOARD bb = lhs.vBB_[i] & rhs.vBB_[j];
+				if (bb) {
+					res.vIdx_.push_back(lhs.vIdx_[i]);
+					res.vBB_.push_back(bb);
+				}
+				return true;
+			});
+
+		return res;
+	}
+
+	inline
+	int count_and(const BitsetSpSoA& lhs, const BitsetSpSoA& rhs) {
+		const BITBOARD* bbL = lhs.vBB_.data();
+		const BITBOARD* bbR = rhs.vBB_.data();
+
+		//the common bitblocks are gathered in a stack buffer and counted by the bbkernel layer
+		constexpr int NBUF = 32;
+		BITBOARD buf[NBUF];
+		int n = 0, pc = 0;
+		bbkernel::for_each_common_block_u32(lhs.vIdx_.data(), static_cast<int>(lhs.vIdx_.size()),
+			rhs.vIdx_.data(), static_cast<int>(rhs.vIdx_.size()),
+			[&](int i, int j) {
+				buf[n++] = bbL[i] & bbR[j];
+				if (n == NBUF) {
+					pc += bbkernel::popcount(buf, n);
+					n = 0;
+				}
+				return true;
+			});
+		return pc + bbkernel::popcount(buf, n);
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,742 @@
+/**
+ * @file bbset_summary.h
+ * @brief header file of the SummaryBitset class from the BITSCAN library.
+ *		  Dense bitset with a hierarchy of summary bitmaps of its non-empty bitblocks
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: Bit i of the summary level 0 is set iff bitblock i is non-empty, bit i of the summary level l + 1 is set iff
+ *			 the summary word i of level l is non-empty. Levels are added until a level fits in a single word
+ *			 (1 level up to 4096 bits, 2 up to 262144 bits, 3 up to 16M bits...), so that
+ *			 - next / previous bit, lsb, msb and the bitscanning (stateful or not) jump over the empty bitblocks in O(levels)
+ *			 - is_empty() is O(1), count() and the set operations visit only the non-empty bitblocks
+ *			 at the cost of a summary update when a bitblock becomes empty / non-empty (amortized O(1)).
+ *			 Intended for the candidate sets of very large graphs (e.g. a few thousand vertices out of 1M).
+ *			 Generalizes the low / high sentinels of BBSentinel.
+ * @details: The BBScan interface is inherited from _impl::DenseBase (bbset_dense.h), on the summary-driven hooks
+ *			 of this class (see graph/simple_summary_ugraph.h). Bitscanning ranges and fused operations (bits(bb),
+ *			 bits_and(a, b), count_and(a, b)...) are overloaded at the end of the file.
+ * @details: The bitblocks are read-only from outside (block(i) is const), all the writes keep the summaries updated.
+ **/
+
+#ifndef __BBSET_SUMMARY_H__
+#define __BBSET_SUMMARY_H__
+
+#include "bbset_dense.h"
+#include "bbscan_fused.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <vector>
+#include <initializer_list>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// SummaryBitset class
+	//
+	// (dense bitset with summary bitmaps of the non-empty bitblocks)
+	// @details Binary operations accept bitsets of different sizes: the result res of AND, OR and erase_bit
+	//			has the capacity of lhs
+	//
+	///////////////////////////////////
+
+	class SummaryBitset : public _impl::DenseBase<SummaryBitset> {
+
+		using base_type = _impl::DenseBase<SummaryBitset>;
+		friend base_type;
+
+	public:
+
+		enum : int { MAX_LEVELS = 6 };						//up to 2^36 bitblocks
+
+		////////////
+		//construction / destruction
+
+		SummaryBitset() noexcept : nBB_(0), nLevels_(0) { off_[0] = 0; }
+
+		/**
+		* @brief Creates a bitset given a population size nPop
+		* @param val: initial value (TRUE, FALSE) of every bit in the range [0, nPop)
+		**/
+		explicit SummaryBitset(int nPop, bool val = false) { init(nPop, val); }
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		**/
+		template<class ColT>
+		explicit SummaryBitset(int nPop, const ColT& lv) { init(nPop, lv); }
+
+		explicit SummaryBitset(int nPop, std::initializer_list<int> lv) { init(nPop, lv); }
+
+		//Move and copy semantics allowed
+		SummaryBitset(const SummaryBitset&) = default;
+		SummaryBitset(SummaryBitset&&) noexcept = default;
+		SummaryBitset& operator = (const SummaryBitset&) = default;
+		SummaryBitset& operator = (SummaryBitset&&) noexcept = default;
+
+		~SummaryBitset() = default;
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Resets the bitset to nPop bits with value val (allocates memory)
+		**/
+		void init(int nPop, bool val = false);
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		**/
+		template<class ColT>
+		void init(int nPop, const ColT& lv) {
+			init(nPop, false);
+			for (auto bit : lv) {
+				set_bit(static_cast<int>(bit));
+			}
+		}
+
+		void init(int nPop, std::initializer_list<int> lv) {
+			init(nPop, false);
+			for (auto bit : lv) {
+				set_bit(bit);
+			}
+		}
+
+		void reset(int nPop, bool val = false) { init(nPop, val); }
+		void reset(int nPop, const bitpos_list& lv) { init(nPop, lv); }
+
+		void shrink_to_fit() {
+			vBB_.shrink_to_fit();
+			sum_.shrink_to_fit();
+		}
+
+		/////////////////////
+		//setters and getters
+
+		int num_blocks() const noexcept { return nBB_; }
+		std::size_t size() const noexcept { return vBB_.size(); }
+
+		/**
+		* @brief number of summary levels
+		**/
+		int num_levels() const noexcept { return nLevels_; }
+
+		/**
+		* @brief summary words of level l (bit i set iff the word i of level l - 1, or bitblock i for l = 0, is non-empty)
+		**/
+		const BITBOARD* summary(int l) const noexcept { return sum_.data() + off_[l]; }
+		int summary_size(int l) const noexcept { return off_[l + 1] - off_[l]; }
+
+		const BITBOARD* data() const noexcept { return vBB_.data(); }
+
+		BITBOARD block(index_t blockID) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID];
+		}
+
+		/**
+		* @brief index of the first non-empty bitblock in [blockID, num_blocks()), -1 if none - O(levels)
+		**/
+		int next_block(int blockID) const noexcept { return next_set(0, std::max(blockID, 0)); }
+
+		/**
+		* @brief index of the last non-empty bitblock in [0, blockID], -1 if none - O(levels)
+		**/
+		int prev_block(int blockID) const noexcept { return prev_set(0, blockID); }
+
+		/**
+		* @brief index of the first non-empty summary word of level 0 at or after w, -1 if none
+		*		 (the words of level 0 are skipped in blocks of 64 by level 1)
+		**/
+		int next_word(int w) const noexcept {
+			if (nLevels_ == 1) { return (w == 0 && sum_[0]) ? 0 : -1; }
+			return next_set(1, w);
+		}
+
+		/**
+		* @brief Applies f to the index of every non-empty bitblock in increasing order
+		* @details: f may modify the bitblocks of this bitset
+		**/
+		template<class Func>
+		void for_each_block(Func f) const {
+			for (int w = next_word(0); w != -1; w = next_word(w + 1)) {
+				for (BITBOARD bb = sum_[w]; bb; bb &= bb - 1) {
+					f(WMUL(w) + bblock::lsb(bb));
+				}
+			}
+		}
+
+		//////////////////////////////
+		// Bitscanning (with cached info - the scan starts at the first / last non-empty bitblock)
+
+		/**
+		* @brief Configures the initial block and bit position for bitscanning
+		*		 according to one of the 4 scan types passed as argument
+		* @returns -1 if the bitset is empty, 0 otherwise
+		**/
+		int init_scan(scan_types sct) noexcept;
+
+		/**
+		* @brief Configures the initial block and bit position for bitscanning
+		*		 starting from the bit 'firstBit' onwards, excluding 'firstBit'.
+		*		 If firstBit is -1 (BBObject::noBit), the scan starts from the beginning.
+		* @returns -1 if the bitset is empty, 0 otherwise
+		**/
+		int init_scan(int firstBit, scan_types sct) noexcept;
+
+		/////////////////////////////
+		//Boolean functions
+
+		/**
+		* @brief O(1) - the top summary word
+		**/
+		bool is_empty() const noexcept { return (nLevels_ == 0 || sum_[off_[nLevels_ - 1]] == ZERO); }
+
+		/////////////////////
+		// Conversions
+
+		/**
+		* @brief converts the bitset to a vector of 1-bit elements (in increasing order)
+		* @details: decodes the non-empty bitblocks only
+		**/
+		void extract(bitpos_list& lb) const;
+
+		/////////////////
+		// hooks of _impl::DenseBase (only the non-empty bitblocks are visited, the summaries are updated)
+
+	private:
+
+		BITBOARD* wblocks() noexcept { return vBB_.data(); }
+
+		//rebuilds the summaries from the bitblocks
+		void refresh() noexcept;
+
+		//sets / erases the bits of mask in bitblock i
+		void set_bits(int i, BITBOARD mask) noexcept {
+			if (!vBB_[i]) { mark(i); }
+			vBB_[i] |= mask;
+		}
+
+		void erase_bits(int i, BITBOARD mask) noexcept {
+			if (vBB_[i] && !(vBB_[i] &= ~mask)) { unmark(i); }
+		}
+
+		int count_blocks(int firstBlock, int lastBlock) const noexcept;
+
+		void clear_blocks() noexcept {
+			for_each_block([&](int i) { vBB_[i] = ZERO; });
+			std::fill(sum_.begin(), sum_.end(), ZERO);
+		}
+
+		//res has the capacity of lhs
+		SummaryBitset& assign_and(const SummaryBitset& lhs, const SummaryBitset& rhs);
+		SummaryBitset& assign_or(const SummaryBitset& lhs, const SummaryBitset& rhs) noexcept;
+		SummaryBitset& assign_andnot(const SummaryBitset& lhs, const SummaryBitset& rhs) noexcept;
+
+		int first_common(const SummaryBitset& rhs) const noexcept;
+		bool equal_blocks(const SummaryBitset& rhs) const noexcept;
+
+		/////////////////////
+		// summaries
+
+		BITBOARD* level(int l) noexcept { return sum_.data() + off_[l]; }
+
+		//first set bit >= pos in the bitmap of summary level l, -1 if none
+		int next_set(int l, int pos) const noexcept;
+
+		//last set bit <= pos in the bitmap of summary level l, -1 if none
+		int prev_set(int l, int pos) const noexcept;
+
+		//bitblock i has become non-empty / empty
+		void mark(int i) noexcept;
+		void unmark(int i) noexcept;
+
+		/////////////////
+		// data members
+
+		std::vector<BITBOARD> vBB_;							//bitblocks
+		std::vector<BITBOARD> sum_;							//summary words, level by level (bottom-up)
+		int off_[MAX_LEVELS + 1];							//offset of each level in sum_
+		int nBB_;											//number of bitblocks
+		int nLevels_;										//number of summary levels (the top one is a single word)
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation, must be in header file
+
+namespace bitgraph {
+
+	inline
+	void SummaryBitset::init(int nPop, bool val) {
+
+		nBB_ = INDEX_1TO1(nPop);
+		vBB_.assign(nBB_, ZERO);
+
+		//summary levels (at least one)
+		nLevels_ = 0;
+		off_[0] = 0;
+		int n = nBB_;
+		do {
+			if (nLevels_ == MAX_LEVELS) {
+				LOGG_ERROR("population size ", nPop, " too large - SummaryBitset::init");
+				LOG_ERROR("exiting...");
+				std::exit(EXIT_FAILURE);
+			}
+			n = INDEX_1TO1(n);
+			off_[nLevels_ + 1] = off_[nLevels_] + std::max(n, 1);
+			++nLevels_;
+		} while (n > 1);
+		sum_.assign(off_[nLevels_], ZERO);
+
+		if (val && nPop > 0) {
+			set_bit(0, nPop - 1);
+		}
+	}
+
+	inline
+	int SummaryBitset::next_set(int l, int pos) const noexcept {
+
+		//climbs the levels until a word with a 1-bit at or after pos is found
+		int w = 0;
+		BITBOARD bb = ZERO;
+		int lev = l;
+		for (; lev < nLevels_ && lev < MAX_LEVELS; ++lev) {
+			w = WDIV(pos);
+			if (w >= off_[lev + 1] - off_[lev]) {
+				return -1;
+			}
+			bb = sum_[off_[lev] + w] & (ONE << WMOD(pos));
+			if (bb) {
+				break;
+			}
+			pos = w + 1;								//next word of level lev
+		}
+		if (lev == nLevels_ || lev == MAX_LEVELS) {
+			return -1;
+		}
+
+		//descends to level l through the first non-empty words
+		int idx = WMUL(w) + bblock::lsb(bb);
+		while (lev > l) {
+			--lev;
+			idx = WMUL(idx) + bblock::lsb(sum_[off_[lev] + idx]);
+		}
+
+		return idx;
+	}
+
+	inline
+	int SummaryBitset::prev_set(int l, int pos) const noexcept {
+
+		//climbs the levels until a word with a 1-bit at or before pos is found
+		int w = 0;
+		BITBOARD bb = ZERO;
+		int lev = l;
+		for (; lev < nLevels_ && lev < MAX_LEVELS; ++lev) {
+			if (pos < 0) {
+				return -1;
+			}
+			const int nw = off_[lev + 1] - off_[lev];
+			w = WDIV(pos);
+			if (w >= nw) {
+				w = nw - 1;
+				bb = sum_[off_[lev] + w];
+			}
+			else {
+				bb = sum_[off_[lev] + w] & (ONE >> (WORD_SIZE_MINUS_ONE - WMOD(pos)));
+			}
+			if (bb) {
+				break;
+			}
+			pos = w - 1;								//previous word of level lev
+		}
+		if (lev == nLevels_ || lev == MAX_LEVELS) {
+			return -1;
+		}
+
+		//descends to level l through the last non-empty words
+		int idx = WMUL(w) + bblock::msb(bb);
+		while (lev > l) {
+			--lev;
+			idx = WMUL(idx) + bblock::msb(sum_[off_[lev] + idx]);
+		}
+
+		return idx;
+	}
+
+	inline
+	void SummaryBitset::mark(int i) noexcept {
+		for (int l = 0; l < nLevels_; ++l) {
+			BITBOARD& s = sum_[off_[l] + WDIV(i)];
+			const bool wasEmpty = (s == ZERO);
+			s |= bblock::MASK_BIT(WMOD(i));
+			if (!wasEmpty) { break; }
+			i = WDIV(i);
+		}
+	}
+
+	inline
+	void SummaryBitset::unmark(int i) noexcept {
+		for (int l = 0; l < nLevels_; ++l) {
+			BITBOARD& s = sum_[off_[l] + WDIV(i)];
+			if ((s &= ~bblock::MASK_BIT(WMOD(i))) != ZERO) { break; }
+			i = WDIV(i);
+		}
+	}
+
+	inline
+	int SummaryBitset::init_scan(scan_types sct) noexcept {
+
+		if (is_empty()) {
+			return -1;
+		}
+
+		switch (sct) {
+		case BBObject::NON_DESTRUCTIVE:
+			scan_block(next_block(0));
+			scan_bit(MASK_LIM);
+			break;
+		case BBObject::NON_DESTRUCTIVE_REVERSE:
+			scan_block(prev_block(nBB_ - 1));
+			scan_bit(WORD_SIZE);		//mask_low[WORD_SIZE] = ONE
+			break;
+		case BBObject::DESTRUCTIVE:
+			scan_block(next_block(0));
+			break;
+		case BBObject::DESTRUCTIVE_REVERSE:
+			scan_block(prev_block(nBB_ - 1));
+			break;
+		default:
+			assert(false && "unknown scan type - SummaryBitset::init_scan");
+		}
+
+		return 0;
+	}
+
+	inline
+	int SummaryBitset::init_scan(int firstBit, scan_types sct) noexcept {
+
+		//special case - first bitscan
+		if (firstBit == BBObject::noBit) {
+			return init_scan(sct);
+		}
+
+		base_type::init_scan(firstBit, sct);
+		return (is_empty() ? -1 : 0);
+	}
+
+	inline
+	void SummaryBitset::refresh() noexcept {
+		std::fill(sum_.begin(), sum_.end(), ZERO);
+		for (int i = 0; i < nBB_; ++i) {
+			if (vBB_[i]) { mark(i); }
+		}
+	}
+
+	inline
+	int SummaryBitset::count_blocks(int firstBlock, int lastBlock) const noexcept {
+
+		int pc = 0;
+		if (firstBlock == 0 && lastBlock == nBB_ - 1) {
+			for_each_block([&](int i) { pc += bblock::popc64(vBB_[i]); });
+		}
+		else {
+			for (int i = next_block(firstBlock); i != -1 && i <= lastBlock; i = next_block(i + 1)) {
+				pc += bblock::popc64(vBB_[i]);
+			}
+		}
+		return pc;
+	}
+
+	/////////////////////
+	// Set operations
+
+	namespace _impl {
+
+		/**
+		* @brief Applies f to the index of every bitblock which is non-empty in both lhs and rhs, in increasing order,
+		*		 until f returns TRUE (only the summary words of level 0 which are non-empty in lhs are visited)
+		* @returns TRUE if f returned TRUE (early exit), FALSE otherwise
+		**/
+		template<class Func>
+		inline
+		bool for_each_common_block(const SummaryBitset& lhs, const SummaryBitset& rhs, Func f) {
+			const BITBOARD* sl = lhs.summary(0);
+			const BITBOARD* sr = rhs.summary(0);
+			const int nW = rhs.summary_size(0);
+			for (int w = lhs.next_word(0); w != -1 && w < nW; w = lhs.next_word(w + 1)) {
+				for (BITBOARD bb = sl[w] & sr[w]; bb; bb &= bb - 1) {
+					if (f(WMUL(w) + bblock::lsb(bb))) { return true; }
+				}
+			}
+			return false;
+		}
+	}
+
+	inline
+	SummaryBitset& SummaryBitset::assign_and(const SummaryBitset& lhs, const SummaryBitset& rhs) {
+
+		//in place: only the non-empty bitblocks of this bitset are visited
+		if (&lhs == this) {
+			for_each_block([&](int i) { erase_bits(i, (i < rhs.nBB_) ? ~rhs.vBB_[i] : ONE); });
+			return *this;
+		}
+
+		if (nBB_ != lhs.nBB_) {
+			init(WMUL(lhs.nBB_));
+		}
+		else {
+			clear_blocks();
+		}
+
+		_impl::for_each_common_block(lhs, rhs, [&](int i) {
+			const BITBOARD bb = lhs.vBB_[i] & rhs.vBB_[i];
+			if (bb) { set_bits(i, bb); }
+			return false;
+		});
+
+		return *this;
+	}
+
+	inline
+	SummaryBitset& SummaryBitset::assign_or(const SummaryBitset& lhs, const SummaryBitset& rhs) noexcept {
+
+		if (&lhs != this) {
+			*this = lhs;
+		}
+
+		const int nBB = std::min(nBB_, rhs.nBB_);
+		rhs.for_each_block([&](int i) { if (i < nBB) { set_bits(i, rhs.vBB_[i]); } });
+		return *this;
+	}
+
+	inline
+	SummaryBitset& SummaryBitset::assign_andnot(const SummaryBitset& lhs, const SummaryBitset& rhs) noexcept {
+
+		if (&lhs != this) {
+			*this = lhs;
+		}
+
+		const int nBB = std::min(nBB_, rhs.nBB_);
+		rhs.for_each_block([&](int i) { if (i < nBB) { erase_bits(i, rhs.vBB_[i]); } });
+		return *this;
+	}
+
+	inline
+	int SummaryBitset::first_common(const SummaryBitset& rhs) const noexcept {
+		int bit = BBObject::noBit;
+		_impl::for_each_common_block(*this, rhs, [&](int i) {
+			const BITBOARD bb = vBB_[i] & rhs.vBB_[i];
+			if (bb) { bit = WMUL(i) + bblock::lsb(bb); }
+			return (bb != ZERO);
+		});
+		return bit;
+	}
+
+	inline
+	bool SummaryBitset::equal_blocks(const SummaryBitset& rhs) const noexcept {
+		if (nBB_ != rhs.nBB_ || sum_ != rhs.sum_) {
+			return false;
+		}
+		bool equal = true;
+		for_each_block([&](int i) { equal = equal && (vBB_[i] == rhs.vBB_[i]); });
+		return equal;
+	}
+
+	/////////////////////
+	// Conversions
+
+	inline
+	void SummaryBitset::extract(bitpos_list& lb) const {
+
+		lb.resize(count() + bbkernel::DECODE_PAD);
+
+		int n = 0;
+		for_each_block([&](int i) { n += bbkernel::decode(vBB_.data() + i, 1, WMUL(i), lb.data() + n); });
+		lb.resize(n);
+	}
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// Bitscanning ranges and fused operations for SummaryBitset
+// (overloads of bbscan_iter.h and bbscan_fused.h - only the non-empty bitblocks are visited)
+//
+///////////////////////
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////////////////
+		//
+		// Cursors of SummaryBitset
+		//
+		// (produce the non-empty bitblocks of bb, a & b or a & ~b in increasing order - same protocol
+		//  as the cursors of bbscan_fused.h)
+		//
+		///////////////////////////////////
+
+		class SummaryCursor {
+		public:
+			explicit SummaryCursor(const SummaryBitset& bb) noexcept :
+				bb_(&bb), w_(bb.next_word(0)), pend_((w_ == -1) ? ZERO : bb.summary(0)[w_])
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				while (!pend_) {
+					if (w_ == -1 || (w_ = bb_->next_word(w_ + 1)) == -1) {
+						return false;
+					}
+					pend_ = bb_->summary(0)[w_];
+				}
+				idx = WMUL(w_) + bblock::lsb(pend_);
+				pend_ &= pend_ - 1;
+				bb = bb_->block(idx);
+				return true;
+			}
+
+		private:
+			const SummaryBitset* bb_;
+			int w_;									//current summary word of level 0
+			BITBOARD pend_;							//bitblocks of w_ not yet visited
+		};
+
+		template<class OpT>
+		class SummaryFusedCursor2 {
+		public:
+			SummaryFusedCursor2(const SummaryBitset& lhs, const SummaryBitset& rhs) noexcept :
+				lhs_(&lhs), rhs_(&rhs), w_(lhs.next_word(0)), pend_(candidates(w_))
+			{}
+
+			bool next(int& idx, BITBOARD& bb) noexcept {
+				for (;;) {
+					while (!pend_) {
+						if (w_ == -1 || (w_ = lhs_->next_word(w_ + 1)) == -1) {
+							return false;
+						}
+						pend_ = candidates(w_);
+					}
+					const int i = WMUL(w_) + bblock::lsb(pend_);
+					pend_ &= pend_ - 1;
+					const BITBOARD bbr = (i < rhs_->num_blocks()) ? rhs_->block(i) : ZERO;
+					if ((bb = OpT::apply(lhs_->block(i), bbr))) {
+						idx = i;
+						return true;
+					}
+				}
+			}
+
+		private:
+
+			//bitblocks of the summary word w which may contribute (non-empty in lhs, and in rhs if required)
+			BITBOARD candidates(int w) const noexcept {
+				if (w == -1) { return ZERO; }
+				BITBOARD bb = lhs_->summary(0)[w];
+				if (!OpT::rhs_optional) {
+					bb &= (w < rhs_->summary_size(0)) ? rhs_->summary(0)[w] : ZERO;
+				}
+				return bb;
+			}
+
+			const SummaryBitset* lhs_;
+			const SummaryBitset* rhs_;
+			int w_;									//current summary word of level 0
+			BITBOARD pend_;							//candidate bitblocks of w_ not yet visited
+		};
+
+	}//end namespace _impl
+
+	/**
+	* @brief range of the 1-bits of bb in increasing order (non-destructive)
+	*		 usage: for (int v : bits(bb)) {...}
+	* @details: bb must not be modified during the scan
+	**/
+	inline
+	auto bits(const SummaryBitset& bb) {
+		return _impl::make_fused_range(_impl::SummaryCursor(bb));
+	}
+
+	/**
+	* @brief Applies f to every 1-bit of bb in increasing order (non-destructive)
+	**/
+	template<class Func>
+	inline
+	void for_each_bit(const SummaryBitset& bb, Func f) {
+		_impl::for_each_fused(_impl::SummaryCursor(bb), f);
+	}
+
+	/**
+	* @brief range of the 1-bits of a & b in increasing order, no bitset is built
+	**/
+	inline
+	auto bits_and(const SummaryBitset& a, const SummaryBitset& b) {
+		return _impl::make_fused_range(_impl::SummaryFusedCursor2<_impl::fused_and>(a, b));
+	}
+
+	/**
+	* @brief range of the 1-bits of a & ~b in increasing order, no bitset is built
+	**/
+	inline
+	auto bits_andnot(const SummaryBitset& a, const SummaryBitset& b) {
+		return _impl::make_fused_range(_impl::SummaryFusedCursor2<_impl::fused_andnot>(a, b));
+	}
+
+	template<class Func>
+	inline
+	void for_each_bit_and(const SummaryBitset& a, const SummaryBitset& b, Func f) {
+		_impl::for_each_fused(_impl::SummaryFusedCursor2<_impl::fused_and>(a, b), f);
+	}
+
+	template<class Func>
+	inline
+	void for_each_bit_andnot(const SummaryBitset& a, const SummaryBitset& b, Func f) {
+		_impl::for_each_fused(_impl::SummaryFusedCursor2<_impl::fused_andnot>(a, b), f);
+	}
+
+	/**
+	* @brief number of 1-bits in a & b, no bitset is built
+	**/
+	inline
+	int count_and(const SummaryBitset& a, const SummaryBitset& b) {
+		int pc = 0;
+		_impl::for_each_common_block(a, b, [&](int i) {
+			pc += bblock::popc64(a.block(i) & b.block(i));
+			return false;
+		});
+		return pc;
+	}
+
+	/**
+	* @brief number of 1-bits in a & ~b, no bitset is built
+	**/
+	inline
+	int count_andnot(const SummaryBitset& a, const SummaryBitset& b) {
+		return a.count() - count_and(a, b);
+	}
+
+	/**
+	* @brief determines if a & b has at least k 1-bits (early exit)
+	**/
+	inline
+	bool intersects_at_least(const SummaryBitset& a, const SummaryBitset& b, int k) {
+		if (k <= 0) { return true; }
+
+		int pc = 0;
+		return _impl::for_each_common_block(a, b, [&](int i) {
+			return ((pc += bblock::popc64(a.block(i) & b.block(i))) >= k);
+		});
+	}
+
+}//end namespace bitgraph
+
+#endif
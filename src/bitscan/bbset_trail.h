@@ -0,0 +1,268 @@
+/**
+ * @file bbset_trail.h
+ * @brief header file of the TrailedBitset class from the BITSCAN library.
+ *		  Bitset with an undo log (trail) of the modified bitblocks for backtracking
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: Every mutating operation records the old bitblocks it modifies in the trail:
+ *			 - single bit updates: (block index, old bitblock), only if the bitblock changes, and once for consecutive
+ *			   updates of the same bitblock since the last checkpoint
+ *			 - block range operations (&=, AND_block, erase_block...): a copy of the range, the operation itself
+ *			   runs on the vectorized kernels (bbkernel.h)
+ * @details: checkpoint() / rollback(cp) replace the copy of the bitset at each node of a tree search:
+ *			 rollback is O(bitblocks recorded since cp), instead of O(n/64) for the copy.
+ *			 Typical use: cp = bb.checkpoint(); for each child { ...modify bb...; recurse; bb.rollback(cp); }
+ *			 (rollback keeps cp active, so it may be called once per child).
+ * @details: Modifications before the first checkpoint (or after clear_trail()) are not recorded.
+ **/
+
+#ifndef __BBSET_TRAIL_H__
+#define __BBSET_TRAIL_H__
+
+#include "bbset.h"
+#include "bitblock.h"
+#include "bbkernel.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	/////////////////////////////////
+	//
+	// TrailedBitset class
+	//
+	// (owns a bitset of type BitsetT - Bitset or derived non-sparse types such as BBScan)
+	//
+	///////////////////////////////////
+
+	template<class BitsetT = Bitset>
+	class TrailedBitset {
+
+	public:
+
+		using bitset_type = BitsetT;
+
+		/**
+		* @brief position of the trail, returned by checkpoint()
+		**/
+		struct checkpoint_t {
+			std::size_t pos;
+		};
+
+		////////////
+		//construction / destruction
+
+		TrailedBitset() = default;
+
+		/**
+		* @brief Creates an empty bitset of population size nPop (empty trail)
+		**/
+		explicit TrailedBitset(std::size_t nPop) : bb_(nPop) {}
+
+		/**
+		* @brief Creates a trailed copy of bb (empty trail)
+		**/
+		explicit TrailedBitset(BitsetT bb) : bb_(std::move(bb)) {}
+
+		//Move and copy semantics allowed (the trail is copied)
+		TrailedBitset(const TrailedBitset&) = default;
+		TrailedBitset(TrailedBitset&&) noexcept = default;
+		TrailedBitset& operator = (const TrailedBitset&) = default;
+		TrailedBitset& operator = (TrailedBitset&&) noexcept = default;
+
+		~TrailedBitset() = default;
+
+		/**
+		* @brief sets the contents to bb and clears the trail (not recorded)
+		**/
+		void assign(const BitsetT& bb) {
+			bb_ = bb;
+			clear_trail();
+		}
+
+		/**
+		* @brief resets to an empty bitset of population size nPop and clears the trail
+		**/
+		void reset(std::size_t nPop) {
+			bb_.reset(nPop);
+			clear_trail();
+		}
+
+		/////////////////////
+		//setters and getters (read-only access to the bitset, e.g. bits(tbb.bitset()))
+
+		const BitsetT& bitset()		const noexcept { return bb_; }
+		int num_blocks()			const noexcept { return bb_.num_blocks(); }
+		BITBOARD block(int blockID)	const { return bb_.block(blockID); }
+
+		bool is_bit(int bit)		const { return bb_.is_bit(bit); }
+		bool is_empty()				const { return bb_.is_empty(); }
+		int count()					const { return bb_.count(); }
+		int lsb()					const { return bb_.lsb(); }
+
+		/**
+		* @brief number of bitblocks recorded in the trail
+		**/
+		std::size_t trail_size()	const noexcept { return words_.size(); }
+
+		/////////////////////
+		// Checkpoints
+
+		/**
+		* @brief opens a new checkpoint - the following modifications are undone by rollback
+		* @returns the checkpoint to be passed to rollback
+		**/
+		checkpoint_t checkpoint() noexcept {
+			cp_ = entries_.size();
+			active_ = true;
+			return checkpoint_t{ cp_ };
+		}
+
+		/**
+		* @brief restores the bitset as it was when cp was taken, O(bitblocks recorded since cp)
+		* @details: cp remains active (e.g. one rollback per child of a search node), later checkpoints are discarded
+		**/
+		void rollback(const checkpoint_t& cp) {
+
+			assert(cp.pos <= entries_.size());
+
+			BITBOARD* pbb = bb_.bitset().data();
+			while (entries_.size() > cp.pos) {
+				const entry_t& e = entries_.back();
+				const std::size_t off = words_.size() - e.n;
+				std::copy(words_.begin() + off, words_.end(), pbb + e.first);
+				words_.resize(off);
+				entries_.pop_back();
+			}
+			cp_ = cp.pos;
+		}
+
+		/**
+		* @brief clears the trail and all the checkpoints (the bitset is not modified)
+		**/
+		void clear_trail() noexcept {
+			entries_.clear();
+			words_.clear();
+			cp_ = 0;
+			active_ = false;
+		}
+
+		/////////////////////
+		// Bit updates (recorded)
+
+		/**
+		* @brief sets bitblock blockID to bb
+		**/
+		void set_block(int blockID, BITBOARD bb) {
+			BITBOARD& w = bb_.block(blockID);
+			if (w != bb) {
+				save(blockID, w);
+				w = bb;
+			}
+		}
+
+		TrailedBitset& set_bit(int bit) {
+			set_block(WDIV(bit), bb_.block(WDIV(bit)) | bblock::MASK_BIT(WMOD(bit)));
+			return *this;
+		}
+
+		TrailedBitset& erase_bit(int bit) {
+			set_block(WDIV(bit), bb_.block(WDIV(bit)) & ~bblock::MASK_BIT(WMOD(bit)));
+			return *this;
+		}
+
+		/**
+		* @brief removes the least significant 1-bit
+		* @returns the bit removed or BBObject::noBit if the bitset is empty (destructive scan, e.g. branching)
+		**/
+		int pop_lsb() {
+			const int bit = bb_.lsb();
+			if (bit != BBObject::noBit) { erase_bit(bit); }
+			return bit;
+		}
+
+		/**
+		* @brief AND with rhs (same number of bitblocks)
+		**/
+		TrailedBitset& operator &= (const Bitset& rhs) {
+			return AND_block(0, num_blocks() - 1, rhs);
+		}
+
+		/**
+		* @brief OR with rhs (same number of bitblocks)
+		**/
+		TrailedBitset& operator |= (const Bitset& rhs) {
+			assert(rhs.num_blocks() >= num_blocks());
+			bbkernel::or_assign(save(0, num_blocks() - 1), rhs.bitset().data(), num_blocks());
+			return *this;
+		}
+
+		/**
+		* @brief removes the 1-bits of rhs (same number of bitblocks)
+		**/
+		TrailedBitset& erase_bit(const Bitset& rhs) {
+			return erase_block(0, num_blocks() - 1, rhs);
+		}
+
+		/**
+		* @brief AND with rhs in the closed range of bitblocks [firstBlock, lastBlock], the rest is not modified
+		**/
+		TrailedBitset& AND_block(int firstBlock, int lastBlock, const Bitset& rhs) {
+			assert(firstBlock >= 0 && lastBlock < num_blocks() && lastBlock < rhs.num_blocks());
+			if (firstBlock <= lastBlock) {
+				bbkernel::and_assign(save(firstBlock, lastBlock), rhs.bitset().data() + firstBlock, lastBlock - firstBlock + 1);
+			}
+			return *this;
+		}
+
+		/**
+		* @brief removes the 1-bits of rhs in the closed range of bitblocks [firstBlock, lastBlock]
+		**/
+		TrailedBitset& erase_block(int firstBlock, int lastBlock, const Bitset& rhs) {
+			assert(firstBlock >= 0 && lastBlock < num_blocks() && lastBlock < rhs.num_blocks());
+			if (firstBlock <= lastBlock) {
+				bbkernel::andnot_assign(save(firstBlock, lastBlock), rhs.bitset().data() + firstBlock, lastBlock - firstBlock + 1);
+			}
+			return *this;
+		}
+
+		/////////////////
+		// data members
+	private:
+
+		struct entry_t {
+			int first;										//first bitblock recorded
+			int n;											//number of bitblocks recorded
+		};
+
+		//records the old value of bitblock blockID (skipped if it is the last entry, recorded after the last checkpoint)
+		void save(int blockID, BITBOARD old) {
+			if (!active_) { return; }
+			if (entries_.size() > cp_ && entries_.back().first == blockID && entries_.back().n == 1) { return; }
+			entries_.push_back(entry_t{ blockID, 1 });
+			words_.push_back(old);
+		}
+
+		//records the closed range of bitblocks [firstBlock, lastBlock], returns a pointer to firstBlock
+		BITBOARD* save(int firstBlock, int lastBlock) {
+			BITBOARD* pbb = bb_.bitset().data() + firstBlock;
+			if (!active_) { return pbb; }
+			entries_.push_back(entry_t{ firstBlock, lastBlock - firstBlock + 1 });
+			words_.insert(words_.end(), pbb, pbb + (lastBlock - firstBlock + 1));
+			return pbb;
+		}
+
+		BitsetT bb_;
+		std::vector<entry_t> entries_;						//undo log: ranges of bitblocks
+		std::vector<BITBOARD> words_;						//undo log: old bitblocks of the ranges (in entry order)
+		std::size_t cp_ = 0;								//trail position of the last checkpoint
+		bool active_ = false;								//FALSE before the first checkpoint (modifications not recorded)
+	};
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_TRAIL_H__
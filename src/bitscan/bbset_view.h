@@ -0,0 +1,413 @@
+/**
+ * @file bbset_view.h
+ * @brief header file of the ConstBitsetView and BitsetView classes from the BITSCAN library.
+ *		  Non-owning views (pointer + number of bitblocks) over external bitblock memory
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: Same block layout as Bitset (bit i in bitblock WDIV(i), position WMOD(i)), so that rows of a
+ *			 memory-mapped file, slices of a larger buffer, BitsetArena rows or the storage of a Bitset / BBScan
+ *			 (Bitset::view()) can be operated in place, without copies.
+ *			 - ConstBitsetView: read-only API (bitscanning, popcount, is_bit, is_disjoint, intersections...)
+ *			 - BitsetView: ConstBitsetView + mutating API (set_bit, erase_bit, &=, |=...) on the viewed memory
+ * @details: Views are cheap to copy (two words) and are passed by value. The viewed memory must outlive the view,
+ *			 and views of a Bitset are invalidated when the bitset is reallocated (e.g. reset).
+ * @details: Iterator-based bitscanning also works on views, e.g. for (int v : bits(bb.view())) {...} (bbscan_iter.h)
+ **/
+
+#ifndef __BBSET_VIEW_H__
+#define __BBSET_VIEW_H__
+
+#include "bbobject.h"
+#include "bitblock.h"
+#include "bbkernel.h"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//TRUE if bb.bitset().data() is a pointer to (possibly const) BITBOARD - non-sparse bitsets
+		template<class BitsetT, class PtrT, class = void>
+		struct has_dense_blocks : std::false_type {};
+
+		template<class BitsetT, class PtrT>
+		struct has_dense_blocks<BitsetT, PtrT, typename std::enable_if<
+			std::is_convertible<decltype(std::declval<BitsetT&>().bitset().data()), PtrT>::value>::type> : std::true_type {};
+	}
+
+	/////////////////////////////////
+	//
+	// ConstBitsetView class
+	//
+	// (read-only, non-owning view of nBB bitblocks)
+	//
+	///////////////////////////////////
+
+	class ConstBitsetView {
+
+	public:
+
+		////////////
+		//construction / destruction
+
+		ConstBitsetView() noexcept : pBB_(nullptr), nBB_(0) {}
+
+		/**
+		* @brief view of the nBB bitblocks starting at pBB
+		**/
+		ConstBitsetView(const BITBOARD* pBB, int nBB) noexcept : pBB_(pBB), nBB_(nBB) { assert(nBB >= 0); }
+
+		/**
+		* @brief view of all the bitblocks of a non-sparse bitset (Bitset, BBScan, BBSentinel...)
+		**/
+		template<class BitsetT, class = typename std::enable_if<_impl::has_dense_blocks<const BitsetT, const BITBOARD*>::value>::type>
+		ConstBitsetView(const BitsetT& bb) noexcept : pBB_(bb.bitset().data()), nBB_(bb.num_blocks()) {}
+
+		/////////////////////
+		//setters and getters
+
+		const BITBOARD* data()		const noexcept { return pBB_; }
+		int num_blocks()			const noexcept { return nBB_; }
+
+		BITBOARD block(int blockID)	const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return pBB_[blockID];
+		}
+
+		/**
+		* @brief view of the closed range of bitblocks [firstBlock, lastBlock]
+		* @details: bit positions of the subview are relative to firstBlock
+		**/
+		ConstBitsetView subview(int firstBlock, int lastBlock) const {
+			assert(firstBlock >= 0 && lastBlock < nBB_ && firstBlock <= lastBlock + 1);
+			return ConstBitsetView(pBB_ + firstBlock, lastBlock - firstBlock + 1);
+		}
+
+		/////////////////////
+		// Bitscanning (stateless)
+
+		/**
+		* @brief index of the least significant 1-bit, BBObject::noBit if the view is empty
+		**/
+		int lsb() const;
+
+		/**
+		* @brief index of the most significant 1-bit, BBObject::noBit if the view is empty
+		**/
+		int msb() const;
+
+		/**
+		* @brief next 1-bit after bit, the least significant 1-bit if bit == BBObject::noBit
+		* @returns the next 1-bit or BBObject::noBit if there are no more bits
+		**/
+		int next_bit(int bit) const;
+
+		/**
+		* @brief previous 1-bit before bit, the most significant 1-bit if bit == BBObject::noBit
+		* @returns the previous 1-bit or BBObject::noBit if there are no more bits
+		**/
+		int prev_bit(int bit) const;
+
+		/////////////////////
+		// Queries
+
+		bool is_bit(int bit) const {
+			assert(bit >= 0 && WDIV(bit) < nBB_);
+			return (pBB_[WDIV(bit)] & bblock::MASK_BIT(WMOD(bit))) != 0;
+		}
+
+		bool is_empty() const {
+			for (int i = 0; i < nBB_; ++i) {
+				if (pBB_[i]) { return false; }
+			}
+			return true;
+		}
+
+		int count()	const { return bbkernel::popcount(pBB_, nBB_); }
+
+		/**
+		* @brief TRUE if there are no 1-bits in common with rhs (bitblocks beyond the shorter view are ignored)
+		**/
+		bool is_disjoint(ConstBitsetView rhs) const {
+			const int nBB = std::min(nBB_, rhs.nBB_);
+			return bbkernel::first_common(pBB_, rhs.pBB_, nBB) == nBB;
+		}
+
+		/**
+		* @brief number of 1-bits in common with rhs (bitblocks beyond the shorter view are ignored)
+		**/
+		int count_and(ConstBitsetView rhs) const {
+			return bbkernel::popcount_and(pBB_, rhs.pBB_, std::min(nBB_, rhs.nBB_));
+		}
+
+		/**
+		* @brief first 1-bit in common with rhs, BBObject::noBit if disjoint
+		**/
+		int find_first_common(ConstBitsetView rhs) const;
+
+		/////////////////////
+		// Conversions
+
+		/**
+		* @brief writes the 1-bits in out in ascending order (batched decoding)
+		* @param out: output array with room for count() + bbkernel::DECODE_PAD ints (external ownership)
+		* @returns number of bits written
+		**/
+		int decode(int* out) const { return bbkernel::decode(pBB_, nBB_, 0, out); }
+
+		/**
+		* @brief appends the 1-bits to lv in ascending order
+		**/
+		std::vector<int>& extract(std::vector<int>& lv) const;
+
+		std::vector<int> to_vector() const {
+			std::vector<int> lv;
+			return extract(lv);
+		}
+
+		/**
+		* @brief TRUE if both views have the same number of bitblocks and the same contents
+		**/
+		friend bool operator == (ConstBitsetView lhs, ConstBitsetView rhs) {
+			return lhs.nBB_ == rhs.nBB_ && std::equal(lhs.pBB_, lhs.pBB_ + lhs.nBB_, rhs.pBB_);
+		}
+		friend bool operator != (ConstBitsetView lhs, ConstBitsetView rhs) { return !(lhs == rhs); }
+
+		/////////////////
+		// data members
+	protected:
+
+		const BITBOARD* pBB_;								//first bitblock (external ownership)
+		int nBB_;											//number of bitblocks
+	};
+
+	/////////////////////////////////
+	//
+	// BitsetView class
+	//
+	// (writable, non-owning view of nBB bitblocks - the read-only API is that of ConstBitsetView)
+	//
+	///////////////////////////////////
+
+	class BitsetView : public ConstBitsetView {
+
+	public:
+
+		////////////
+		//construction / destruction
+
+		BitsetView() noexcept = default;
+
+		/**
+		* @brief writable view of the nBB bitblocks starting at pBB
+		**/
+		BitsetView(BITBOARD* pBB, int nBB) noexcept : ConstBitsetView(pBB, nBB) {}
+
+		/**
+		* @brief writable view of all the bitblocks of a non-sparse bitset (Bitset, BBScan, BBSentinel...)
+		**/
+		template<class BitsetT, class = typename std::enable_if<
+			!std::is_const<BitsetT>::value && _impl::has_dense_blocks<BitsetT, BITBOARD*>::value>::type>
+		BitsetView(BitsetT& bb) noexcept : ConstBitsetView(bb.bitset().data(), bb.num_blocks()) {}
+
+		/////////////////////
+		//setters and getters
+
+		//the viewed memory is writable (constructors only accept non-const pointers)
+		BITBOARD* data()			const noexcept { return const_cast<BITBOARD*>(pBB_); }
+
+		BITBOARD& block(int blockID) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return data()[blockID];
+		}
+
+		BitsetView subview(int firstBlock, int lastBlock) const {
+			assert(firstBlock >= 0 && lastBlock < nBB_ && firstBlock <= lastBlock + 1);
+			return BitsetView(data() + firstBlock, lastBlock - firstBlock + 1);
+		}
+
+		/////////////////////
+		// Bit updates (operate on the viewed memory, const as in std::span)
+
+		const BitsetView& set_bit(int bit) const {
+			assert(bit >= 0 && WDIV(bit) < nBB_);
+			data()[WDIV(bit)] |= bblock::MASK_BIT(WMOD(bit));
+			return *this;
+		}
+
+		const BitsetView& erase_bit(int bit) const {
+			assert(bit >= 0 && WDIV(bit) < nBB_);
+			data()[WDIV(bit)] &= ~bblock::MASK_BIT(WMOD(bit));
+			return *this;
+		}
+
+		/**
+		* @brief sets all the bits of the view to 0
+		**/
+		const BitsetView& erase_bit() const {
+			std::fill(data(), data() + nBB_, ZERO);
+			return *this;
+		}
+
+		/**
+		* @brief sets all the bits of the view to 1 (including the bits of the last bitblock beyond the population size)
+		**/
+		const BitsetView& set_bit() const {
+			std::fill(data(), data() + nBB_, ONE);
+			return *this;
+		}
+
+		/**
+		* @brief removes the least significant 1-bit
+		* @returns the bit removed or BBObject::noBit if the view is empty
+		**/
+		int pop_lsb() const {
+			const int bit = lsb();
+			if (bit != BBObject::noBit) { erase_bit(bit); }
+			return bit;
+		}
+
+		/**
+		* @brief copies the bitblocks of rhs (same number of bitblocks or more)
+		**/
+		const BitsetView& assign(ConstBitsetView rhs) const {
+			assert(rhs.num_blocks() >= nBB_);
+			std::copy(rhs.data(), rhs.data() + nBB_, data());
+			return *this;
+		}
+
+		/**
+		* @brief AND, OR and removal of the 1-bits of rhs (same number of bitblocks or more)
+		**/
+		const BitsetView& operator &= (ConstBitsetView rhs) const {
+			assert(rhs.num_blocks() >= nBB_);
+			bbkernel::and_assign(data(), rhs.data(), nBB_);
+			return *this;
+		}
+
+		const BitsetView& operator |= (ConstBitsetView rhs) const {
+			assert(rhs.num_blocks() >= nBB_);
+			bbkernel::or_assign(data(), rhs.data(), nBB_);
+			return *this;
+		}
+
+		const BitsetView& operator ^= (ConstBitsetView rhs) const {
+			assert(rhs.num_blocks() >= nBB_);
+			bbkernel::xor_assign(data(), rhs.data(), nBB_);
+			return *this;
+		}
+
+		const BitsetView& erase_bit(ConstBitsetView rhs) const {
+			assert(rhs.num_blocks() >= nBB_);
+			bbkernel::andnot_assign(data(), rhs.data(), nBB_);
+			return *this;
+		}
+	};
+
+	//////////////////////////
+	//
+	// Set operations into a view (res must have the same number of bitblocks as lhs and rhs or less)
+	//
+	//////////////////////////
+
+	inline
+	BitsetView AND(ConstBitsetView lhs, ConstBitsetView rhs, BitsetView res) {
+		assert(lhs.num_blocks() >= res.num_blocks() && rhs.num_blocks() >= res.num_blocks());
+		bbkernel::and_to(res.data(), lhs.data(), rhs.data(), res.num_blocks());
+		return res;
+	}
+
+	inline
+	BitsetView OR(ConstBitsetView lhs, ConstBitsetView rhs, BitsetView res) {
+		assert(lhs.num_blocks() >= res.num_blocks() && rhs.num_blocks() >= res.num_blocks());
+		bbkernel::or_to(res.data(), lhs.data(), rhs.data(), res.num_blocks());
+		return res;
+	}
+
+	/**
+	* @brief res = lhs \ rhs
+	**/
+	inline
+	BitsetView erase_bit(ConstBitsetView lhs, ConstBitsetView rhs, BitsetView res) {
+		assert(lhs.num_blocks() >= res.num_blocks() && rhs.num_blocks() >= res.num_blocks());
+		bbkernel::andnot_to(res.data(), lhs.data(), rhs.data(), res.num_blocks());
+		return res;
+	}
+
+	///////////////////////
+	// ConstBitsetView - implementation
+
+	inline
+	int ConstBitsetView::lsb() const {
+		for (int i = 0; i < nBB_; ++i) {
+			if (pBB_[i]) { return bblock::lsb(pBB_[i]) + WMUL(i); }
+		}
+		return BBObject::noBit;
+	}
+
+	inline
+	int ConstBitsetView::msb() const {
+		for (int i = nBB_ - 1; i >= 0; --i) {
+			if (pBB_[i]) { return bblock::msb(pBB_[i]) + WMUL(i); }
+		}
+		return BBObject::noBit;
+	}
+
+	inline
+	int ConstBitsetView::next_bit(int bit) const {
+
+		if (bit == BBObject::noBit) { return lsb(); }
+
+		//trims the bitblock of bit
+		int i = WDIV(bit);
+		const int pos = WMOD(bit);
+		BITBOARD bb = (pos == (WORD_SIZE - 1)) ? ZERO : pBB_[i] & (ONE << (pos + 1));
+
+		while (true) {
+			if (bb) { return bblock::lsb(bb) + WMUL(i); }
+			if (++i == nBB_) { break; }
+			bb = pBB_[i];
+		}
+		return BBObject::noBit;
+	}
+
+	inline
+	int ConstBitsetView::prev_bit(int bit) const {
+
+		if (bit == BBObject::noBit) { return msb(); }
+
+		//trims the bitblock of bit
+		int i = WDIV(bit);
+		BITBOARD bb = pBB_[i] & (bblock::MASK_BIT(WMOD(bit)) - 1);
+
+		while (true) {
+			if (bb) { return bblock::msb(bb) + WMUL(i); }
+			if (--i < 0) { break; }
+			bb = pBB_[i];
+		}
+		return BBObject::noBit;
+	}
+
+	inline
+	int ConstBitsetView::find_first_common(ConstBitsetView rhs) const {
+		const int nBB = std::min(nBB_, rhs.nBB_);
+		const int i = bbkernel::first_common(pBB_, rhs.pBB_, nBB);
+		return (i == nBB) ? BBObject::noBit : bblock::lsb(pBB_[i] & rhs.pBB_[i]) + WMUL(i);
+	}
+
+	inline
+	std::vector<int>& ConstBitsetView::extract(std::vector<int>& lv) const {
+		const std::size_t n = lv.size();
+		lv.resize(n + count() + bbkernel::DECODE_PAD);
+		lv.resize(n + decode(lv.data() + n));
+		return lv;
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_VIEW_H__
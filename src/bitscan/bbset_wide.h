@@ -0,0 +1,546 @@
+/**
+ * @file bbset_wide.h
+ * @brief header file of the WideBitset class from the BITSCAN library.
+ *		  Dense bitset organized in blocks of WBITS = 64, 128, 256 or 512 bits
+ * @author pss
+ * @details: created 17/10/2026
+ * @details: The bit layout is that of Bitset (bit i in the 64-bit bitblock WDIV(i), position WMOD(i)), but the
+ *			 storage is padded to a whole number of wide blocks of WBITS bits (WBITS / 64 bitblocks), so that
+ *			 - the early-exit loops (bitscanning, is_empty, is_disjoint, find_first_common, truncated degrees...)
+ *			   visit one wide block per iteration: WBITS / 64 times fewer iterations and branches, and one
+ *			   vector instruction per block (VPTEST / VPTESTMQ) when compiled for AVX2 (WBITS = 256)
+ *			   or AVX512F (WBITS = 512), e.g. -march=native. Otherwise a constant-bound loop of WBITS / 64 words.
+ *			 - the full-row operations (&=, |=, erase_bit(rhs), count...) run on the vectorized kernels
+ *			   (bbkernel.h, runtime dispatch) over a whole number of vectors, without scalar tails.
+ * @details: The BBScan interface is inherited from _impl::DenseBase (bbset_dense.h), with the wide block skips
+ *			 in next_block / prev_block. The bitscanning cursors (scan_block / scan_bit) refer to 64-bit bitblocks.
+ * @details: Intended for dense graphs of a few thousand vertices or more (e.g. 5k - 50k), where the rows
+ *			 are long and mostly non-empty.
+ * @details: The bitblocks are 64-byte aligned. A bitset owns them, except for the rows of a BitsetMatrix
+ *			 (bbset_matrix.h), which are bound to the slab of the matrix (the adjacency matrix of Graph<WideBitset<W>>).
+ **/
+
+#ifndef __BBSET_WIDE_H__
+#define __BBSET_WIDE_H__
+
+#include "bbset_dense.h"
+#include "bbset_view.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+	#include <immintrin.h>
+#endif
+
+#include <cassert>					//uncomment #undef NDEBUG in bbconfig.h to enable run-time assertions
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//////////////////
+		// operations on a single wide block of K 64-bit bitblocks (unaligned)
+
+		template<int K>
+		struct wide_block {
+
+			static bool any(const BITBOARD* p) noexcept {
+				BITBOARD bb = ZERO;
+				for (int i = 0; i < K; ++i) { bb |= p[i]; }
+				return bb != ZERO;
+			}
+
+			static bool any_and(const BITBOARD* lhs, const BITBOARD* rhs) noexcept {
+				BITBOARD bb = ZERO;
+				for (int i = 0; i < K; ++i) { bb |= lhs[i] & rhs[i]; }
+				return bb != ZERO;
+			}
+
+			static bool any_and(const BITBOARD* p1, const BITBOARD* p2, const BITBOARD* p3) noexcept {
+				BITBOARD bb = ZERO;
+				for (int i = 0; i < K; ++i) { bb |= p1[i] & p2[i] & p3[i]; }
+				return bb != ZERO;
+			}
+		};
+
+#if defined(__AVX2__)
+		template<>
+		struct wide_block<4> {
+
+			static bool any(const BITBOARD* p) noexcept {
+				const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				return !_mm256_testz_si256(v, v);
+			}
+
+			static bool any_and(const BITBOARD* lhs, const BITBOARD* rhs) noexcept {
+				return !_mm256_testz_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)),
+											_mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)));
+			}
+
+			static bool any_and(const BITBOARD* p1, const BITBOARD* p2, const BITBOARD* p3) noexcept {
+				const __m256i v = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p1)),
+													_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p2)));
+				return !_mm256_testz_si256(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p3)));
+			}
+		};
+#endif
+
+#if defined(__AVX512F__)
+		template<>
+		struct wide_block<8> {
+
+			static bool any(const BITBOARD* p) noexcept {
+				const __m512i v = _mm512_loadu_si512(p);
+				return _mm512_test_epi64_mask(v, v) != 0;
+			}
+
+			static bool any_and(const BITBOARD* lhs, const BITBOARD* rhs) noexcept {
+				return _mm512_test_epi64_mask(_mm512_loadu_si512(lhs), _mm512_loadu_si512(rhs)) != 0;
+			}
+
+			static bool any_and(const BITBOARD* p1, const BITBOARD* p2, const BITBOARD* p3) noexcept {
+				const __m512i v = _mm512_and_si512(_mm512_loadu_si512(p1), _mm512_loadu_si512(p2));
+				return _mm512_test_epi64_mask(v, _mm512_loadu_si512(p3)) != 0;
+			}
+		};
+#endif
+
+		//////////////////
+		// storage of the bitblocks
+
+		/**
+		* @brief returns memory for n bitblocks, aligned to 64 bytes (cache line)
+		* @param mem: output - the block to be passed to std::free
+		* @param zero: if TRUE the bitblocks are set to 0 (calloc - large blocks are zero pages of the OS,
+		*			   mapped on first use), otherwise they are not initialized
+		* @details: Fail-fast policy: the program exits if the allocation fails
+		**/
+		inline BITBOARD* alloc_aligned_blocks(std::size_t n, void*& mem, bool zero = true) noexcept {
+
+			const std::size_t ALIGN = 64;
+			const std::size_t nBB = n + ALIGN / sizeof(BITBOARD);
+			mem = zero ? std::calloc(nBB, sizeof(BITBOARD)) : std::malloc(nBB * sizeof(BITBOARD));
+			if (mem == nullptr) {
+				LOG_ERROR("Error during allocation - alloc_aligned_blocks");
+				LOG_ERROR("exiting...");
+				std::exit(EXIT_FAILURE);
+			}
+
+			const auto addr = reinterpret_cast<std::uintptr_t>(mem);
+			return reinterpret_cast<BITBOARD*>((addr + ALIGN - 1) & ~static_cast<std::uintptr_t>(ALIGN - 1));
+		}
+
+		/**
+		* @brief bitblocks of a WideBitset: a 64-byte aligned block owned by the object, or a binding
+		*		 to external memory (a row of the slab of a BitsetMatrix), which is not released
+		* @details: copies are owned. Assignment to an object of the same size writes the bitblocks in place
+		*			 (a bound row stays in its slab), moving from a bound object copies the bitblocks.
+		**/
+		class AlignedBlocks {
+		public:
+
+			AlignedBlocks() noexcept : mem_(nullptr), data_(nullptr), size_(0) {}
+
+			AlignedBlocks(const AlignedBlocks& rhs) noexcept : AlignedBlocks() { copy_from(rhs); }
+
+			AlignedBlocks(AlignedBlocks&& rhs) noexcept : AlignedBlocks() {
+				if (rhs.mem_) { steal(rhs); }
+				else { copy_from(rhs); }
+			}
+
+			AlignedBlocks& operator = (const AlignedBlocks& rhs) noexcept {
+				if (this != &rhs) { copy_from(rhs); }
+				return *this;
+			}
+
+			AlignedBlocks& operator = (AlignedBlocks&& rhs) noexcept {
+				if (this == &rhs) { return *this; }
+				if (rhs.mem_ && !(is_bound() && size_ == rhs.size_)) {
+					release();
+					steal(rhs);
+				}
+				else {
+					copy_from(rhs);
+				}
+				return *this;
+			}
+
+			~AlignedBlocks() { release(); }
+
+			/**
+			* @brief n bitblocks with value val (in place if the size does not change)
+			**/
+			void assign(std::size_t n, BITBOARD val) noexcept {
+				if (n != size_) {
+					allocate(n, val == ZERO);
+					if (val == ZERO) { return; }
+				}
+				std::fill(data_, data_ + size_, val);
+			}
+
+			/**
+			* @brief binds the object to n bitblocks of external memory p (previous contents are released)
+			**/
+			void bind(BITBOARD* p, std::size_t n) noexcept {
+				release();
+				data_ = p;
+				size_ = n;
+			}
+
+			bool is_bound() const noexcept { return mem_ == nullptr && data_ != nullptr; }
+
+			void shrink_to_fit() noexcept {}
+
+			std::size_t size() const noexcept { return size_; }
+			BITBOARD* data() noexcept { return data_; }
+			const BITBOARD* data() const noexcept { return data_; }
+			BITBOARD* begin() noexcept { return data_; }
+			const BITBOARD* begin() const noexcept { return data_; }
+			BITBOARD* end() noexcept { return data_ + size_; }
+			const BITBOARD* end() const noexcept { return data_ + size_; }
+
+			BITBOARD& operator[] (std::size_t i) noexcept { return data_[i]; }
+			const BITBOARD& operator[] (std::size_t i) const noexcept { return data_[i]; }
+
+			friend bool operator == (const AlignedBlocks& lhs, const AlignedBlocks& rhs) noexcept {
+				return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+			}
+
+		private:
+
+			//owned block of n bitblocks (set to 0 if zero is TRUE)
+			void allocate(std::size_t n, bool zero) noexcept {
+				release();
+				if (n > 0) { data_ = alloc_aligned_blocks(n, mem_, zero); }
+				size_ = n;
+			}
+
+			void copy_from(const AlignedBlocks& rhs) noexcept {
+				if (size_ != rhs.size_) { allocate(rhs.size_, false); }
+				if (size_) { std::memcpy(data_, rhs.data_, size_ * sizeof(BITBOARD)); }
+			}
+
+			void steal(AlignedBlocks& rhs) noexcept {
+				mem_ = rhs.mem_;
+				data_ = rhs.data_;
+				size_ = rhs.size_;
+				rhs.mem_ = nullptr;
+				rhs.data_ = nullptr;
+				rhs.size_ = 0;
+			}
+
+			void release() noexcept {
+				std::free(mem_);
+				mem_ = nullptr;
+				data_ = nullptr;
+				size_ = 0;
+			}
+
+			void* mem_;											//owned memory, nullptr if bound or empty
+			BITBOARD* data_;									//first bitblock, 64-byte aligned if owned
+			std::size_t size_;									//number of bitblocks
+		};
+
+	}//end namespace _impl
+
+	//forward declaration
+	template<class RowT>
+	class BitsetMatrix;
+
+	/////////////////////////////////
+	//
+	// WideBitset class
+	//
+	// (dense bitset in blocks of WBITS bits)
+	// @details Binary operations require bitsets of the same population size
+	//
+	///////////////////////////////////
+
+	template<int WBITS>
+	class WideBitset : public _impl::DenseBase<WideBitset<WBITS>> {
+
+		static_assert(WBITS == 64 || WBITS == 128 || WBITS == 256 || WBITS == 512,
+						"WideBitset requires blocks of 64, 128, 256 or 512 bits");
+
+		using base_type = _impl::DenseBase<WideBitset<WBITS>>;
+
+		//rows of a matrix are bound to its slab
+		template <class RowT>
+		friend class BitsetMatrix;
+
+	public:
+
+		using typename base_type::index_t;
+		using typename base_type::bitpos_list;
+
+		/**
+		* @brief number of 64-bit bitblocks of a wide block (compile-time)
+		**/
+		static constexpr int K() { return WBITS / WORD_SIZE; }
+
+		////////////
+		//construction / destruction
+
+		WideBitset() noexcept : nBB_(0) {}
+
+		/**
+		* @brief Constructor of a bitset given a population size nPop
+		* @param nPop : population size
+		* @param val: initial value (TRUE, FALSE) of every bit in the range [0, nPop)
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		explicit WideBitset(std::size_t nPop, bool val = false) noexcept : nBB_(0) { init(nPop, val); }
+
+		/**
+		* @brief Creates a bitset with an initial collection @lv of 1-bit elements
+		*		  and a population size nPop
+		* @param lv : collection of integers representing 1-bits in the bitset
+		* @details: any collection supporting begin() and end() iterators can be used
+		**/
+		template<class ColT>
+		explicit WideBitset(std::size_t nPop, const ColT& lv) noexcept : nBB_(0) { init(nPop, lv); }
+
+		explicit WideBitset(std::size_t nPop, std::initializer_list<int> lv) noexcept : nBB_(0) { init(nPop, lv); }
+
+		/**
+		* @brief Creates a copy of the non-sparse bitset bb (e.g. a row of a ugraph)
+		**/
+		explicit WideBitset(ConstBitsetView bb) noexcept : nBB_(0) {
+			init(WMUL(bb.num_blocks()), false);
+			std::copy(bb.data(), bb.data() + bb.num_blocks(), vBB_.begin());
+		}
+
+		//Move and copy semantics allowed
+		WideBitset(const WideBitset&) = default;
+		WideBitset(WideBitset&&) noexcept = default;
+		WideBitset& operator = (const WideBitset&) = default;
+		WideBitset& operator = (WideBitset&&) noexcept = default;
+
+		~WideBitset() = default;
+
+		////////////
+		//Reset / init
+
+		/**
+		* @brief Resets the bitset to nPop bits with value val
+		* @details: Fail-fast policy: exceptions are handled inside the program exits
+		**/
+		void init(std::size_t nPop, bool val = false) noexcept;
+
+		/**
+		* @brief Resets the bitset to an initial collection lv of 1-bit elements
+		**/
+		template<class ColT>
+		void init(std::size_t nPop, const ColT& lv) noexcept;
+
+		void reset(std::size_t nPop) noexcept { init(nPop, false); }
+		void reset(std::size_t nPop, const bitpos_list& lv) noexcept { init(nPop, lv); }
+
+		void shrink_to_fit() { vBB_.shrink_to_fit(); }
+
+		/////////////////////
+		//setters and getters
+
+		/**
+		* @brief returns the number of 64-bit bitblocks of the bitset (a multiple of K())
+		**/
+		int num_blocks() const noexcept { return nBB_; }
+
+		/**
+		* @brief returns the number of 64-bit bitblocks of the bitset - std::size_t type
+		**/
+		std::size_t size() const noexcept { return vBB_.size(); }
+
+		/**
+		* @brief returns the number of wide blocks of WBITS bits
+		**/
+		int num_wide_blocks() const noexcept { return nBB_ / K(); }
+
+		BITBOARD* data() noexcept { return vBB_.data(); }
+		const BITBOARD* data() const noexcept { return vBB_.data(); }
+
+		BITBOARD block(index_t blockID) const {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID];
+		}
+		BITBOARD& block(index_t blockID) {
+			assert(blockID >= 0 && blockID < nBB_);
+			return vBB_[blockID];
+		}
+
+		/**
+		* @brief non-owning views of the bitblocks (bbset_view.h)
+		**/
+		BitsetView view() noexcept { return BitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView view() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+		ConstBitsetView cview() const noexcept { return ConstBitsetView(vBB_.data(), nBB_); }
+
+		/**
+		* @brief index of the first non-empty 64-bit bitblock in [i, num_blocks()), -1 if there is none.
+		*		 Skips empty wide blocks in one step.
+		**/
+		int next_block(int i) const noexcept;
+
+		/**
+		* @brief index of the last non-empty 64-bit bitblock in [0, i], -1 if there is none.
+		*		 Skips empty wide blocks in one step.
+		**/
+		int prev_block(int i) const noexcept;
+
+		/**
+		* @brief AND with rhs in the closed range of bitblocks [firstBlock, lastBlock]
+		*		 If lastBlock == -1 the range is [firstBlock, num_blocks())
+		**/
+		WideBitset& AND_EQUAL_block(int firstBlock, int lastBlock, const WideBitset& rhs) noexcept {
+			const int last_block = (lastBlock == -1) ? nBB_ - 1 : lastBlock;
+			assert(rhs.nBB_ == nBB_ && firstBlock >= 0 && firstBlock <= last_block + 1 && last_block < nBB_);
+			bbkernel::and_assign(vBB_.data() + firstBlock, rhs.vBB_.data() + firstBlock, last_block - firstBlock + 1);
+			return *this;
+		}
+
+		using base_type::is_disjoint;
+
+		/**
+		* @brief TRUE if this bitset, lhs and rhs have no 1-bits in common (one test per wide block)
+		**/
+		bool is_disjoint(const WideBitset& lhs, const WideBitset& rhs) const noexcept {
+			assert(lhs.nBB_ == nBB_ && rhs.nBB_ == nBB_);
+			for (int i = 0; i < nBB_; i += K()) {
+				if (_impl::wide_block<K()>::any_and(&vBB_[i], &lhs.vBB_[i], &rhs.vBB_[i])) { return false; }
+			}
+			return true;
+		}
+
+		/////////////////
+		// data members
+
+	protected:
+		_impl::AlignedBlocks vBB_;							//bitblocks (a whole number of wide blocks), 64-byte aligned
+		int nBB_;											//number of 64-bit bitblocks
+
+	private:
+
+		//binds the bitset to nBB bitblocks of external memory p (a row of a BitsetMatrix)
+		void bind(BITBOARD* p, int nBB) noexcept {
+			vBB_.bind(p, nBB);
+			nBB_ = nBB;
+		}
+	};
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// INLINE Implementation for generic code, must be in header file
+
+namespace bitgraph {
+
+	template<int WBITS>
+	inline
+	void WideBitset<WBITS>::init(std::size_t nPop, bool val) noexcept {
+
+		//rounds up to a whole number of wide blocks
+		const int nBB = static_cast<int>(INDEX_1TO1(nPop));
+		nBB_ = ((nBB + K() - 1) / K()) * K();
+
+		try {
+			vBB_.assign(nBB_, ZERO);
+		}
+		catch (...) {
+			LOG_ERROR("Error during allocation - WideBitset::init");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+
+		if (val && nPop > 0) {
+			this->set_bit(0, static_cast<int>(nPop) - 1);
+		}
+	}
+
+	template<int WBITS>
+	template<class ColT>
+	inline
+	void WideBitset<WBITS>::init(std::size_t nPop, const ColT& lv) noexcept {
+
+		init(nPop, false);
+
+		//sets bit conveniently
+		for (auto& bit : lv) {
+
+			//////////////////
+			assert(bit >= 0 && bit < static_cast<int>(nPop));
+			/////////////////
+
+			this->set_bit(bit);
+		}
+	}
+
+	template<int WBITS>
+	inline
+	int WideBitset<WBITS>::next_block(int i) const noexcept {
+
+		//remaining bitblocks of the wide block of i
+		const int end = std::min(nBB_, (i / K() + 1) * K());
+		for (; i < end; ++i) {
+			if (vBB_[i]) { return i; }
+		}
+
+		//whole wide blocks
+		for (; i < nBB_; i += K()) {
+			if (_impl::wide_block<K()>::any(&vBB_[i])) {
+				while (!vBB_[i]) { ++i; }
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	template<int WBITS>
+	inline
+	int WideBitset<WBITS>::prev_block(int i) const noexcept {
+
+		if (i < 0) { return -1; }
+
+		//remaining bitblocks of the wide block of i
+		const int first = (i / K()) * K();
+		for (; i >= first; --i) {
+			if (vBB_[i]) { return i; }
+		}
+
+		//whole wide blocks
+		for (i = first - K(); i >= 0; i -= K()) {
+			if (_impl::wide_block<K()>::any(&vBB_[i])) {
+				i += K() - 1;
+				while (!vBB_[i]) { --i; }
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+}//end namespace bitgraph
+
+///////////////////////
+//
+// Bitblocks of WideBitset for the bitscanning ranges
+// (overload of bbscan_iter.h and bbscan_fused.h, the read-only one is in _impl::DenseBase)
+//
+///////////////////////
+
+namespace bitgraph {
+
+	template<int WBITS>
+	inline
+	_impl::block_span<BITBOARD> blocks(WideBitset<WBITS>& bb) {
+		return { bb.data(), bb.num_blocks() };
+	}
+
+}//end namespace bitgraph
+
+#endif	// __BBSET_WIDE_H__
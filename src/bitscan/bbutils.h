@@ -18,7 +18,8 @@ namespace bitgraph {
 	/**
 	* @brief Converts a bitset to a vector of integers of size the
 	*		 population count of the bitset hierarchy. The bitset is not modified.
-	* @details: function next_bit() is used to extract the bits
+	* @details: the bits are decoded by the member function extract (batched decoding in the
+	*			 bitsets of the hierarchy, last_update 17/10/2026)
 	**/
 	template<class BitsetT>
 	std::vector<int> to_vector(BitsetT& bbn);
@@ -524,14 +525,7 @@ namespace bitgraph {
 		std::vector<int> to_vector(BitsetT& bbn) {
 
 		std::vector<int> res;
-		res.reserve(bbn.count());
-
-		//uses primitive bitscanning which is compatible for all bitsets in the hierarchy
-		int v = BBObject::noBit;
-		while ((v = bbn.next_bit(v)) != BBObject::noBit) {
-			res.emplace_back(v);
-		}
-
+		bbn.extract(res);
 		return res;
 	}
 
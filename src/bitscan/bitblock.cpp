@@ -32,13 +32,13 @@ namespace bitgraph {
 
 			if (bb) {
 				bb16 = (U16)bb;
-				if (bb16) return (Tables::lsba[0][bb16]);
+				if (bb16) return (Tables::lsb[bb16]);
 				bb16 = (U16)(bb >> 16);
-				if (bb16) return (Tables::lsba[1][bb16]);
+				if (bb16) return (Tables::lsb[bb16] + 16);
 				bb16 = (U16)(bb >> 32);
-				if (bb16) return (Tables::lsba[2][bb16]);
+				if (bb16) return (Tables::lsb[bb16] + 32);
 				bb16 = (U16)(bb >> 48);
-				if (bb16) return (Tables::lsba[3][bb16]);
+				if (bb16) return (Tables::lsb[bb16] + 48);
 			}
 
 			return BBObject::noBit;		//should not occur
@@ -115,10 +115,10 @@ namespace bitgraph {
 			//if(bb == 0) return -1;				//for sparse data
 
 			if (val.b) {
-				if (val.c[3]) return (Tables::msba[3][val.c[3]]);
-				if (val.c[2]) return (Tables::msba[2][val.c[2]]);
-				if (val.c[1]) return (Tables::msba[1][val.c[1]]);
-				if (val.c[0]) return (Tables::msba[0][val.c[0]]);
+				if (val.c[3]) return (Tables::msb[val.c[3]] + 48);
+				if (val.c[2]) return (Tables::msb[val.c[2]] + 32);
+				if (val.c[1]) return (Tables::msb[val.c[1]] + 16);
+				if (val.c[0]) return (Tables::msb[val.c[0]]);
 			}
 
 			/*	if (val.c[3])							//access table msb[65536](valores:0-15) in blocks of 16 bits
@@ -28,43 +28,39 @@
 #else
 	#define __popcnt64 __builtin_popcountll
 
-	#if defined(__x86_64__)
-		#include <x86intrin.h>
-		static inline unsigned char _BitScanForward64(unsigned long* Index, unsigned long long Mask)
-		{
-			unsigned long long Ret;
-			__asm__(
-				"bsfq %[Mask], %[Ret]"
-				: [Ret] "=r" (Ret)
-				: [Mask] "mr" (Mask)
-			);
-			*Index = (unsigned long)Ret;
-			return Mask ? 1 : 0;
-		}
+	#if defined(__x86_64__) || defined(__aarch64__)
+		#if defined(__x86_64__)
+			#include <x86intrin.h>
+		#endif
+
+		//////////////////
+		// LSB / MSB of a 64-bit block with TZCNT / LZCNT semantics (replaces the legacy bsfq / bsrq inline assembler)
+		//
+		// x86_64: compiles to TZCNT / LZCNT when the target has BMI1 / LZCNT (e.g. -march=native),
+		//		   else to REP BSF (executed as TZCNT by BMI1 processors) and BSR
+		// aarch64: RBIT + CLZ / CLZ
+		//
+		// The output index is only written for non-empty blocks
 
-		static inline unsigned char _BitScanReverse64(unsigned long* Index, unsigned long long Mask)
-		{
-			unsigned long long Ret;
-			__asm__(
-				"bsrq %[Mask], %[Ret]"
-				: [Ret] "=r" (Ret)
-				: [Mask] "mr" (Mask)
-			);
-			*Index = (unsigned long)Ret;
-			return Mask ? 1 : 0;
-		}
-	#elif defined(__aarch64__)
 		static inline unsigned char _BitScanForward64(unsigned long* Index, unsigned long long Mask)
 		{
 			if (Mask == 0) return 0;
-			*Index = __builtin_ctzll(Mask);
+		#if defined(__BMI__)
+			*Index = static_cast<unsigned long>(_tzcnt_u64(Mask));
+		#else
+			*Index = static_cast<unsigned long>(__builtin_ctzll(Mask));
+		#endif
 			return 1;
 		}
 
 		static inline unsigned char _BitScanReverse64(unsigned long* Index, unsigned long long Mask)
 		{
 			if (Mask == 0) return 0;
-			*Index = 63 - __builtin_clzll(Mask);
+		#if defined(__LZCNT__)
+			*Index = static_cast<unsigned long>(63 - _lzcnt_u64(Mask));
+		#else
+			*Index = static_cast<unsigned long>(63 - __builtin_clzll(Mask));
+		#endif
 			return 1;
 		}
 	#else
@@ -263,6 +259,47 @@ namespace bitgraph {
 		**/
 		inline int count(const BITBOARD bb) { return popc64(bb); }
 
+		/**
+		* @brief Index of the k-th 1-bit (0-based, from the least significant bit) in bb
+		* @param bb: input 64-bit bitblock
+		* @param k: rank of the 1-bit [0, popc64(bb))
+		* @returns index of the k-th 1-bit or -1 if bb has k or less 1-bits
+		* @details PDEP + TZCNT if the target has BMI2 (e.g. -march=native), else
+		*		   byte-wise prefix popcounts with a broadcast comparison (no branches but
+		*		   the final scan in the selected byte)
+		**/
+		int select64(const BITBOARD bb, int k);
+
+		/**
+		* @brief Parallel bit extract: gathers the bits of bb selected by mask into the
+		*		 consecutive low-order bits of the result (x86 PEXT)
+		* @param bb: input 64-bit bitblock
+		* @param mask: selection mask
+		* @returns bitblock with popc64(mask) significant bits
+		* @details PEXT if the target has BMI2 (e.g. -march=native), else a loop over the 1-bits of mask
+		**/
+		BITBOARD pext64(BITBOARD bb, BITBOARD mask);
+
+		/**
+		* @brief Parallel bit deposit: scatters the low-order bits of bb to the positions
+		*		 of the 1-bits of mask (x86 PDEP), inverse of pext64
+		* @param bb: input 64-bit bitblock (only the popc64(mask) low-order bits are used)
+		* @param mask: deposit mask
+		* @returns bitblock, a subset of mask
+		* @details PDEP if the target has BMI2 (e.g. -march=native), else a loop over the 1-bits of mask
+		**/
+		BITBOARD pdep64(BITBOARD bb, BITBOARD mask);
+
+		/**
+		* @brief Writes the positions of the 1-bits of bb, offset by base, in ascending order
+		*		 (batched decoding: 4 positions per step, unrolled lsb + clear)
+		* @param bb: input 64-bit bitblock
+		* @param base: offset of the positions (e.g. WMUL(block index))
+		* @param out: output array with room for popc64(bb) + 4 ints (external ownership)
+		* @returns number of 1-bits of bb
+		**/
+		int decode64(BITBOARD bb, int base, int* out);
+
 		/**
 		* @brief deprecated alias for population count in @bb
 		**/
@@ -423,9 +460,74 @@ namespace bitgraph {
 
 			val.b = bb_dato; //Carga unisn
 
-			return (impl::Tables::pc[val.c[0]] + impl::Tables::pc[val.c[1]] + impl::Tables::pc[val.c[2]] + impl::Tables::pc[val.c[3]]); //Suma de poblaciones  
+			return (Tables::pc[val.c[0]] + Tables::pc[val.c[1]] + Tables::pc[val.c[2]] + Tables::pc[val.c[3]]); //Suma de poblaciones  
+#endif
+
+		}
+
+		inline int select64(const BITBOARD bb, int k) {
+
+			if (k < 0 || k >= popc64(bb)) {
+				return BBObject::noBit;
+			}
+
+#if defined(__BMI2__)
+			return lsb64_intrinsic(_pdep_u64(1ULL << k, bb));
+#else
+			const BITBOARD L8 = 0x0101010101010101ULL;
+			const BITBOARD H8 = 0x8080808080808080ULL;
+
+			//byte i of s = number of 1-bits in bytes [0, i] of bb
+			BITBOARD s = bb - ((bb >> 1) & 0x5555555555555555ULL);
+			s = (s & 0x3333333333333333ULL) + ((s >> 2) & 0x3333333333333333ULL);
+			s = ((s + (s >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * L8;
+
+			//first byte with more than k 1-bits up to it (counts <= 64, no borrows between bytes)
+			const int byte = lsb64_intrinsic(((s | H8) - (static_cast<BITBOARD>(k + 1) * L8)) & H8) >> 3;
+			int r = k - ((byte == 0) ? 0 : static_cast<int>((s >> ((byte - 1) << 3)) & 0xFF));
+
+			//k-th bit in the byte
+			BITBOARD b = (bb >> (byte << 3)) & 0xFF;
+			for (; r > 0; --r) { b &= b - 1; }
+			return (byte << 3) + lsb64_intrinsic(b);
+#endif
+		}
+		
+		inline BITBOARD pext64(BITBOARD bb, BITBOARD mask) {
+#if defined(__BMI2__)
+			return _pext_u64(bb, mask);
+#else
+			BITBOARD res = ZERO;
+			for (BITBOARD bit = 1; mask != 0; mask &= mask - 1, bit <<= 1) {
+				if (bb & mask & (~mask + 1)) { res |= bit; }
+			}
+			return res;
+#endif
+		}
+
+		inline BITBOARD pdep64(BITBOARD bb, BITBOARD mask) {
+#if defined(__BMI2__)
+			return _pdep_u64(bb, mask);
+#else
+			BITBOARD res = ZERO;
+			for (BITBOARD bit = 1; mask != 0; mask &= mask - 1, bit <<= 1) {
+				if (bb & bit) { res |= mask & (~mask + 1); }
+			}
+			return res;
 #endif
+		}
 
+		inline int decode64(BITBOARD bb, int base, int* out) {
+
+			//4 positions per step, without a data dependency between the stores
+			const int n = popc64(bb);
+			for (int* p = out; bb != 0; p += 4) {
+				p[0] = base + lsb(bb); bb &= bb - 1;
+				p[1] = base + lsb(bb); bb &= bb - 1;
+				p[2] = base + lsb(bb); bb &= bb - 1;
+				p[3] = base + lsb(bb); bb &= bb - 1;
+			}
+			return n;
 		}
 		
 		inline int lsb64_de_Bruijn(const BITBOARD bb_dato) {
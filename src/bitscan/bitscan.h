@@ -10,6 +10,23 @@
 
 #include "bbsentinel.h"					//base of the non-sparse hierarchy
 #include "bbscan_sparse.h"	
+#include "bbset_sparse_soa.h"				//sparse, structure-of-arrays layout
+#include "bbset_fixed.h"					//inline storage, compile-time size
+#include "bbset_wide.h"					//dense, in blocks of 64 / 128 / 256 / 512 bits
+#include "bbset_matrix.h"					//rows of WideBitset<W> in one contiguous 64-byte aligned slab
+#include "bbset_hybrid.h"					//adaptive array / dense / run chunks
+#include "bbset_summary.h"					//summary bitmaps of the non-empty bitblocks
+#include "bbset_counted.h"					//O(1) popcount maintained under all updates (optional superblock counts)
+#include "bbset_sentinel.h"					//range of the non-empty bitblocks (sentinels) maintained under all updates
+#include "bbset_rank.h"					//rank / select directory (rank(i), select(k), random_bit(rng))
+#include "bbset_arena.h"					//stack-like allocation of bitsets (BitsetArena rows, BitsetPool<BitsetT>)
+#include "bbset_trail.h"					//undo log of bitblocks for backtracking (checkpoint / rollback)
+#include "bbset_atomic.h"					//concurrent set / erase / test_and_set (std::atomic bitblocks)
+#include "bbset_hash.h"					//bitset hashing (incremental), content equality, lock-free TranspositionTable
+#include "bbset_view.h"					//non-owning views of external bitblock memory (BitsetView, ConstBitsetView)
+#include "bbscan_iter.h"					//iterator-based bitscanning (bits(bb), for_each_bit(bb, f))
+#include "bbscan_fused.h"					//fused bitscanning and counting (bits_and(a, b), count_and(a, b))
+#include "bbset_expr.h"					//expression templates (res = (a & b) | (c & ~d))
 #include "bbutils.h"					//basic algorithms
 
 namespace bitgraph {
@@ -18,12 +35,31 @@ namespace bitgraph {
 
 	using simple_bitarray = Bitset;
 	using bitarray = BBScan;
-	using watched_bitarray = _impl::BBSentinel;
+	using watched_bitarray = SentinelBitset;			//sentinels maintained by every operation (legacy: _impl::BBSentinel)
+
+	template<std::size_t NBITS>
+	using fixed_bitarray = FixedBitset<NBITS>;
+
+	template<int WBITS>
+	using wide_bitarray = WideBitset<WBITS>;
 
 	//sparse
 	
 	using simple_sparse_bitarray = BitsetSp;
 	using sparse_bitarray = BBScanSp;
+	using packed_sparse_bitarray = BitsetSpSoA;
+
+	//hybrid
+
+	using hybrid_bitarray = HybridBitset;
+
+	//hierarchical
+
+	using summary_bitarray = SummaryBitset;
+
+	//counted
+
+	using counted_bitarray = CountedBitset;
 
 }
 
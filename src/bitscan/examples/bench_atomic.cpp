@@ -0,0 +1,118 @@
+/**
+* @file bench_atomic.cpp
+* @brief Scaling benchmark of AtomicBitset with the number of threads
+* @details created 17/10/2026
+* @details usage: bench_atomic [<population size> <average degree> <max threads>]
+* @details workloads:
+*			- bfs: level-synchronous parallel BFS on a random graph (rows are Bitsets), visited set is an AtomicBitset
+*				   claimed with test_and_set (ms)
+*			- set: concurrent set_bit of random bits, all the threads on the same bitset (M bits / s)
+*			- merge: each thread builds a private Bitset and merges it (ms)
+* @author pss
+**/
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//runs f(t) on nThreads threads
+template<class Func>
+void run(int nThreads, Func f) {
+	vector<std::thread> th;
+	for (int t = 0; t < nThreads; ++t) { th.emplace_back(f, t); }
+	for (auto& x : th) { x.join(); }
+}
+
+int main(int argc, char** argv) {
+
+	int NPOP = 20000;
+	int DEG = 20;
+	int MAX_THREADS = static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+	if (argc == 4) {
+		NPOP = std::stoi(argv[1]);
+		DEG = std::stoi(argv[2]);
+		MAX_THREADS = std::stoi(argv[3]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_atomic [<population size> <average degree> <max threads>]" << endl;
+		return -1;
+	}
+
+	//random graph (directed rows)
+	std::mt19937 gen(4321);
+	std::uniform_int_distribution<int> vertex(0, NPOP - 1);
+	vector<Bitset> adj(NPOP, Bitset(NPOP));
+	for (auto& bb : adj) {
+		for (int i = 0; i < DEG; ++i) { bb.set_bit(vertex(gen)); }
+	}
+
+	const int NSET = 1 << 22;
+	vector<int> rbits(NSET);
+	for (auto& v : rbits) { v = vertex(gen); }
+
+	cout << "population: " << NPOP << " degree: " << DEG << " hardware threads: " << std::thread::hardware_concurrency() << endl;
+	cout << left << setw(10) << "threads" << setw(12) << "bfs(ms)" << setw(12) << "set(M/s)" << setw(12) << "merge(ms)" << "reached" << endl;
+
+	PrecisionTimer pt;
+	for (int nTh = 1; nTh <= MAX_THREADS; nTh *= 2) {
+
+		//bfs
+		AtomicBitset visited(NPOP);
+		vector<int> frontier{ 0 };
+		visited.set_bit(0);
+		int reached = 1;
+
+		pt.wall_tic();
+		while (!frontier.empty()) {
+			vector<vector<int>> next(nTh);
+			run(nTh, [&](int t) {
+				for (std::size_t i = t; i < frontier.size(); i += nTh) {
+					for (int w : bits(adj[frontier[i]])) {
+						if (!visited.test_and_set(w)) { next[t].push_back(w); }
+					}
+				}
+			});
+			frontier.clear();
+			for (auto& lv : next) { frontier.insert(frontier.end(), lv.begin(), lv.end()); }
+			reached += static_cast<int>(frontier.size());
+		}
+		const double tbfs = pt.wall_toc();
+
+		//concurrent set_bit
+		AtomicBitset abb(NPOP);
+		pt.wall_tic();
+		run(nTh, [&](int t) {
+			for (int i = t; i < NSET; i += nTh) { abb.set_bit(rbits[i]); }
+		});
+		const double tset = pt.wall_toc();
+
+		//private bitsets merged
+		AtomicBitset abbm(NPOP);
+		pt.wall_tic();
+		run(nTh, [&](int t) {
+			Bitset own(NPOP);
+			for (int i = t; i < NSET; i += nTh) { own.set_bit(rbits[i]); }
+			abbm.merge(own);
+		});
+		const double tmerge = pt.wall_toc();
+
+		if (abb.count() != abbm.count() || reached != visited.count()) {
+			cerr << "ERROR: inconsistent results" << endl;
+			return -1;
+		}
+
+		cout << fixed << setprecision(2) << setw(10) << nTh << setw(12) << 1.0e3 * tbfs
+			 << setw(12) << NSET / tset / 1.0e6 << setw(12) << 1.0e3 * tmerge << reached << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/**
+* @file bench_expr.cpp
+* @brief Benchmark of the expression templates of bbset_expr.h against the separate passes of the
+*		 Bitset operations (AND, erase_bit, |=) for res = (a & b) | (c & ~d) and its popcount
+* @details created 17/10/2026
+* @details usage: bench_expr [<population size> <number of repetitions>]
+* @details times in ns per bitblock of the operands
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+void bench(int nPop, int nRep) {
+
+	std::mt19937_64 gen(12345);
+	std::bernoulli_distribution coin(0.5);
+	BBScan a(nPop), b(nPop), c(nPop), d(nPop);
+	for (auto* bb : { &a, &b, &c, &d }) {
+		for (int i = 0; i < nPop; ++i) {
+			if (coin(gen)) { bb->set_bit(i); }
+		}
+	}
+
+	const int nBB = a.num_blocks();
+	BBScan res(nPop), tmp(nPop);
+	volatile long long sink = 0;
+
+	cout << left << fixed << setprecision(3) << setw(12) << nPop;
+
+	//separate passes
+	cout << setw(12) << 1.0e9 / nBB * wall_time_per_rep(nRep, [&]() {
+		AND(a, b, res);
+		erase_bit(c, d, tmp);
+		res |= tmp;
+		sink = sink + res.block(0);
+	});
+
+	//expression template
+	cout << setw(12) << 1.0e9 / nBB * wall_time_per_rep(nRep, [&]() {
+		res = (a & b) | (c & ~d);
+		sink = sink + res.block(0);
+	});
+
+	//popcount with separate passes
+	cout << setw(12) << 1.0e9 / nBB * wall_time_per_rep(nRep, [&]() {
+		AND(a, b, res);
+		erase_bit(c, d, tmp);
+		res |= tmp;
+		sink = sink + res.count();
+	});
+
+	//popcount of the expression (no result bitset)
+	cout << setw(12) << 1.0e9 / nBB * wall_time_per_rep(nRep, [&]() {
+		sink = sink + ((a & b) | (c & ~d)).count();
+	});
+
+	cout << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NPOP = 0;
+	int NREP = 10000;
+	if (argc == 3) {
+		NPOP = std::stoi(argv[1]);
+		NREP = std::stoi(argv[2]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_expr [<population size> <number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "res = (a & b) | (c & ~d)\trepetitions: " << NREP << "\ttime per bitblock (ns)" << endl;
+	cout << left << setw(12) << "population" << setw(12) << "passes" << setw(12) << "expr"
+		<< setw(12) << "passes+pc" << setw(12) << "expr.count" << endl;
+
+	if (NPOP > 0) {
+		bench(NPOP, NREP);
+	}
+	else {
+		for (int nPop : { 1000, 10000, 100000, 1000000 }) {
+			bench(nPop, std::max(1, NREP * 1000 / nPop));
+		}
+	}
+}
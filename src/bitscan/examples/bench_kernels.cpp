@@ -0,0 +1,93 @@
+/**
+* @file bench_kernels.cpp
+* @brief Benchmark of the bulk Bitset operations for each ISA level of the
+*		 bbkernel layer (SCALAR / AVX2 / AVX512) in the same machine
+* @details created 17/10/2026
+* @details usage: bench_kernels [<population size> <number of repetitions>]
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "bitscan/bbkernel.h"
+#include "bitscan/bbset.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+int main(int argc, char** argv) {
+
+	int NPOP = 20000;
+	int NREP = 200000;
+	if (argc == 3) {
+		NPOP = std::stoi(argv[1]);
+		NREP = std::stoi(argv[2]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_kernels [<population size> <number of repetitions>]" << endl;
+		return -1;
+	}
+
+	//random bitsets with density 0.5
+	std::mt19937_64 gen(12345);
+	Bitset bb1(NPOP), bb2(NPOP), res(NPOP);
+	for (int i = 0; i < bb1.num_blocks(); ++i) {
+		bb1.block(i) = gen();
+		bb2.block(i) = gen();
+	}
+	bb1.erase_bit(NPOP, WMUL(bb1.num_blocks()) - 1);
+	bb2.erase_bit(NPOP, WMUL(bb2.num_blocks()) - 1);
+
+	//disjoint sets for the worst case of is_disjoint / find_common_singleton
+	Bitset bbd(bb1);
+	bbd.flip();
+
+	cout << "population: " << NPOP << "\tblocks: " << bb1.num_blocks() << "\trepetitions: " << NREP << endl;
+	cout << "time per operation (ns)" << endl;
+	cout << left << setw(10) << "ISA" << setw(10) << "&=" << setw(10) << "AND" << setw(10) << "OR"
+		<< setw(10) << "erase" << setw(10) << "popcn" << setw(10) << "disj" << setw(10) << "singl"
+		<< setw(10) << "decod" << setw(10) << "dec&" << endl;
+
+	volatile int sink = 0;
+
+	//bit decoding: output buffer and bit-at-a-time reference (lsb + clear)
+	vector<int> lv(NPOP + bbkernel::DECODE_PAD);
+	cout << left << setw(10) << "bitscan" << setw(70) << " " << fixed << setprecision(1)
+		<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() {
+				int* p = lv.data();
+				for (int i = 0; i < bb1.num_blocks(); ++i) {
+					for (BITBOARD bb = bb1.block(i); bb != 0; bb &= bb - 1) { *p++ = WMUL(i) + bblock::lsb(bb); }
+				}
+				sink = sink + static_cast<int>(p - lv.data());
+			})
+		<< endl;
+
+	const auto isa = bbkernel::isa();
+	for (auto level : { bbkernel::isa_t::SCALAR, bbkernel::isa_t::AVX2, bbkernel::isa_t::AVX512 }) {
+
+		if (!bbkernel::set_isa(level)) {
+			cout << left << setw(10) << bbkernel::isa_name(level) << "not supported" << endl;
+			continue;
+		}
+
+		int bit;
+		cout << left << fixed << setprecision(1) << setw(10) << bbkernel::isa_name(level)
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { res = bb1; res &= bb2; })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { AND(bb1, bb2, res); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { OR(bb1, bb2, res); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { res = bb1; res.erase_bit(bb2); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { sink = sink + bb1.count(); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { sink = sink + bb1.is_disjoint(bbd); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { sink = sink + bb1.find_common_singleton(bbd, bit); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { sink = sink + bb1.decode(lv.data()); })
+			<< setw(10) << 1.0e9 * wall_time_per_rep(NREP, [&]() { sink = sink + bb1.decode_and(bb2, lv.data()); })
+			<< endl;
+	}
+
+	bbkernel::set_isa(isa);
+	return 0;
+}
@@ -0,0 +1,222 @@
+/**
+* @file bench_scan.cpp
+* @brief Benchmark of the bitscanning alternatives for dense (BBScan) and sparse (BBScanSp) bitsets:
+*		 stateful virtual scans (init_scan / next_bit), nested scan classes, stateless next_bit(int)
+*		 and the iterator-based scans of bbscan_iter.h (bits, bits_del, for_each_bit).
+*		 Also compares the scan of a & b with a materialized intersection (AND + bits) against the
+*		 fused scans and counts of bbscan_fused.h (bits_and, count_and)
+* @details created 17/10/2026
+* @details usage: bench_scan [<population size> <number of repetitions>]
+* @details a set of NROWS bitsets is scanned (as the neighborhoods of a graph), times in ns per 1-bit
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+const int NROWS = 64;
+
+//////////////////
+// timing of a scan of all the rows over nRep repetitions (ns per bit)
+
+template<class Func>
+double time_scan(int nRep, long long nBits, Func f) {
+	PrecisionTimer pt;
+	pt.wall_tic();
+	for (int r = 0; r < nRep; ++r) { f(); }
+	return 1.0e9 * pt.wall_toc() / (static_cast<double>(nRep) * nBits);
+}
+
+template<class BitsetT>
+void bench(const string& type, int nPop, double p, int nRep) {
+
+	//random rows with density p
+	std::mt19937_64 gen(12345);
+	std::bernoulli_distribution coin(p);
+	vector<BitsetT> rows(NROWS, BitsetT(nPop));
+	long long nBits = 0;
+	for (auto& bb : rows) {
+		for (int i = 0; i < nPop; ++i) {
+			if (coin(gen)) { bb.set_bit(i); ++nBits; }
+		}
+	}
+	if (nBits == 0) { return; }
+
+	vector<BitsetT> copies(rows);
+	volatile long long sink = 0;
+	long long sum = 0;
+
+	cout << left << fixed << setprecision(2) << setw(10) << type << setw(8) << p;
+
+	//stateful virtual scan (as in KCore, the bitsets are reached by reference)
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (auto& bb : rows) {
+			if (bb.init_scan(BBObject::NON_DESTRUCTIVE) == -1) { continue; }
+			int v = BBObject::noBit;
+			while ((v = bb.next_bit()) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//nested scan class
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (auto& bb : rows) {
+			if (bb.is_empty()) { continue; }
+			typename BitsetT::scan sc(bb);
+			int v = BBObject::noBit;
+			while ((v = sc.next_bit()) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//stateless scan
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (auto& bb : rows) {
+			int v = BBObject::noBit;
+			while ((v = bb.next_bit(v)) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//iterators
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (auto& bb : rows) {
+			for (int v : bits(bb)) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//for_each_bit
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (auto& bb : rows) {
+			for_each_bit(bb, [&](int v) { sum += v; });
+		}
+		sink = sink + sum;
+	});
+
+	//destructive scans (copies restored at each repetition, included in time)
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		copies = rows;
+		for (auto& bb : copies) {
+			if (bb.init_scan(BBObject::DESTRUCTIVE) == -1) { continue; }
+			int v = BBObject::noBit;
+			while ((v = bb.next_bit_del()) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		copies = rows;
+		for (auto& bb : copies) {
+			for (int v : bits_del(bb)) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	cout << endl;
+}
+
+template<class BitsetT>
+void bench_fused(const string& type, int nPop, double p, int nRep) {
+
+	//random rows with density p
+	std::mt19937_64 gen(12345);
+	std::bernoulli_distribution coin(p);
+	vector<BitsetT> rows(NROWS, BitsetT(nPop));
+	for (auto& bb : rows) {
+		for (int i = 0; i < nPop; ++i) {
+			if (coin(gen)) { bb.set_bit(i); }
+		}
+	}
+
+	//number of bits of all the intersections of consecutive rows
+	long long nBits = 0;
+	for (int i = 0; i + 1 < NROWS; ++i) {
+		nBits += count_and(rows[i], rows[i + 1]);
+	}
+	if (nBits == 0) { return; }
+
+	BitsetT tmp(nPop);
+	volatile long long sink = 0;
+	long long sum = 0;
+
+	cout << left << fixed << setprecision(2) << setw(10) << type << setw(8) << p;
+
+	//AND + scan of the intersection
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (int i = 0; i + 1 < NROWS; ++i) {
+			AND(rows[i], rows[i + 1], tmp);
+			for (int v : bits(tmp)) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//fused scan
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (int i = 0; i + 1 < NROWS; ++i) {
+			for (int v : bits_and(rows[i], rows[i + 1])) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//AND + count of the intersection
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (int i = 0; i + 1 < NROWS; ++i) {
+			AND(rows[i], rows[i + 1], tmp);
+			sum += tmp.count();
+		}
+		sink = sink + sum;
+	});
+
+	//fused count
+	cout << setw(10) << time_scan(nRep, nBits, [&]() {
+		for (int i = 0; i + 1 < NROWS; ++i) {
+			sum += count_and(rows[i], rows[i + 1]);
+		}
+		sink = sink + sum;
+	});
+
+	cout << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NPOP = 10000;
+	int NREP = 100;
+	if (argc == 3) {
+		NPOP = std::stoi(argv[1]);
+		NREP = std::stoi(argv[2]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_scan [<population size> <number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "population: " << NPOP << "\trows: " << NROWS << "\trepetitions: " << NREP << endl;
+	cout << "time per bit (ns)" << endl;
+	cout << left << setw(10) << "type" << setw(8) << "p" << setw(10) << "next_bit" << setw(10) << "scan"
+		<< setw(10) << "stateless" << setw(10) << "bits" << setw(10) << "for_each"
+		<< setw(10) << "next_del" << setw(10) << "bits_del" << endl;
+
+	for (double p : { 0.01, 0.1, 0.5 }) {
+		bench<BBScan>("BBScan", NPOP, p, NREP);
+		bench<BBScanSp>("BBScanSp", NPOP, p, NREP);
+	}
+
+	cout << endl << "intersection of consecutive rows, time per bit of a & b (ns)" << endl;
+	cout << left << setw(10) << "type" << setw(8) << "p" << setw(10) << "AND+bits" << setw(10) << "bits_and"
+		<< setw(10) << "AND+count" << setw(10) << "count_and" << endl;
+
+	for (double p : { 0.01, 0.1, 0.5 }) {
+		bench_fused<BBScan>("BBScan", NPOP, p, NREP);
+		bench_fused<BBScanSp>("BBScanSp", NPOP, p, NREP);
+	}
+}
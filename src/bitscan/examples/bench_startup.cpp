@@ -0,0 +1,114 @@
+/**
+* @file bench_startup.cpp
+* @brief Benchmark of the startup cost of the BITSCAN lookup tables: latency of short-lived processes
+*		 and resident memory (RSS) touched by the tables
+* @details created 17/10/2026
+* @details usage: bench_startup [<number of launches>]
+* @details reports
+*			- the bytes of the tables (read-only, generated at compile time, and legacy, initialized at startup)
+*			- the RSS of this process at the start of main (VmRSS / VmHWM, Linux only)
+*			- the time of Tables::InitAllTables() (legacy tables only, no-op otherwise)
+*			- the wall time per launch of a child process which builds, scans and counts a small bitset and exits
+*			To compare with the legacy tables, build with -DBITSCAN_LEGACY_TABLES=ON
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+using _impl::Tables;
+
+//////////////////
+// RSS of the process in KB (Linux only, -1 otherwise)
+
+long status_kb(const string& key) {
+#ifdef __linux__
+	ifstream f("/proc/self/status");
+	string line;
+	while (getline(f, line)) {
+		if (line.compare(0, key.size(), key) == 0) {
+			return std::stol(line.substr(key.size() + 1));
+		}
+	}
+#endif
+	return -1;
+}
+
+//////////////////
+// work of the child process: small bitset (as in the roots of a solver)
+
+int child() {
+	BBScan bb(1000);
+	for (int v = 0; v < 1000; v += 3) { bb.set_bit(v); }
+	bb.erase_bit(10, 500);
+
+	int sum = 0;
+	bb.init_scan(BBObject::NON_DESTRUCTIVE);
+	for (int v = bb.next_bit(); v != BBObject::noBit; v = bb.next_bit()) { sum += v; }
+	return (sum + bb.count() + bb.msb()) == 0;
+}
+
+int main(int argc, char** argv) {
+
+	if (argc == 2 && string(argv[1]) == "--child") {
+		return child();
+	}
+
+	const long rss = status_kb("VmRSS:");
+	const long hwm = status_kb("VmHWM:");
+
+	int NLAUNCH = 200;
+	if (argc == 2) {
+		NLAUNCH = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_startup [<number of launches>]" << endl;
+		return -1;
+	}
+
+	//table sizes
+	const std::size_t nConst = sizeof(Tables::mask) + sizeof(Tables::mask8) + sizeof(Tables::mask_low) + sizeof(Tables::mask_high) +
+		sizeof(Tables::mask_mid) + sizeof(Tables::pc) + sizeof(Tables::lsb) + sizeof(Tables::msb) + sizeof(Tables::pc8) +
+		sizeof(Tables::T_32) + sizeof(Tables::T_64) + sizeof(Tables::indexDeBruijn64_ISOL) + sizeof(Tables::indexDeBruijn64_SEP);
+	std::size_t nLegacy = 0;
+#ifdef BITSCAN_LEGACY_TABLES
+	nLegacy = sizeof(Tables::lsba) + sizeof(Tables::msba) + sizeof(Tables::pc_sa);
+#endif
+
+	//(re-)initialization of the runtime tables
+	PrecisionTimer pt;
+	pt.wall_tic();
+	Tables::InitAllTables();
+	const double t_init = 1.0e6 * pt.wall_toc();
+
+	//launches of short-lived processes
+	const string cmd = string("\"") + argv[0] + "\" --child";
+	int nFail = 0;
+	pt.wall_tic();
+	for (int i = 0; i < NLAUNCH; ++i) {
+		nFail += (std::system(cmd.c_str()) != 0);
+	}
+	const double t_launch = 1.0e3 * pt.wall_toc() / NLAUNCH;
+
+#ifdef BITSCAN_LEGACY_TABLES
+	cout << "tables: legacy (BITSCAN_LEGACY_TABLES)" << endl;
+#else
+	cout << "tables: compile-time (constexpr)" << endl;
+#endif
+	cout << left << fixed << setprecision(1);
+	cout << setw(36) << "read-only tables (KB)" << nConst / 1024.0 << endl;
+	cout << setw(36) << "startup-initialized tables (KB)" << nLegacy / 1024.0 << endl;
+	cout << setw(36) << "RSS at main (KB)" << rss << endl;
+	cout << setw(36) << "peak RSS at main (KB)" << hwm << endl;
+	cout << setw(36) << "InitAllTables (us)" << t_init << endl;
+	cout << setw(36) << "launch + exit (ms per process)" << setprecision(3) << t_launch << "\t(" << NLAUNCH << " launches";
+	if (nFail) { cout << ", " << nFail << " failed"; }
+	cout << ")" << endl;
+}
@@ -0,0 +1,149 @@
+/**
+* @file bench_summary.cpp
+* @brief Benchmark of SummaryBitset (dense bitset with summary bitmaps of the non-empty bitblocks) against BBScan
+*		 on huge sparse sets: a few thousand 1-bits out of a population of 1M (e.g. candidate sets of large graphs)
+* @details created 17/10/2026
+* @details usage: bench_summary [<population size> <number of 1-bits> <number of repetitions>]
+* @details a set of NROWS bitsets is processed, times in us per row (per pair of rows for the intersections):
+*			- next_bit: stateful scan (init_scan / next_bit)
+*			- stateless: next_bit(int)
+*			- bits: range-based scan of bbscan_iter.h
+*			- empty: is_empty() and lsb()
+*			- count: count()
+*			- count_and / bits_and: fused intersection of consecutive rows (bbscan_fused.h)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+const int NROWS = 64;
+
+//////////////////
+// timing of an operation on all the rows over nRep repetitions (us per row)
+
+template<class Func>
+double time_rows(int nRep, Func f) {
+	PrecisionTimer pt;
+	pt.wall_tic();
+	for (int r = 0; r < nRep; ++r) { f(); }
+	return 1.0e6 * pt.wall_toc() / (static_cast<double>(nRep) * NROWS);
+}
+
+template<class BitsetT>
+void bench(const string& type, int nPop, int nBits, int nRep) {
+
+	//random rows: half of the 1-bits uniform, half in a few clusters
+	std::mt19937_64 gen(12345);
+	std::uniform_int_distribution<int> bit(0, nPop - 1);
+	std::uniform_int_distribution<int> len(0, 1023);
+	vector<BitsetT> rows(NROWS, BitsetT(nPop));
+	for (auto& bb : rows) {
+		for (int i = 0; i < nBits / 2; ++i) {
+			bb.set_bit(bit(gen));
+		}
+		for (int c = 0; c < 4; ++c) {
+			const int first = bit(gen);
+			for (int i = 0; i < nBits / 8; ++i) {
+				bb.set_bit(std::min(nPop - 1, first + len(gen)));
+			}
+		}
+	}
+
+	volatile long long sink = 0;
+	long long sum = 0;
+
+	cout << left << fixed << setprecision(2) << setw(10) << type;
+
+	//stateful scan
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (auto& bb : rows) {
+			if (bb.init_scan(BBObject::NON_DESTRUCTIVE) == -1) { continue; }
+			int v = BBObject::noBit;
+			while ((v = bb.next_bit()) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//stateless scan
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (auto& bb : rows) {
+			int v = BBObject::noBit;
+			while ((v = bb.next_bit(v)) != BBObject::noBit) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//range-based scan
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (const auto& bb : rows) {
+			for (int v : bits(bb)) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	//emptiness and first bit
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (const auto& bb : rows) {
+			sum += bb.is_empty() + bb.lsb();
+		}
+		sink = sink + sum;
+	});
+
+	//popcount
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (const auto& bb : rows) {
+			sum += bb.count();
+		}
+		sink = sink + sum;
+	});
+
+	//fused intersections of consecutive rows
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (int i = 0; i < NROWS; ++i) {
+			sum += count_and(rows[i], rows[(i + 1) % NROWS]);
+		}
+		sink = sink + sum;
+	});
+
+	cout << setw(12) << time_rows(nRep, [&]() {
+		for (int i = 0; i < NROWS; ++i) {
+			for (int v : bits_and(rows[i], rows[(i + 1) % NROWS])) { sum += v; }
+		}
+		sink = sink + sum;
+	});
+
+	cout << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NPOP = 1000000;
+	int NBITS = 2000;
+	int NREP = 20;
+	if (argc == 4) {
+		NPOP = std::stoi(argv[1]);
+		NBITS = std::stoi(argv[2]);
+		NREP = std::stoi(argv[3]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_summary [<population size> <number of 1-bits> <number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "population: " << NPOP << "\t1-bits per row: ~" << NBITS << "\trows: " << NROWS << "\trepetitions: " << NREP << endl;
+	cout << "time per row (us)" << endl;
+	cout << left << setw(10) << "type" << setw(12) << "next_bit" << setw(12) << "stateless" << setw(12) << "bits"
+		<< setw(12) << "empty" << setw(12) << "count" << setw(12) << "count_and" << setw(12) << "bits_and" << endl;
+
+	bench<BBScan>("BBScan", NPOP, NBITS, NREP);
+	bench<SummaryBitset>("Summary", NPOP, NBITS, NREP);
+}
@@ -0,0 +1,123 @@
+/**
+* @file bench_trail.cpp
+* @brief Benchmark of TrailedBitset (checkpoint / rollback) against copying the candidate set at each node
+*		 of a tree search
+* @details created 17/10/2026
+* @details usage: bench_trail [<population size> <density> <depth> <branching factor>]
+* @details the search: at each node the first b vertices v of the candidate set P are branched on,
+*		   P := P \ {v} and the child is called with P & N(v) - N(v) are random rows of the given density.
+*			- copy: a copy of P per node and a new bitset per child (P & N(v))
+*			- trail: a single TrailedBitset, one checkpoint per node and per child
+*			 Times in us per node, and the average number of bitblocks recorded by P & N(v) per node (trail).
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "bitscan/bitscan.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//////////////////
+// search with copies of the candidate set
+
+void search_copy(const vector<Bitset>& adj, const Bitset& P, int depth, int nBranch, long long& nodes) {
+
+	++nodes;
+	if (depth == 0) { return; }
+
+	Bitset Pc(P);
+	for (int b = 0; b < nBranch; ++b) {
+		const int v = Pc.lsb();
+		if (v == BBObject::noBit) { break; }
+		Pc.erase_bit(v);
+
+		Bitset child(Pc);
+		child &= adj[v];
+		search_copy(adj, child, depth - 1, nBranch, nodes);
+	}
+}
+
+//////////////////
+// search with a trailed candidate set
+
+void search_trail(const vector<Bitset>& adj, TrailedBitset<>& P, int depth, int nBranch, long long& nodes, long long& trail) {
+
+	++nodes;
+	if (depth == 0) { return; }
+
+	auto cp = P.checkpoint();
+	for (int b = 0; b < nBranch; ++b) {
+		const int v = P.pop_lsb();
+		if (v == BBObject::noBit) { break; }
+
+		auto cpc = P.checkpoint();
+		const auto nRec = P.trail_size();
+		P.AND_block(WDIV(v), P.num_blocks() - 1, adj[v]);			//bitblocks before v are empty
+		trail += static_cast<long long>(P.trail_size() - nRec);
+		search_trail(adj, P, depth - 1, nBranch, nodes, trail);
+		P.rollback(cpc);
+	}
+	P.rollback(cp);
+}
+
+int main(int argc, char** argv) {
+
+	int NPOP = 10000;
+	double DEN = 0.9;
+	int DEPTH = 8;
+	int NBRANCH = 3;
+	if (argc == 5) {
+		NPOP = std::stoi(argv[1]);
+		DEN = std::stod(argv[2]);
+		DEPTH = std::stoi(argv[3]);
+		NBRANCH = std::stoi(argv[4]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_trail [<population size> <density> <depth> <branching factor>]" << endl;
+		return -1;
+	}
+
+	//random neighborhoods
+	std::mt19937_64 gen(13579);
+	std::bernoulli_distribution coin(DEN);
+	vector<Bitset> adj(NPOP, Bitset(NPOP));
+	for (auto& bb : adj) {
+		for (int i = 0; i < NPOP; ++i) {
+			if (coin(gen)) { bb.set_bit(i); }
+		}
+	}
+	Bitset P(NPOP, true);
+
+	cout << "population: " << NPOP << " density: " << DEN << " depth: " << DEPTH << " branching: " << NBRANCH << endl;
+
+	PrecisionTimer pt;
+	long long nodes = 0, nodesT = 0, trail = 0;
+
+	pt.wall_tic();
+	search_copy(adj, P, DEPTH, NBRANCH, nodes);
+	const double tc = pt.wall_toc();
+
+	TrailedBitset<> tP(P);
+	pt.wall_tic();
+	search_trail(adj, tP, DEPTH, NBRANCH, nodesT, trail);
+	const double tt = pt.wall_toc();
+
+	if (nodes != nodesT || !(tP.bitset() == P)) {
+		cerr << "ERROR: different search trees" << endl;
+		return -1;
+	}
+
+	cout << left << fixed << setprecision(3);
+	cout << setw(10) << "nodes" << nodes << endl;
+	cout << setw(10) << "copy" << 1.0e6 * tc / nodes << " us/node" << endl;
+	cout << setw(10) << "trail" << 1.0e6 * tt / nodes << " us/node, "
+		 << static_cast<double>(trail) / nodes << " of " << P.num_blocks() << " bitblocks recorded per node" << endl;
+
+	return 0;
+}
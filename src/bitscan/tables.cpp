@@ -3,49 +3,65 @@
 
 using namespace bitgraph;
 using bitgraph::_impl::Tables;
+namespace gen = bitgraph::_impl::tables_gen;
+
+//common masks (constexpr - definitions required for odr-use in C++14)
+constexpr bitgraph::_impl::table_t<BITBOARD, 64> Tables::mask;
+constexpr bitgraph::_impl::table_t<U8, 8> Tables::mask8;
+constexpr bitgraph::_impl::table_t<BITBOARD, 65> Tables::mask_low;
+constexpr bitgraph::_impl::table_t<BITBOARD, 66> Tables::mask_high;
+constexpr bitgraph::_impl::table_t<bitgraph::_impl::table_t<BITBOARD, 64>, 64> Tables::mask_mid;
+constexpr bitgraph::_impl::table_t<bitgraph::_impl::table_t<U8, 8>, 256> Tables::pos8;
+
+constexpr BITBOARD Tables::mask0_1W;
+constexpr BITBOARD Tables::mask0_2W;
+constexpr BITBOARD Tables::mask0_3W;
+constexpr BITBOARD Tables::mask0_4W;
+
+//16-bit lookup tables always available (constant initialization - read-only data, nothing is computed at startup)
+namespace {
+	constexpr auto pc16 = gen::make_popc<65536>();
+	constexpr auto lsb16 = gen::make_lsb16();
+	constexpr auto msb16 = gen::make_msb16();
+	constexpr auto pc8b = gen::make_popc<256>();
+}
+
+const bitgraph::_impl::table_t<U8, 65536> Tables::pc = pc16;						//1_bit population in 16 bit blocks
+const bitgraph::_impl::table_t<std::int8_t, 65536> Tables::lsb = lsb16;			//LSB lookup table 16 bits
+const bitgraph::_impl::table_t<std::int8_t, 65536> Tables::msb = msb16;			//MSB in 16 bit blocks
+const bitgraph::_impl::table_t<U8, 256> Tables::pc8 = pc8b;						//population of 1-bits en U8
 
-//common masks and lookup tables always available
-int Tables::pc[65536];								//1_bit population in 16 bit blocks
-int Tables::lsb[65536];								//LSB lookup table 16 bits
-int Tables::msb[65536];								//MSB in 16 bit blocks	
-int Tables::pc8[256];								//population of 1-bits en U8
+//legacy tables
+#ifdef BITSCAN_LEGACY_TABLES
 int Tables::pc_sa[65536];							//population of 1-bits en BITBOARD16 (Shift + Add implementations)
 int Tables::msba[4][65536];							//MSB lookup table 16 bits con pos index
 int Tables::lsba[4][65536];							//LSB lookup table 16 bits con pos index
+#endif
 
-BITBOARD	Tables::mask[64];						//masks for 64 bit block of a single bit
-BITBOARD	Tables::mask_low[65];					//1_bit to the right of index (less significant bits, excluding index)
-BITBOARD	Tables::mask_high[66];			
-
-BITBOARD	Tables::mask0_1W;						
-BITBOARD	Tables::mask0_2W;
-BITBOARD	Tables::mask0_3W;
-BITBOARD	Tables::mask0_4W;
-U8			Tables::mask8[8];						//masks for 8 bit block of a single bit
-BITBOARD	Tables::mask_mid[64/*a*/][64/*b*/];		//1-bits between intervals
-
-#ifdef CACHED_INDEX_OPERATIONS 
+#ifdef CACHED_INDEX_OPERATIONS
 int Tables::t_wdindex[MAX_CACHED_INDEX];
 int Tables::t_wxindex[MAX_CACHED_INDEX];
 int Tables::t_wmodindex[MAX_CACHED_INDEX];
 #endif
 
 //extended lookups
-#ifdef EXTENDED_LOOKUPS				
+#ifdef EXTENDED_LOOKUPS
 int Tables::lsb_l[65536][16];				//LSB position list of 1-bits in BITBOARD16
 #endif
 
-//global initialization of tables
+//global initialization of the tables which are not generated at compile time
+#if defined(BITSCAN_LEGACY_TABLES) || defined(EXTENDED_LOOKUPS) || defined(CACHED_INDEX_OPERATIONS)
 struct Init{
 	Init(){Tables::InitAllTables();}
 } initTables;
+#endif
 
 ////////////////////
 // magic number tables of 64 bits (always available since space requierement is trivial)
 
 //8BYTES
-const int Tables::T_64[67]={	
-	-1,0,1,39,2,15,40,23,			
+const std::int8_t Tables::T_64[67]={
+	-1,0,1,39,2,15,40,23,
 	3,12,16,59,41,19,24,54,
 	4,-1,13,10,17,62,60,28,
 	42,30,20,51,25,44,55,47,
@@ -56,15 +72,15 @@ const int Tables::T_64[67]={
 	6,34,33						};
 
 //4BYTES (for 32 bits: present not used)
-const int Tables::T_32[37]={	
-	-1,0,1,26,2,23,27,-1,			
+const std::int8_t Tables::T_32[37]={
+	-1,0,1,26,2,23,27,-1,
 	3,16,24,30,28,11,-1,13,
 	4,7,17,-1,25,22,31,15,
-	29,10,12,6,-1,21,14,9,	
-	5,20,8,19,18				};	
+	29,10,12,6,-1,21,14,9,
+	5,20,8,19,18				};
 
-//De Bruijn Magic number 
-const int Tables::indexDeBruijn64_ISOL[64] = {								
+//De Bruijn Magic number
+const U8 Tables::indexDeBruijn64_ISOL[64] = {
 	63,  0, 58,  1, 59, 47, 53,  2,
 	60, 39, 48, 27, 54, 33, 42,  3,
 	61, 51, 37, 40, 49, 18, 28, 20,
@@ -75,7 +91,7 @@ const int Tables::indexDeBruijn64_ISOL[64] = {
 	44, 24, 15,  8, 23,  7,  6,  5	};
 
 
- const int Tables::indexDeBruijn64_SEP[64] = {
+ const U8 Tables::indexDeBruijn64_SEP[64] = {
     0, 47,  1, 56, 48, 27,  2, 60,
    57, 49, 41, 37, 28, 16,  3, 61,
    54, 58, 35, 52, 50, 42, 21, 44,
@@ -87,144 +103,21 @@ const int Tables::indexDeBruijn64_ISOL[64] = {
 
 
 /////////////////////////////////////
+// Legacy tables (int, runtime initialization)
 
-void Tables::init_masks(){
-
-	BITBOARD uno = 1;
-
-	for (int c=0;c<64;c++) 
-				mask[c]= uno<<c;
-
-
-	////////////////////////////
-	//mask8[8]
-	U8 uno8 = 1;
-
-	for (int c=0;c<8;c++) 
-				mask8[c]= uno8<<c;
-
-	////////////////////////////
-	//mask_low[65]
-	for (int c=0;c<64;c++)
-	{
-		for ( int j=0; j<c /* not included the element itself*/; j++)
-		{
-			mask_low[c] |= mask[j];
-
-		}
-	}
-	//mask_low[0]=ZERO;
-	mask_low[64]=ONE;
-
-	////////////////////////////
-	//mask_high[64] (from mask_low)
-	for (int c=0;c<64;c++)
-	{
-		mask_high[c]= ~mask_low[c] ^ mask[c]/*erase the element itself*/;
-	}
-	
-	mask_high[64]=ZERO;
-	mask_high[MASK_LIM]=ONE;
-
-	
-	////////////////////////////
-	//mask_mid[64][64] 
-	
-	for (int c=0;c<64;c++)	{
-		for ( int j=0; j<64 ; j++ )		{
-			if(j<c) continue; 
-
-			if(j==c) mask_mid[c][j]=mask[c];
-			else mask_mid[c][j]= (mask_low[j] & mask_high[c]) | mask[c] | mask[j];
-		}
-	}
-
-	/////////////////////////////
-	//mscara de 0s
-	
-	mask0_1W= ONE <<16;
-	mask0_2W= (mask0_1W<<16) | (~mask0_1W);
-	mask0_3W= (mask0_2W<<16) | (~mask0_1W);
-	mask0_4W= (mask0_3W<<16) | (~mask0_1W);
-}
-
-/////////////////////////////////
-// Inicio Tabla PopCount (poblacion 8 bits)
-
-void Tables::init_popc8(){
-	int n;
-	int c;
-	int k;
-		
-	pc8[0]=0;							//null bit population
-
-	for (c=1;c<256;c++)	{
-		n=0;
-		for (k=0;k<=7;k++)		{
-			 if (c & (1 << k))
-							n++;		//increase the population count
-		}
-		pc8[c]=n;
-	}
-}
-
-/////////////////////////////////
-// Table begin PopCount (16 bits population)
-
-void Tables::init_popc(){
-////////////////////
-//
+void Tables::init_legacy(){
+#ifdef BITSCAN_LEGACY_TABLES
 	int n,c,k;
-	pc[0]=0;				 //null bits population
-
-	for (c=1;c<65536;c++)	{
-		n=0;
-		for (k=0;k<=15;k++)		{
-			 if (c & (1 << k))
-				n++;			//increase the population count
-		}
-		pc[c]=n;
-	}
-
 
-	//Implementacion Shift+Add: 
+	//Implementacion Shift+Add:
 	pc_sa[0]=0;					//null bits population
 
 	for (c=1;c<65536;c++)	{
 		n=0;
 		for(k=0;k<13;k+=4)
 				n+=0xF & (c>>k);  //Sum of the number of bits every 4
-		
-		pc_sa[c]=n;
-	}
-}
 
-////////////////////////////////////////
-//  Tables for MSB / LSB
-
-void Tables::init_mlsb(){
-////////////////////////
-// builds tables for most significant bit and least signifincat bit fast bitscan
-	int c,k;
-
-	msb[0] = EMPTY_ELEM;				//no 1-bit
-	for ( c=1;c<65536;c++){
-		for (k=15;k>=0;k--){
-			 if (c & (1/*int*/ << k)) {
-				 msb[c] = k;
-				break;
-			}
-		}
-	}
-
-	lsb[0]= EMPTY_ELEM;					//no 1-bit
-	for ( c=1;c<65536;c++){
-		for (k=0;k<16;k++)	{
-			 if (c & (1/*int*/ << k)) {
-				 lsb[c] = k;	//0-15
-				 break;
-			}
-		}
+		pc_sa[c]=n;
 	}
 
 	//lsb with position index
@@ -233,7 +126,7 @@ void Tables::init_mlsb(){
 			lsba[k][c]=lsb[c]+k*16;
 
 	for(k=0; k<4; k++)
-		lsba[k][0]=EMPTY_ELEM;			
+		lsba[k][0]=EMPTY_ELEM;
 
 	//msb with position index
 	for(k=0; k<4; k++)
@@ -241,7 +134,8 @@ void Tables::init_mlsb(){
 			msba[k][c]=msb[c]+k*16;
 
 	for(k=0; k<4; k++)
-			msba[k][0]=EMPTY_ELEM;		
+			msba[k][0]=EMPTY_ELEM;
+#endif
 }
 
 void Tables::init_lsb_l(){
@@ -252,13 +146,13 @@ void Tables::init_lsb_l(){
 
 	int k;
 	BITBOARD c;
-	
+
 	for ( c=0;c<65536;c++)	{
 		for (k=0;k<16;k++){
 			if(c & mask[k])
 				lsb_l[c][k]=k;
 			else lsb_l[c][k]=100 /*upper bound*/;
-			
+
 		}
 	}
 
@@ -269,10 +163,10 @@ void Tables::init_lsb_l(){
 		k=0;
 		while (k < 16){
 			if ( (k == 0) || (lsb_l[c][k-1] <= lsb_l[c][k]) ) k++;
-			else 
-			{ 
-				tmp= lsb_l[c][k]; 
-				lsb_l[c][k] = lsb_l[c][k-1]; 
+			else
+			{
+				tmp= lsb_l[c][k];
+				lsb_l[c][k] = lsb_l[c][k-1];
 				lsb_l[c][--k] = tmp;
 			}
 		}
@@ -281,11 +175,11 @@ void Tables::init_lsb_l(){
 	//replace upper bound by -1
 	for ( c=0;c<65536;c++){
 		for (k=0;k<16;k++)	{
-			if(lsb_l[c][k] ==100) 
+			if(lsb_l[c][k] ==100)
 					lsb_l[c][k]=EMPTY_ELEM;
 		}
 	}
-#endif 	
+#endif
 }
 
 
@@ -294,28 +188,25 @@ void Tables::init_cached_index()
 {
 //index tables
 
-#ifdef  CACHED_INDEX_OPERATIONS 
-	for(int i=0; i<MAX_CACHED_INDEX; i++) 
+#ifdef  CACHED_INDEX_OPERATIONS
+	for(int i=0; i<MAX_CACHED_INDEX; i++)
 						Tables::t_wdindex[i]=i/WORD_SIZE;
 
 
-	for(int i=0; i<MAX_CACHED_INDEX; i++) 
+	for(int i=0; i<MAX_CACHED_INDEX; i++)
 						Tables::t_wxindex[i]=i*WORD_SIZE;
 
 
-	for(int i=0; i<MAX_CACHED_INDEX; i++) 
+	for(int i=0; i<MAX_CACHED_INDEX; i++)
 						Tables::t_wmodindex[i]=i%WORD_SIZE;
 #endif
 }
 
 
-//boot tables in RAM
+//boot the remaining tables in RAM
 
 int Tables::InitAllTables(){
-	init_mlsb();
-    init_popc();
-    init_popc8();
-    init_masks(); 
+	init_legacy();
 	init_lsb_l();
 	init_cached_index();
 
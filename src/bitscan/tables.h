@@ -1,32 +1,145 @@
-/*  
- * tables.h file from the BITSCAN library, a C++ library for bit 
+/*
+ * tables.h file from the BITSCAN library, a C++ library for bit
  * sets optimization. It has been used to implement BBMC, a very
- * succesful bit-parallel algorithm for exact maximum clique. 
+ * succesful bit-parallel algorithm for exact maximum clique.
  * (see license file for references)
  *
  * Copyright (C)
  * Author: Pablo San Segundo
- * Intelligent Control Research Group (CSIC-UPM) 
+ * Intelligent Control Research Group (CSIC-UPM)
  *
  * Permission to use, modify and distribute this software is
- * granted provided that this copyright notice appears in all 
- * copies, in source code or in binaries. For precise terms 
+ * granted provided that this copyright notice appears in all
+ * copies, in source code or in binaries. For precise terms
  * see the accompanying LICENSE file.
  *
- * This software is provided "AS IS" with no warranty of any 
+ * This software is provided "AS IS" with no warranty of any
  * kind, express or implied, and with no claim as to its
  * suitability for any purpose.
  */
 
+/**
+ * @details: last_update 17/10/2026 - the tables are generated at compile time (constexpr) into read-only data,
+ *			 with the smallest integer type possible, so that nothing is computed nor written at startup.
+ *			 The legacy tables (lsba, msba, pc_sa - 2.25 MB of int) are only available if the
+ *			 macro BITSCAN_LEGACY_TABLES is defined (CMake option BITSCAN_LEGACY_TABLES), and are
+ *			 initialized at startup by InitAllTables() as in previous releases.
+ **/
+
 #ifndef __TABLES_H__
 #define __TABLES_H__
 
 #include "bbtypes.h"
+#include <cstddef>
 
 namespace bitgraph {
 
 	namespace _impl {
 
+		/**
+		* @brief read-only lookup table of N elements of type T, generated at compile time
+		* @details: literal type, indexed as a C array (e.g. Tables::mask[i], Tables::mask_mid[a][b])
+		**/
+		template<class T, std::size_t N>
+		struct table_t {
+			T v_[N];
+
+			constexpr const T& operator[](std::size_t i) const { return v_[i]; }
+			constexpr const T* data() const { return v_; }
+			static constexpr std::size_t size() { return N; }
+		};
+
+		/////////////////////////////////
+		//
+		// namespace tables_gen
+		//
+		// (compile-time generators of the tables - C++14 constexpr)
+		//
+		///////////////////////////////////
+
+		namespace tables_gen {
+
+			//1-bit masks
+			constexpr table_t<BITBOARD, 64> make_mask() {
+				table_t<BITBOARD, 64> t{};
+				for (int c = 0; c < 64; ++c) { t.v_[c] = BITBOARD(1) << c; }
+				return t;
+			}
+
+			//less significant bits than c (excluding c) - mask_low[64] = ONE
+			constexpr table_t<BITBOARD, 65> make_mask_low() {
+				table_t<BITBOARD, 65> t{};
+				for (int c = 0; c < 64; ++c) { t.v_[c] = (BITBOARD(1) << c) - 1; }
+				t.v_[64] = ONE;
+				return t;
+			}
+
+			//more significant bits than c (excluding c) - mask_high[64] = ZERO, mask_high[MASK_LIM] = ONE
+			constexpr table_t<BITBOARD, 66> make_mask_high() {
+				table_t<BITBOARD, 66> t{};
+				for (int c = 0; c < 63; ++c) { t.v_[c] = ONE << (c + 1); }
+				t.v_[63] = ZERO;
+				t.v_[64] = ZERO;
+				t.v_[MASK_LIM] = ONE;
+				return t;
+			}
+
+			//1-bits in the closed range [a, b] (a <= b), ZERO if a > b
+			constexpr table_t<table_t<BITBOARD, 64>, 64> make_mask_mid() {
+				table_t<table_t<BITBOARD, 64>, 64> t{};
+				for (int a = 0; a < 64; ++a) {
+					for (int b = a; b < 64; ++b) {
+						const BITBOARD low = (b == 63) ? ONE : ((BITBOARD(1) << (b + 1)) - 1);
+						t.v_[a].v_[b] = low & ~((BITBOARD(1) << a) - 1);
+					}
+				}
+				return t;
+			}
+
+			constexpr table_t<U8, 8> make_mask8() {
+				table_t<U8, 8> t{};
+				for (int c = 0; c < 8; ++c) { t.v_[c] = static_cast<U8>(1u << c); }
+				return t;
+			}
+
+			//positions of the 1-bits of 8-bit numbers in ascending order (0-padded)
+			constexpr table_t<table_t<U8, 8>, 256> make_pos8() {
+				table_t<table_t<U8, 8>, 256> t{};
+				for (int c = 0; c < 256; ++c) {
+					int k = 0;
+					for (int b = 0; b < 8; ++b) {
+						if (c & (1 << b)) { t.v_[c].v_[k++] = static_cast<U8>(b); }
+					}
+				}
+				return t;
+			}
+
+			//population count of N-bit numbers (pc[i] = pc[i / 2] + i % 2)
+			template<std::size_t N>
+			constexpr table_t<U8, N> make_popc() {
+				table_t<U8, N> t{};
+				for (std::size_t c = 1; c < N; ++c) { t.v_[c] = static_cast<U8>(t.v_[c >> 1] + (c & 1)); }
+				return t;
+			}
+
+			//least significant bit of 16-bit numbers (EMPTY_ELEM for 0)
+			constexpr table_t<std::int8_t, 65536> make_lsb16() {
+				table_t<std::int8_t, 65536> t{};
+				t.v_[0] = EMPTY_ELEM;
+				for (int c = 1; c < 65536; ++c) { t.v_[c] = static_cast<std::int8_t>((c & 1) ? 0 : t.v_[c >> 1] + 1); }
+				return t;
+			}
+
+			//most significant bit of 16-bit numbers (EMPTY_ELEM for 0)
+			constexpr table_t<std::int8_t, 65536> make_msb16() {
+				table_t<std::int8_t, 65536> t{};
+				t.v_[0] = EMPTY_ELEM;
+				for (int c = 1; c < 65536; ++c) { t.v_[c] = static_cast<std::int8_t>(t.v_[c >> 1] + 1); }
+				return t;
+			}
+
+		}//end namespace tables_gen
+
 		class Tables {
 
 		private:
@@ -34,60 +147,65 @@ namespace bitgraph {
 			virtual ~Tables() {};
 
 		public:
+			/**
+			* @brief initializes the tables which are not generated at compile time
+			*		 (legacy tables, extended lookups and cached index tables, see bbconfig.h)
+			* @details: called automatically at startup only if any of these tables is enabled, no-op otherwise
+			**/
 			static int InitAllTables();							//Driver for all inits
 		private:
-			static void init_masks();
-			static void init_popc8();
-			static void init_popc();
-			static void init_mlsb();
-			static void init_lsb_l();							//Conditioned to EXTENDED_LOOKUPS 
+			static void init_legacy();							//Conditioned to BITSCAN_LEGACY_TABLES
+			static void init_lsb_l();							//Conditioned to EXTENDED_LOOKUPS
 
 			//Table
-			static void init_cached_index();					//Conditioned to CACHED_INDEX_OPERATIONS 
+			static void init_cached_index();					//Conditioned to CACHED_INDEX_OPERATIONS
 
 			////////////////////////////////////////
 			//data members
 
 		public:
-			//commonly used tables
-			static BITBOARD	mask[64];						//masks for 64 bit block of a single bit
-			static U8 mask8[8];								//masks for 8 bit block of a single bit
-			static BITBOARD mask_low[65];					//1_bit to the right of index (less significant bits, excluding index) - mask_low[WORD_SIZE] = ONE
-			static BITBOARD mask_high[66];					//1_bit to the left of index (more significant bits, excluding index)
+			//commonly used tables (constexpr, may be folded at compile time)
+			static constexpr table_t<BITBOARD, 64> mask = tables_gen::make_mask();					//masks for 64 bit block of a single bit
+			static constexpr table_t<U8, 8> mask8 = tables_gen::make_mask8();						//masks for 8 bit block of a single bit
+			static constexpr table_t<BITBOARD, 65> mask_low = tables_gen::make_mask_low();			//1_bit to the right of index (less significant bits, excluding index) - mask_low[WORD_SIZE] = ONE
+			static constexpr table_t<BITBOARD, 66> mask_high = tables_gen::make_mask_high();		//1_bit to the left of index (more significant bits, excluding index)
 
-			//private:
-			static BITBOARD mask_mid[64/*a*/][64/*b*/];	//1-bits between intervals (a<=b)
+			static constexpr table_t<table_t<BITBOARD, 64>, 64> mask_mid = tables_gen::make_mask_mid();	//1-bits between intervals (a<=b)
 
-			//0 but word masks
-			static BITBOARD  mask0_1W;
-			static BITBOARD  mask0_2W;
-			static BITBOARD  mask0_3W;
-			static BITBOARD	 mask0_4W;
+			static constexpr table_t<table_t<U8, 8>, 256> pos8 = tables_gen::make_pos8();		//positions of the 1-bits of 8-bit numbers (bit decoding)
 
-			static int pc[65536];							//16 bit population count
-			static int lsb[65536];							//LSB lookup table 16 bits
+			//0 but word masks
+			static constexpr BITBOARD mask0_1W = ONE << 16;
+			static constexpr BITBOARD mask0_2W = (mask0_1W << 16) | (~mask0_1W);
+			static constexpr BITBOARD mask0_3W = (mask0_2W << 16) | (~mask0_1W);
+			static constexpr BITBOARD mask0_4W = (mask0_3W << 16) | (~mask0_1W);
+
+			//16-bit lookup tables (read-only data, generated at compile time in tables.cpp)
+			static const table_t<U8, 65536> pc;								//16 bit population count
+			static const table_t<std::int8_t, 65536> lsb;					//LSB lookup table 16 bits (EMPTY_ELEM for 0)
+			static const table_t<std::int8_t, 65536> msb;					//MSB lookup table 16 bits (EMPTY_ELEM for 0)
+			static const table_t<U8, 256> pc8;								//population count for 8 bits
+
+#ifdef BITSCAN_LEGACY_TABLES
 			static int lsba[4][65536];						//LSB lookup table 16 bits con pos indes
 			static int msba[4][65536];						//MSB lookup table 16 bits con pos indes
+			static int pc_sa[65536];						//populaton count for 16 bits (Shift + Add)
+#endif
 
-
-			static int pc8[256];					//population count for 8 bits
-			static int pc_sa[65536];				//populaton count for 16 bits (Shift + Add)
-			static int msb[65536];					//MSB for 16 bits
-
-#ifdef EXTENDED_LOOKUPS	
+#ifdef EXTENDED_LOOKUPS
 			static int lsb_l[65536][16];			//LSB for 16 bits list of position of 1-bits)
 #endif
 
 			////////////////////////
 			//magic number tables
 
-			static const int T_32[37];									//32 bits	
-			static const int T_64[67];									//64 bits
-			static const int indexDeBruijn64_ISOL[64];					//bit scan with b&(-b)	
-			static const int indexDeBruijn64_SEP[64];					//bit scan with b^(b-1)
+			static const std::int8_t T_32[37];							//32 bits
+			static const std::int8_t T_64[67];							//64 bits
+			static const U8 indexDeBruijn64_ISOL[64];					//bit scan with b&(-b)
+			static const U8 indexDeBruijn64_SEP[64];					//bit scan with b^(b-1)
 
 			//64 bit block index cache
-#ifdef  CACHED_INDEX_OPERATIONS 
+#ifdef  CACHED_INDEX_OPERATIONS
 			static int t_wdindex[MAX_CACHED_INDEX];
 			static int t_wxindex[MAX_CACHED_INDEX];
 			static int t_wmodindex[MAX_CACHED_INDEX];
@@ -99,4 +217,4 @@ namespace bitgraph {
 
 }//end of namespace bitgraph
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,336 @@
+/**
+* @file test_bbkernel.cpp
+* @brief Unit tests of the bulk bitblock kernels (SCALAR / AVX2 / AVX512) and of the
+*		 Bitset operations which delegate to them
+* @details Every test is run for ALL the ISA levels supported by the machine (forced with set_isa)
+* @created 17/10/2026
+* @authos pss
+**/
+
+#include "bitscan/bbkernel.h"
+#include "bitscan/bbset.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+class BBKernelTest : public ::testing::TestWithParam<bbkernel::isa_t> {
+protected:
+	void SetUp() override {
+		isa_ = bbkernel::isa();
+		if (!bbkernel::set_isa(GetParam())) {
+			GTEST_SKIP() << "ISA not supported: " << bbkernel::isa_name(GetParam());
+		}
+	}
+	void TearDown() override { bbkernel::set_isa(isa_); }
+
+	//random bitset with density p
+	static Bitset random_bitset(int nPop, double p, std::mt19937_64& gen) {
+		Bitset bb(nPop);
+		std::bernoulli_distribution coin(p);
+		for (int i = 0; i < nPop; ++i) {
+			if (coin(gen)) { bb.set_bit(i); }
+		}
+		return bb;
+	}
+
+	bbkernel::isa_t isa_;
+};
+
+TEST_P(BBKernelTest, raw_kernels) {
+
+	std::mt19937_64 gen(1357);
+	const auto& k = bbkernel::kernels;
+
+	//all tails for 4 and 8-block vectors
+	for (int n = 0; n <= 37; ++n) {
+
+		vector<BITBOARD> a(n), b(n), r(n), ref(n);
+		for (int i = 0; i < n; ++i) { a[i] = gen() & gen(); b[i] = gen() & gen(); }
+
+		r = a; k.and_assign(r.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] & b[i], r[i]); }
+
+		r = a; k.or_assign(r.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] | b[i], r[i]); }
+
+		r = a; k.xor_assign(r.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] ^ b[i], r[i]); }
+
+		r = a; k.andnot_assign(r.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] & ~b[i], r[i]); }
+
+		k.and_to(r.data(), a.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] & b[i], r[i]); }
+
+		k.or_to(r.data(), a.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] | b[i], r[i]); }
+
+		k.andnot_to(r.data(), a.data(), b.data(), n);
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] & ~b[i], r[i]); }
+
+		int pc = 0, pc_and = 0, first = n;
+		for (int i = 0; i < n; ++i) {
+			pc += bblock::popc64(a[i]);
+			pc_and += bblock::popc64(a[i] & b[i]);
+			if (first == n && (a[i] & b[i])) { first = i; }
+		}
+		EXPECT_EQ(pc, k.popcount(a.data(), n));
+		EXPECT_EQ(pc_and, k.popcount_and(a.data(), b.data(), n));
+		EXPECT_EQ(first, k.first_common(a.data(), b.data(), n));
+
+		//single common block in every position
+		for (int j = 0; j < n; ++j) {
+			vector<BITBOARD> c(n, ZERO);
+			c[j] = a[j] | ONE;
+			vector<BITBOARD> d(n, ZERO);
+			d[j] = 0x8000000000000001ULL;
+			EXPECT_EQ(j, k.first_common(c.data(), d.data(), n));
+			EXPECT_EQ(2, k.popcount_and(c.data(), d.data(), n));
+		}
+	}
+}
+
+TEST_P(BBKernelTest, hash) {
+
+	std::mt19937_64 gen(2468);
+	const auto& k = bbkernel::kernels;
+
+	//all tails for 4 and 8-block vectors, some empty blocks, several offsets of the first block
+	for (int n = 0; n <= 37; ++n) {
+		vector<BITBOARD> a(n);
+		for (int i = 0; i < n; ++i) { a[i] = (gen() % 3 == 0) ? ZERO : gen(); }
+
+		for (int firstBlock : { 0, 1, 5, 1000 }) {
+			BITBOARD h = ZERO;
+			for (int i = 0; i < n; ++i) { h ^= bbkernel::hash_block(a[i], firstBlock + i); }
+			EXPECT_EQ(h, k.hash(a.data(), n, firstBlock));
+			EXPECT_EQ(h, bbkernel::hash(a.data(), n, firstBlock));
+		}
+	}
+
+	//empty blocks do not contribute, the block index does
+	EXPECT_EQ(ZERO, bbkernel::hash_block(ZERO, 7));
+	EXPECT_NE(bbkernel::hash_block(ONE, 0), bbkernel::hash_block(ONE, 1));
+}
+
+TEST_P(BBKernelTest, decode) {
+
+	std::mt19937_64 gen(97531);
+	const auto& k = bbkernel::kernels;
+
+	//all tails, different densities (empty, sparse, dense and full bitblocks)
+	for (int n = 0; n <= 37; ++n) {
+		for (int d = 0; d < 4; ++d) {
+
+			vector<BITBOARD> a(n), b(n);
+			for (int i = 0; i < n; ++i) {
+				switch (d) {
+				case 0: a[i] = gen() & gen() & gen() & gen(); break;
+				case 1: a[i] = gen(); break;
+				case 2: a[i] = (i % 3 == 0) ? ZERO : ~(gen() & gen() & gen()); break;
+				default: a[i] = ONE;
+				}
+				b[i] = gen() | gen();
+			}
+
+			//expected positions (with an offset)
+			const int base = 128;
+			vector<int> exp, exp_and;
+			for (int i = 0; i < n; ++i) {
+				for (int bit = 0; bit < WORD_SIZE; ++bit) {
+					if (a[i] & Tables::mask[bit]) { exp.push_back(base + WMUL(i) + bit); }
+					if (a[i] & b[i] & Tables::mask[bit]) { exp_and.push_back(base + WMUL(i) + bit); }
+				}
+			}
+
+			vector<int> out(exp.size() + bbkernel::DECODE_PAD, -1);
+			out.resize(k.decode(a.data(), n, base, out.data()));
+			EXPECT_EQ(exp, out);
+
+			out.assign(exp_and.size() + bbkernel::DECODE_PAD, -1);
+			out.resize(k.decode_and(a.data(), b.data(), n, base, out.data()));
+			EXPECT_EQ(exp_and, out);
+
+			//inline entry points
+			out.assign(exp.size() + bbkernel::DECODE_PAD, -1);
+			out.resize(bbkernel::decode(a.data(), n, base, out.data()));
+			EXPECT_EQ(exp, out);
+		}
+	}
+}
+
+TEST_P(BBKernelTest, compress_expand) {
+
+	std::mt19937_64 gen(24680);
+	const auto& k = bbkernel::kernels;
+
+	//single words (BMI2 or portable, depending on the ISA level)
+	for (int t = 0; t < 200; ++t) {
+		BITBOARD bb = gen(), mask = (t % 4 == 0) ? ONE : gen() & gen();
+		BITBOARD pext = 0, pdep = 0;
+		int pos = 0;
+		for (int bit = 0; bit < WORD_SIZE; ++bit) {
+			if (mask & Tables::mask[bit]) {
+				if (bb & Tables::mask[bit]) { pext |= Tables::mask[pos]; }
+				if (bb & Tables::mask[pos]) { pdep |= Tables::mask[bit]; }
+				++pos;
+			}
+		}
+		EXPECT_EQ(pext, k.pext(bb, mask));
+		EXPECT_EQ(pdep, k.pdep(bb, mask));
+		EXPECT_EQ(pext, bblock::pext64(bb, mask));
+		EXPECT_EQ(pdep, bblock::pdep64(bb, mask));
+	}
+
+	//all tails, different mask densities
+	for (int n = 0; n <= 37; ++n) {
+		for (int d = 0; d < 3; ++d) {
+
+			vector<BITBOARD> a(n), m(n);
+			for (int i = 0; i < n; ++i) {
+				a[i] = gen();
+				switch (d) {
+				case 0: m[i] = gen() & gen() & gen(); break;
+				case 1: m[i] = (i % 3 == 0) ? ZERO : gen(); break;
+				default: m[i] = ONE;
+				}
+			}
+
+			//naive reference: bits of a at the positions of m, packed
+			vector<BITBOARD> exp(n + 1, ZERO);
+			int pos = 0;
+			for (int i = 0; i < n; ++i) {
+				for (int bit = 0; bit < WORD_SIZE; ++bit) {
+					if (m[i] & Tables::mask[bit]) {
+						if (a[i] & Tables::mask[bit]) { exp[WDIV(pos)] |= Tables::mask[WMOD(pos)]; }
+						++pos;
+					}
+				}
+			}
+
+			vector<BITBOARD> c(n + 1, ZERO);
+			EXPECT_EQ(pos, k.compress(a.data(), m.data(), n, c.data()));
+			EXPECT_EQ(exp, c);
+
+			//expand restores a & m
+			vector<BITBOARD> e(n, ONE);
+			k.expand(c.data(), m.data(), n, e.data());
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(a[i] & m[i], e[i]); }
+
+			//inline entry points
+			c.assign(n + 1, ZERO);
+			EXPECT_EQ(pos, bbkernel::compress(a.data(), m.data(), n, c.data()));
+			EXPECT_EQ(exp, c);
+		}
+	}
+}
+
+TEST_P(BBKernelTest, bitset_operations) {
+
+	std::mt19937_64 gen(2468);
+	const int NPOP = 2000;										//32 blocks - dispatched to the kernels
+
+	Bitset bb1 = random_bitset(NPOP, 0.3, gen);
+	Bitset bb2 = random_bitset(NPOP, 0.3, gen);
+	Bitset res(NPOP);
+
+	//reference by bits
+	int pc_and = 0, pc_or = 0, pc_diff = 0;
+	for (int i = 0; i < NPOP; ++i) {
+		pc_and += (bb1.is_bit(i) && bb2.is_bit(i));
+		pc_or += (bb1.is_bit(i) || bb2.is_bit(i));
+		pc_diff += (bb1.is_bit(i) && !bb2.is_bit(i));
+	}
+
+	AND(bb1, bb2, res);
+	EXPECT_EQ(pc_and, res.count());
+	OR(bb1, bb2, res);
+	EXPECT_EQ(pc_or, res.count());
+	erase_bit(bb1, bb2, res);
+	EXPECT_EQ(pc_diff, res.count());
+
+	Bitset bb3(bb1);
+	bb3 &= bb2;
+	EXPECT_EQ(pc_and, bb3.count());
+	EXPECT_EQ(AND(bb1, bb2), bb3);
+
+	bb3 = bb1;
+	bb3.erase_bit(bb2);
+	EXPECT_EQ(pc_diff, bb3.count());
+	EXPECT_TRUE(bb3.is_disjoint(bb2));
+	EXPECT_FALSE(bb1.is_disjoint(bb2));
+
+	//block range [3, 20]
+	AND_block<true>(3, 20, bb1, bb2, res);
+	int pc_block = 0;
+	for (int i = WMUL(3); i < WMUL(21); ++i) {
+		pc_block += (bb1.is_bit(i) && bb2.is_bit(i));
+	}
+	EXPECT_EQ(pc_block, res.count());
+	EXPECT_TRUE(res.is_empty_block(0, 2));
+	EXPECT_TRUE(res.is_empty_block(21, BBObject::npos));
+
+	OR_block<false>(0, 1, bb1, bb2, res);
+	EXPECT_EQ(bb1.block(0) | bb2.block(0), res.block(0));
+	EXPECT_EQ(bb1.block(1) | bb2.block(1), res.block(1));
+}
+
+TEST_P(BBKernelTest, common_singleton) {
+
+	const int NPOP = 1000;
+	Bitset bb1(NPOP), bb2(NPOP);
+	int bit = 0;
+
+	//disjoint
+	bb1.set_bit(10); bb2.set_bit(11);
+	EXPECT_EQ(0, bb1.find_common_singleton(bb2, bit));
+	EXPECT_EQ(BBObject::noBit, bit);
+	EXPECT_TRUE(bb1.is_disjoint(bb2));
+	EXPECT_EQ(BBObject::noBit, bb1.find_first_common(bb2));
+
+	//singleton in the last block
+	bb1.set_bit(999); bb2.set_bit(999);
+	EXPECT_EQ(1, bb1.find_common_singleton(bb2, bit));
+	EXPECT_EQ(999, bit);
+	EXPECT_EQ(999, bb1.find_first_common(bb2));
+
+	//two common bits in different blocks
+	bb1.set_bit(500); bb2.set_bit(500);
+	EXPECT_EQ(-1, bb1.find_common_singleton(bb2, bit));
+	EXPECT_EQ(BBObject::noBit, bit);
+	EXPECT_EQ(500, bb1.find_first_common(bb2));
+
+	//block range [0, 10] - only 500 (block 7)
+	EXPECT_EQ(1, bb1.find_common_singleton_block(0, 10, bb2, bit));
+	EXPECT_EQ(500, bit);
+	EXPECT_FALSE(bb1.is_disjoint_block(0, 10, bb2));
+	EXPECT_TRUE(bb1.is_disjoint_block(8, 14, bb2));
+
+	//two common bits in the same block
+	bb1.set_bit(501); bb2.set_bit(501);
+	EXPECT_EQ(-1, bb1.find_common_singleton_block(0, 10, bb2, bit));
+	EXPECT_EQ(BBObject::noBit, bit);
+}
+
+INSTANTIATE_TEST_SUITE_P(ISA, BBKernelTest,
+	::testing::Values(bbkernel::isa_t::SCALAR, bbkernel::isa_t::AVX2, bbkernel::isa_t::AVX512),
+	[](const ::testing::TestParamInfo<bbkernel::isa_t>& info) { return std::string(bbkernel::isa_name(info.param)); });
+
+TEST(BBKernel, isa_selection) {
+
+	//the startup level is the best one unless forced by BITGRAPH_ISA
+	EXPECT_TRUE(bbkernel::is_supported(bbkernel::isa()));
+	EXPECT_TRUE(bbkernel::is_supported(bbkernel::isa_t::SCALAR));
+
+	auto current = bbkernel::isa();
+	EXPECT_TRUE(bbkernel::set_isa(bbkernel::isa_t::SCALAR));
+	EXPECT_EQ(bbkernel::isa_t::SCALAR, bbkernel::isa());
+	EXPECT_TRUE(bbkernel::set_isa(current));
+
+	//I/O
+	//cout << "best ISA: " << bbkernel::isa_name(bbkernel::best_isa()) << endl;
+}
@@ -0,0 +1,148 @@
+/**
+* @file test_bbscan_fused.cpp
+* @brief Unit tests of the fused bitscanning and counting over a & b, a & ~b and a & b & c
+*		 (bits_and, bits_andnot, for_each_bit_and, count_and, count_andnot, intersects_at_least)
+*		 for dense, sparse and fixed bitsets
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbscan_fused.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbscan_sparse.h"
+#include "bitscan/bbset_fixed.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+template<class BitsetT>
+class BBScanFusedTest : public ::testing::Test {
+protected:
+	BBScanFusedTest() : a(NPOP), b(NPOP), c(NPOP) {}
+	void SetUp() override {
+
+		//a: multiples of 3, b: multiples of 5, c: multiples of 7 (empty blocks in the middle of b)
+		for (int i = 0; i < NPOP; i += 3) { a.set_bit(i); }
+		for (int i = 0; i < NPOP; i += 5) {
+			if (i < 128 || i >= 320) { b.set_bit(i); }
+		}
+		for (int i = 0; i < NPOP; i += 7) { c.set_bit(i); }
+
+		for (int i = 0; i < NPOP; ++i) {
+			if (a.is_bit(i) && b.is_bit(i)) { sol_and.push_back(i); }
+			if (a.is_bit(i) && !b.is_bit(i)) { sol_andnot.push_back(i); }
+			if (a.is_bit(i) && b.is_bit(i) && c.is_bit(i)) { sol_and3.push_back(i); }
+		}
+	}
+
+	static const int NPOP = 500;
+
+	//////////////////////
+	//data members
+	BitsetT a, b, c;
+	vector<int> sol_and;
+	vector<int> sol_andnot;
+	vector<int> sol_and3;
+};
+
+using BitsetTypes = ::testing::Types<Bitset, BBScan, BitsetSp, BBScanSp, FixedBitset<512>>;
+TYPED_TEST_SUITE(BBScanFusedTest, BitsetTypes);
+
+TYPED_TEST(BBScanFusedTest, scan) {
+
+	vector<int> res;
+	for (int v : bits_and(this->a, this->b)) { res.push_back(v); }
+	EXPECT_EQ(this->sol_and, res);
+
+	res.clear();
+	for (int v : bits_andnot(this->a, this->b)) { res.push_back(v); }
+	EXPECT_EQ(this->sol_andnot, res);
+
+	res.clear();
+	for (int v : bits_and(this->a, this->b, this->c)) { res.push_back(v); }
+	EXPECT_EQ(this->sol_and3, res);
+}
+
+TYPED_TEST(BBScanFusedTest, for_each) {
+
+	vector<int> res;
+	for_each_bit_and(this->a, this->b, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(this->sol_and, res);
+
+	res.clear();
+	for_each_bit_andnot(this->a, this->b, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(this->sol_andnot, res);
+
+	res.clear();
+	for_each_bit_and(this->a, this->b, this->c, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(this->sol_and3, res);
+}
+
+TYPED_TEST(BBScanFusedTest, count) {
+
+	const int nAnd = static_cast<int>(this->sol_and.size());
+	EXPECT_EQ(nAnd, count_and(this->a, this->b));
+	EXPECT_EQ(nAnd, count_and(this->b, this->a));
+	EXPECT_EQ(static_cast<int>(this->sol_andnot.size()), count_andnot(this->a, this->b));
+	EXPECT_EQ(this->a.count(), count_and(this->a, this->a));
+	EXPECT_EQ(0, count_andnot(this->a, this->a));
+
+	EXPECT_TRUE(intersects_at_least(this->a, this->b, 0));
+	EXPECT_TRUE(intersects_at_least(this->a, this->b, 1));
+	EXPECT_TRUE(intersects_at_least(this->a, this->b, nAnd));
+	EXPECT_FALSE(intersects_at_least(this->a, this->b, nAnd + 1));
+}
+
+TYPED_TEST(BBScanFusedTest, empty) {
+
+	TypeParam e(TestFixture::NPOP);
+	int nBits = 0;
+	for (int v : bits_and(this->a, e)) { ++nBits; (void)v; }
+	for (int v : bits_and(e, this->a)) { ++nBits; (void)v; }
+	for (int v : bits_andnot(e, this->a)) { ++nBits; (void)v; }
+	for (int v : bits_and(this->a, this->b, e)) { ++nBits; (void)v; }
+	for_each_bit_and(e, this->b, [&](int) { ++nBits; });
+	EXPECT_EQ(0, nBits);
+
+	//a & ~empty = a
+	vector<int> res;
+	for (int v : bits_andnot(this->a, e)) { res.push_back(v); }
+	EXPECT_EQ(this->a.count(), static_cast<int>(res.size()));
+	EXPECT_EQ(this->a.count(), count_andnot(this->a, e));
+
+	EXPECT_EQ(0, count_and(this->a, e));
+	EXPECT_FALSE(intersects_at_least(this->a, e, 1));
+}
+
+TEST(BBScanFused, different_capacity) {
+
+	//dense: the missing bitblocks of the shorter bitset are considered empty
+	BBScan a(300, { 0, 10, 100, 200, 299 });
+	BBScan b(130, { 10, 100, 129 });
+
+	vector<int> res;
+	for (int v : bits_and(a, b)) { res.push_back(v); }
+	EXPECT_EQ(vector<int>({ 10, 100 }), res);
+
+	res.clear();
+	for (int v : bits_andnot(a, b)) { res.push_back(v); }
+	EXPECT_EQ(vector<int>({ 0, 200, 299 }), res);
+	EXPECT_EQ(3, count_andnot(a, b));
+	EXPECT_EQ(2, count_and(a, b));
+
+	//sparse
+	BBScanSp as(1000, { 5, 500, 999 });
+	BBScanSp bs(1000, { 500, 700, 999 });
+	BBScanSp cs(1000, { 999 });
+
+	res.clear();
+	for (int v : bits_and(as, bs, cs)) { res.push_back(v); }
+	EXPECT_EQ(vector<int>({ 999 }), res);
+	EXPECT_EQ(2, count_and(as, bs));
+	EXPECT_EQ(1, count_andnot(as, bs));
+	EXPECT_TRUE(intersects_at_least(as, bs, 2));
+	EXPECT_FALSE(intersects_at_least(as, bs, 3));
+}
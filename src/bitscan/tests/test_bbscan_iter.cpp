@@ -0,0 +1,125 @@
+/**
+* @file test_bbscan_iter.cpp
+* @brief Unit tests of the iterator-based bitscanning (bits, bits_rev, bits_del, bits_del_rev, for_each_bit)
+*		 for dense, sparse and fixed bitsets
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbscan_iter.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbscan_sparse.h"
+#include "bitscan/bbset_fixed.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+template<class BitsetT>
+class BBScanIterTest : public ::testing::Test {
+protected:
+	BBScanIterTest() : bb(NPOP) {}
+	void SetUp() override {
+		for (int i = 3; i < NPOP; i += 37) {
+			bb.set_bit(i);
+			sol.push_back(i);
+		}
+		bb.set_bit(NPOP - 1);
+		sol.push_back(NPOP - 1);
+		sol_rev.assign(sol.rbegin(), sol.rend());
+	}
+
+	static const int NPOP = 500;
+
+	//////////////////////
+	//data members
+	BitsetT bb;
+	vector<int> sol;
+	vector<int> sol_rev;
+};
+
+using BitsetTypes = ::testing::Types<Bitset, BBScan, BitsetSp, BBScanSp, FixedBitset<512>>;
+TYPED_TEST_SUITE(BBScanIterTest, BitsetTypes);
+
+TYPED_TEST(BBScanIterTest, non_destructive) {
+
+	vector<int> res;
+	for (int v : bits(this->bb)) {
+		res.push_back(v);
+	}
+	EXPECT_EQ(this->sol, res);
+
+	res.clear();
+	for_each_bit(this->bb, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(this->sol, res);
+
+	//bitset is not modified
+	EXPECT_EQ(static_cast<int>(this->sol.size()), this->bb.count());
+}
+
+TYPED_TEST(BBScanIterTest, non_destructive_reverse) {
+
+	vector<int> res;
+	for (int v : bits_rev(this->bb)) {
+		res.push_back(v);
+	}
+	EXPECT_EQ(this->sol_rev, res);
+
+	res.clear();
+	for_each_bit_rev(this->bb, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(this->sol_rev, res);
+}
+
+TYPED_TEST(BBScanIterTest, destructive) {
+
+	TypeParam bb(this->bb);
+	vector<int> res;
+	for (int v : bits_del(bb)) {
+		EXPECT_FALSE(bb.is_bit(v));					//removed when reached
+		res.push_back(v);
+	}
+	EXPECT_EQ(this->sol, res);
+	EXPECT_TRUE(bb.is_empty());
+
+	bb = this->bb;
+	res.clear();
+	for (int v : bits_del_rev(bb)) {
+		res.push_back(v);
+	}
+	EXPECT_EQ(this->sol_rev, res);
+	EXPECT_TRUE(bb.is_empty());
+}
+
+TYPED_TEST(BBScanIterTest, destructive_with_updates) {
+
+	//the scanned set is modified during the scan: removes the next bit in sol every time
+	TypeParam bb(this->bb);
+	vector<int> res;
+	for (int v : bits_del(bb)) {
+		res.push_back(v);
+		int w = this->bb.next_bit(v);
+		if (w != BBObject::noBit) {
+			bb.erase_bit(w);
+		}
+	}
+
+	vector<int> sol;
+	for (auto i = 0u; i < this->sol.size(); i += 2) {
+		sol.push_back(this->sol[i]);
+	}
+	EXPECT_EQ(sol, res);
+}
+
+TYPED_TEST(BBScanIterTest, empty) {
+
+	TypeParam bb(TestFixture::NPOP);
+	int nBits = 0;
+	for (int v : bits(bb)) { ++nBits; (void)v; }
+	for (int v : bits_rev(bb)) { ++nBits; (void)v; }
+	for (int v : bits_del(bb)) { ++nBits; (void)v; }
+	for (int v : bits_del_rev(bb)) { ++nBits; (void)v; }
+	for_each_bit(bb, [&](int) { ++nBits; });
+	EXPECT_EQ(0, nBits);
+}
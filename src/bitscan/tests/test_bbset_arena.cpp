@@ -0,0 +1,156 @@
+/**
+* @file test_bbset_arena.cpp
+* @brief Unit tests of the BitsetArena and BitsetPool classes (stack-like allocation of bitsets)
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_arena.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbscan_sparse.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(Arena, alloc_release) {
+
+	BitsetArena arena(1000, 4);
+	EXPECT_EQ(16, arena.num_blocks());
+	EXPECT_EQ(16, arena.stride());
+	EXPECT_EQ(4, arena.capacity());
+
+	BITBOARD* r0 = arena.alloc();
+	for (int i = 0; i < arena.num_blocks(); ++i) { EXPECT_EQ(ZERO, r0[i]); }
+	r0[3] = 0xFF;
+
+	//the first rows are contiguous and 64-byte aligned
+	BITBOARD* r1 = arena.alloc();
+	EXPECT_EQ(r0 + arena.stride(), r1);
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(r1) % 64);
+
+	//nested level
+	const int m = arena.mark();
+	BITBOARD* r2 = arena.alloc(r0);
+	EXPECT_EQ(0xFFu, r2[3]);
+	EXPECT_EQ(3, arena.size());
+	arena.release(m);
+	EXPECT_EQ(2, arena.size());
+
+	//the released row is handed out again
+	EXPECT_EQ(r2, arena.alloc());
+	EXPECT_EQ(ZERO, r2[3]);
+
+	arena.clear();
+	EXPECT_EQ(0, arena.size());
+	EXPECT_EQ(r0, arena.alloc());
+}
+
+TEST(Arena, growth) {
+
+	BitsetArena arena(100, 2);
+	EXPECT_EQ(2, arena.num_blocks());
+	EXPECT_EQ(8, arena.stride());
+
+	//rows handed out are not moved when new slabs are added
+	vector<BITBOARD*> rows;
+	for (int i = 0; i < 300; ++i) {
+		rows.push_back(arena.alloc());
+		rows.back()[0] = i;
+		rows.back()[1] = ~static_cast<BITBOARD>(i);
+	}
+	EXPECT_EQ(300, arena.size());
+	EXPECT_LE(300, arena.capacity());
+	EXPECT_EQ(300u, set<BITBOARD*>(rows.begin(), rows.end()).size());
+	for (int i = 0; i < 300; ++i) {
+		EXPECT_EQ(static_cast<BITBOARD>(i), rows[i][0]);
+		EXPECT_EQ(~static_cast<BITBOARD>(i), rows[i][1]);
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(rows[i]) % 64);
+	}
+
+	//release into the middle of a slab and across slabs
+	const int cap = arena.capacity();
+	for (int m : {150, 2, 67, 0, 299}) {
+		arena.release(m);
+		for (int i = m; i < 300; ++i) {
+			EXPECT_EQ(rows[i], arena.alloc());
+		}
+	}
+	EXPECT_EQ(cap, arena.capacity());
+}
+
+TEST(Arena, frame_and_bitset) {
+
+	BitsetArena arena(200);
+	Bitset bb(130, { 0, 64, 129 });
+
+	{
+		BitsetArena::Frame f(arena);
+		BITBOARD* row = arena.alloc(bb);
+		EXPECT_EQ(3, bbkernel::popcount(row, arena.num_blocks()));
+		EXPECT_EQ(ZERO, row[3]);						//arena rows may be larger than bb
+		EXPECT_EQ(1, arena.size());
+	}
+	EXPECT_EQ(0, arena.size());
+
+	//thread-local instances
+	BitsetArena* pa = &BitsetArena::local(1000);
+	EXPECT_EQ(pa, &BitsetArena::local(10));
+	EXPECT_LE(16, pa->num_blocks());
+
+	BitsetArena* pb = nullptr;
+	std::thread t([&pb]() { pb = &BitsetArena::local(1000); });
+	t.join();
+	EXPECT_NE(pa, pb);
+}
+
+TEST(Pool, acquire_release) {
+
+	BitsetPool<BBScan> pool;
+	BBScan bbsg(300, { 1, 2, 100, 299 });
+
+	BBScan* p0 = nullptr;
+	const BITBOARD* d0 = nullptr;
+	for (int rep = 0; rep < 3; ++rep) {
+
+		BitsetPool<BBScan>::Frame f(pool);
+
+		BBScan& bb = pool.acquire(bbsg);
+		EXPECT_TRUE(bb == bbsg);
+
+		BBScan& bbe = pool.acquire(300);
+		EXPECT_TRUE(bbe.is_empty());
+		EXPECT_EQ(bbsg.num_blocks(), bbe.num_blocks());
+		bbe.set_bit(5);
+		EXPECT_EQ(2, pool.size());
+
+		//the same objects (and storage) are reused
+		if (rep == 0) { p0 = &bb; d0 = bb.bitset().data(); }
+		EXPECT_EQ(p0, &bb);
+		EXPECT_EQ(d0, bb.bitset().data());
+	}
+	EXPECT_EQ(0, pool.size());
+	EXPECT_EQ(2, pool.capacity());
+
+	//references remain valid when the pool grows
+	BBScan& first = pool.acquire(bbsg);
+	for (int i = 0; i < 100; ++i) { pool.acquire(300); }
+	EXPECT_TRUE(first == bbsg);
+	pool.clear();
+
+	//sparse bitsets
+	BitsetPool<BBScanSp>& pools = BitsetPool<BBScanSp>::local();
+	{
+		BitsetPool<BBScanSp>::Frame f(pools);
+		BBScanSp& bbs = pools.acquire(10000);
+		bbs.set_bit(9999);
+		EXPECT_EQ(1, bbs.count());
+		EXPECT_TRUE(pools.acquire(10000).is_empty());
+	}
+	EXPECT_EQ(0, pools.size());
+}
@@ -0,0 +1,143 @@
+/**
+* @file test_bbset_atomic.cpp
+* @brief Unit tests of the AtomicBitset class, including multithreaded stress tests
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_atomic.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+const int NTHREADS = 8;
+
+TEST(Atomic, basic) {
+
+	AtomicBitset abb(130);
+	EXPECT_EQ(3, abb.num_blocks());
+	EXPECT_TRUE(abb.is_empty());
+
+	abb.set_bit(0);
+	abb.set_bit(64);
+	EXPECT_FALSE(abb.test_and_set(129));
+	EXPECT_TRUE(abb.test_and_set(129));
+	EXPECT_EQ(3, abb.count());
+	EXPECT_TRUE(abb.is_bit(64));
+
+	EXPECT_TRUE(abb.test_and_erase(64));
+	EXPECT_FALSE(abb.test_and_erase(64));
+	abb.erase_bit(0);
+	EXPECT_EQ(1, abb.count());
+
+	//bulk operations
+	Bitset bb(130, { 1, 2, 65, 128 });
+	abb.merge(bb);
+	EXPECT_EQ(vector<int>({ 1, 2, 65, 128, 129 }), static_cast<bitpos_list>(abb.to_bitset()));
+	abb.erase_bit(Bitset(130, { 2, 128 }));
+	EXPECT_EQ(vector<int>({ 1, 65, 129 }), static_cast<bitpos_list>(static_cast<Bitset>(abb)));
+
+	//conversions
+	BBScan bbs;
+	abb.to_bitset(bbs);
+	EXPECT_EQ(3, bbs.num_blocks());
+	EXPECT_EQ(3, bbs.count());
+
+	AtomicBitset abb2(bb);
+	EXPECT_TRUE(abb2.to_bitset() == bb);
+
+	abb.erase_bit();
+	EXPECT_TRUE(abb.is_empty());
+}
+
+TEST(Atomic, stress_test_and_set) {
+
+	const int NPOP = 100000;
+	AtomicBitset abb(NPOP);
+	vector<int> winners(NTHREADS, 0);
+
+	//all threads try to set all the bits (in different orders), each bit is won by exactly one thread
+	vector<std::thread> th;
+	for (int t = 0; t < NTHREADS; ++t) {
+		th.emplace_back([&abb, &winners, t]() {
+			vector<int> order(NPOP);
+			for (int i = 0; i < NPOP; ++i) { order[i] = i; }
+			std::shuffle(order.begin(), order.end(), std::mt19937(t));
+			for (int v : order) {
+				if (!abb.test_and_set(v)) { ++winners[t]; }
+			}
+		});
+	}
+	for (auto& x : th) { x.join(); }
+
+	int total = 0;
+	for (int w : winners) { total += w; }
+	EXPECT_EQ(NPOP, total);
+	EXPECT_EQ(NPOP, abb.count());
+}
+
+TEST(Atomic, stress_set_erase) {
+
+	const int NPOP = 4096;
+	AtomicBitset abb(NPOP);
+
+	//thread t owns the bits v with v % NTHREADS == t (all threads write to the same bitblocks):
+	//it sets its bits, erases the odd ones and merges a private bitset, repeatedly
+	vector<std::thread> th;
+	for (int t = 0; t < NTHREADS; ++t) {
+		th.emplace_back([&abb, t]() {
+			Bitset own(NPOP);
+			for (int v = t; v < NPOP; v += 2 * NTHREADS) { own.set_bit(v); }
+			for (int rep = 0; rep < 20; ++rep) {
+				for (int v = t; v < NPOP; v += NTHREADS) { abb.set_bit(v); }
+				for (int v = t + NTHREADS; v < NPOP; v += 2 * NTHREADS) { abb.erase_bit(v); }
+				abb.erase_bit(own);
+				abb.merge(own);
+			}
+		});
+	}
+	for (auto& x : th) { x.join(); }
+
+	//only the even multiples of the owners survive: v % (2 * NTHREADS) < NTHREADS
+	Bitset bb = abb.to_bitset();
+	for (int v = 0; v < NPOP; ++v) {
+		EXPECT_EQ(v % (2 * NTHREADS) < NTHREADS, bb.is_bit(v)) << v;
+	}
+}
+
+TEST(Atomic, stress_merge) {
+
+	const int NPOP = 20000;
+	AtomicBitset abb(NPOP);
+	Bitset expected(NPOP);
+
+	//random private bitsets merged concurrently
+	vector<Bitset> parts(NTHREADS, Bitset(NPOP));
+	std::mt19937 gen(97);
+	std::uniform_int_distribution<int> bit(0, NPOP - 1);
+	for (auto& p : parts) {
+		for (int i = 0; i < NPOP / 4; ++i) { p.set_bit(bit(gen)); }
+		expected |= p;
+	}
+
+	std::atomic<int> go{ 0 };
+	vector<std::thread> th;
+	for (int t = 0; t < NTHREADS; ++t) {
+		th.emplace_back([&abb, &parts, &go, t]() {
+			++go;
+			while (go.load() < NTHREADS) { std::this_thread::yield(); }	//all threads start together
+			abb.merge(parts[t]);
+		});
+	}
+	for (auto& x : th) { x.join(); }
+
+	EXPECT_TRUE(expected == abb.to_bitset());
+}
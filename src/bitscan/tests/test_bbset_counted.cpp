@@ -0,0 +1,216 @@
+/**
+* @file test_bbset_counted.cpp
+* @brief Unit tests of the CountedBitset class (dense bitset with a maintained popcount)
+* @details After every operation the cached counts are checked against a popcount of the bitblocks,
+*		   with and without superblock counts
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_counted.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//TRUE if the cached counts of bb are those of its bitblocks
+	::testing::AssertionResult counts_ok(const CountedBitset& bb) {
+
+		const int pc = bbkernel::popcount(bb.data(), bb.num_blocks());
+		if (pc != bb.count()) {
+			return ::testing::AssertionFailure() << "count " << bb.count() << " expected " << pc;
+		}
+
+		if (bb.has_superblocks()) {
+			for (int s = 0; s < bb.num_superblocks(); ++s) {
+				const int first = s * CountedBitset::SBLOCK;
+				const int n = std::min(bb.num_blocks() - first, static_cast<int>(CountedBitset::SBLOCK));
+				const int spc = bbkernel::popcount(bb.data() + first, n);
+				if (spc != bb.superblock_count(s)) {
+					return ::testing::AssertionFailure() << "superblock " << s << ": " << bb.superblock_count(s) << " expected " << spc;
+				}
+			}
+		}
+
+		return ::testing::AssertionSuccess();
+	}
+}
+
+class CountedBitsetTest : public ::testing::TestWithParam<bool> {};
+INSTANTIATE_TEST_SUITE_P(CountedBitset, CountedBitsetTest, ::testing::Values(false, true));
+
+TEST_P(CountedBitsetTest, bit_updates) {
+
+	CountedBitset bb(1000);
+	bb.enable_superblocks(GetParam());
+
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_EQ(BBObject::noBit, bb.lsb());
+
+	bb.set_bit(10);
+	bb.set_bit(10);									//no change
+	bb.set_bit(999);
+	EXPECT_EQ(2, bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+
+	bb.erase_bit(500);								//no change
+	EXPECT_FALSE(bb.erase_bit_if(11));
+	EXPECT_TRUE(bb.erase_bit_if(10));
+	EXPECT_TRUE(bb.is_singleton());
+	EXPECT_EQ(999, bb.lsb());
+
+	bb.set_block(3, ~ZERO);
+	EXPECT_EQ(65, bb.count());
+	bb.set_block(3, bblock::MASK_BIT(0));
+	EXPECT_EQ(2, bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+
+	//ranges
+	bb.set_bit(60, 700);
+	EXPECT_EQ(642, bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+	bb.erase_bit(100, 199);
+	EXPECT_EQ(542, bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+	bb.erase_bit(650, -1);
+	EXPECT_TRUE(counts_ok(bb));
+
+	bb.flip();
+	EXPECT_EQ(1024 - 490, bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+
+	bb.erase_bit();
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(counts_ok(bb));
+}
+
+TEST_P(CountedBitsetTest, set_operations) {
+
+	const int NPOP = 3000;
+	std::mt19937 gen(17);
+	std::bernoulli_distribution coin(0.3);
+
+	CountedBitset lhs(NPOP), rhs(NPOP), res(NPOP);
+	BBScan blhs(NPOP), brhs(NPOP), bres(NPOP);
+	lhs.enable_superblocks(GetParam());
+	res.enable_superblocks(GetParam());
+
+	for (int i = 0; i < NPOP; ++i) {
+		if (coin(gen)) { lhs.set_bit(i); blhs.set_bit(i); }
+		if (coin(gen)) { rhs.set_bit(i); brhs.set_bit(i); }
+	}
+
+	EXPECT_EQ(blhs.count(), lhs.count());
+	EXPECT_TRUE(counts_ok(lhs));
+
+	//independent operators
+	AND(lhs, rhs, res);
+	EXPECT_EQ(AND(blhs, brhs, bres).count(), res.count());
+	EXPECT_TRUE(counts_ok(res));
+	OR(lhs, rhs, res);
+	EXPECT_EQ(OR(blhs, brhs, bres).count(), res.count());
+	EXPECT_TRUE(counts_ok(res));
+	erase_bit(lhs, rhs, res);
+	EXPECT_EQ(erase_bit(blhs, brhs, bres).count(), res.count());
+	EXPECT_TRUE(counts_ok(res));
+
+	//block operations
+	CountedBitset bb = lhs;
+	bb.AND_EQUAL_block(5, 30, rhs);
+	EXPECT_TRUE(counts_ok(bb));
+	bb.set_block(10, 40, rhs);
+	EXPECT_TRUE(counts_ok(bb));
+	bb.erase_block(0, 20, rhs);
+	EXPECT_TRUE(counts_ok(bb));
+	bb.assign_block(41, bb.num_blocks() - 1, rhs);
+	EXPECT_TRUE(counts_ok(bb));
+
+	//compound operators
+	bb = lhs;
+	bb &= rhs;
+	blhs &= brhs;
+	EXPECT_EQ(blhs.count(), bb.count());
+	EXPECT_TRUE(counts_ok(bb));
+	bb |= lhs;
+	EXPECT_TRUE(counts_ok(bb));
+	bb ^= rhs;
+	EXPECT_TRUE(counts_ok(bb));
+	bb.erase_bit(rhs);
+	EXPECT_TRUE(counts_ok(bb));
+	EXPECT_TRUE(bb.is_disjoint(rhs));
+}
+
+TEST_P(CountedBitsetTest, range_count) {
+
+	const int NPOP = 5000;
+	std::mt19937 gen(3);
+	std::bernoulli_distribution coin(0.5);
+
+	CountedBitset bb(NPOP);
+	BBScan bbsc(NPOP);
+	bb.enable_superblocks(GetParam());
+
+	for (int i = 0; i < NPOP; ++i) {
+		if (coin(gen)) { bb.set_bit(i); bbsc.set_bit(i); }
+	}
+
+	std::uniform_int_distribution<int> pos(0, NPOP - 1);
+	for (int k = 0; k < 200; ++k) {
+		int first = pos(gen), last = pos(gen);
+		if (first > last) { std::swap(first, last); }
+		ASSERT_EQ(bbsc.count(first, last), bb.count(first, last));
+	}
+	EXPECT_EQ(bbsc.count(1000), bb.count(1000));
+}
+
+TEST_P(CountedBitsetTest, destructive_scan) {
+
+	CountedBitset bb(300, { 1, 64, 65, 200, 299 });
+	CountedBitset bbdel(300, { 1, 65, 299 });
+	bb.enable_superblocks(GetParam());
+
+	int nBit = BBObject::noBit;
+	vector<int> lv;
+	bb.init_scan(BBObject::DESTRUCTIVE);
+	while ((nBit = bb.next_bit_del(bbdel)) != BBObject::noBit) {
+		lv.push_back(nBit);
+		EXPECT_TRUE(counts_ok(bb));
+	}
+
+	EXPECT_EQ(vector<int>({ 1, 64, 65, 200, 299 }), lv);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(bbdel.is_empty());
+	EXPECT_TRUE(counts_ok(bbdel));
+
+	//reverse destructive scan over the cached bitscanning class
+	bb.set_bit(7);
+	bb.set_bit(150);
+	lv.clear();
+	CountedBitset::scanDR sc(bb);
+	while ((nBit = sc.next_bit()) != BBObject::noBit) {
+		lv.push_back(nBit);
+	}
+	EXPECT_EQ(vector<int>({ 150, 7 }), lv);
+	EXPECT_EQ(0, bb.count());
+}
+
+TEST(CountedBitset, conversions) {
+
+	BBScan bbsc(200, { 0, 63, 64, 199 });
+	CountedBitset bb(bbsc.cview());
+
+	EXPECT_EQ(4, bb.count());
+	EXPECT_EQ(static_cast<bitpos_list>(bbsc), static_cast<bitpos_list>(bb));
+	EXPECT_EQ("[0 63 64 199 (4)]", bb.to_string());
+
+	CountedBitset bb1(200, { 0, 63, 64, 199 });
+	EXPECT_TRUE(bb == bb1);
+	bb1.erase_bit(199);
+	EXPECT_TRUE(bb != bb1);
+}
@@ -0,0 +1,139 @@
+/**
+* @file test_bbset_expr.cpp
+* @brief Unit tests of the expression templates for Bitset / BBScan (operators &, |, ^, ~,
+*		 evaluation, block range assignment and reductions)
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_expr.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+
+using namespace std;
+using namespace bitgraph;
+
+class BitsetExprTest : public ::testing::Test {
+protected:
+	BitsetExprTest() : a(NPOP), b(NPOP), c(NPOP), d(NPOP) {}
+	void SetUp() override {
+		for (int i = 0; i < NPOP; i += 2) { a.set_bit(i); }
+		for (int i = 0; i < NPOP; i += 3) { b.set_bit(i); }
+		for (int i = 0; i < NPOP; i += 5) { c.set_bit(i); }
+		for (int i = 0; i < NPOP; i += 7) { d.set_bit(i); }
+	}
+
+	//reference result of (a & b) | (c & ~d) built with the existing operations
+	BBScan reference() const {
+		BBScan res(NPOP), tmp(NPOP);
+		AND(a, b, res);
+		erase_bit(c, d, tmp);
+		res |= tmp;
+		return res;
+	}
+
+	static const int NPOP = 1000;
+
+	//////////////////////
+	//data members
+	BBScan a, b, c, d;
+};
+
+TEST_F(BitsetExprTest, evaluation) {
+
+	BBScan res(NPOP);
+	res = (a & b) | (c & ~d);
+	EXPECT_EQ(reference(), res);
+
+	//xor
+	BBScan resx(NPOP), sol(a);
+	resx = a ^ b;
+	sol ^= b;
+	EXPECT_EQ(sol, resx);
+
+	//Bitset result, resized to the expression
+	Bitset resb;
+	resb = a & b;
+	EXPECT_EQ(a.num_blocks(), resb.num_blocks());
+	EXPECT_EQ(AND(a, b).count(), resb.count());
+}
+
+TEST_F(BitsetExprTest, aliasing) {
+
+	//the result is one of the operands
+	BBScan sol(a);
+	sol.erase_bit(b);
+
+	a = a & ~b;
+	EXPECT_EQ(sol, a);
+}
+
+TEST_F(BitsetExprTest, compound_assignment) {
+
+	BBScan res(a), sol(a);
+	res &= b | c;
+	sol &= OR(b, c);
+	EXPECT_EQ(sol, res);
+
+	res = d;
+	sol = d;
+	res |= a & b;
+	sol |= AND(a, b);
+	EXPECT_EQ(sol, res);
+}
+
+TEST_F(BitsetExprTest, assign_block) {
+
+	BBScan res(NPOP);
+	res.set_bit(0, NPOP - 1);
+	const BBScan res_ori(res);
+
+	//blocks outside the range are not modified
+	res.assign_block(2, 4, a & b & c);
+	BBScan sol(NPOP);
+	sol = a & b & c;
+
+	for (int i = 0; i < res.num_blocks(); ++i) {
+		if (i >= 2 && i <= 4) {
+			EXPECT_EQ(sol.block(i), res.block(i));
+		}
+		else {
+			EXPECT_EQ(res_ori.block(i), res.block(i));
+		}
+	}
+
+	//till the end
+	res.assign_block(10, BBObject::npos, a & b & c);
+	for (int i = 10; i < res.num_blocks(); ++i) {
+		EXPECT_EQ(sol.block(i), res.block(i));
+	}
+}
+
+TEST_F(BitsetExprTest, reductions) {
+
+	BBScan sol = reference();
+	auto e = (a & b) | (c & ~d);
+
+	EXPECT_EQ(sol.count(), e.count());
+	EXPECT_FALSE(e.is_empty());
+	EXPECT_EQ(sol.lsb(), e.lsb());
+
+	//block range
+	int pc = 0;
+	for (int i = 3; i <= 7; ++i) {
+		pc += bblock::popc64(sol.block(i));
+	}
+	EXPECT_EQ(pc, e.count_block(3, 7));
+	EXPECT_EQ(sol.next_bit(WMUL(3) - 1), e.lsb_block(3, 7));
+	EXPECT_FALSE(e.is_empty_block(3, BBObject::npos));
+
+	//empty expression
+	EXPECT_TRUE((a & ~a).is_empty());
+	EXPECT_EQ(0, (a & ~a).count());
+	EXPECT_EQ(BBObject::noBit, (a & ~a).lsb());
+	EXPECT_EQ(0, (a ^ a).count());
+
+	//complement over whole bitblocks
+	EXPECT_EQ(WMUL(a.num_blocks()) - a.count(), (~a).count());
+}
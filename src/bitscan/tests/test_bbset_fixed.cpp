@@ -0,0 +1,238 @@
+/**
+* @file test_bbset_fixed.cpp
+* @brief Unit tests of the FixedBitset class (inline storage, compile-time size)
+* @details Results are checked against BBScan for the same operations
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_fixed.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <set>
+#include <type_traits>
+
+using namespace std;
+using namespace bitgraph;
+
+class FixedBitsetTest : public ::testing::Test {
+protected:
+	FixedBitsetTest() : bbf(201), bbsc(201) {}
+	void SetUp() override {
+		for (int i = 0; i <= 200; i += 25) {
+			bbf.set_bit(i);
+			bbsc.set_bit(i);
+			sol.insert(i);
+		}
+	}
+
+	//////////////////////
+	//data members
+	FixedBitset<256> bbf;
+	BBScan bbsc;
+	set<int> sol;
+};
+
+TEST(FixedBitset, layout) {
+
+	//no vptr, inline storage
+	EXPECT_FALSE(std::is_polymorphic<FixedBitset<512>>::value);
+	EXPECT_TRUE(std::is_trivially_copyable<FixedBitset<512>>::value);
+	EXPECT_EQ(8, FixedBitset<512>::NBB());
+	EXPECT_EQ(1, FixedBitset<1>::NBB());
+	EXPECT_EQ(2, FixedBitset<65>::NBB());
+	EXPECT_EQ(512u, FixedBitset<512>::capacity());
+	EXPECT_EQ(8, FixedBitset<512>(200).num_blocks());
+}
+
+TEST(FixedBitset, construction) {
+
+	FixedBitset<130> bb(130, true);
+	EXPECT_EQ(130, bb.count());
+	EXPECT_EQ(0, bb.lsb());
+	EXPECT_EQ(129, bb.msb());
+
+	FixedBitset<130> bb1(100, { 5, 64, 99 });
+	EXPECT_EQ(3, bb1.count());
+	EXPECT_TRUE(bb1.is_bit(64));
+
+	vector<int> lv = { 1, 2, 3 };
+	FixedBitset<130> bb2(100, lv);
+	EXPECT_EQ(lv, static_cast<vector<int>>(bb2));
+
+	bb2.reset(10);
+	EXPECT_TRUE(bb2.is_empty());
+
+	FixedBitset<130> bb3;
+	EXPECT_TRUE(bb3.is_empty());
+	EXPECT_EQ(BBObject::noBit, bb3.lsb());
+	EXPECT_EQ(BBObject::noBit, bb3.msb());
+}
+
+TEST_F(FixedBitsetTest, non_destructive) {
+
+	std::set<int> res;
+	int nBit = BBObject::noBit;
+	while ((nBit = bbf.next_bit(nBit)) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(sol, res);
+
+	res.clear();
+	bbf.init_scan(BBObject::NON_DESTRUCTIVE);
+	while ((nBit = bbf.next_bit()) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(sol, res);
+
+	//starting point (excluded)
+	res.clear();
+	bbf.init_scan(50, BBObject::NON_DESTRUCTIVE);
+	while ((nBit = bbf.next_bit()) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(6u, res.size());
+	EXPECT_EQ(75, *res.begin());
+
+	//nested scan
+	res.clear();
+	FixedBitset<256>::scan sc(bbf);
+	while ((nBit = sc.next_bit()) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(sol, res);
+}
+
+TEST_F(FixedBitsetTest, non_destructive_reverse) {
+
+	std::vector<int> res;
+	int nBit = BBObject::noBit;
+	while ((nBit = bbf.prev_bit(nBit)) != BBObject::noBit) {
+		res.push_back(nBit);
+	}
+	EXPECT_EQ(vector<int>(sol.rbegin(), sol.rend()), res);
+
+	res.clear();
+	bbf.init_scan(BBObject::NON_DESTRUCTIVE_REVERSE);
+	while ((nBit = bbf.prev_bit()) != BBObject::noBit) {
+		res.push_back(nBit);
+	}
+	EXPECT_EQ(vector<int>(sol.rbegin(), sol.rend()), res);
+
+	res.clear();
+	FixedBitset<256>::scanR sc(bbf);
+	while ((nBit = sc.next_bit()) != BBObject::noBit) {
+		res.push_back(nBit);
+	}
+	EXPECT_EQ(vector<int>(sol.rbegin(), sol.rend()), res);
+}
+
+TEST_F(FixedBitsetTest, destructive) {
+
+	std::set<int> res;
+	FixedBitset<256> bbdel(201, true);
+
+	FixedBitset<256> bb(bbf);
+	bb.init_scan(BBObject::DESTRUCTIVE);
+	int nBit = BBObject::noBit;
+	while ((nBit = bb.next_bit_del(bbdel)) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(sol, res);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_EQ(201 - static_cast<int>(sol.size()), bbdel.count());
+	EXPECT_TRUE(bbdel.is_disjoint(bbf));
+
+	//reverse
+	res.clear();
+	bb = bbf;
+	FixedBitset<256>::scanDR sc(bb);
+	while ((nBit = sc.next_bit()) != BBObject::noBit) {
+		res.insert(nBit);
+	}
+	EXPECT_EQ(sol, res);
+	EXPECT_TRUE(bb.is_empty());
+}
+
+TEST_F(FixedBitsetTest, set_operations) {
+
+	std::mt19937_64 gen(1357);
+	std::bernoulli_distribution coin(0.4);
+
+	FixedBitset<256> bbf2(201);
+	BBScan bbsc2(201);
+	for (int i = 0; i < 201; ++i) {
+		if (coin(gen)) { bbf2.set_bit(i); bbsc2.set_bit(i); }
+	}
+
+	//AND
+	FixedBitset<256> resf(201);
+	BBScan ressc(201);
+	AND(bbf, bbf2, resf);
+	AND(bbsc, bbsc2, ressc);
+	EXPECT_EQ(ressc.count(), resf.count());
+	for (int i = 0; i < resf.num_blocks() && i < ressc.num_blocks(); ++i) {
+		EXPECT_EQ(ressc.block(i), resf.block(i));
+	}
+	EXPECT_EQ(resf, AND(bbf, bbf2));
+	EXPECT_EQ(find_first_common(bbsc, bbsc2), find_first_common(bbf, bbf2));
+
+	//OR
+	OR(bbf, bbf2, resf);
+	OR(bbsc, bbsc2, ressc);
+	EXPECT_EQ(ressc.count(), resf.count());
+
+	//set difference
+	erase_bit(bbf, bbf2, resf);
+	erase_bit(bbsc, bbsc2, ressc);
+	EXPECT_EQ(ressc.count(), resf.count());
+	EXPECT_TRUE(resf.is_disjoint(bbf2));
+
+	resf = bbf;
+	resf.erase_bit(bbf2);
+	EXPECT_EQ(ressc.count(), resf.count());
+
+	//XOR with itself
+	resf = bbf;
+	resf ^= bbf;
+	EXPECT_TRUE(resf.is_empty());
+
+	//ranges
+	resf.set_bit(10, 140);
+	EXPECT_EQ(131, resf.count());
+	EXPECT_EQ(31, resf.count(110, 140));
+	EXPECT_EQ(5, resf.count(10, 14));
+	resf.erase_bit(20, 129);
+	EXPECT_EQ(21, resf.count());
+	resf.erase_bit(0, -1);
+	EXPECT_TRUE(resf.is_empty());
+}
+
+TEST_F(FixedBitsetTest, common_singleton) {
+
+	FixedBitset<256> bb(201);
+	int bit = 0;
+
+	bb.set_bit(1);
+	EXPECT_EQ(0, bbf.find_common_singleton(bb, bit));
+	EXPECT_EQ(BBObject::noBit, bit);
+
+	bb.set_bit(150);
+	EXPECT_EQ(1, bbf.find_common_singleton(bb, bit));
+	EXPECT_EQ(150, bit);
+
+	bb.set_bit(175);
+	EXPECT_EQ(-1, bbf.find_common_singleton(bb, bit));
+	EXPECT_EQ(BBObject::noBit, bit);
+}
+
+TEST_F(FixedBitsetTest, IO) {
+
+	FixedBitset<64> bb(10, { 1, 3, 5 });
+	EXPECT_EQ("[1 3 5 (3)]", bb.to_string());
+
+	//I/O
+	//cout << bbf << endl;
+}
@@ -0,0 +1,247 @@
+/**
+* @file test_bbset_hash.cpp
+* @brief Unit tests of bitset hashing / content equality (bbset_hash.h) and of the TranspositionTable class,
+*		  including a multithreaded stress test
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_hash.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbset_counted.h"
+#include "bitscan/bbset_wide.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+const int NTHREADS = 8;
+
+TEST(Hash, same_bits_same_hash) {
+
+	const int POP = 300;
+	std::mt19937 gen(1357);
+	std::uniform_int_distribution<int> dist(0, POP - 1);
+
+	for (int rep = 0; rep < 20; ++rep) {
+		vector<int> lv;
+		for (int i = 0; i < rep * 5; ++i) { lv.push_back(dist(gen)); }
+
+		Bitset bb(POP);
+		BBScan bbs(POP + 200);								//larger capacity, same 1-bits
+		BitsetSp bbsp(POP);
+		CountedBitset bbc(POP);
+		WideBitset<256> bbw(POP);
+		for (int v : lv) {
+			bb.set_bit(v);
+			bbs.set_bit(v);
+			bbsp.set_bit(v);
+			bbc.set_bit(v);
+			bbw.set_bit(v);
+		}
+
+		const auto h = bitset_hash(bb);
+		EXPECT_EQ(h, bitset_hash(bbs));
+		EXPECT_EQ(h, bitset_hash(bbsp));
+		EXPECT_EQ(h, bitset_hash(bbc));
+		EXPECT_EQ(h, bitset_hash(bbw));
+		EXPECT_EQ(h, bitset_hash(bb.cview()));
+
+		EXPECT_TRUE(same_bits(bb, bb));
+		EXPECT_TRUE(same_bits(bb.cview(), bbs.cview()));
+		EXPECT_TRUE(same_bits(bbs.cview(), bb.cview()));
+		EXPECT_TRUE(same_bits(bb.cview(), bbw.cview()));
+
+		if (!lv.empty()) {
+			bbs.erase_bit(lv[0]);
+			EXPECT_NE(h, bitset_hash(bbs));
+			EXPECT_FALSE(same_bits(bb.cview(), bbs.cview()));
+		}
+	}
+
+	//the empty set
+	EXPECT_EQ(0, bitset_hash(Bitset(100)));
+	EXPECT_EQ(0, bitset_hash(BitsetSp(100)));
+	EXPECT_TRUE(same_bits(Bitset(100).cview(), Bitset(1000).cview()));
+}
+
+TEST(Hash, sparse_empty_blocks) {
+
+	BitsetSp lhs(500, { 10, 200, 400 });
+	BitsetSp rhs(500, { 10, 130, 400 });
+	rhs.erase_bit(130);										//an empty bitblock may remain in rhs
+	rhs.set_bit(200);
+
+	EXPECT_TRUE(same_bits(lhs, rhs));
+	EXPECT_EQ(bitset_hash(lhs), bitset_hash(rhs));
+
+	rhs.erase_bit(400);
+	EXPECT_FALSE(same_bits(lhs, rhs));
+	EXPECT_FALSE(same_bits(rhs, lhs));
+	EXPECT_NE(bitset_hash(lhs), bitset_hash(rhs));
+}
+
+TEST(Hash, incremental) {
+
+	const int POP = 1000;
+	std::mt19937 gen(2468);
+	std::uniform_int_distribution<int> dist(0, POP - 1);
+
+	Bitset bb(POP);
+	std::uint64_t h = bitset_hash(bb);
+	for (int i = 0; i < 2000; ++i) {
+		const int v = dist(gen);
+		h = bitset_hash_flip(h, bb.block(WDIV(v)), v);
+		if (bb.is_bit(v)) { bb.erase_bit(v); }
+		else { bb.set_bit(v); }
+		ASSERT_EQ(bitset_hash(bb), h);
+	}
+
+	//block update
+	const BITBOARD old = bb.block(3);
+	bb.block(3) = 0xF0F0;
+	h = bitset_hash_update(h, 3, old, 0xF0F0);
+	EXPECT_EQ(bitset_hash(bb), h);
+}
+
+TEST(Hash, unordered_containers) {
+
+	std::unordered_set<Bitset, BitsetHash, BitsetEqual> seen;
+	seen.insert(Bitset(200, { 1, 2, 3 }));
+	seen.insert(Bitset(200, { 1, 2, 3 }));
+	seen.insert(Bitset(200, { 1, 2, 150 }));
+	EXPECT_EQ(2, seen.size());
+	EXPECT_EQ(1, seen.count(Bitset(200, { 150, 2, 1 })));
+
+	std::unordered_map<BitsetSp, int, BitsetHash, BitsetEqual> memo;
+	memo[BitsetSp(200, { 5, 70 })] = 1;
+	memo[BitsetSp(200, { 70, 5 })] = 2;
+	EXPECT_EQ(1, memo.size());
+	EXPECT_EQ(2, memo[BitsetSp(200, { 5, 70 })]);
+}
+
+TEST(TranspositionTable, insert_find) {
+
+	TranspositionTable<int> tt(200, 1000);
+	EXPECT_EQ(1024, tt.capacity());
+	EXPECT_EQ(4, tt.num_blocks());
+	EXPECT_EQ(0, tt.size());
+
+	Bitset a(200, { 1, 64, 199 });
+	Bitset b(200, { 1, 64 });
+	int val = -1;
+	EXPECT_FALSE(tt.find(a, val));
+
+	EXPECT_TRUE(tt.insert(a, 10));
+	EXPECT_TRUE(tt.find(a, val));
+	EXPECT_EQ(10, val);
+	EXPECT_FALSE(tt.find(b, val));
+
+	//overwrite
+	EXPECT_TRUE(tt.insert(a, 20));
+	EXPECT_TRUE(tt.find(a, val));
+	EXPECT_EQ(20, val);
+	EXPECT_EQ(1, tt.size());
+
+	//shorter dense keys and sparse keys address the same entries
+	BitsetSp asp(200, { 1, 64, 199 });
+	EXPECT_TRUE(tt.find(asp, val));
+	EXPECT_EQ(20, val);
+	EXPECT_TRUE(tt.find(Bitset(130, { 1, 64 }), val) == false);
+	EXPECT_TRUE(tt.insert(BitsetSp(200, { 1, 64 }), 30));
+	EXPECT_TRUE(tt.find(b, val));
+	EXPECT_EQ(30, val);
+
+	//incremental hash supplied by the caller
+	std::uint64_t h = bitset_hash(b);
+	h = bitset_hash_flip(h, b.block(WDIV(199)), 199);
+	EXPECT_TRUE(tt.find(a, h, val));
+	EXPECT_EQ(20, val);
+
+	tt.clear();
+	EXPECT_EQ(0, tt.size());
+	EXPECT_FALSE(tt.find(a, val));
+}
+
+TEST(TranspositionTable, collisions) {
+
+	//one bucket: keys compete for WAYS slots, lookups never return a wrong value
+	TranspositionTable<std::uint64_t> tt(100, 1);
+	EXPECT_EQ(TranspositionTable<std::uint64_t>::WAYS, tt.capacity());
+
+	vector<Bitset> keys;
+	for (int v = 0; v < 100; ++v) {
+		keys.emplace_back(100, std::initializer_list<int>{ v });
+		EXPECT_TRUE(tt.insert(keys.back(), 1000 + v));
+	}
+	EXPECT_EQ(tt.capacity(), tt.size());
+
+	int found = 0;
+	for (int v = 0; v < 100; ++v) {
+		std::uint64_t val = 0;
+		if (tt.find(keys[v], val)) {
+			EXPECT_EQ(1000 + v, val);
+			++found;
+		}
+	}
+	EXPECT_GE(found, 1);
+	EXPECT_LE(found, TranspositionTable<std::uint64_t>::WAYS);
+
+	//the last key inserted is always found
+	std::uint64_t val = 0;
+	EXPECT_TRUE(tt.find(keys.back(), val));
+	EXPECT_EQ(1099, val);
+}
+
+TEST(TranspositionTable, stress) {
+
+	//values are a function of the key: a torn read would return a wrong value
+	const int POP = 256, NKEYS = 2000, NOPS = 20000;
+	TranspositionTable<std::uint64_t> tt(POP, 512);
+
+	vector<Bitset> keys;
+	std::mt19937 gen(97531);
+	for (int k = 0; k < NKEYS; ++k) {
+		keys.emplace_back(POP);
+		for (int i = 0; i < POP; ++i) {
+			if (gen() % 4 == 0) { keys.back().set_bit(i); }
+		}
+	}
+	auto value = [](const Bitset& bb) { return static_cast<std::uint64_t>(bb.count()) * 1000003u + bb.lsb(); };
+
+	std::atomic<int> wrong{ 0 }, hits{ 0 };
+	vector<std::thread> threads;
+	for (int t = 0; t < NTHREADS; ++t) {
+		threads.emplace_back([&, t]() {
+			std::mt19937 g(t);
+			for (int i = 0; i < NOPS; ++i) {
+				const Bitset& key = keys[g() % NKEYS];
+				std::uint64_t val = 0;
+				if (g() % 2) {
+					tt.insert(key, value(key));
+				}
+				else if (tt.find(key, val)) {
+					++hits;
+					if (val != value(key)) { ++wrong; }
+				}
+			}
+		});
+	}
+	for (auto& th : threads) { th.join(); }
+
+	EXPECT_EQ(0, wrong.load());
+	EXPECT_GT(hits.load(), 0);
+
+	//the table is consistent after the writers have finished
+	for (const auto& key : keys) {
+		std::uint64_t val = 0;
+		if (tt.find(key, val)) { EXPECT_EQ(value(key), val); }
+	}
+}
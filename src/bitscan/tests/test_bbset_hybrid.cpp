@@ -0,0 +1,274 @@
+/**
+* @file test_bbset_hybrid.cpp
+* @brief Unit tests of the HybridBitset class (adaptive array / dense / run chunks)
+* @details Results are checked against BBScanSp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_hybrid.h"
+#include "bitscan/bbscan_sparse.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+using HB = HybridBitset;
+
+namespace {
+
+	//types of the chunks of bb
+	vector<HB::chunk_types> chunk_types(const HB& bb) {
+		vector<HB::chunk_types> res;
+		for (const auto& c : bb.chunks()) {
+			res.push_back(c.type_);
+		}
+		return res;
+	}
+
+	//random bitset of nPop bits with dense, sparse and full chunks
+	void random_sets(int nPop, std::mt19937& gen, HB& bb, BBScanSp& bbs) {
+		bb.reset(nPop);
+		bbs.reset(nPop);
+		std::uniform_int_distribution<int> bit(0, nPop - 1);
+		std::uniform_int_distribution<int> len(1, 3000);
+		for (int i = 0; i < 300; ++i) {
+			const int v = bit(gen);
+			bb.set_bit(v);
+			bbs.set_bit(v);
+		}
+		for (int i = 0; i < 3; ++i) {
+			const int first = bit(gen);
+			const int last = std::min(nPop - 1, first + len(gen));
+			bb.set_bit(first, last);
+			for (int v = first; v <= last; ++v) {
+				bbs.set_bit(v);
+			}
+		}
+	}
+}
+
+TEST(Hybrid, construction) {
+
+	HB bb(10000, { 10, 64, 65, 4096, 9999 });
+	EXPECT_EQ(157, bb.num_blocks());
+	EXPECT_EQ(3u, bb.size());
+	EXPECT_EQ(5, bb.count());
+	EXPECT_TRUE(bb.is_bit(4096));
+	EXPECT_FALSE(bb.is_bit(4097));
+	EXPECT_EQ(10, bb.lsb());
+	EXPECT_EQ(9999, bb.msb());
+	EXPECT_EQ(ONE >> 62, bb.block(1));
+	EXPECT_EQ(ZERO, bb.block(2));
+	EXPECT_EQ(bitpos_list({ 10, 64, 65, 4096, 9999 }), static_cast<bitpos_list>(bb));
+	EXPECT_EQ("[10 64 65 4096 9999 (5)]", bb.to_string());
+
+	HB bbe(10000);
+	EXPECT_TRUE(bbe.is_empty());
+	EXPECT_EQ(BBObject::noBit, bbe.lsb());
+	EXPECT_EQ(-1, bbe.init_scan(BBObject::NON_DESTRUCTIVE));
+}
+
+TEST(Hybrid, chunk_types) {
+
+	HB bb(20000);
+
+	//ARRAY to DENSE (more than ARRAY_MAX elements)
+	for (int v = 0; v < 2 * HB::ARRAY_MAX; v += 2) {
+		bb.set_bit(v);
+	}
+	EXPECT_EQ(vector<HB::chunk_types>({ HB::ARRAY }), chunk_types(bb));
+	bb.set_bit(2 * HB::ARRAY_MAX + 1);
+	EXPECT_EQ(vector<HB::chunk_types>({ HB::DENSE }), chunk_types(bb));
+	EXPECT_EQ(HB::ARRAY_MAX + 1, bb.count());
+
+	//DENSE to ARRAY (hysteresis)
+	for (int v = 0; v < HB::ARRAY_MAX; v += 2) {
+		bb.erase_bit(v);
+	}
+	EXPECT_EQ(vector<HB::chunk_types>({ HB::DENSE }), chunk_types(bb));
+	bb.erase_bit(HB::ARRAY_MAX);
+	EXPECT_EQ(vector<HB::chunk_types>({ HB::ARRAY }), chunk_types(bb));
+	EXPECT_EQ(HB::ARRAY_MAX / 2, bb.count());
+
+	//RUN (range operations)
+	bb.erase_bit();
+	bb.set_bit(100, 10000);
+	EXPECT_EQ(vector<HB::chunk_types>({ HB::RUN, HB::RUN, HB::RUN }), chunk_types(bb));
+	EXPECT_EQ(9901, bb.count());
+	EXPECT_EQ(9901, bb.count(0, -1));
+	EXPECT_EQ(11, bb.count(4090, 4100));
+	EXPECT_EQ(3 * sizeof(HB::Chunk) + 6 * sizeof(uint16_t), bb.num_bytes());
+
+	//point updates on a RUN chunk
+	bb.erase_bit(5000);
+	EXPECT_FALSE(bb.is_bit(5000));
+	EXPECT_TRUE(bb.is_bit(5001));
+	EXPECT_EQ(HB::RUN, bb.chunks()[1].type_);
+	bb.set_bit(5000);
+	EXPECT_EQ(9901, bb.count());
+
+	bb.erase_bit(0, 4095);
+	EXPECT_EQ(2u, bb.size());
+	EXPECT_EQ(4096, bb.lsb());
+	bb.erase_bit(8000, -1);
+	EXPECT_EQ(7999, bb.msb());
+
+	//shrink_to_fit re-encodes
+	HB bbd(10000);
+	for (int v = 0; v < 600; v += 2) {
+		bbd.set_bit(v);
+	}
+	for (int v = 400; v < 600; v += 2) {
+		bbd.erase_bit(v);
+	}
+	EXPECT_EQ(HB::DENSE, bbd.chunks()[0].type_);
+	bbd.shrink_to_fit();
+	EXPECT_EQ(HB::ARRAY, bbd.chunks()[0].type_);
+	EXPECT_EQ(200, bbd.count());
+
+	//overflow of an ARRAY chunk with a single run
+	bbd.erase_bit();
+	for (int v = 0; v <= HB::ARRAY_MAX; ++v) {
+		bbd.set_bit(v);
+	}
+	EXPECT_EQ(HB::RUN, bbd.chunks()[0].type_);
+	EXPECT_EQ(2 * sizeof(uint16_t) + sizeof(HB::Chunk), bbd.num_bytes());
+}
+
+TEST(Hybrid, bitscanning) {
+
+	std::mt19937 gen(11);
+	HB bb;
+	BBScanSp bbs;
+	random_sets(30000, gen, bb, bbs);
+
+	//stateless
+	bitpos_list lv, lvs;
+	bbs.extract(lvs);
+	for (int v = bb.next_bit(BBObject::noBit); v != BBObject::noBit; v = bb.next_bit(v)) {
+		lv.push_back(v);
+	}
+	EXPECT_EQ(lvs, lv);
+
+	lv.clear();
+	for (int v = bb.prev_bit(BBObject::noBit); v != BBObject::noBit; v = bb.prev_bit(v)) {
+		lv.push_back(v);
+	}
+	std::reverse(lv.begin(), lv.end());
+	EXPECT_EQ(lvs, lv);
+
+	//non-destructive, from a bit
+	lv.clear();
+	bb.init_scan(lvs[10], BBObject::NON_DESTRUCTIVE);
+	for (int v = bb.next_bit(); v != BBObject::noBit; v = bb.next_bit()) {
+		lv.push_back(v);
+	}
+	EXPECT_EQ(bitpos_list(lvs.begin() + 11, lvs.end()), lv);
+
+	lv.clear();
+	bb.init_scan(lvs[10], BBObject::NON_DESTRUCTIVE_REVERSE);
+	for (int v = bb.prev_bit(); v != BBObject::noBit; v = bb.prev_bit()) {
+		lv.push_back(v);
+	}
+	EXPECT_EQ(10u, lv.size());
+
+	//iterator-based
+	lv.clear();
+	for (int v : bits(bb)) {
+		lv.push_back(v);
+	}
+	EXPECT_EQ(lvs, lv);
+
+	//destructive
+	HB bbc(bb);
+	lv.clear();
+	bbc.init_scan(BBObject::DESTRUCTIVE);
+	for (int v = bbc.next_bit_del(); v != BBObject::noBit; v = bbc.next_bit_del()) {
+		lv.push_back(v);
+	}
+	EXPECT_EQ(lvs, lv);
+	EXPECT_TRUE(bbc.is_empty());
+
+	bbc = bb;
+	int nBits = 0;
+	bbc.init_scan(BBObject::DESTRUCTIVE_REVERSE);
+	while (bbc.prev_bit_del() != BBObject::noBit) {
+		++nBits;
+	}
+	EXPECT_EQ(bb.count(), nBits);
+	EXPECT_TRUE(bbc.is_empty());
+}
+
+TEST(Hybrid, set_operations) {
+
+	std::mt19937 gen(5);
+	const int NPOP = 30000;
+
+	for (int rep = 0; rep < 10; ++rep) {
+		HB lhs, rhs;
+		BBScanSp lhss, rhss;
+		random_sets(NPOP, gen, lhs, lhss);
+		random_sets(NPOP, gen, rhs, rhss);
+
+		bitpos_list lv, lvs;
+
+		//AND
+		BBScanSp ress(NPOP);
+		HB res;
+		AND(lhss, rhss, ress);
+		AND(lhs, rhs, res);
+		ress.extract(lvs);
+		res.extract(lv);
+		EXPECT_EQ(lvs, lv);
+		EXPECT_EQ(ress.count(), count_and(lhs, rhs));
+		EXPECT_EQ(ress.is_empty(), lhs.is_disjoint(rhs));
+
+		lv.clear();
+		for (int v : bits_and(lhs, rhs)) {
+			lv.push_back(v);
+		}
+		EXPECT_EQ(lvs, lv);
+		EXPECT_TRUE(intersects_at_least(lhs, rhs, ress.count()));
+		EXPECT_FALSE(intersects_at_least(lhs, rhs, ress.count() + 1));
+
+		HB bb(lhs);
+		bb &= rhs;
+		EXPECT_EQ(res, bb);
+
+		//OR
+		bitpos_list lvl, lvr;
+		lhss.extract(lvl);
+		rhss.extract(lvr);
+		lvs.clear();
+		std::set_union(lvl.begin(), lvl.end(), lvr.begin(), lvr.end(), std::back_inserter(lvs));
+		OR(lhs, rhs, res);
+		res.extract(lv);
+		EXPECT_EQ(lvs, lv);
+
+		bb = lhs;
+		bb |= rhs;
+		EXPECT_EQ(res, bb);
+
+		//set difference
+		BBScanSp diffs(lhss);
+		diffs.erase_bit(rhss);
+		diffs.extract(lvs);
+		bb = lhs;
+		bb.erase_bit(rhs);
+		bb.extract(lv);
+		EXPECT_EQ(lvs, lv);
+		EXPECT_EQ(bb.count(), count_andnot(lhs, rhs));
+
+		lv.clear();
+		for (int v : bits_andnot(lhs, rhs)) {
+			lv.push_back(v);
+		}
+		EXPECT_EQ(lvs, lv);
+	}
+}
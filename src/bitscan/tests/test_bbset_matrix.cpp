@@ -0,0 +1,156 @@
+/**
+* @file test_bbset_matrix.cpp
+* @brief Unit tests of the BitsetMatrix class (rows of WideBitset<W> in one contiguous 64-byte aligned slab)
+*		 and of the aligned storage of WideBitset
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_matrix.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+	bool is_aligned_64(const void* p) { return reinterpret_cast<std::uintptr_t>(p) % 64 == 0; }
+}
+
+TEST(BitsetMatrix, layout) {
+
+	BitsetMatrix<WideBitset<64>> m(100, 200);				//4 bitblocks per row, stride of 8
+
+	EXPECT_EQ(100u, m.size());
+	EXPECT_EQ(4, m.num_blocks());
+	EXPECT_EQ(8, m.stride());
+	EXPECT_TRUE(is_aligned_64(m.data()));
+
+	for (int v = 0; v < 100; ++v) {
+		EXPECT_TRUE(m.is_in_slab(v));
+		EXPECT_EQ(m.data() + v * m.stride(), m[v].data());
+		EXPECT_TRUE(is_aligned_64(m[v].data()));
+		EXPECT_TRUE(m[v].is_empty());
+		EXPECT_EQ(4, m[v].num_blocks());
+	}
+
+	BitsetMatrix<WideBitset<512>> m8(10, 600);				//2 wide blocks per row
+	EXPECT_EQ(16, m8.num_blocks());
+	EXPECT_EQ(16, m8.stride());
+
+	//owned bitsets are aligned as well
+	WideBitset<64> bb(1000);
+	EXPECT_TRUE(is_aligned_64(bb.data()));
+}
+
+TEST(BitsetMatrix, rows) {
+
+	BitsetMatrix<WideBitset<64>> m(50, 300);
+	m[0].set_bit(10);
+	m[0].set_bit(299);
+	m[1].set_bit(0, 100);
+	m[49] = WideBitset<64>(300, { 5, 6, 7 });				//same size - written in the slab
+
+	EXPECT_TRUE(m.is_in_slab(49));
+	EXPECT_EQ(3, m[49].count());
+	EXPECT_EQ(2, m[0].count());
+	EXPECT_EQ(bblock::MASK_BIT(10), m.row_data(0)[0]);
+	EXPECT_EQ(101, m[1].count());
+	EXPECT_TRUE(m[2].is_empty());
+
+	//swap of rows keeps both in the slab
+	std::swap(m[0], m[1]);
+	EXPECT_TRUE(m.is_in_slab(0));
+	EXPECT_TRUE(m.is_in_slab(1));
+	EXPECT_EQ(101, m[0].count());
+	EXPECT_TRUE(m[1].is_bit(299));
+
+	//moving from a row copies it (the row is not released)
+	WideBitset<64> bb(std::move(m[1]));
+	EXPECT_EQ(2, bb.count());
+	EXPECT_EQ(2, m[1].count());
+	EXPECT_NE(bb.data(), m[1].data());
+
+	//a row of a different size leaves the slab
+	m[2].reset(1000);
+	EXPECT_FALSE(m.is_in_slab(2));
+	EXPECT_EQ(16, m[2].num_blocks());
+	m[2].set_bit(999);
+	EXPECT_EQ(0u, m.row_data(2)[0]);
+
+	//copy of a row
+	WideBitset<64> bb1(m[0]);
+	bb1.erase_bit(0);
+	EXPECT_TRUE(m[0].is_bit(0));
+}
+
+TEST(BitsetMatrix, assign_resize) {
+
+	WideBitset<128> row(200, { 1, 100, 199 });
+	BitsetMatrix<WideBitset<128>> m(20, row);
+
+	EXPECT_EQ(4, m.num_blocks());
+	for (int v = 0; v < 20; ++v) {
+		EXPECT_TRUE(m[v] == row);
+	}
+
+	//shrink keeps the slab
+	const BITBOARD* p = m.data();
+	m.resize(10);
+	EXPECT_EQ(10u, m.size());
+	EXPECT_EQ(p, m.data());
+
+	//grow - new empty rows
+	m[3].erase_bit(100);
+	m.resize(30);
+	EXPECT_EQ(30u, m.size());
+	for (int v = 0; v < 30; ++v) {
+		EXPECT_TRUE(m.is_in_slab(v));
+	}
+	EXPECT_EQ(2, m[3].count());
+	EXPECT_EQ(3, m[9].count());
+	EXPECT_TRUE(m[10].is_empty());
+	EXPECT_TRUE(m[29].is_empty());
+
+	m.clear();
+	EXPECT_TRUE(m.empty());
+	EXPECT_EQ(nullptr, m.data());
+}
+
+TEST(BitsetMatrix, copy_move) {
+
+	BitsetMatrix<WideBitset<64>> m(30, 130);
+	for (int v = 0; v < 30; ++v) {
+		m[v].set_bit(v);
+		m[v].set_bit(129 - v);
+	}
+	m[7].reset(64);											//row outside the slab
+
+	//copy - new slab
+	BitsetMatrix<WideBitset<64>> mc(m);
+	EXPECT_TRUE(mc == m);
+	EXPECT_NE(m.data(), mc.data());
+	EXPECT_TRUE(mc.is_in_slab(0));
+	EXPECT_FALSE(mc.is_in_slab(7));
+	mc[0].erase_bit(0);
+	EXPECT_TRUE(m[0].is_bit(0));
+	EXPECT_TRUE(mc != m);
+
+	//move - same slab
+	const BITBOARD* p = m.data();
+	BitsetMatrix<WideBitset<64>> mm(std::move(m));
+	EXPECT_EQ(p, mm.data());
+	EXPECT_TRUE(mm.is_in_slab(29));
+	EXPECT_TRUE(mm[29].is_bit(100));
+	EXPECT_TRUE(m.empty());
+
+	mc = mm;
+	EXPECT_TRUE(mc == mm);
+	EXPECT_NE(mc.data(), mm.data());
+
+	mc = std::move(mm);
+	EXPECT_EQ(p, mc.data());
+}
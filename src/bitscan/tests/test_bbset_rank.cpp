@@ -0,0 +1,119 @@
+/**
+* @file test_bbset_rank.cpp
+* @brief Unit tests of the BitsetRank class (rank / select directory over a Bitset)
+* @details Results are checked against a linear scan of the bitset
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_rank.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(Rank, basic) {
+
+	Bitset bb(1000, { 0, 10, 63, 64, 511, 512, 999 });
+	BitsetRank rs(bb);
+
+	EXPECT_EQ(7, rs.count());
+	EXPECT_EQ(0, rs.rank(0));
+	EXPECT_EQ(1, rs.rank(1));
+	EXPECT_EQ(2, rs.rank(63));
+	EXPECT_EQ(3, rs.rank(64));
+	EXPECT_EQ(5, rs.rank(512));
+	EXPECT_EQ(6, rs.rank(999));
+	EXPECT_EQ(7, rs.rank(WMUL(bb.num_blocks())));
+	EXPECT_EQ(4, rs.count(10, 511));
+
+	EXPECT_EQ(0, rs.select(0));
+	EXPECT_EQ(63, rs.select(2));
+	EXPECT_EQ(512, rs.select(5));
+	EXPECT_EQ(999, rs.select(6));
+	EXPECT_EQ(BBObject::noBit, rs.select(7));
+	EXPECT_EQ(BBObject::noBit, rs.select(-1));
+
+	//empty bitset
+	Bitset bbe(100);
+	BitsetRank rse(bbe);
+	EXPECT_EQ(0, rse.count());
+	EXPECT_EQ(0, rse.rank(50));
+	EXPECT_EQ(BBObject::noBit, rse.select(0));
+	std::mt19937 gen(1);
+	EXPECT_EQ(BBObject::noBit, rse.random_bit(gen));
+}
+
+TEST(Rank, random_vs_scan) {
+
+	std::mt19937 gen(7);
+	for (int nPop : { 64, 500, 4096, 100000 }) {
+		for (double p : { 0.001, 0.1, 0.9, 1.0 }) {
+			std::bernoulli_distribution coin(p);
+			Bitset bb(nPop);
+			for (int i = 0; i < nPop; ++i) {
+				if (coin(gen)) { bb.set_bit(i); }
+			}
+
+			BitsetRank rs(bb);
+			const bitpos_list lv = static_cast<bitpos_list>(bb);
+			ASSERT_EQ(static_cast<int>(lv.size()), rs.count());
+
+			int r = 0;
+			for (int i = 0; i < nPop; ++i) {
+				ASSERT_EQ(r, rs.rank(i));
+				if (bb.is_bit(i)) { ++r; }
+			}
+			for (int k = 0; k < static_cast<int>(lv.size()); ++k) {
+				ASSERT_EQ(lv[k], rs.select(k));
+			}
+			EXPECT_EQ(bb.count(nPop / 3, nPop - 1), rs.count(nPop / 3, nPop - 1));
+		}
+	}
+}
+
+TEST(Rank, invalidate) {
+
+	BBScan bb(2000, { 5, 700, 1500 });
+	BitsetRank rs(bb);
+	EXPECT_EQ(700, rs.select(1));
+	EXPECT_FALSE(rs.is_stale());
+
+	//contents are not tracked
+	bb.set_bit(100);
+	EXPECT_EQ(700, rs.select(1));
+	rs.invalidate();
+	EXPECT_TRUE(rs.is_stale());
+	EXPECT_EQ(100, rs.select(1));
+	EXPECT_EQ(4, rs.count());
+
+	//reallocation is tracked
+	bb.init(100000, bitpos_list{ 99999 });
+	EXPECT_TRUE(rs.is_stale());
+	EXPECT_EQ(1, rs.count());
+	EXPECT_EQ(99999, rs.select(0));
+}
+
+TEST(Rank, random_bit) {
+
+	Bitset bb(10000, { 3, 4000, 4001, 9999 });
+	BitsetRank rs(bb);
+	std::mt19937 gen(11);
+
+	vector<int> freq(10000, 0);
+	for (int i = 0; i < 4000; ++i) {
+		const int v = rs.random_bit(gen);
+		ASSERT_TRUE(bb.is_bit(v));
+		++freq[v];
+	}
+
+	//roughly uniform
+	for (int v : { 3, 4000, 4001, 9999 }) {
+		EXPECT_GT(freq[v], 800);
+		EXPECT_LT(freq[v], 1200);
+	}
+}
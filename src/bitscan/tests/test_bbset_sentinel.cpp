@@ -0,0 +1,332 @@
+/**
+* @file test_bbset_sentinel.cpp
+* @brief Unit tests of the SentinelBitset class (dense bitset with exact low / high sentinels)
+* @details After every operation the sentinels are checked against the first and last non-empty bitblocks,
+*		   and the 1-bits against a BBScan reference which undergoes the same operations
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_sentinel.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbscan_iter.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//TRUE if the sentinels of bb are its first and last non-empty bitblocks
+	::testing::AssertionResult sentinels_ok(const SentinelBitset& bb) {
+
+		int lo = bb.num_blocks(), hi = -1;
+		for (int i = 0; i < bb.num_blocks(); ++i) {
+			if (bb.block(i)) {
+				lo = std::min(lo, i);
+				hi = i;
+			}
+		}
+
+		if (lo != bb.sentinel_low() || hi != bb.sentinel_high()) {
+			return ::testing::AssertionFailure() << "sentinels [" << bb.sentinel_low() << ", " << bb.sentinel_high()
+				<< "] expected [" << lo << ", " << hi << "]";
+		}
+		return ::testing::AssertionSuccess();
+	}
+
+	//TRUE if bb and the reference ref have the same 1-bits
+	::testing::AssertionResult same_as(const SentinelBitset& bb, const BBScan& ref) {
+
+		for (int i = 0; i < bb.num_blocks(); ++i) {
+			if (bb.block(i) != ref.block(i)) {
+				return ::testing::AssertionFailure() << "bitblock " << i << " differs: " << bb << " expected " << ref;
+			}
+		}
+		if (bb.count() != ref.count()) {
+			return ::testing::AssertionFailure() << "count " << bb.count() << " expected " << ref.count();
+		}
+		if (bb.lsb() != ref.lsb() || bb.msb() != ref.msb()) {
+			return ::testing::AssertionFailure() << "lsb / msb " << bb.lsb() << " / " << bb.msb()
+				<< " expected " << ref.lsb() << " / " << ref.msb();
+		}
+		return ::testing::AssertionSuccess();
+	}
+
+	//random bitset with 1-bits in the bitblocks [lo, hi] only
+	void random_fill(std::mt19937& gen, int lo, int hi, double p, SentinelBitset& bb, BBScan& ref) {
+		std::bernoulli_distribution coin(p);
+		for (int v = WMUL(lo); v < WMUL(hi + 1); ++v) {
+			if (coin(gen)) {
+				bb.set_bit(v);
+				ref.set_bit(v);
+			}
+		}
+	}
+}
+
+TEST(SentinelBitset, bit_updates) {
+
+	SentinelBitset bb(1000);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(16, bb.sentinel_low());
+	EXPECT_EQ(-1, bb.sentinel_high());
+	EXPECT_EQ(BBObject::noBit, bb.lsb());
+	EXPECT_EQ(BBObject::noBit, bb.msb());
+
+	bb.set_bit(200);
+	EXPECT_TRUE(bb.is_singleton());
+	EXPECT_EQ(3, bb.sentinel_low());
+	EXPECT_EQ(3, bb.sentinel_high());
+
+	bb.set_bit(10);
+	bb.set_bit(999);
+	EXPECT_EQ(0, bb.sentinel_low());
+	EXPECT_EQ(15, bb.sentinel_high());
+	EXPECT_EQ(10, bb.lsb());
+	EXPECT_EQ(999, bb.msb());
+	EXPECT_FALSE(bb.is_singleton());
+
+	//erasing the only bit of a sentinel bitblock moves the sentinel inwards
+	bb.erase_bit(10);
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(3, bb.sentinel_low());
+	EXPECT_FALSE(bb.erase_bit_if(10));
+	EXPECT_TRUE(bb.erase_bit_if(999));
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(3, bb.sentinel_high());
+	EXPECT_TRUE(bb.is_singleton());
+
+	bb.erase_bit(200);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(sentinels_ok(bb));
+
+	//ranges
+	bb.set_bit(100, 700);
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(601, bb.count());
+	EXPECT_EQ(601, bb.count(0, -1));
+	EXPECT_EQ(11, bb.count(690, 999));
+	bb.erase_bit(100, 191);
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(192, bb.lsb());
+	bb.erase_bit(640, -1);
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(639, bb.msb());
+	bb.erase_bit();
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(sentinels_ok(bb));
+
+	//block writes
+	bb.set_block(7, 0xF0);
+	EXPECT_TRUE(sentinels_ok(bb));
+	bb.set_block(7, ZERO);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(sentinels_ok(bb));
+
+	//full set, flip
+	SentinelBitset full(130, true);
+	EXPECT_EQ(130, full.count());
+	EXPECT_TRUE(sentinels_ok(full));
+	full.flip();
+	EXPECT_TRUE(sentinels_ok(full));
+	EXPECT_EQ(62, full.count());
+	EXPECT_EQ(130, full.lsb());
+}
+
+TEST(SentinelBitset, set_operations) {
+
+	const int POP = 2000;
+	std::mt19937 gen(4242);
+	std::uniform_int_distribution<int> block(0, INDEX_1TO1(POP) - 1);
+
+	for (int rep = 0; rep < 200; ++rep) {
+
+		SentinelBitset lhs(POP), rhs(POP), res(POP);
+		BBScan rlhs(POP), rrhs(POP), rres(POP);
+
+		int a = block(gen), b = block(gen), c = block(gen), d = block(gen);
+		if (a > b) { std::swap(a, b); }
+		if (c > d) { std::swap(c, d); }
+		random_fill(gen, a, b, 0.05, lhs, rlhs);
+		random_fill(gen, c, d, 0.05, rhs, rrhs);
+		ASSERT_TRUE(sentinels_ok(lhs));
+		ASSERT_TRUE(sentinels_ok(rhs));
+
+		//stale bits in res outside the range of the operands
+		random_fill(gen, 0, INDEX_1TO1(POP) - 1, 0.01, res, rres);
+
+		AND(lhs, rhs, res);
+		AND(rlhs, rrhs, rres);
+		ASSERT_TRUE(sentinels_ok(res));
+		ASSERT_TRUE(same_as(res, rres));
+		EXPECT_EQ(rres.count(), count_and(lhs, rhs));
+		EXPECT_EQ(rres.lsb(), find_first_common(lhs, rhs));
+		EXPECT_EQ(rres.is_empty(), lhs.is_disjoint(rhs));
+
+		OR(lhs, rhs, res);
+		OR(rlhs, rrhs, rres);
+		ASSERT_TRUE(sentinels_ok(res));
+		ASSERT_TRUE(same_as(res, rres));
+
+		erase_bit(lhs, rhs, res);
+		erase_bit(rlhs, rrhs, rres);
+		ASSERT_TRUE(sentinels_ok(res));
+		ASSERT_TRUE(same_as(res, rres));
+
+		//range AND
+		const int first = std::min(WMUL(a) + 5, POP - 1);
+		const int last = std::min(first + 300, POP - 1);
+		AND<false>(first, last, lhs, rhs, res);
+		AND<false>(first, last, rlhs, rrhs, rres);
+		ASSERT_TRUE(sentinels_ok(res));
+		ASSERT_TRUE(same_as(res, rres));
+		AND<true>(first, last, lhs, rhs, res);
+		AND<true>(first, last, rlhs, rrhs, rres);
+		ASSERT_TRUE(sentinels_ok(res));
+		ASSERT_TRUE(same_as(res, rres));
+
+		//compound operators
+		SentinelBitset x(lhs);
+		BBScan rx(rlhs);
+		x &= rhs;
+		rx &= rrhs;
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x = lhs;
+		rx = rlhs;
+		x |= rhs;
+		rx |= rrhs;
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x ^= lhs;
+		rx ^= rlhs;
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x.erase_bit(rhs);
+		rx.erase_bit(rrhs);
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		//block operations in the range of rhs
+		x = lhs;
+		rx = rlhs;
+		x.AND_EQUAL_block(c, d, rhs);
+		rx.AND_EQUAL_block(c, d, rrhs);
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x.set_block(c, -1, lhs);
+		rx.set_block(c, -1, rlhs);
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x.erase_block(0, d, rhs);
+		rx.erase_block(0, d, rrhs);
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+
+		x.assign_block(a, -1, rhs);
+		for (int i = a; i < rx.num_blocks(); ++i) { rx.block(i) = rrhs.block(i); }
+		ASSERT_TRUE(sentinels_ok(x));
+		ASSERT_TRUE(same_as(x, rx));
+	}
+}
+
+TEST(SentinelBitset, scanning) {
+
+	SentinelBitset bb(500, { 70, 71, 200, 430 });
+	bitpos_list lv;
+	bb.extract(lv);
+	EXPECT_EQ(bitpos_list({ 70, 71, 200, 430 }), lv);
+
+	//stateless
+	EXPECT_EQ(71, bb.next_bit(70));
+	EXPECT_EQ(430, bb.next_bit(200));
+	EXPECT_EQ(BBObject::noBit, bb.next_bit(430));
+	EXPECT_EQ(200, bb.prev_bit(430));
+	EXPECT_EQ(BBObject::noBit, bb.prev_bit(70));
+
+	//range-based for loops
+	lv.clear();
+	for (int v : bits(bb)) { lv.push_back(v); }
+	EXPECT_EQ(bitpos_list({ 70, 71, 200, 430 }), lv);
+	lv.clear();
+	for (int v : bits_rev(bb)) { lv.push_back(v); }
+	EXPECT_EQ(bitpos_list({ 430, 200, 71, 70 }), lv);
+
+	//stateful
+	lv.clear();
+	bb.init_scan(BBObject::NON_DESTRUCTIVE);
+	for (int v = bb.next_bit(); v != BBObject::noBit; v = bb.next_bit()) { lv.push_back(v); }
+	EXPECT_EQ(bitpos_list({ 70, 71, 200, 430 }), lv);
+
+	lv.clear();
+	bb.init_scan(BBObject::NON_DESTRUCTIVE_REVERSE);
+	for (int v = bb.prev_bit(); v != BBObject::noBit; v = bb.prev_bit()) { lv.push_back(v); }
+	EXPECT_EQ(bitpos_list({ 430, 200, 71, 70 }), lv);
+
+	//destructive scans tighten the sentinels as they go
+	SentinelBitset bbd(bb);
+	lv.clear();
+	for (int v : bits_del(bbd)) {
+		lv.push_back(v);
+		ASSERT_TRUE(sentinels_ok(bbd));
+	}
+	EXPECT_EQ(bitpos_list({ 70, 71, 200, 430 }), lv);
+	EXPECT_TRUE(bbd.is_empty());
+
+	bbd = bb;
+	lv.clear();
+	for (int v : bits_del_rev(bbd)) {
+		lv.push_back(v);
+		ASSERT_TRUE(sentinels_ok(bbd));
+	}
+	EXPECT_EQ(bitpos_list({ 430, 200, 71, 70 }), lv);
+	EXPECT_TRUE(bbd.is_empty());
+
+	//shrinking candidate set: P := P & N(v) for each v taken from P
+	SentinelBitset P(500, true), N(500);
+	N.set_bit(100, 300);
+	int v = P.lsb();
+	P.erase_bit(v);
+	P &= N;
+	EXPECT_TRUE(sentinels_ok(P));
+	EXPECT_EQ(1, P.sentinel_low());
+	EXPECT_EQ(4, P.sentinel_high());
+	EXPECT_EQ(201, P.count());
+
+	//empty bitsets
+	SentinelBitset empty(300);
+	lv.clear();
+	for (int w : bits(empty)) { lv.push_back(w); }
+	for (int w : bits_del(empty)) { lv.push_back(w); }
+	EXPECT_TRUE(lv.empty());
+}
+
+TEST(SentinelBitset, conversions) {
+
+	BBScan bbs(300);
+	bbs.set_bit(65);
+	bbs.set_bit(250);
+
+	SentinelBitset bb(bbs.cview());
+	EXPECT_TRUE(sentinels_ok(bb));
+	EXPECT_EQ(2, bb.count());
+	EXPECT_EQ("[65 250 (2)]", bb.to_string());
+
+	int bit = BBObject::noBit;
+	SentinelBitset rhs(300, { 250, 299 });
+	EXPECT_EQ(1, bb.find_common_singleton(rhs, bit));
+	EXPECT_EQ(250, bit);
+
+	EXPECT_TRUE(bb == SentinelBitset(300, { 65, 250 }));
+	EXPECT_TRUE(bb != rhs);
+}
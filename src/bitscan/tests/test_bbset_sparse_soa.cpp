@@ -0,0 +1,135 @@
+/**
+* @file test_bbset_sparse_soa.cpp
+* @brief Unit tests of the BitsetSpSoA class (sparse bitset, structure-of-arrays layout)
+*		 and of the intersection kernels of bbkernel_sparse.h (merge, galloping, SIMD block merge)
+* @details Results are checked against BitsetSp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_sparse_soa.h"
+#include "bitscan/bbscan_sparse.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//random sparse bitset with nBlocks non-empty bitblocks at most
+	BitsetSp random_sparse(int nPop, int nBlocks, std::mt19937& gen) {
+		BitsetSp bbs(nPop);
+		std::uniform_int_distribution<int> bit(0, nPop - 1);
+		for (int i = 0; i < nBlocks; ++i) {
+			bbs.set_bit(bit(gen));
+		}
+		return bbs;
+	}
+}
+
+TEST(SparseSoA, construction) {
+
+	BitsetSpSoA bb(1000, { 10, 64, 65, 999 });
+	EXPECT_EQ(16, bb.num_blocks());
+	EXPECT_EQ(3u, bb.size());
+	EXPECT_EQ(4, bb.count());
+	EXPECT_TRUE(bb.is_bit(65));
+	EXPECT_FALSE(bb.is_bit(66));
+	EXPECT_EQ(10, bb.lsb());
+	EXPECT_EQ(vector<int>({ 10, 64, 65, 999 }), bb.to_vector());
+
+	//conversions
+	BitsetSp bbs(1000, { 10, 64, 65, 999 });
+	EXPECT_EQ(bb, BitsetSpSoA(bbs));
+	EXPECT_EQ(bbs, static_cast<BitsetSp>(bb));
+
+	BitsetSpSoA bbe(1000);
+	EXPECT_TRUE(bbe.is_empty());
+	EXPECT_EQ(BBObject::noBit, bbe.lsb());
+}
+
+TEST(SparseSoA, set_erase) {
+
+	BitsetSpSoA bb(10000);
+	for (int v : { 9000, 5, 640, 7, 6400 }) {
+		bb.set_bit(v);
+	}
+	EXPECT_EQ(vector<int>({ 5, 7, 640, 6400, 9000 }), bb.to_vector());
+	EXPECT_TRUE(std::is_sorted(bb.indices().begin(), bb.indices().end()));
+
+	bb.erase_bit(640);
+	bb.erase_bit(641);							//not in the set
+	EXPECT_FALSE(bb.is_bit(640));
+	EXPECT_EQ(4, bb.count());
+	EXPECT_EQ(0u, bb.find_block(WDIV(640)));
+	EXPECT_EQ(static_cast<int>(BBObject::npos), bb.find_block_pos(WDIV(5000)));
+
+	bb.erase_bit();
+	EXPECT_TRUE(bb.is_empty());
+}
+
+TEST(SparseSoA, intersection) {
+
+	std::mt19937 gen(7);
+	const int NPOP = 100000;
+
+	//balanced sizes (SIMD block merge) and skewed sizes (galloping)
+	for (auto sizes : { std::make_pair(500, 500), std::make_pair(1000, 30), std::make_pair(20, 1500), std::make_pair(3, 5) }) {
+		for (int rep = 0; rep < 10; ++rep) {
+			BitsetSp lhs = random_sparse(NPOP, sizes.first, gen);
+			BitsetSp rhs = random_sparse(NPOP, sizes.second, gen);
+			BitsetSpSoA lhsS(lhs), rhsS(rhs);
+
+			BitsetSp res;
+			AND(lhs, rhs, res);
+			BitsetSpSoA resS;
+			AND(lhsS, rhsS, resS);
+
+			EXPECT_EQ(res.count(), resS.count());
+			EXPECT_EQ(res.count(), count_and(lhsS, rhsS));
+			EXPECT_EQ(res.count(), count_and(rhsS, lhsS));
+			EXPECT_EQ(res.is_empty(), lhsS.is_disjoint(rhsS));
+			EXPECT_EQ(res.is_empty(), lhs.is_disjoint(rhs));
+			EXPECT_EQ(BitsetSpSoA(res), resS);
+		}
+	}
+
+	//disjoint
+	BitsetSpSoA a(1000, { 1, 100, 500 }), b(1000, { 2, 101, 501 });
+	EXPECT_TRUE(a.is_disjoint(b));
+	EXPECT_EQ(0, count_and(a, b));
+}
+
+TEST(SparseSoA, kernels) {
+
+	//packed indices with matches at both ends and in the SIMD blocks
+	vector<uint32_t> a = { 0, 3, 4, 5, 8, 9, 12, 20, 21, 22, 40, 41, 100 };
+	vector<uint32_t> b = { 0, 1, 2, 5, 9, 10, 11, 12, 21, 30, 41, 99, 100 };
+	vector<int> sol = { 0, 5, 9, 12, 21, 41, 100 };
+
+	vector<int> res;
+	bbkernel::for_each_common_block_u32(a.data(), (int)a.size(), b.data(), (int)b.size(),
+		[&](int i, int j) { EXPECT_EQ(a[i], b[j]); res.push_back(a[i]); return true; });
+	EXPECT_EQ(sol, res);
+
+	//generic version
+	res.clear();
+	bbkernel::for_each_common_block([&](int i) { return a[i]; }, (int)a.size(), [&](int j) { return b[j]; }, (int)b.size(),
+		[&](int i, int j) { EXPECT_EQ(a[i], b[j]); res.push_back(a[i]); return true; });
+	EXPECT_EQ(sol, res);
+
+	//early exit
+	int nMatch = 0;
+	bool completed = bbkernel::for_each_common_block_u32(a.data(), (int)a.size(), b.data(), (int)b.size(),
+		[&](int, int) { return ++nMatch < 3; });
+	EXPECT_FALSE(completed);
+	EXPECT_EQ(3, nMatch);
+
+	//galloping
+	EXPECT_EQ(0, bbkernel::gallop([&](int i) { return a[i]; }, 0, (int)a.size(), 0));
+	EXPECT_EQ(7, bbkernel::gallop([&](int i) { return a[i]; }, 0, (int)a.size(), 13));
+	EXPECT_EQ((int)a.size(), bbkernel::gallop([&](int i) { return a[i]; }, 3, (int)a.size(), 101));
+}
@@ -0,0 +1,334 @@
+/**
+* @file test_bbset_summary.cpp
+* @brief Unit tests of the SummaryBitset class (dense bitset with summary bitmaps of the non-empty bitblocks)
+* @details Results are checked against BBScan
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_summary.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+using SB = SummaryBitset;
+
+namespace {
+
+	//random bitset of nPop bits with nBits 1-bits and a few dense ranges
+	void random_sets(int nPop, int nBits, std::mt19937& gen, SB& bb, BBScan& bbs) {
+		bb.reset(nPop);
+		bbs.reset(nPop);
+		std::uniform_int_distribution<int> bit(0, nPop - 1);
+		std::uniform_int_distribution<int> len(1, 300);
+		for (int i = 0; i < nBits; ++i) {
+			const int v = bit(gen);
+			bb.set_bit(v);
+			bbs.set_bit(v);
+		}
+		for (int i = 0; i < 3; ++i) {
+			const int first = bit(gen);
+			const int last = std::min(nPop - 1, first + len(gen));
+			bb.set_bit(first, last);
+			bbs.set_bit(first, last);
+		}
+	}
+
+	//checks the summaries of bb against its bitblocks
+	bool check_summaries(const SB& bb) {
+		for (int i = 0; i < bb.num_blocks(); ++i) {
+			const bool nonEmpty = (bb.block(i) != ZERO);
+			if (nonEmpty != bool(bb.summary(0)[WDIV(i)] & bblock::MASK_BIT(WMOD(i)))) {
+				return false;
+			}
+		}
+		for (int l = 1; l < bb.num_levels(); ++l) {
+			for (int i = 0; i < bb.summary_size(l - 1); ++i) {
+				const bool nonEmpty = (bb.summary(l - 1)[i] != ZERO);
+				if (nonEmpty != bool(bb.summary(l)[WDIV(i)] & bblock::MASK_BIT(WMOD(i)))) {
+					return false;
+				}
+			}
+		}
+		return bb.summary_size(bb.num_levels() - 1) == 1;
+	}
+}
+
+TEST(Summary, construction) {
+
+	SB bb(10000, { 10, 64, 65, 4096, 9999 });
+	EXPECT_EQ(157, bb.num_blocks());
+	EXPECT_EQ(2, bb.num_levels());
+	EXPECT_EQ(5, bb.count());
+	EXPECT_TRUE(bb.is_bit(4096));
+	EXPECT_FALSE(bb.is_bit(4097));
+	EXPECT_EQ(10, bb.lsb());
+	EXPECT_EQ(9999, bb.msb());
+	EXPECT_EQ(ONE >> 62, bb.block(1));
+	EXPECT_EQ(bitpos_list({ 10, 64, 65, 4096, 9999 }), static_cast<bitpos_list>(bb));
+	EXPECT_EQ("[10 64 65 4096 9999 (5)]", bb.to_string());
+	EXPECT_TRUE(check_summaries(bb));
+
+	SB bbe(10000);
+	EXPECT_TRUE(bbe.is_empty());
+	EXPECT_EQ(BBObject::noBit, bbe.lsb());
+	EXPECT_EQ(BBObject::noBit, bbe.msb());
+	EXPECT_EQ(-1, bbe.init_scan(BBObject::NON_DESTRUCTIVE));
+
+	//levels
+	EXPECT_EQ(1, SB(64).num_levels());
+	EXPECT_EQ(1, SB(4096).num_levels());
+	EXPECT_EQ(2, SB(4097).num_levels());
+	EXPECT_EQ(2, SB(262144).num_levels());
+	EXPECT_EQ(3, SB(262145).num_levels());
+
+	//full set
+	SB bbf(1000, true);
+	EXPECT_EQ(1000, bbf.count());
+	EXPECT_EQ(999, bbf.msb());
+	EXPECT_TRUE(check_summaries(bbf));
+}
+
+TEST(Summary, set_erase) {
+
+	SB bb(1000000);
+	bb.set_bit(500000);
+	EXPECT_FALSE(bb.is_empty());
+	EXPECT_TRUE(bb.is_singleton());
+	EXPECT_EQ(500000, bb.lsb());
+	EXPECT_EQ(500000, bb.msb());
+	EXPECT_EQ(3, bb.num_levels());
+
+	bb.set_bit(999999);
+	EXPECT_FALSE(bb.is_singleton());
+	EXPECT_EQ(999999, bb.next_bit(500000));
+	EXPECT_EQ(500000, bb.prev_bit(999999));
+	EXPECT_EQ(BBObject::noBit, bb.next_bit(999999));
+	EXPECT_EQ(BBObject::noBit, bb.prev_bit(500000));
+
+	bb.erase_bit(500000);
+	EXPECT_EQ(999999, bb.lsb());
+	bb.erase_bit(999999);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(check_summaries(bb));
+
+	//ranges
+	bb.set_bit(100, 300000);
+	EXPECT_EQ(300000 - 100 + 1, bb.count());
+	EXPECT_EQ(300000 - 1000 + 1, bb.count(1000, -1));
+	EXPECT_EQ(11, bb.count(290, 300));
+	bb.erase_bit(200, 299999);
+	EXPECT_EQ(101, bb.count());
+	EXPECT_EQ(300000, bb.msb());
+	EXPECT_TRUE(check_summaries(bb));
+	bb.erase_bit(0, -1);
+	EXPECT_TRUE(bb.is_empty());
+	EXPECT_TRUE(check_summaries(bb));
+}
+
+TEST(Summary, multi_level_blocks) {
+
+	//8192 bitblocks: 128 words in level 0, 2 in level 1, 1 in level 2
+	SB bb(524288, { 5, 300000, 524287 });
+	EXPECT_EQ(3, bb.num_levels());
+	EXPECT_EQ(128, bb.summary_size(0));
+	EXPECT_EQ(2, bb.summary_size(1));
+	EXPECT_EQ(1, bb.summary_size(2));
+	EXPECT_TRUE(check_summaries(bb));
+
+	//next_block skips the empty words of level 0 and the empty bits of level 1 (blockID included)
+	EXPECT_EQ(0, bb.next_block(0));
+	EXPECT_EQ(WDIV(300000), bb.next_block(1));
+	EXPECT_EQ(WDIV(300000), bb.next_block(WDIV(300000)));
+	EXPECT_EQ(8191, bb.next_block(WDIV(300000) + 1));
+	EXPECT_EQ(-1, bb.next_block(8192));
+
+	//prev_block climbs and descends the levels in the same way
+	EXPECT_EQ(8191, bb.prev_block(8191));
+	EXPECT_EQ(WDIV(300000), bb.prev_block(8190));
+	EXPECT_EQ(0, bb.prev_block(WDIV(300000) - 1));
+	EXPECT_EQ(-1, bb.prev_block(-1));
+
+	//non-empty words of level 0 (skipped by level 1)
+	EXPECT_EQ(0, bb.next_word(0));
+	EXPECT_EQ(WDIV(WDIV(300000)), bb.next_word(1));
+	EXPECT_EQ(127, bb.next_word(WDIV(WDIV(300000)) + 1));
+
+	//the middle bitblock empties its words in levels 0 and 1
+	bb.erase_bit(300000);
+	EXPECT_TRUE(check_summaries(bb));
+	EXPECT_EQ(8191, bb.next_block(1));
+	EXPECT_EQ(0, bb.prev_block(8190));
+	EXPECT_EQ(524287, bb.next_bit(5));
+	EXPECT_EQ(5, bb.prev_bit(524287));
+
+	//only the first and last bits of the population
+	bb.erase_bit(524287);
+	EXPECT_EQ(-1, bb.next_block(1));
+	EXPECT_EQ(0, bb.prev_block(8191));
+	EXPECT_EQ(BBObject::noBit, bb.next_bit(5));
+}
+
+TEST(Summary, random_vs_bbscan) {
+
+	std::mt19937 gen(17);
+	for (int nPop : { 100, 5000, 300000, 1000000 }) {
+		SB bb;
+		BBScan bbs;
+		random_sets(nPop, 2000, gen, bb, bbs);
+		EXPECT_TRUE(check_summaries(bb));
+		EXPECT_EQ(bbs.count(), bb.count());
+		EXPECT_EQ(bbs.lsb(), bb.lsb());
+		EXPECT_EQ(bbs.msb(), bb.msb());
+		EXPECT_EQ(static_cast<bitpos_list>(bbs), static_cast<bitpos_list>(bb));
+		EXPECT_EQ(bbs.count(nPop / 3, nPop / 2), bb.count(nPop / 3, nPop / 2));
+
+		//stateless reverse scan
+		const bitpos_list lv = static_cast<bitpos_list>(bbs);
+		bitpos_list lr;
+		for (int v = bb.prev_bit(BBObject::noBit); v != BBObject::noBit; v = bb.prev_bit(v)) { lr.push_back(v); }
+		EXPECT_EQ(bitpos_list(lv.rbegin(), lv.rend()), lr);
+	}
+}
+
+TEST(Summary, scanning) {
+
+	std::mt19937 gen(3);
+	SB bb;
+	BBScan bbs;
+	random_sets(1000000, 3000, gen, bb, bbs);
+	const bitpos_list lv = static_cast<bitpos_list>(bbs);
+
+	//non destructive
+	bitpos_list res;
+	bb.init_scan(BBObject::NON_DESTRUCTIVE);
+	for (int v = bb.next_bit(); v != BBObject::noBit; v = bb.next_bit()) { res.push_back(v); }
+	EXPECT_EQ(lv, res);
+
+	//non destructive reverse
+	res.clear();
+	bb.init_scan(BBObject::NON_DESTRUCTIVE_REVERSE);
+	for (int v = bb.prev_bit(); v != BBObject::noBit; v = bb.prev_bit()) { res.push_back(v); }
+	EXPECT_EQ(bitpos_list(lv.rbegin(), lv.rend()), res);
+
+	//non destructive from a given bit
+	res.clear();
+	bb.init_scan(lv[10], BBObject::NON_DESTRUCTIVE);
+	for (int v = bb.next_bit(); v != BBObject::noBit; v = bb.next_bit()) { res.push_back(v); }
+	EXPECT_EQ(bitpos_list(lv.begin() + 11, lv.end()), res);
+
+	//nested scanning classes
+	res.clear();
+	SB::scan sc(bb);
+	for (int v = sc.next_bit(); v != BBObject::noBit; v = sc.next_bit()) { res.push_back(v); }
+	EXPECT_EQ(lv, res);
+
+	//destructive (copy)
+	SB bbd(bb);
+	res.clear();
+	bbd.init_scan(BBObject::DESTRUCTIVE);
+	for (int v = bbd.next_bit_del(); v != BBObject::noBit; v = bbd.next_bit_del()) { res.push_back(v); }
+	EXPECT_EQ(lv, res);
+	EXPECT_TRUE(bbd.is_empty());
+	EXPECT_TRUE(check_summaries(bbd));
+
+	//destructive reverse with a second bitset
+	bbd = bb;
+	SB bbc(bb);
+	res.clear();
+	bbd.init_scan(BBObject::DESTRUCTIVE_REVERSE);
+	for (int v = bbd.prev_bit_del(bbc); v != BBObject::noBit; v = bbd.prev_bit_del(bbc)) { res.push_back(v); }
+	EXPECT_EQ(bitpos_list(lv.rbegin(), lv.rend()), res);
+	EXPECT_TRUE(bbd.is_empty());
+	EXPECT_TRUE(bbc.is_empty());
+	EXPECT_TRUE(check_summaries(bbc));
+
+	//range and for_each_bit
+	res.clear();
+	for (int v : bits(bb)) { res.push_back(v); }
+	EXPECT_EQ(lv, res);
+	res.clear();
+	for_each_bit(bb, [&](int v) { res.push_back(v); });
+	EXPECT_EQ(lv, res);
+}
+
+TEST(Summary, set_operations) {
+
+	std::mt19937 gen(5);
+	for (int nPop : { 3000, 1000000 }) {
+		SB a, b;
+		BBScan as, bs;
+		random_sets(nPop, 1500, gen, a, as);
+		random_sets(nPop, 1500, gen, b, bs);
+
+		//shared bitblocks
+		for (int v = 0; v < nPop; v += 1000) {
+			a.set_bit(v);
+			as.set_bit(v);
+			b.set_bit(v);
+			bs.set_bit(v);
+		}
+
+		BBScan ress(nPop);
+		SB res;
+		AND(a, b, res);
+		EXPECT_EQ(static_cast<bitpos_list>(AND(as, bs, ress)), static_cast<bitpos_list>(res));
+		EXPECT_TRUE(check_summaries(res));
+		EXPECT_EQ(res, AND(a, b));
+
+		OR(a, b, res);
+		EXPECT_EQ(static_cast<bitpos_list>(OR(as, bs, ress)), static_cast<bitpos_list>(res));
+		EXPECT_TRUE(check_summaries(res));
+
+		erase_bit(a, b, res);
+		BBScan diffs(as);
+		diffs.erase_bit(bs);
+		EXPECT_EQ(static_cast<bitpos_list>(diffs), static_cast<bitpos_list>(res));
+		EXPECT_TRUE(check_summaries(res));
+
+		SB c(a);
+		c &= b;
+		EXPECT_EQ(AND(a, b), c);
+		c |= a;
+		EXPECT_EQ(a, c);
+		EXPECT_NE(b, c);
+
+		//fused operations
+		EXPECT_EQ(count_and(as, bs), count_and(a, b));
+		EXPECT_EQ(count_andnot(as, bs), count_andnot(a, b));
+		EXPECT_EQ(find_first_common(as, bs), find_first_common(a, b));
+		EXPECT_TRUE(intersects_at_least(a, b, count_and(as, bs)));
+		EXPECT_FALSE(intersects_at_least(a, b, count_and(as, bs) + 1));
+
+		bitpos_list l1, l2;
+		for (int v : bits_and(a, b)) { l1.push_back(v); }
+		for (int v : bits_and(as, bs)) { l2.push_back(v); }
+		EXPECT_EQ(l2, l1);
+
+		l1.clear(); l2.clear();
+		for (int v : bits_andnot(a, b)) { l1.push_back(v); }
+		for (int v : bits_andnot(as, bs)) { l2.push_back(v); }
+		EXPECT_EQ(l2, l1);
+
+		l1.clear();
+		for_each_bit_and(a, b, [&](int v) { l1.push_back(v); });
+		EXPECT_EQ(static_cast<bitpos_list>(AND(a, b)), l1);
+		l1.clear();
+		for_each_bit_andnot(a, b, [&](int v) { l1.push_back(v); });
+		EXPECT_EQ(static_cast<bitpos_list>(diffs), l1);
+	}
+
+	//disjoint sets
+	SB a(1000000, { 5, 300000 });
+	SB b(1000000, { 6, 300001, 999999 });
+	EXPECT_TRUE(a.is_disjoint(b));
+	EXPECT_EQ(BBObject::noBit, find_first_common(a, b));
+	b.set_bit(300000);
+	EXPECT_FALSE(a.is_disjoint(b));
+	EXPECT_EQ(300000, find_first_common(a, b));
+}
@@ -0,0 +1,140 @@
+/**
+* @file test_bbset_trail.cpp
+* @brief Unit tests of the TrailedBitset class (undo log of bitblocks, checkpoint / rollback)
+* @details Results are checked against copies of the bitset taken at each checkpoint
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_trail.h"
+#include "bitscan/bbscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(Trail, basic) {
+
+	TrailedBitset<> tbb(Bitset(300, { 1, 2, 64, 200, 299 }));
+	Bitset bb0(tbb.bitset());
+
+	//no checkpoint: modifications are not recorded
+	tbb.set_bit(3);
+	EXPECT_EQ(0u, tbb.trail_size());
+	bb0.set_bit(3);
+
+	auto cp = tbb.checkpoint();
+	tbb.erase_bit(1);
+	tbb.erase_bit(2);
+	tbb.erase_bit(3);									//same bitblock, recorded once
+	EXPECT_EQ(1u, tbb.trail_size());
+	tbb.set_bit(250);
+	tbb.set_bit(250);
+	EXPECT_EQ(2u, tbb.trail_size());
+	tbb.erase_bit(100);									//no change, not recorded
+	EXPECT_EQ(2u, tbb.trail_size());
+
+	Bitset bbAND(300, { 64, 65, 299 });
+	tbb &= bbAND;
+	EXPECT_EQ(2u + 5u, tbb.trail_size());				//the range of bitblocks is recorded
+	EXPECT_EQ(vector<int>({ 64, 299 }), static_cast<bitpos_list>(tbb.bitset()));
+
+	tbb.rollback(cp);
+	EXPECT_EQ(0u, tbb.trail_size());
+	EXPECT_TRUE(bb0 == tbb.bitset());
+
+	//the checkpoint remains active after rollback
+	EXPECT_EQ(1, tbb.pop_lsb());
+	EXPECT_EQ(1u, tbb.trail_size());
+	tbb.rollback(cp);
+	EXPECT_TRUE(bb0 == tbb.bitset());
+
+	//clear_trail keeps the bitset
+	tbb.erase_bit(64);
+	tbb.clear_trail();
+	tbb.rollback(cp);
+	EXPECT_EQ(0u, tbb.trail_size());
+	EXPECT_FALSE(tbb.is_bit(64));
+}
+
+TEST(Trail, nested) {
+
+	TrailedBitset<BBScan> tbb(BBScan(1000, true));
+	Bitset bbd(1000, { 5, 500, 999 });
+
+	auto cp1 = tbb.checkpoint();
+	tbb.erase_bit(bbd);
+	Bitset bb1(tbb.bitset());
+
+	auto cp2 = tbb.checkpoint();
+	tbb.erase_bit(6);									//bitblock 0, recorded again for cp2
+	tbb.erase_bit(7);
+	tbb.AND_block(1, 10, bbd);
+	EXPECT_EQ(16u + 1u + 10u, tbb.trail_size());
+	EXPECT_EQ(61 + 64 * 4 + 39, tbb.count());			//bitblocks 1-10 emptied
+
+	tbb.rollback(cp2);
+	EXPECT_TRUE(bb1 == tbb.bitset());
+	EXPECT_EQ(16u, tbb.trail_size());
+
+	//reopening a checkpoint after rollback
+	auto cp3 = tbb.checkpoint();
+	tbb.erase_bit(7);
+	tbb.rollback(cp3);
+	EXPECT_TRUE(bb1 == tbb.bitset());
+
+	tbb.rollback(cp1);
+	EXPECT_EQ(1000, tbb.count());
+	EXPECT_EQ(0u, tbb.trail_size());
+}
+
+TEST(Trail, random_search) {
+
+	const int NPOP = 2000;
+	std::mt19937 gen(2468);
+	std::uniform_int_distribution<int> bit(0, NPOP - 1);
+	std::uniform_int_distribution<int> op(0, 5);
+
+	vector<Bitset> masks;
+	for (int i = 0; i < 8; ++i) {
+		Bitset m(NPOP);
+		for (int j = 0; j < NPOP / 2; ++j) { m.set_bit(bit(gen)); }
+		masks.push_back(m);
+	}
+
+	TrailedBitset<> tbb(Bitset(NPOP, true));
+
+	//random DFS: copies of the bitset at each checkpoint are the reference
+	vector<TrailedBitset<>::checkpoint_t> cps;
+	vector<Bitset> copies;
+	for (int step = 0; step < 5000; ++step) {
+		const int o = op(gen);
+		if (o == 0 || cps.empty()) {
+			cps.push_back(tbb.checkpoint());
+			copies.push_back(tbb.bitset());
+		}
+		else if (o == 1) {
+			tbb.rollback(cps.back());
+			ASSERT_TRUE(copies.back() == tbb.bitset());
+			if (gen() % 2) { cps.pop_back(); copies.pop_back(); }
+		}
+		else if (o == 2) { tbb.erase_bit(bit(gen)); }
+		else if (o == 3) { tbb.set_bit(bit(gen)); }
+		else if (o == 4) {
+			const int first = bit(gen) / 64;
+			tbb.AND_block(first, std::min(first + 3, tbb.num_blocks() - 1), masks[gen() % masks.size()]);
+		}
+		else { tbb.erase_block(0, tbb.num_blocks() - 1, masks[gen() % masks.size()]); }
+	}
+
+	while (!cps.empty()) {
+		tbb.rollback(cps.back());
+		ASSERT_TRUE(copies.back() == tbb.bitset());
+		cps.pop_back();
+		copies.pop_back();
+	}
+	EXPECT_EQ(0u, tbb.trail_size());
+}
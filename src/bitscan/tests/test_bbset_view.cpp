@@ -0,0 +1,136 @@
+/**
+* @file test_bbset_view.cpp
+* @brief Unit tests of the non-owning views BitsetView and ConstBitsetView
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bitscan.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(View, external_memory) {
+
+	//bitblocks of a larger buffer, e.g. rows of a memory-mapped file
+	vector<BITBOARD> buf(6, ZERO);
+	BitsetView v1(buf.data(), 3);
+	BitsetView v2(buf.data() + 3, 3);
+
+	v1.set_bit(10).set_bit(64).set_bit(191);
+	v2.set_bit(64).set_bit(100);
+
+	EXPECT_EQ(3, v1.count());
+	EXPECT_EQ(2, v2.count());
+	EXPECT_TRUE(v1.is_bit(191));
+	EXPECT_FALSE(v1.is_bit(100));
+	EXPECT_EQ(bblock::MASK_BIT(0), buf[1]);					//written in place
+
+	EXPECT_EQ(10, v1.lsb());
+	EXPECT_EQ(191, v1.msb());
+	EXPECT_EQ(64, v1.next_bit(10));
+	EXPECT_EQ(191, v1.next_bit(64));
+	EXPECT_EQ(BBObject::noBit, v1.next_bit(191));
+	EXPECT_EQ(64, v1.prev_bit(191));
+	EXPECT_EQ(BBObject::noBit, v1.prev_bit(10));
+
+	EXPECT_EQ(1, v1.count_and(v2));
+	EXPECT_EQ(64, v1.find_first_common(v2));
+	EXPECT_FALSE(v1.is_disjoint(v2));
+
+	v1.erase_bit(64);
+	EXPECT_TRUE(v1.is_disjoint(v2));
+	EXPECT_EQ(BBObject::noBit, v1.find_first_common(v2));
+
+	vector<int> lv_exp = { 10, 191 };
+	EXPECT_EQ(lv_exp, v1.to_vector());
+
+	//subview - bits relative to the first bitblock
+	ConstBitsetView sv = v2.subview(1, 2);
+	EXPECT_EQ(2, sv.num_blocks());
+	EXPECT_EQ(0, sv.lsb());
+	EXPECT_EQ(36, sv.msb());
+
+	v1.erase_bit();
+	EXPECT_TRUE(v1.is_empty());
+	EXPECT_EQ(BBObject::noBit, v1.lsb());
+	EXPECT_EQ(BBObject::noBit, v1.msb());
+}
+
+TEST(View, set_operations) {
+
+	BBScan bb1(200), bb2(200), bb3(200);
+	bb1.set_bit(0, 150);
+	bb2.set_bit(100, 199);
+
+	//writable view of a BBScan - operates on the bitset itself
+	BitsetView v = bb1.view();
+	v &= bb2;
+	EXPECT_EQ(51, bb1.count());
+	EXPECT_EQ(100, bb1.lsb());
+
+	v |= bb3.set_bit(5);
+	EXPECT_EQ(52, bb1.count());
+
+	v.erase_bit(bb2);
+	EXPECT_EQ(1, bb1.count());
+	EXPECT_TRUE(bb1.is_bit(5));
+
+	//set operations into a view
+	Bitset res(200);
+	OR(bb1, bb2, res.view());
+	EXPECT_EQ(101, res.count());
+	AND(bb2, res, res.view());
+	EXPECT_EQ(100, res.count());
+	erase_bit(bb2, bb3, res.view());
+	EXPECT_TRUE(res == bb2);
+
+	//copy and comparison
+	vector<BITBOARD> buf(res.num_blocks());
+	BitsetView(buf.data(), static_cast<int>(buf.size())).assign(res);
+	EXPECT_TRUE(ConstBitsetView(buf.data(), static_cast<int>(buf.size())) == res.cview());
+	EXPECT_EQ(5, v.pop_lsb());
+	EXPECT_TRUE(bb1.is_empty());
+}
+
+TEST(View, bitscanning) {
+
+	Bitset bb(300);
+	bb.set_bit(3).set_bit(64).set_bit(200).set_bit(299);
+	vector<int> lv_exp = { 3, 64, 200, 299 };
+
+	const Bitset& cbb = bb;
+	vector<int> lv;
+	for (int v : bits(cbb.view())) { lv.push_back(v); }
+	EXPECT_EQ(lv_exp, lv);
+
+	lv.clear();
+	for_each_bit(bb.view(), [&lv](int v) { lv.push_back(v); });
+	EXPECT_EQ(lv_exp, lv);
+
+	//destructive scan on a writable view
+	BitsetView v = bb.view();
+	lv.clear();
+	for (int b : bits_del(v)) { lv.push_back(b); }
+	EXPECT_EQ(lv_exp, lv);
+	EXPECT_TRUE(bb.is_empty());
+
+	bb.set_bit(7).set_bit(100);
+	EXPECT_EQ(1, count_and(bb.cview(), ConstBitsetView(bb.bitset().data(), 1)));
+}
+
+TEST(View, arena) {
+
+	BitsetArena arena(130);
+	BitsetArena::Frame f(arena);
+
+	BitsetView v = arena.alloc_view();
+	EXPECT_EQ(3, v.num_blocks());
+	EXPECT_TRUE(v.is_empty());
+
+	v.set_bit(129);
+	EXPECT_EQ(129, v.lsb());
+}
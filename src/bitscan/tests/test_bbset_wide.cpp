@@ -0,0 +1,182 @@
+/**
+* @file test_bbset_wide.cpp
+* @brief Unit tests of the WideBitset class (dense, in blocks of 64, 128, 256 or 512 bits)
+* @details Results are checked against BBScan for the same operations, for all the block sizes
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "bitscan/bbset_wide.h"
+#include "bitscan/bbscan.h"
+#include "bitscan/bbscan_iter.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+template<class T>
+class WideBitsetTest : public ::testing::Test {};
+
+using WideTypes = ::testing::Types<WideBitset<64>, WideBitset<128>, WideBitset<256>, WideBitset<512>>;
+TYPED_TEST_SUITE(WideBitsetTest, WideTypes);
+
+TEST(WideBitset, layout) {
+
+	EXPECT_EQ(4, WideBitset<256>::K());
+	EXPECT_EQ(4, WideBitset<256>(200).num_blocks());			//4 bitblocks needed, 1 wide block
+	EXPECT_EQ(8, WideBitset<256>(257).num_blocks());
+	EXPECT_EQ(2, WideBitset<256>(257).num_wide_blocks());
+	EXPECT_EQ(8, WideBitset<512>(1).num_blocks());
+	EXPECT_EQ(1, WideBitset<64>(1).num_blocks());
+}
+
+TYPED_TEST(WideBitsetTest, bitscanning) {
+
+	const int NPOP = 1000;
+	TypeParam bbw(NPOP);
+	BBScan bbsc(NPOP);
+
+	//sparse content - most wide blocks are empty
+	for (int bit : { 3, 64, 65, 400, 511, 512, 777, 999 }) {
+		bbw.set_bit(bit);
+		bbsc.set_bit(bit);
+	}
+
+	EXPECT_EQ(bbsc.count(), bbw.count());
+	EXPECT_EQ(bbsc.lsb(), bbw.lsb());
+	EXPECT_EQ(bbsc.msb(), bbw.msb());
+	EXPECT_EQ(static_cast<bitpos_list>(bbsc), static_cast<bitpos_list>(bbw));
+	EXPECT_EQ(bbsc.count(64, 600), bbw.count(64, 600));
+	EXPECT_EQ(bbsc.count(100), bbw.count(100));
+
+	//stateless
+	for (int bit = BBObject::noBit, bitw = BBObject::noBit; ; ) {
+		bit = bbsc.Bitset::next_bit(bit);
+		bitw = bbw.next_bit(bitw);
+		ASSERT_EQ(bit, bitw);
+		if (bit == BBObject::noBit) { break; }
+	}
+	for (int bit = BBObject::noBit, bitw = BBObject::noBit; ; ) {
+		bit = bbsc.Bitset::prev_bit(bit);
+		bitw = bbw.prev_bit(bitw);
+		ASSERT_EQ(bit, bitw);
+		if (bit == BBObject::noBit) { break; }
+	}
+
+	//stateful non-destructive and reverse
+	vector<int> lv, lvw;
+	bbsc.init_scan(BBObject::NON_DESTRUCTIVE);
+	bbw.init_scan(BBObject::NON_DESTRUCTIVE);
+	for (int bit; (bit = bbsc.next_bit()) != BBObject::noBit; ) { lv.push_back(bit); }
+	for (int bit; (bit = bbw.next_bit()) != BBObject::noBit; ) { lvw.push_back(bit); }
+	EXPECT_EQ(lv, lvw);
+
+	lv.clear(); lvw.clear();
+	bbsc.init_scan(BBObject::NON_DESTRUCTIVE_REVERSE);
+	bbw.init_scan(BBObject::NON_DESTRUCTIVE_REVERSE);
+	for (int bit; (bit = bbsc.prev_bit()) != BBObject::noBit; ) { lv.push_back(bit); }
+	for (int bit; (bit = bbw.prev_bit()) != BBObject::noBit; ) { lvw.push_back(bit); }
+	EXPECT_EQ(lv, lvw);
+
+	//from a given bit
+	lv.clear(); lvw.clear();
+	bbsc.init_scan(65, BBObject::NON_DESTRUCTIVE);
+	bbw.init_scan(65, BBObject::NON_DESTRUCTIVE);
+	for (int bit; (bit = bbsc.next_bit()) != BBObject::noBit; ) { lv.push_back(bit); }
+	for (int bit; (bit = bbw.next_bit()) != BBObject::noBit; ) { lvw.push_back(bit); }
+	EXPECT_EQ(lv, lvw);
+
+	//range-based
+	lvw.clear();
+	for (int v : bits(bbw)) { lvw.push_back(v); }
+	EXPECT_EQ(static_cast<bitpos_list>(bbsc), lvw);
+
+	//destructive, reverse
+	lv.clear(); lvw.clear();
+	TypeParam bbw2(bbw);
+	bbw.init_scan(BBObject::DESTRUCTIVE_REVERSE);
+	bbsc.init_scan(BBObject::DESTRUCTIVE_REVERSE);
+	for (int bit; (bit = bbsc.prev_bit_del()) != BBObject::noBit; ) { lv.push_back(bit); }
+	for (int bit; (bit = bbw.prev_bit_del()) != BBObject::noBit; ) { lvw.push_back(bit); }
+	EXPECT_EQ(lv, lvw);
+	EXPECT_TRUE(bbw.is_empty());
+	EXPECT_EQ(BBObject::noBit, bbw.lsb());
+
+	//destructive
+	lvw.clear();
+	bbw2.init_scan(BBObject::DESTRUCTIVE);
+	for (int bit; (bit = bbw2.next_bit_del()) != BBObject::noBit; ) { lvw.push_back(bit); }
+	EXPECT_EQ(static_cast<bitpos_list>(TypeParam(NPOP, { 3, 64, 65, 400, 511, 512, 777, 999 })), lvw);
+	EXPECT_TRUE(bbw2.is_empty());
+}
+
+TYPED_TEST(WideBitsetTest, set_operations) {
+
+	const int NPOP = 1500;
+	std::mt19937 gen(17);
+	std::uniform_int_distribution<int> dist(0, NPOP - 1);
+
+	TypeParam a(NPOP), b(NPOP), res(NPOP);
+	BBScan as(NPOP), bs(NPOP), ress(NPOP);
+	for (int i = 0; i < 300; ++i) {
+		const int v = dist(gen), w = dist(gen);
+		a.set_bit(v); as.set_bit(v);
+		b.set_bit(w); bs.set_bit(w);
+	}
+
+	EXPECT_EQ(AND(as, bs, ress).count(), AND(a, b, res).count());
+	EXPECT_EQ(static_cast<bitpos_list>(ress), static_cast<bitpos_list>(res));
+	EXPECT_EQ(OR(as, bs, ress).count(), OR(a, b, res).count());
+	EXPECT_EQ(erase_bit(as, bs, ress).count(), erase_bit(a, b, res).count());
+	EXPECT_EQ(find_first_common(as, bs), find_first_common(a, b));
+	EXPECT_EQ(as.is_disjoint(bs), a.is_disjoint(b));
+
+	//disjoint sets
+	TypeParam c(a);
+	c.erase_bit(b);
+	EXPECT_TRUE(c.is_disjoint(b));
+	EXPECT_EQ(BBObject::noBit, find_first_common(c, b));
+	int common = BBObject::noBit;
+	EXPECT_EQ(0, c.find_common_singleton(b, common));
+
+	int bit = BBObject::noBit;
+	c.set_bit(1499);
+	b.set_bit(1499);
+	EXPECT_EQ(1, c.find_common_singleton(b, bit));
+	EXPECT_EQ(1499, bit);
+	EXPECT_FALSE(c.is_disjoint(b));
+	EXPECT_TRUE(c.is_disjoint(b, TypeParam(NPOP, { 1 })));
+
+	//ranges
+	TypeParam d(NPOP);
+	d.set_bit(10, 1400);
+	EXPECT_EQ(1391, d.count());
+	d.erase_bit(100, -1);
+	EXPECT_EQ(90, d.count());
+	d.erase_bit(11, 98);
+	EXPECT_EQ(2, d.count());
+	EXPECT_FALSE(d.is_singleton());
+	d.erase_bit(10);
+	EXPECT_TRUE(d.is_singleton());
+
+	//assignment operators
+	TypeParam e(a);
+	e &= b;
+	EXPECT_EQ(AND(a, b, res), e);
+	e |= a;
+	EXPECT_EQ(a, e);
+	e ^= a;
+	EXPECT_TRUE(e.is_empty());
+
+	//conversion from a Bitset row
+	TypeParam f(as.cview());
+	EXPECT_EQ(static_cast<bitpos_list>(as), static_cast<bitpos_list>(f));
+
+	//full bitset
+	TypeParam g(200, true);
+	EXPECT_EQ(200, g.count());
+	EXPECT_EQ(199, g.msb());
+}
@@ -135,6 +135,70 @@ TEST(bblockTest, popcount) {
 
 }
 
+TEST(bblockTest, lookup_tables) {
+
+	//compile-time tables
+	static_assert(Tables::mask[5] == 0x20, "mask table not constexpr");
+	static_assert(Tables::mask_low[64] == ONE && Tables::mask_high[MASK_LIM] == ONE, "mask tables not constexpr");
+	static_assert(Tables::mask_mid[4][7] == 0xF0, "mask_mid table not constexpr");
+
+	for (int a = 0; a < 64; ++a) {
+		EXPECT_EQ(BITBOARD(1) << a, Tables::mask[a]);
+		EXPECT_EQ(Tables::mask[a] - 1, Tables::mask_low[a]);
+		EXPECT_EQ(~Tables::mask_low[a] ^ Tables::mask[a], Tables::mask_high[a]);
+		for (int b = a; b < 64; ++b) {
+			EXPECT_EQ((Tables::mask_low[b] & Tables::mask_high[a]) | Tables::mask[a] | Tables::mask[b], Tables::mask_mid[a][b]);
+		}
+	}
+	EXPECT_EQ(ZERO, Tables::mask_high[64]);
+
+	//16-bit lookup tables
+	for (int c = 0; c < 65536; ++c) {
+		int pc = 0, lsb = EMPTY_ELEM, msb = EMPTY_ELEM;
+		for (int k = 0; k < 16; ++k) {
+			if (c & (1 << k)) {
+				++pc;
+				if (lsb == EMPTY_ELEM) { lsb = k; }
+				msb = k;
+			}
+		}
+		ASSERT_EQ(pc, Tables::pc[c]);
+		ASSERT_EQ(lsb, Tables::lsb[c]);
+		ASSERT_EQ(msb, Tables::msb[c]);
+		if (c < 256) { ASSERT_EQ(pc, Tables::pc8[c]); }
+	}
+
+	//lookup implementations
+	const BITBOARD bb = 0x0030000000400000ULL;
+	EXPECT_EQ(22, bblock::lsb64_lup(bb));
+	EXPECT_EQ(22, bblock::lsb64_lup_eff(bb));
+	EXPECT_EQ(53, bblock::msb64_lup(bb));
+	EXPECT_EQ(3, bblock::popc64_lup(bb));
+	EXPECT_EQ(3, bblock::popc64_lup_1(bb));
+}
+
+TEST(bblockTest, select) {
+
+	BITBOARD bb = 0xf0f0f0f0;
+	EXPECT_EQ(4, bblock::select64(bb, 0));
+	EXPECT_EQ(7, bblock::select64(bb, 3));
+	EXPECT_EQ(12, bblock::select64(bb, 4));
+	EXPECT_EQ(31, bblock::select64(bb, 15));
+	EXPECT_EQ(BBObject::noBit, bblock::select64(bb, 16));
+	EXPECT_EQ(BBObject::noBit, bblock::select64(0, 0));
+	EXPECT_EQ(63, bblock::select64(ONE, 63));
+	EXPECT_EQ(63, bblock::select64(Tables::mask[63], 0));
+
+	//every 1-bit of a pseudo-random block
+	BITBOARD bbr = 0x9E3779B97F4A7C15ULL;
+	int k = 0;
+	for (int i = 0; i < 64; ++i) {
+		if (bbr & Tables::mask[i]) {
+			EXPECT_EQ(i, bblock::select64(bbr, k++));
+		}
+	}
+}
+
 TEST(bblockTest, copy_bits) {
 
 	//sets the mask all 1s except[10...15]
@@ -427,6 +427,99 @@ TEST(BitSetClass, to_vector) {
 	/////////////////////////
 }
 
+TEST(BitSetClass, decode) {
+
+	const int POPULATION_SIZE = 1000;
+
+	Bitset bb(POPULATION_SIZE), bb1(POPULATION_SIZE);
+	for (int v = 0; v < POPULATION_SIZE; v += 3) { bb.set_bit(v); }
+	for (int v = 0; v < POPULATION_SIZE; v += 5) { bb1.set_bit(v); }
+	bb.set_bit(63);
+	bb1.set_bit(63);
+
+	vector<int> out(POPULATION_SIZE + bbkernel::DECODE_PAD);
+
+	//all the bits
+	out.resize(bb.decode(out.data()));
+	EXPECT_EQ(static_cast<bitpos_list>(bb), out);
+
+	//intersection
+	Bitset bbAND(POPULATION_SIZE);
+	AND(bb, bb1, bbAND);
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bb.decode_and(bb1, out.data()));
+	EXPECT_EQ(static_cast<bitpos_list>(bbAND), out);
+
+	//closed ranges, in the same or in different bitblocks, and up to the end
+	const int ranges[][2] = { {0, 0}, {3, 3}, {4, 62}, {63, 64}, {10, 500}, {64, 127}, {65, 999}, {130, -1}, {999, -1} };
+	for (const auto& r : ranges) {
+		vector<int> exp, exp_and;
+		const int last = (r[1] == -1) ? POPULATION_SIZE - 1 : r[1];
+		for (int v = r[0]; v <= last; ++v) {
+			if (bb.is_bit(v)) { exp.push_back(v); }
+			if (bbAND.is_bit(v)) { exp_and.push_back(v); }
+		}
+
+		out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+		out.resize(bb.decode(r[0], r[1], out.data()));
+		EXPECT_EQ(exp, out);
+
+		out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+		out.resize(bb.decode_and(r[0], r[1], bb1, out.data()));
+		EXPECT_EQ(exp_and, out);
+	}
+
+	//empty bitset
+	Bitset bbE(POPULATION_SIZE);
+	EXPECT_EQ(0, bbE.decode(out.data()));
+	EXPECT_EQ(0, bbE.decode(10, 500, out.data()));
+}
+
+
+TEST(BitSetClass, compress_expand) {
+
+	const int POPULATION_SIZE = 1000;
+
+	Bitset bb(POPULATION_SIZE), mask(POPULATION_SIZE);
+	for (int v = 0; v < POPULATION_SIZE; v += 3) { bb.set_bit(v); }
+	for (int v = 0; v < POPULATION_SIZE; v += 2) { mask.set_bit(v); }
+	mask.set_bit(63);
+	mask.set_bit(999);
+
+	//compress: bits of bb at the positions of mask, renumbered 0, 1, 2...
+	const bitpos_list lm = static_cast<bitpos_list>(mask);
+	Bitset res(POPULATION_SIZE);
+	res.set_bit(POPULATION_SIZE - 1);									//stale bit, must be cleared
+	compress(bb, mask, res);
+
+	Bitset exp(POPULATION_SIZE);
+	for (std::size_t i = 0; i < lm.size(); ++i) {
+		if (bb.is_bit(lm[i])) { exp.set_bit(static_cast<int>(i)); }
+	}
+	EXPECT_TRUE(exp == res);
+
+	//compress into a smaller bitset (only room for the mask population)
+	Bitset res_small(static_cast<int>(lm.size()));
+	compress(bb, mask, res_small);
+	EXPECT_EQ(exp.count(), res_small.count());
+	for (std::size_t i = 0; i < lm.size(); ++i) {
+		EXPECT_EQ(exp.is_bit(static_cast<int>(i)), res_small.is_bit(static_cast<int>(i)));
+	}
+
+	//expand is the inverse on the mask: expand(compress(bb)) = bb & mask
+	Bitset bbe(POPULATION_SIZE);
+	bbe.set_bit(1);																	//stale bit, must be cleared
+	expand(res_small, mask, bbe);
+
+	Bitset bbAND(POPULATION_SIZE);
+	AND(bb, mask, bbAND);
+	EXPECT_TRUE(bbAND == bbe);
+
+	//in place
+	compress(bb, mask, bb);
+	EXPECT_TRUE(exp == bb);
+}
+
 TEST(BitSetClass, cast_to_vector) {
 
 	Bitset bb(130);
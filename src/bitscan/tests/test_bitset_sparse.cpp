@@ -75,7 +75,7 @@ TEST(Sparse, construction_from_vector) {
 	EXPECT_TRUE(bbsp.is_bit(400));
 	EXPECT_TRUE(bbsp.is_bit(500));
 	EXPECT_EQ(5, bbsp.count());
-	EXPECT_EQ(5, bbsp.size());			//sparse number of blocks, one per element in this case 
+	EXPECT_EQ(5u, bbsp.size());			//sparse number of blocks, one per element in this case 
 }
 
 TEST(Sparse, construction_initalizer_list) {
@@ -273,7 +273,45 @@ TEST(Sparse, set_bits) {
 	EXPECT_TRUE(bbsp.is_bit(1100));
 	EXPECT_FALSE(bbsp.is_bit(1101));
 	EXPECT_TRUE(std::is_sorted(bbsp.bitset().begin(), bbsp.bitset().end(), BitsetSp::pBlock_less()));
+}
+
+TEST(Sparse, set_bits_range_no_blocks) {
+
+	//regression: a range of more than two bitblocks with no existing bitblock at or above it was
+	//appended as first, last, in between - unsorted, so that the binary searches (find_block, is_bit) failed
 
+	//empty bitset
+	BitsetSp bbsp(1000);
+	bbsp.set_bit(10, 300);
+	EXPECT_EQ(291, bbsp.count());
+	EXPECT_TRUE(std::is_sorted(bbsp.bitset().begin(), bbsp.bitset().end(), BitsetSp::pBlock_less()));
+	EXPECT_EQ(5u, bbsp.size());
+	EXPECT_EQ(4, bbsp.bitset().back().idx_);
+	EXPECT_FALSE(bbsp.is_bit(9));
+	EXPECT_TRUE(bbsp.is_bit(10));
+	EXPECT_TRUE(bbsp.is_bit(100));
+	EXPECT_TRUE(bbsp.is_bit(200));
+	EXPECT_TRUE(bbsp.is_bit(300));
+	EXPECT_FALSE(bbsp.is_bit(301));
+	EXPECT_EQ(ONE, bbsp.find_block(2));
+	EXPECT_EQ(10, bbsp.lsb());
+	EXPECT_EQ(300, bbsp.msb());
+
+	//existing bitblocks below the range only
+	BitsetSp bbsp1(1000, { 1, 70 });
+	bbsp1.set_bit(130, 400);
+	EXPECT_EQ(273, bbsp1.count());
+	EXPECT_TRUE(std::is_sorted(bbsp1.bitset().begin(), bbsp1.bitset().end(), BitsetSp::pBlock_less()));
+	EXPECT_TRUE(bbsp1.is_bit(70));
+	EXPECT_FALSE(bbsp1.is_bit(129));
+	EXPECT_TRUE(bbsp1.is_bit(256));
+	EXPECT_TRUE(bbsp1.is_bit(400));
+
+	//further insertions rely on the order
+	bbsp1.set_bit(200);
+	bbsp1.set_bit(500);
+	EXPECT_EQ(274, bbsp1.count());
+	EXPECT_TRUE(std::is_sorted(bbsp1.bitset().begin(), bbsp1.bitset().end(), BitsetSp::pBlock_less()));
 }
 
 TEST(Sparse, set_bits_from_bitset) {
@@ -797,6 +835,132 @@ TEST(Sparse, operator_and_eq) {
 
 }
 
+TEST(Sparse, decode) {
+
+	const int POPULATION_SIZE = 10000;
+
+	BitsetSp bbsp(POPULATION_SIZE), bbsp1(POPULATION_SIZE);
+	for (int v : {1, 2, 63, 64, 65, 500, 2000, 2047, 5000, 9999}) { bbsp.set_bit(v); }
+	for (int v : {0, 2, 63, 65, 501, 2047, 4999, 9999}) { bbsp1.set_bit(v); }
+
+	vector<int> out(POPULATION_SIZE + bbkernel::DECODE_PAD);
+
+	//all the bits
+	out.resize(bbsp.decode(out.data()));
+	EXPECT_EQ(vector<int>({ 1, 2, 63, 64, 65, 500, 2000, 2047, 5000, 9999 }), out);
+
+	//intersection
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bbsp.decode_and(bbsp1, out.data()));
+	EXPECT_EQ(vector<int>({ 2, 63, 65, 2047, 9999 }), out);
+
+	//closed ranges
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bbsp.decode(2, 64, out.data()));
+	EXPECT_EQ(vector<int>({ 2, 63, 64 }), out);
+
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bbsp.decode(65, 2046, out.data()));
+	EXPECT_EQ(vector<int>({ 65, 500, 2000 }), out);
+
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bbsp.decode(2001, -1, out.data()));
+	EXPECT_EQ(vector<int>({ 2047, 5000, 9999 }), out);
+
+	out.resize(POPULATION_SIZE + bbkernel::DECODE_PAD);
+	out.resize(bbsp.decode(5001, 9998, out.data()));
+	EXPECT_TRUE(out.empty());
+
+	//extract
+	bitpos_list lv;
+	bbsp.extract(lv);
+	EXPECT_EQ(vector<int>({ 1, 2, 63, 64, 65, 500, 2000, 2047, 5000, 9999 }), lv);
+}
+
+TEST(Sparse, compress_expand) {
+
+	const int POPULATION_SIZE = 10000;
+
+	BitsetSp bbsp(POPULATION_SIZE), mask(POPULATION_SIZE);
+	for (int v : {1, 2, 63, 64, 65, 500, 2000, 2047, 5000, 9999}) { bbsp.set_bit(v); }
+	for (int v : {0, 2, 63, 65, 66, 500, 2047, 4999, 5000, 9999}) { mask.set_bit(v); }
+	for (int v = 6000; v < 6200; ++v) { mask.set_bit(v); }			//crosses several stream blocks
+	bbsp.set_bit(6001);
+	bbsp.set_bit(6199);
+
+	//compress: bits of bbsp renumbered by their position in mask (6000..6199 -> 9..208, 9999 -> 209)
+	BitsetSp res(POPULATION_SIZE);
+	compress(bbsp, mask, res);
+
+	bitpos_list lv;
+	res.extract(lv);
+	EXPECT_EQ(vector<int>({ 1, 2, 3, 5, 6, 8, 10, 208, 209 }), lv);
+
+	//expand restores bbsp & mask
+	BitsetSp bbe(POPULATION_SIZE);
+	bbe.set_bit(7);
+	expand(res, mask, bbe);
+	bbe.extract(lv);
+	EXPECT_EQ(vector<int>({ 2, 63, 65, 500, 2047, 5000, 6001, 6199, 9999 }), lv);
+
+	//empty mask
+	BitsetSp empty(POPULATION_SIZE);
+	compress(bbsp, empty, res);
+	EXPECT_TRUE(res.is_empty());
+}
+
+TEST(Sparse, inline_blocks) {
+
+	const int POP = 100000;
+
+	//blocks are inserted out of order: the first ones stay inline, the rest spill to the heap
+	BBScanSp bbsp(POP);
+	BBScanSp ref(POP);
+	vector<int> lv = { 70000, 5, 300, 99999, 64, 4000, 128, 70001 };
+	for (auto i = 0u; i < lv.size(); ++i) {
+		bbsp.set_bit(lv[i]);
+		ref.set_bit(lv[i]);
+		EXPECT_TRUE(std::is_sorted(bbsp.bitset().begin(), bbsp.bitset().end(), BitsetSp::pBlock_less()));
+		EXPECT_EQ(static_cast<int>(i + 1), bbsp.count());
+	}
+
+	EXPECT_EQ(7, bbsp.size());
+	EXPECT_EQ(5, bbsp.lsb());
+	EXPECT_EQ(99999, bbsp.msb());
+
+	//copies and moves preserve the bits whether the blocks are inline or not
+	BBScanSp small(POP);
+	small.set_bit(10);
+	BBScanSp c1(small), c2(bbsp);
+	EXPECT_TRUE(c1 == small);
+	EXPECT_TRUE(c2 == ref);
+
+	BBScanSp m(std::move(c2));
+	EXPECT_TRUE(m == ref);
+	m = std::move(c1);
+	EXPECT_TRUE(m == small);
+
+	//erasing back to a few blocks
+	bbsp.erase_bit(64, 70000);
+	EXPECT_EQ(3, bbsp.count());
+	bbsp.shrink_to_fit();
+	EXPECT_EQ(5, bbsp.lsb());
+	EXPECT_EQ(70001, bbsp.next_bit(5));
+	EXPECT_EQ(99999, bbsp.msb());
+
+	//vector of rows (reallocation moves the rows)
+	vector<BBScanSp> rows;
+	for (int v = 0; v < 100; ++v) {
+		rows.emplace_back(POP);
+		rows.back().set_bit(v);
+		if (v % 3 == 0) { rows.back().set_bit(POP - 1 - v); }
+	}
+	for (int v = 0; v < 100; ++v) {
+		EXPECT_EQ(v, rows[v].lsb());
+		EXPECT_EQ((v % 3 == 0) ? 2 : 1, rows[v].count());
+	}
+}
+
 TEST(Sparse, DISABLED_clear_bits) {
 
 	BitsetSp bbsp(10000);
@@ -16,6 +16,8 @@
 #include "bitscan/bbobject.h"		
 #include "bitscan/bitblock.h"		//for bitblock operations
 #include "bitscan/bbset.h"	
+#include "bitscan/bbset_arena.h"	//thread-local pools of working bitsets
+#include "bitscan/bbset_sentinel.h"	//SentinelBitset overloads (AND, count_and) for watched graphs
 #include "graph/graph_types.h"
 
 #include <cassert>					//DEBUG run-time assertions 
@@ -174,38 +176,31 @@ namespace bitgraph {
 			inline
 				int find_clique(const GraphT& g, std::vector<int>& clq, typename GraphT::VertexBitset& bbsg) {
 
-				typename GraphT::VertexBitset bb(bbsg);
+				//working copy of bbsg from the thread-local pool (no allocation once warm)
+				auto& pool = BitsetPool<typename GraphT::VertexBitset>::local();
+				typename BitsetPool<typename GraphT::VertexBitset>::Frame frame(pool);
+				auto& bb = pool.acquire(bbsg);
 				clq.clear();
 
-				//main loop - destructive scan of bb
+				//main loop - destructive scan of bb (v is not in N(v), bb is read again at each step)
 				if /*constexpr*/ (Reverse) {
-					bb.init_scan(bbo::NON_DESTRUCTIVE_REVERSE);
-				}
-				else { bb.init_scan(bbo::NON_DESTRUCTIVE); }
+					for (int v : bits_del_rev(bb)) {
 
-				int v = bbo::noBit;
-				while (true) {
+						//v fixed in the clique
+						clq.push_back(v);
 
-					if /*constexpr*/ (Reverse) { v = bb.prev_bit(); }
-					else { v = bb.next_bit(); }
-
-					/////////////////////////////
-					if (v == bbo::noBit) break;
-					///////////////////////////////
+						//bb &= g.get_neighbors(w) up to the bitblock of v
+						bb.AND_EQUAL_block(0, WDIV(v), g.neighbors(v));
+					}
+				}
+				else {
+					for (int v : bits_del(bb)) {
 
-					//v fixed in the clique
-					clq.push_back(v);
+						//v fixed in the clique
+						clq.push_back(v);
 
-					//optimization of bb &= g.get_neighbors(w);	
-					if /*constexpr*/ (Reverse) {
-						for (auto nBB = WDIV(v); nBB >= 0; --nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
-					}
-					else {
-						for (auto nBB = WDIV(v); nBB < static_cast<int>(g.num_blocks()); ++nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						//bb &= g.get_neighbors(w) from the bitblock of v onwards
+						bb.AND_EQUAL_block(WDIV(v), -1, g.neighbors(v));
 					}
 				}
 
@@ -227,7 +222,9 @@ namespace bitgraph {
 			inline
 				int find_clique_max_deg(const GraphT& g, std::vector<int>& clq, const typename GraphT::VertexBitset& bbsg) {
 
-				typename GraphT::VertexBitset bbsgC{ bbsg };
+				auto& pool = BitsetPool<typename GraphT::VertexBitset>::local();
+				typename BitsetPool<typename GraphT::VertexBitset>::Frame frame(pool);
+				auto& bbsgC = pool.acquire(bbsg);
 				clq.clear();
 
 				int pcmax, pc;
@@ -248,11 +245,7 @@ namespace bitgraph {
 						if (v == bbo::noBit) break;
 						////////////////////////////
 
-						pc = 0;
-						const typename GraphT::VertexBitset& bbn =  g.neighbors(v);
-						for (int nBB = 0; nBB < g.num_blocks(); ++nBB) {
-							pc += bitgraph::bblock::popc64(bbsgC.block(nBB) & bbn.block(nBB));
-						}
+						pc = bitgraph::count_and(bbsgC, g.neighbors(v));
 
 						//store vertex if more neighbors
 						if (pcmax < pc) {
@@ -306,7 +299,9 @@ namespace bitgraph {
 			inline
 				int find_clique_from_pool(const GraphT& g, std::vector<int>& clq, typename GraphT::VertexBitset& bbsg) {
 
-				typename GraphT::VertexBitset bb(g.size());
+				auto& pool = BitsetPool<typename GraphT::VertexBitset>::local();
+				typename BitsetPool<typename GraphT::VertexBitset>::Frame frame(pool);
+				auto& bb = pool.acquire(g.size());
 				clq.clear();
 
 				//main loop - seed vertex for a clique 
@@ -331,10 +326,8 @@ namespace bitgraph {
 
 						clq_curr.push_back(w);
 
-						//optimization of bb &= g.get_neighbors(w);	
-						for (auto nBB = WDIV(w); nBB < g.num_blocks(); ++nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						//bb &= g.get_neighbors(w) from the bitblock of w onwards
+						bb.AND_EQUAL_block(WDIV(w), -1, g.neighbors(v));
 
 					}
 					///////////
@@ -695,7 +688,9 @@ namespace bitgraph {
 			inline
 				int find_clique_lb(const GraphT& g, typename GraphT::VertexBitset& bbsg) {
 
-				typename GraphT::VertexBitset bb(bbsg);
+				auto& pool = BitsetPool<typename GraphT::VertexBitset>::local();
+				typename BitsetPool<typename GraphT::VertexBitset>::Frame frame(pool);
+				auto& bb = pool.acquire(bbsg);
 				int lb = 0;
 
 				//main loop - destructive scan of bb
@@ -719,14 +714,10 @@ namespace bitgraph {
 
 					//optimization of bb &= g.get_neighbors(w);	
 					if /* constexpr */ (Reverse) {
-						for (auto nBB = WDIV(v); nBB >= 0; --nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						bb.AND_EQUAL_block(0, WDIV(v), g.neighbors(v));
 					}
 					else {
-						for (auto nBB = WDIV(v); nBB < g.num_blocks(); ++nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						bb.AND_EQUAL_block(WDIV(v), -1, g.neighbors(v));
 					}
 				}
 
@@ -744,7 +735,10 @@ namespace bitgraph {
 			inline
 				int find_clique_lb(const GraphT& g) {
 
-				typename GraphT::VertexBitset bb((int)g.size(), true);
+				auto& pool = BitsetPool<typename GraphT::VertexBitset>::local();
+				typename BitsetPool<typename GraphT::VertexBitset>::Frame frame(pool);
+				auto& bb = pool.acquire(g.size());
+				if (g.size() > 0) { bb.set_bit(0, static_cast<int>(g.size()) - 1); }
 				int lb = 0;
 
 				//main loop - destructive scan of bb
@@ -768,14 +762,10 @@ namespace bitgraph {
 
 					//optimization of bb &= g.get_neighbors(w);	
 					if /*constexpr*/ (Reverse) {									//for C++14 support
-						for (auto nBB = WDIV(v); nBB >= 0; --nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						bb.AND_EQUAL_block(0, WDIV(v), g.neighbors(v));
 					}
 					else {
-						for (auto nBB = WDIV(v); nBB < g.num_blocks(); ++nBB) {
-							bb.block(nBB) &= g.neighbors(v).block(nBB);
-						}
+						bb.AND_EQUAL_block(WDIV(v), -1, g.neighbors(v));
 					}
 				}
 
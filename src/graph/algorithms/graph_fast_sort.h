@@ -12,6 +12,7 @@
 							
 
 #include "graph/simple_ugraph.h"				//to limit template GraphT to undirected types - types must be known
+#include "graph/simple_csr_ugraph.h"
 
 #include "utils/logger.h"
 #include "utils/common.h"						
@@ -31,16 +32,17 @@ namespace bitgraph {
 		///////////////////////////
 		//
 		// GraphFastRootSort class
-		// (GraphT should be restricted to ugraph and sparse_ugraph types)
+		// (GraphT should be restricted to ugraph and sparse_ugraph types, or CsrUgraph)
 		//
 		////////////////////////////
 
 		template <class GraphT>
 		class GraphFastRootSort {
 			
-			//restrict to ugraph and sparse_ugraph types
-			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, GraphT>::value ||
-				std::is_same<bitgraph::Ugraph<BBScanSp>, GraphT>::value, "is not a valid GraphFastRootSort type");
+			//restrict to undirected graphs (ugraph, sparse_ugraph, Ugraph<FixedBitset<N>>..., CsrUgraph)
+			static_assert((std::is_same<bitgraph::Ugraph<typename GraphT::bitset_type>, GraphT>::value &&
+				bitgraph::is_graph_bitset<typename GraphT::bitset_type>::value) || bitgraph::is_csr_graph<GraphT>::value,
+				"is not a valid GraphFastRootSort type");
 		
 		public:
 			using VertexOrdering = bitgraph::VertexOrdering;
@@ -409,15 +411,8 @@ namespace bitgraph {
 			///////////////////////////////////
 
 			//update degree info of the remaining active vertices
-			VertexBitset& bbn = g_.neighbors(v);
-
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
+			for (int w : bits_and(g_.neighbors(v), node_active_state_)) {
+				nb_neigh_[w]--;
 			}
 
 		} while (true);
@@ -459,14 +454,8 @@ namespace bitgraph {
 			//////////////////////////////////
 
 			//updates neighborhood info in remaining vertices
-			VertexBitset& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
+			for (int w : bits_and(g_.neighbors(v), node_active_state_)) {
+				nb_neigh_[w]--;
 			}
 
 		} while (true);
@@ -547,14 +536,8 @@ namespace bitgraph {
 			node_active_state_.erase_bit(v);
 
 			//updates neighborhood info in remaining vertices
-			VertexBitset& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
+			for (int w : bits_and(g_.neighbors(v), node_active_state_)) {
+				nb_neigh_[w]--;
 			}
 		}
 
@@ -589,14 +572,8 @@ namespace bitgraph {
 			node_active_state_.erase_bit(v);
 
 			//updates neighborhood info in remaining vertices
-			VertexBitset& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
+			for (int w : bits_and(g_.neighbors(v), node_active_state_)) {
+				nb_neigh_[w]--;
 			}
 		}
 
@@ -781,7 +758,7 @@ namespace bitgraph {
 	GraphFastRootSort<GraphT>::compute_deg_root() -> const VertexDegrees&  {
 
 		for (int elem = 0; elem < NV_; ++elem) {
-			nb_neigh_[elem] = g_.neighbors(elem).count();
+			nb_neigh_[elem] = g_.degree(elem);
 		}
 
 		return nb_neigh_;
@@ -793,12 +770,8 @@ namespace bitgraph {
 	{
 		for (int elem = 0; elem < NV_; ++elem) {
 			deg_neigh_[elem] = 0;
-			VertexBitset& bbn = g_.neighbors(elem);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != EMPTY_ELEM) {
-					deg_neigh_[elem] += nb_neigh_[w];
-				}
+			for (int w : bits(g_.neighbors(elem))) {
+				deg_neigh_[elem] += nb_neigh_[w];
 			}
 		}
 
@@ -834,7 +807,7 @@ namespace bitgraph {
 		auto NV = g.num_vertices();
 		deg.assign(NV, -1);
 		for (auto v = 0; v < NV; v++) {
-			deg[v] = g.neighbors(v).size();
+			deg[v] = g.degree(v);
 		}
 		return 0;
 	}
@@ -935,16 +908,17 @@ namespace bitgraph {
 		gn.set_name(g_.name());
 		gn.set_path(g_.path());
 
-		///generate isomorphism (only for undirected graphs) 
-		for (auto i = 0u; i < NV - 1; i++) {
-			for (auto j = i + 1; j < NV; j++) {
-				if (g_.is_edge(i, j)) {									//in O(log) for sparse graphs, should be specialized for that case
+		///generate isomorphism (only for undirected graphs), edges (i, j) with i < j read from the rows
+		for (int i = 0; i < static_cast<int>(NV); i++) {
+			for (int j : bits(g_.neighbors(i))) {
+				if (j > i) {
 					//////////////////////////////////////////////
 					gn.add_edge(new_order[i], new_order[j]);			//maps the new edges according to the new given order
 					//////////////////////////////////////////////
 				}
 			}
 		}
+		build_graph(gn);
 
 		///////////////
 		//stores decoding information [NEW]->[OLD]
@@ -969,16 +943,17 @@ namespace bitgraph {
 		gres.set_name(g.name());
 		gres.set_path(g.path());
 
-		///generate isomorphism (only for undirected graphs) 
-		for (auto i = 0u; i < NV - 1; i++) {
-			for (auto j = i + 1; j < NV; j++) {
-				if (g.is_edge(i, j)) {									//in O(log) for sparse graphs, should be specialized for that case
+		///generate isomorphism (only for undirected graphs), edges (i, j) with i < j read from the rows
+		for (int i = 0; i < static_cast<int>(NV); i++) {
+			for (int j : bits(g.neighbors(i))) {
+				if (j > i) {
 					//////////////////////////////////////////////
 					gres.add_edge(o2n[i], o2n[j]);			//maps the new edges according to the new given order
 					//////////////////////////////////////////////
 				}
 			}
 		}
+		build_graph(gres);
 
 		///////////////
 		//stores decoding information [NEW]->[OLD]
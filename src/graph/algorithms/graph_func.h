@@ -30,105 +30,77 @@ namespace bitgraph {
 	namespace gfunc {
 
 		/*
-		* @brief List of neighbors of v in the set of vertices bbref ()
+		* @brief List of neighbors of v in the set of vertices bbref () from vertex first (included)
 		* @param g: a simple undirected graph
-		* @param lv: output list of vertices
+		* @param first: first vertex of the range [first, num_vertices())
 		* @param bbref: list (bitset) of reference vertices
+		* @param lv: output list of vertices
 		* @returns number of vertices in lv
-		* @date: created 03/09/18, last_update: 09/01/25
+		* @details: the bitblocks of N(v) & bbref are decoded in batch (several vertices per
+		*			step, bblock::decode64) into lv, sized to the population of the intersection
+		* @date: created 17/10/26
 		*/
 		template<class GraphT>
-		std::size_t neighbors(const GraphT& g, Vertex v, typename  GraphT::VertexBitset& bbref, VertexList& lv) {
+		std::size_t neighbors_from(const GraphT& g, Vertex v, Vertex first, typename GraphT::VertexBitset& bbref, VertexList& lv) {
 
 			lv.clear();
-			lv.reserve(g.num_vertices());		//allocates maximum possible size
-			
-			const int maxBB = g.num_blocks();
 
-			for (int nBB = 0; nBB < maxBB; ++nBB) {
-
-				//block NBB of the intersection of N(v) and bbref
-				BITBOARD bb = g.neighbors(v).block(nBB) & bbref.block(nBB);
+			const int maxBB = g.num_blocks();
+			const int firstBB = WDIV(first);
+			if (firstBB >= maxBB) {
+				return 0;
+			}
 
-				//decodes vertices from the bitblock and appends to vertex list
-				int offset = WMUL(nBB);
-				while (bb != 0) {
-					int v64 = bblock::lsb(bb);
+			const auto& bbn = g.neighbors(v);
+			const BITBOARD maskL = bblock::MASK_1_HIGH(WMOD(first));			//trims the vertices before first
 
-					///////////////////////////////
-					lv.emplace_back(v64 + offset);
-					///////////////////////////////
+			//population of the intersection of N(v) and bbref
+			int pc = bblock::popc64(bbn.block(firstBB) & bbref.block(firstBB) & maskL);
+			for (int nBB = firstBB + 1; nBB < maxBB; ++nBB) {
+				pc += bblock::popc64(bbn.block(nBB) & bbref.block(nBB));
+			}
 
-					bb ^= Tables::mask[v64];				//removes v64 from the bitset (XOR bitmask)
+			//decodes the intersection (the padding of the decoder is trimmed afterwards)
+			lv.resize(pc + bbkernel::DECODE_PAD);
+			int* p = lv.data();
+			p += bblock::decode64(bbn.block(firstBB) & bbref.block(firstBB) & maskL, WMUL(firstBB), p);
+			for (int nBB = firstBB + 1; nBB < maxBB; ++nBB) {
+				const BITBOARD bb = bbn.block(nBB) & bbref.block(nBB);
+				if (bb) {
+					p += bblock::decode64(bb, WMUL(nBB), p);
 				}
 			}
+			lv.resize(p - lv.data());
 
 			return lv.size();
 		}
 
+		/*
+		* @brief List of neighbors of v in the set of vertices bbref ()
+		* @param g: a simple undirected graph
+		* @param lv: output list of vertices
+		* @param bbref: list (bitset) of reference vertices
+		* @returns number of vertices in lv
+		* @details: batched decoding of the bitblocks (bblock::decode64)
+		* @date: created 03/09/18, last_update: 17/10/26
+		*/
+		template<class GraphT>
+		std::size_t neighbors(const GraphT& g, Vertex v, typename  GraphT::VertexBitset& bbref, VertexList& lv) {
+			return neighbors_from(g, v, 0, bbref, lv);
+		}
+
 		/*
 		* @brief List of neighbors of v in the set of vertices bbref () that come after v
 		* @param g: a simple undirected graph
 		* @param lv_n: output list of vertices
 		* @param bbref: list (bitset) of reference vertices
 		* @returns number of vertices in lv_n
-		* @date: created 03/09/18, @last_update: 09/01/25
+		* @details: batched decoding of the bitblocks (bblock::decode64)
+		* @date: created 03/09/18, @last_update: 17/10/26
 		*/
 		template<class GraphT>
 		std::size_t neighbors_after(const GraphT& g, Vertex v, typename GraphT::VertexBitset& bbref, VertexList& lv) {
-
-			lv.clear();
-			lv.reserve(g.num_vertices());		//allocates maximum possible size
-
-			
-
-			//////////////////////////////////////////
-			//first nBB - trimming and decoding
-
-			//block index of v
-			int nBBv = WDIV(v);
-
-			//first block of the intersection of N(v) and bbref from v		
-			BITBOARD bb = g.neighbors(v).block(nBBv) & bbref.block(nBBv);
-
-			//trims preceding vertices
-			bb &= Tables::mask_high[WMOD(v)];
-
-			//decodes block of v (appends to lv)	
-			while (bb != 0) {
-				int v64 = bblock::lsb(bb);
-
-				///////////////////////////////
-				lv.emplace_back(v64 + nBBv);
-				///////////////////////////////
-
-				bb ^= Tables::mask[v64];								//removes v64 from the bitset (XOR bitmask)
-			}
-
-			//////////////////////////////////////////
-			//remaining blocks
-
-			const int maxBB = g.num_blocks();
-
-			for (int nBB = nBBv + 1; nBB < maxBB; ++nBB) {
-
-				//block NBB of the intersection of N(v) and bbref
-				BITBOARD bb = g.neighbors(v).block(nBB) & bbref.block(nBB);
-
-				//decodes vertices from the bitblock and appends to vertex list
-				int offset = WMUL(nBB);
-				while (bb != 0) {
-					int v64 = bblock::lsb(bb);
-
-					///////////////////////////////
-					lv.emplace_back(v64 + offset);
-					///////////////////////////////
-
-					bb ^= Tables::mask[v64];				//removes v64 from the bitset (XOR bitmask)
-				}
-			}
-
-			return lv.size();
+			return neighbors_from(g, v, v + 1, bbref, lv);
 		}
 
 		template<class GraphT>
@@ -15,6 +15,7 @@
 #include "utils/common.h"
 #include "bitscan/bbconfig.h"			//for INDEX_1_TO_1 macro
 #include "bitscan/bbobject.h"
+#include "bitscan/bitblock.h"			//batched decoding of bitblocks
 #include "decode.h"
 #include <iostream>
 #include <vector>
@@ -188,13 +189,15 @@ namespace bitgraph{
 		//cleans bbr if requested
 		if (overwrite) { bbr.erase_bit(); }
 		
-		//scan the bitset bbl and map
-		bbl.init_scan(BBObject::NON_DESTRUCTIVE);
-		int v = BBObject::noBit;
-		while ( (v = bbl.next_bit()) != BBObject::noBit) {
-			bbr.set_bit(l2r_[v]);
+		//decodes the bitblocks of bbl in batch and maps
+		int lv[WORD_SIZE + 8];											//room for a bitblock and the padding of the decoder
+		for (int nBB = 0; nBB < bbl.num_blocks(); ++nBB) {
+			const int n = bblock::decode64(bbl.block(nBB), WMUL(nBB), lv);
+			for (int i = 0; i < n; ++i) {
+				bbr.set_bit(l2r_[lv[i]]);
+			}
 		}
-		
+
 
 		return bbr;
 	}
@@ -211,13 +214,15 @@ namespace bitgraph{
 		//cleans bbr if requested
 		if (overwrite) { bbl.erase_bit(); }
 
-		//sets bitscanning configuration
-		bbr.init_scan(BBObject::NON_DESTRUCTIVE);
-		int v = BBObject::noBit;
-		while ((v = bbr.next_bit()) != BBObject::noBit) {
-			bbl.set_bit(r2l_[v]);
+		//decodes the bitblocks of bbr in batch and maps
+		int lv[WORD_SIZE + 8];											//room for a bitblock and the padding of the decoder
+		for (int nBB = 0; nBB < bbr.num_blocks(); ++nBB) {
+			const int n = bblock::decode64(bbr.block(nBB), WMUL(nBB), lv);
+			for (int i = 0; i < n; ++i) {
+				bbl.set_bit(r2l_[lv[i]]);
+			}
 		}
-		
+
 		return bbl;
 	}
 
@@ -415,4 +420,4 @@ namespace bitgraph{
 
 }//end of namespace bitgraph
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -316,15 +316,9 @@ namespace bitgraph {
 		/////////////////////////
 		//Sum of degrees of neighbors to v in the current graph considered, circumscribed to sg
 
-		int ndeg = 0, vadj = EMPTY_ELEM;
-		_bbt nset(g.number_of_vertices());
-		AND(sg, g.neighbors(v), nset);
-		if (nset.init_scan(BBObject::NON_DESTRUCTIVE) != EMPTY_ELEM) {
-			while (true) {
-				vadj = nset.next_bit();
-				if (vadj == EMPTY_ELEM) break;
-				ndeg += g.degree(vadj, sg);
-			}
+		int ndeg = 0;
+		for (int vadj : bits_and(sg, g.neighbors(v))) {
+			ndeg += g.degree(vadj, sg);
 		}
 		return ndeg;
 	}
@@ -351,7 +351,7 @@ namespace bitgraph {
 		subg_(std::move(subg))
 	{
 		try {
-			ver_.assign(subg_.size(), EMPTY_ELEM);
+			ver_.assign(subg_.count(), EMPTY_ELEM);			//number of vertices of the subgraph
 		}
 		catch (std::bad_alloc& ba) {
 			LOGG_ERROR("bad_alloc exception - KCore<T>::reset_subgraph", ba.what());
@@ -369,7 +369,7 @@ namespace bitgraph {
 	{
 		try {
 			subg_ = typename graph_type::VertexBitset{ static_cast<std::size_t>(NV_), subg };
-			ver_.assign(subg_.size(), EMPTY_ELEM);
+			ver_.assign(subg_.count(), EMPTY_ELEM);			//number of vertices of the subgraph
 		}
 		catch (std::bad_alloc& ba) {
 			LOGG_ERROR("bad_alloc exception - KCore<T>::reset_subgraph", ba.what());
@@ -385,7 +385,7 @@ namespace bitgraph {
 		subg_ = std::move(subg);
 
 		try {
-			ver_.assign(subg_.size(), EMPTY_ELEM);
+			ver_.assign(subg_.count(), EMPTY_ELEM);			//number of vertices of the subgraph
 		}
 		catch (std::bad_alloc& ba) {
 			LOGG_ERROR("bad_alloc exception - KCore<T>::reset_subgraph", ba.what());
@@ -411,20 +411,13 @@ namespace bitgraph {
 			//kcore computation for the full graph
 			for (auto& v : ver_) {
 
-				//iterates over N(v)
-				
-				VertexBitset& neigh = g_.neighbors(v);
-				if (neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
-
-					int u = BBObject::noBit;
-					while ((u = neigh.next_bit()) != BBObject::noBit) {
+				//iterates over N(v) - no virtual bitscanning (17/10/2026)
+				for (int u : bits(g_.neighbors(v))) {
 
-						if (deg_[u] > deg_[v]) {
-							SWAP_BIN(u);			//swap bin movement for v (also sorted in ver_)
-							--deg_[u];				//decrease degree of swapped vertex
-						}
+					if (deg_[u] > deg_[v]) {
+						SWAP_BIN(u);			//swap bin movement for v (also sorted in ver_)
+						--deg_[u];				//decrease degree of swapped vertex
 					}
-
 				}
 
 			}//vertex iteration
@@ -432,27 +425,18 @@ namespace bitgraph {
 		else {
 
 			//kcore computation for the induced subgraph by the (bit)set of vertices in subg_
-			VertexBitset neigh(NV_);
 
 			//sorts by degree and computes degeneracy
 			for (auto v : ver_) {
 
-				//computes neightbors of v in the subgraph
-				AND(g_.neighbors(v), subg_, neigh);
+				//iterates over the neighbors of v in the subgraph (fused scan, no neighborhood bitset is built)
+				for (int u : bits_and(g_.neighbors(v), subg_)) {
 
-				//iterates over the neighbors of v in the subgraph
-				if (neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
-
-					int u = BBObject::noBit;
-					while ((u = neigh.next_bit()) != BBObject::noBit) {
-
-						if (deg_[u] > deg_[v]) {
-							SWAP_BIN(u);			//swap bin movement for v (also sorted in ver_)
-							--deg_[u];				//decrease degree of swapped vertex
-						}
+					if (deg_[u] > deg_[v]) {
+						SWAP_BIN(u);			//swap bin movement for v (also sorted in ver_)
+						--deg_[u];				//decrease degree of swapped vertex
 					}
-
-				}//endif
+				}
 
 			}//vertex iteration
 		}
@@ -503,7 +487,6 @@ namespace bitgraph {
 		}
 
 		//variables / update UB to the nearest existing degree
-		int u = BBObject::noBit;
 		int v = BBObject::noBit;
 		int UB = UB_out;
 		int w = ver_[bin_[UB]];
@@ -522,26 +505,24 @@ namespace bitgraph {
 				first_time_newLB = true;
 				p_newUB = -1;
 
-				//loop over neighbors of v with degree greater than UB
-				if (g_.neighbors(v).init_scan(bbo::NON_DESTRUCTIVE) != -1) {
-					while ((u = g_.neighbors(v).next_bit()) != BBObject::noBit) {
+				//loop over neighbors of v with degree greater than UB (no virtual bitscanning)
+				for (int u : bits(g_.neighbors(v))) {
 
-						if (deg_[u] > UB) {
+					if (deg_[u] > UB) {
 
-							/////////////////
-							SWAP_BIN(u);
-							/////////////////
+						/////////////////
+						SWAP_BIN(u);
+						/////////////////
 
-							//update degree: if vertex u has deg LB+1, instead of updating to LB it takes the degree of v
-							if (deg_[u] == UB + 1) {
-								deg_[u] = deg_[v];
-								if (first_time_newLB && deg_[v] != UB) {
-									first_time_newLB = false;
-									p_newUB = pos_[u];		//new position of u
-								}
+						//update degree: if vertex u has deg LB+1, instead of updating to LB it takes the degree of v
+						if (deg_[u] == UB + 1) {
+							deg_[u] = deg_[v];
+							if (first_time_newLB && deg_[v] != UB) {
+								first_time_newLB = false;
+								p_newUB = pos_[u];		//new position of u
 							}
-							else deg_[u]--;
 						}
+						else deg_[u]--;
 					}
 				}
 
@@ -555,19 +536,16 @@ namespace bitgraph {
 						v = ver_[p_newUB];
 
 						//loop over neighbors of v with degree greater than UB
-						if (g_.neighbors(v).init_scan(bbo::NON_DESTRUCTIVE) != -1) {
-
-							while ((u = g_.neighbors(v).next_bit()) != BBObject::noBit) {
-								if (deg_[u] > UB) {
+						for (int u : bits(g_.neighbors(v))) {
+							if (deg_[u] > UB) {
 
-									/////////////////
-									SWAP_BIN(u);										//swaps u to the last position of vertices with one less degree	(does not update degree)
-									/////////////////
+								/////////////////
+								SWAP_BIN(u);										//swaps u to the last position of vertices with one less degree	(does not update degree)
+								/////////////////
 
-									(deg_[u] == UB + 1) ? deg_[u] = deg_[v] : deg_[u]--;		//updates degree
-								}
+								(deg_[u] == UB + 1) ? deg_[u] = deg_[v] : deg_[u]--;		//updates degree
 							}
-						}//endif
+						}
 
 						p_newUB++;	//next vertex in UB
 					}
@@ -629,7 +607,8 @@ namespace bitgraph {
 
 			//kcore for the subgraph induced by subg_
 			//subg_ cannot be empty, so the assertion MUST hold
-			assert(subg_.init_scan(bbo::NON_DESTRUCTIVE) != -1);
+			int r = subg_.init_scan(bbo::NON_DESTRUCTIVE);
+			assert(r != -1); (void)r;
 
 			while ((v = subg_.next_bit()) != BBObject::noBit) {
 
@@ -653,7 +632,8 @@ namespace bitgraph {
 
 			//sets bins values for the induced subgraph
 			//subg_ cannot be empty, so the assertion MUST hold
-			assert(subg_.init_scan(bbo::NON_DESTRUCTIVE) != -1);
+			r = subg_.init_scan(bbo::NON_DESTRUCTIVE);
+			assert(r != -1); (void)r;
 
 			v = BBObject::noBit;
 			while ((v = subg_.next_bit()) != BBObject::noBit) {
@@ -696,7 +676,8 @@ namespace bitgraph {
 
 			//induced subgraph
 			//subg_ cannot be empty, assertion MUST HOLD
-			assert(subg_.init_scan(bbo::NON_DESTRUCTIVE) != -1);
+			const int r = subg_.init_scan(bbo::NON_DESTRUCTIVE);
+			assert(r != -1); (void)r;
 
 			v = BBObject::noBit;
 			while ((v = subg_.next_bit()) != BBObject::noBit) {
@@ -736,7 +717,8 @@ namespace bitgraph {
 
 			//bin_sort subgraph induced by subg_
 			//subg_ cannot be empty, assertion MUST hold
-			assert(subg_.init_scan(bbo::NON_DESTRUCTIVE) != -1);
+			const int r = subg_.init_scan(bbo::NON_DESTRUCTIVE);
+			assert(r != -1); (void)r;
 
 			auto v = BBObject::noBit;
 			while ((v = subg_.next_bit()) != BBObject::noBit) {
@@ -815,19 +797,15 @@ namespace bitgraph {
 
 		int maxNumNeigh = EMPTY_ELEM;
 		int	numNeigh = EMPTY_ELEM;
-		VertexBitset bb_unsel(NV_);
 		VertexBitset bb_sel(NV_);
 
 		if (rev) {
 
 			for (auto it = ver_.rbegin(); it != ver_.rend(); ++it) {
 
-				//computes subgraph population (TODO: optimize)
-				bb_unsel = g_.neighbors(*it);
-				bb_unsel.erase_bit(bb_sel);
-
+				//neighbors of *it not yet selected
 				///////////////////////////////
-				numNeigh = bb_unsel.size();
+				numNeigh = g_.degree(*it) - g_.degree(*it, bb_sel);
 				if (maxNumNeigh < numNeigh) { maxNumNeigh = numNeigh; }
 				////////////////////////////////
 
@@ -839,12 +817,9 @@ namespace bitgraph {
 
 			for (auto it = ver_.begin(); it != ver_.end(); ++it) {
 
-				//computes subgraph population (TODO: optimize)
-				bb_unsel = g_.neighbors(*it);
-				bb_unsel.erase_bit(bb_sel);
-
+				//neighbors of *it not yet selected
 				///////////////////////////////
-				numNeigh = bb_unsel.size();
+				numNeigh = g_.degree(*it) - g_.degree(*it, bb_sel);
 				if (maxNumNeigh < numNeigh) { maxNumNeigh = numNeigh; }
 				///////////////////////////////
 
@@ -985,7 +960,7 @@ namespace bitgraph {
 			//determines neighbor set in degeneracy order
 			neighbors.clear();
 			for (int j = i - 1; j >= 0; --j) {
-				if (deg_[ver_[j]] >= max_size && g_.neighbors(v).is_bit(ver_[j])) {
+				if (deg_[ver_[j]] >= max_size && g_.is_edge(v, ver_[j])) {
 					neighbors.push_back(ver_[j]);									//vertices are placed in neighbor in degeneracy order (I)
 				}
 			}
@@ -995,7 +970,7 @@ namespace bitgraph {
 			for (int n = 0; n < neighbors.size(); ++n) {	//vertices selected in degeneracy order (I)							
 				bool good_vertex = true;
 				for (auto l = 0; l < curr_clique.size(); ++l) {
-					if (!g_.neighbors(curr_clique[l]).is_bit(neighbors[n])) {
+					if (!g_.is_edge(curr_clique[l], neighbors[n])) {
 						good_vertex = false;
 						break;
 					}
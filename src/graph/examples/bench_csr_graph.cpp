@@ -0,0 +1,208 @@
+/**
+* @file bench_csr_graph.cpp
+* @brief Benchmark of large sparse graphs in compressed sparse row format (csr_ugraph) against sparse_ugraph
+*		 (one BBScanSp row per vertex)
+* @details created 17/10/2026
+* @details usage: bench_csr_graph [<file.mtx> | <number of vertices> <average degree>] [<number of repetitions>]
+*		   Without a file, a random graph with locality (as in bench_sparse_sbo) is written to a temporary .mtx file first.
+* @details reports:
+*			- load: time to read the .mtx file (ms)
+*			- RSS: resident memory added by the graph (MB, VmRSS, Linux only)
+*			- scan: iteration over all the neighborhoods (ms per repetition)
+*			- is_edge: 10M queries (v, w), w at most 64 positions after v (ms per repetition)
+*			- kcore: KCore::find_kcore (ms per repetition)
+*			- ego: ego-networks of all the vertices in the degeneracy ordering (later neighbors), built as graphs with
+*			  bitset rows - ugraph from csr_ugraph, sparse_ugraph from sparse_ugraph (ms per repetition)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "graph/graph.h"
+#include "graph/algorithms/kcore.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//////////////////
+// RSS of the process in KB (Linux only, -1 otherwise)
+
+long status_kb(const string& key) {
+#ifdef __linux__
+	ifstream f("/proc/self/status");
+	string line;
+	while (getline(f, line)) {
+		if (line.compare(0, key.size(), key) == 0) {
+			return std::stol(line.substr(key.size() + 1));
+		}
+	}
+#endif
+	return -1;
+}
+
+//////////////////
+// random sparse graph with locality and skewed degrees, in MTX format (1-based, symmetric)
+
+void write_random_mtx(const string& filename, int NV, int avgDeg) {
+
+	std::mt19937 gen(17);
+	std::uniform_int_distribution<int> vertex(0, NV - 1);
+	std::uniform_int_distribution<int> hub(0, 99);
+	std::uniform_int_distribution<int> offset(1, 64);
+
+	//80% of the edges are local (offset <= 64), 15% uniform, 5% go to 100 hubs
+	const long long NE = static_cast<long long>(NV) * avgDeg / 2;
+	FILE* f = std::fopen(filename.c_str(), "w");
+	if (f == nullptr) {
+		cerr << "unable to write " << filename << endl;
+		std::exit(EXIT_FAILURE);
+	}
+
+	vector<pair<int, int>> edges;
+	edges.reserve(NE);
+	for (long long e = 0; e < NE; ++e) {
+		const int v = vertex(gen);
+		const int kind = static_cast<int>(gen() % 20);
+		const int w = (kind == 0) ? hub(gen) : (kind < 4) ? vertex(gen) : std::min(v + offset(gen), NV - 1);
+		if (v != w) { edges.emplace_back(std::max(v, w) + 1, std::min(v, w) + 1); }
+	}
+
+	std::fprintf(f, "%%%%MatrixMarket matrix coordinate pattern symmetric\n");
+	std::fprintf(f, "%d %d %zu\n", NV, NV, edges.size());
+	for (const auto& e : edges) { std::fprintf(f, "%d %d\n", e.first, e.second); }
+	std::fclose(f);
+}
+
+//////////////////
+// ego-network of v (later neighbors in the ordering rank) as a graph with bitset rows
+
+int ego_subgraph(const csr_ugraph& g, ugraph& ego, int v, const VertexList& rank, VertexList& lv) {
+	return g.create_ego_subgraph(ego, v, rank, lv);
+}
+
+int ego_subgraph(const sparse_ugraph& g, sparse_ugraph& ego, int v, const VertexList& rank, VertexList& lv) {
+	lv.clear();
+	for (int w : bits(g.neighbors(v))) {
+		if (rank[w] > rank[v]) { lv.push_back(w); }
+	}
+	return lv.empty() ? -1 : g.create_subgraph(ego, lv);
+}
+
+template<class GraphT, class EgoT>
+void bench(const string& filename, const string& type, int nRep) {
+
+	volatile long long sink = 0;
+
+	//load
+	const long rss0 = status_kb("VmRSS:");
+	PrecisionTimer pt;
+	pt.wall_tic();
+	GraphT g;
+	if (g.read_mtx(filename) == -1) {
+		cerr << "unable to read " << filename << endl;
+		std::exit(EXIT_FAILURE);
+	}
+	const double t_load = 1.0e3 * pt.wall_toc();
+	const long rss1 = status_kb("VmRSS:");
+	const int NV = g.num_vertices();
+
+	const double t_scan = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) {
+			for (int w : bits(g.neighbors(v))) { sum += w; }
+		}
+		sink = sink + sum;
+	});
+
+	const double t_edge = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		std::mt19937 gen(31);
+		std::uniform_int_distribution<int> vertex(0, NV - 1);
+		long long sum = 0;
+		for (int i = 0; i < 10000000; ++i) {
+			const int v = vertex(gen);
+			sum += g.is_edge(v, std::min(v + 1 + static_cast<int>(gen() % 64), NV - 1));		//mostly local pairs
+		}
+		sink = sink + sum;
+	});
+
+	VertexList rank(NV);
+	int kmax = 0;
+	const double t_kcore = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		KCore<GraphT> kc(g);
+		kc.find_kcore();
+		kmax = kc.max_core_number();
+		const VertexList& ord = kc.kcore_ordering();
+		for (int i = 0; i < NV; ++i) { rank[ord[i]] = i; }
+	});
+
+	long long nEgo = 0;
+	const double t_ego = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		EgoT ego;
+		VertexList lv;
+		long long sum = 0;
+		nEgo = 0;
+		for (int v = 0; v < NV; ++v) {
+			if (ego_subgraph(g, ego, v, rank, lv) == 0) {
+				sum += ego.num_edges(false);
+				++nEgo;
+			}
+		}
+		sink = sink + sum;
+	});
+
+	cout << left << fixed << setprecision(2) << setw(14) << type
+		<< setw(10) << t_load << setw(10) << (rss1 - rss0) / 1024.0 << setw(10) << t_scan << setw(10) << t_edge
+		<< setw(10) << t_kcore << setw(10) << t_ego << "[|E|:" << g.num_edges() << " k:" << kmax << " egos:" << nEgo << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	string filename;
+	int NV = 2000000, AVG_DEG = 6, NREP = 3;
+	bool tmp_file = true;
+
+	if (argc == 2 || argc == 3) {
+		if (string(argv[1]).find(".mtx") != string::npos) {
+			filename = argv[1];
+			tmp_file = false;
+			if (argc == 3) { NREP = std::stoi(argv[2]); }
+		}
+		else if (argc == 3) {
+			NV = std::stoi(argv[1]);
+			AVG_DEG = std::stoi(argv[2]);
+		}
+		else {
+			NREP = std::stoi(argv[1]);
+		}
+	}
+	else if (argc == 4) {
+		NV = std::stoi(argv[1]);
+		AVG_DEG = std::stoi(argv[2]);
+		NREP = std::stoi(argv[3]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_csr_graph [<file.mtx> | <number of vertices> <average degree>] [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	if (tmp_file) {
+		filename = "bench_csr_graph_tmp.mtx";
+		write_random_mtx(filename, NV, AVG_DEG);
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+	cout << left << setw(14) << "type" << setw(10) << "load" << setw(10) << "RSS(MB)" << setw(10) << "scan"
+		<< setw(10) << "is_edge" << setw(10) << "kcore" << setw(10) << "ego" << endl;
+
+	//CSR first: its arrays are returned to the OS when released, before the sparse graph is loaded
+	bench<csr_ugraph, ugraph>(filename, "csr_ugraph", NREP);
+	bench<sparse_ugraph, sparse_ugraph>(filename, "sparse_ugraph", NREP);
+
+	if (tmp_file) { std::remove(filename.c_str()); }
+}
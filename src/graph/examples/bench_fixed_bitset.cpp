@@ -0,0 +1,97 @@
+/**
+* @file bench_fixed_bitset.cpp
+* @brief Benchmark of undirected graphs with FixedBitset<256> rows (inline storage, no vptr)
+*		 against the ugraph type (BBScan rows) on the brock200 DIMACS instances
+* @details created 17/10/2026
+* @details usage: bench_fixed_bitset [<number of repetitions>]
+* @details workloads (time per repetition in ms):
+*			- read: reading the DIMACS file
+*			- kcore: KCore::find_kcore()
+*			- deg: degree of every vertex in every neighborhood, i.e. |N(v) & N(w)| for all edges (v, w)
+*			- clq: greedy clique from every vertex (AND + bitscanning of the candidate set)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "graph/algorithms/kcore.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+using ugraph_fixed = Ugraph<FixedBitset<256>>;
+
+template<class GraphT>
+void bench(const string& filename, const string& type, int nRep) {
+
+	using bitset_type = typename GraphT::bitset_type;
+	volatile int sink = 0;
+
+	GraphT g;
+	double t_read = 1.0e3 * wall_time_per_rep(1, [&]() { g.reset(filename); });
+	const int NV = g.num_vertices();
+
+	double t_kcore = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		KCore<GraphT> kc(g);
+		kc.find_kcore();
+		sink = sink + kc.max_core_number();
+	});
+
+	double t_deg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		int ndeg = 0;
+		for (int v = 0; v < NV; ++v) {
+			for (int w = v + 1; w < NV; ++w) {
+				if (g.is_edge(v, w)) {
+					ndeg += g.degree(v, g.neighbors(w));
+				}
+			}
+		}
+		sink = sink + ndeg;
+	});
+
+	int maxClq = 0;
+	double t_clq = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		bitset_type cand(NV);
+		for (int v = 0; v < NV; ++v) {
+			cand = g.neighbors(v);
+			int size = 1, w = BBObject::noBit;
+			cand.init_scan(BBObject::DESTRUCTIVE);
+			while ((w = cand.next_bit_del()) != BBObject::noBit) {
+				++size;
+				cand &= g.neighbors(w);
+				cand.init_scan(BBObject::DESTRUCTIVE);
+			}
+			maxClq = std::max(maxClq, size);
+		}
+	});
+
+	cout << left << fixed << setprecision(3) << setw(16) << g.name() << setw(10) << type
+		<< setw(10) << t_read << setw(10) << t_kcore << setw(10) << t_deg << setw(10) << t_clq
+		<< "[w:" << maxClq << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 20;
+	if (argc == 2) {
+		NREP = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_fixed_bitset [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+	cout << left << setw(16) << "instance" << setw(10) << "type" << setw(10) << "read"
+		<< setw(10) << "kcore" << setw(10) << "deg" << setw(10) << "clq" << endl;
+
+	const string path = PATH_GRAPH_TESTS_CMAKE_SRC_CODE;
+	for (auto name : { "brock200_1.clq", "brock200_2.clq", "brock200_3.clq", "brock200_4.clq" }) {
+		bench<ugraph>(path + name, "BBScan", NREP);
+		bench<ugraph_fixed>(path + name, "Fixed256", NREP);
+	}
+}
@@ -0,0 +1,102 @@
+/**
+* @file bench_hybrid.cpp
+* @brief Benchmark of undirected graphs with HybridBitset rows (adaptive array / dense / run chunks)
+*		 against the ugraph (BBScan) and sparse_ugraph (BBScanSp) types on the .mtx / .edges instances of src/graph/data
+* @details created 17/10/2026
+* @details usage: bench_hybrid [<number of repetitions> [<graph file> ...]]
+* @details reports the bytes of the adjacency rows (bitblocks / chunk headers and payloads, container headers excluded) and the
+*			time per repetition in ms of the workloads:
+*			- read: reading the file
+*			- kcore: KCore::find_kcore()
+*			- deg: |N(v) & N(w)| for all edges (v, w)
+*			- sort: GraphFastRootSort::new_order(MIN_DEGEN, LAST_TO_FIRST)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//////////////////
+// bytes of a row of the adjacency matrix
+
+std::size_t row_bytes(const BBScan& bb) { return bb.num_blocks() * sizeof(BITBOARD); }
+std::size_t row_bytes(const BBScanSp& bb) { return bb.size() * sizeof(BitsetSp::SparseBlock); }
+std::size_t row_bytes(const HybridBitset& bb) { return bb.num_bytes(); }
+
+template<class GraphT>
+void bench(const string& filename, const string& type, int nRep) {
+
+	volatile int sink = 0;
+
+	GraphT g;
+	double t_read = 1.0e3 * wall_time_per_rep(1, [&]() { g.reset(filename); });
+	const int NV = g.num_vertices();
+
+	std::size_t nBytes = 0;
+	for (int v = 0; v < NV; ++v) {
+		nBytes += row_bytes(g.neighbors(v));
+	}
+
+	double t_kcore = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		KCore<GraphT> kc(g);
+		kc.find_kcore();
+		sink = sink + kc.max_core_number();
+	});
+
+	double t_deg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		int ndeg = 0;
+		for (int v = 0; v < NV; ++v) {
+			for (int w : bits(g.neighbors(v))) {
+				if (w > v) {
+					ndeg += g.degree(v, g.neighbors(w));
+				}
+			}
+		}
+		sink = sink + ndeg;
+	});
+
+	double t_sort = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		GraphFastRootSort<GraphT> gfs(g);
+		auto order = gfs.new_order(GraphFastRootSort<GraphT>::MIN_DEGEN, GraphFastRootSort<GraphT>::LAST_TO_FIRST);
+		sink = sink + order[0];
+	});
+
+	cout << left << fixed << setprecision(3) << setw(32) << g.name() << setw(10) << type
+		<< setw(12) << nBytes / 1.0e3 << setw(10) << t_read << setw(10) << t_kcore << setw(10) << t_deg << setw(10) << t_sort << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 10;
+	vector<string> files;
+	if (argc >= 2) {
+		NREP = std::stoi(argv[1]);
+		files.assign(argv + 2, argv + argc);
+	}
+
+	const string path = PATH_GRAPH_TESTS_CMAKE_SRC_CODE;
+	if (files.empty()) {
+		for (auto name : { "bio-yeast.mtx", "bio-yeast-protein-inter.edges", "bio-MUTAG_g1.edges", "ia-southernwomen.edges" }) {
+			files.push_back(path + name);
+		}
+	}
+
+	cout << "repetitions: " << NREP << "\trow storage (KB), time per repetition (ms)" << endl;
+	cout << left << setw(32) << "instance" << setw(10) << "type" << setw(12) << "rows(KB)" << setw(10) << "read"
+		<< setw(10) << "kcore" << setw(10) << "deg" << setw(10) << "sort" << endl;
+
+	for (const auto& filename : files) {
+		bench<ugraph>(filename, "BBScan", NREP);
+		bench<sparse_ugraph>(filename, "BBScanSp", NREP);
+		bench<hybrid_ugraph>(filename, "Hybrid", NREP);
+	}
+}
@@ -0,0 +1,112 @@
+/**
+* @file bench_packed_ugraph.cpp
+* @brief Benchmark of undirected graphs stored as the upper triangle of the adjacency matrix (packed_ugraph)
+*		 against the full matrix (ugraph)
+* @details created 17/10/2026
+* @details usage: bench_packed_ugraph [<number of repetitions>]
+* @details reports (time per repetition in ms):
+*			- MB: memory of the adjacency matrix
+*			- build: adds the edges of a uniform random graph G(n, p)
+*			- is_edge: 10M random queries
+*			- deg: degrees of all the vertices
+*			- nbrs: neighborhoods of all the vertices (reconstructed in the packed graph) and their popcount
+*			- clq: greedy clique from the first 100 vertices (P &= N(w), w the first vertex of P)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+double matrix_mb(const ugraph& g) { return g.num_vertices() * static_cast<double>(g.num_blocks()) * sizeof(BITBOARD) / (1024 * 1024); }
+double matrix_mb(const packed_ugraph& g) { return g.num_packed_blocks() * static_cast<double>(sizeof(BITBOARD)) / (1024 * 1024); }
+
+template<class GraphT>
+void bench(int NV, double p, const string& type, int nRep) {
+
+	volatile long long sink = 0;
+
+	//uniform random graph G(n, p), same edges for all the types
+	GraphT g(NV);
+	const double t_build = 1.0e3 * wall_time_per_rep(1, [&]() {
+		std::mt19937 gen(17);
+		std::bernoulli_distribution edge(p);
+		for (int v = 0; v < NV - 1; ++v) {
+			for (int w = v + 1; w < NV; ++w) {
+				if (edge(gen)) { g.add_edge(v, w); }
+			}
+		}
+	});
+
+	const double t_edge = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		std::mt19937 gen(31);
+		std::uniform_int_distribution<int> vertex(0, NV - 1);
+		long long sum = 0;
+		for (int i = 0; i < 10000000; ++i) {
+			sum += g.is_edge(vertex(gen), vertex(gen));
+		}
+		sink = sink + sum;
+	});
+
+	const double t_deg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) { sum += g.degree(v); }
+		sink = sink + sum;
+	});
+
+	const double t_nbrs = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) { sum += g.neighbors(v).count(); }
+		sink = sink + sum;
+	});
+
+	int maxClq = 0;
+	const double t_clq = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		BBScan cand(NV);
+		for (int v = 0; v < std::min(NV, 100); ++v) {
+			cand = g.neighbors(v);
+			int size = 1, w = BBObject::noBit;
+			while ((w = cand.lsb()) != BBObject::noBit) {
+				++size;
+				cand &= g.neighbors(w);
+			}
+			maxClq = std::max(maxClq, size);
+		}
+	});
+
+	cout << left << fixed << setprecision(2) << setw(10) << type
+		<< setw(10) << matrix_mb(g) << setw(10) << t_build << setw(10) << t_edge << setw(10) << t_deg
+		<< setw(10) << t_nbrs << setw(10) << t_clq << "[w:" << maxClq << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 3;
+	if (argc == 2) {
+		NREP = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_packed_ugraph [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+
+	struct instance_t { int n; double p; };
+	for (auto inst : { instance_t{ 5000, 0.5 }, instance_t{ 20000, 0.1 }, instance_t{ 40000, 0.02 } }) {
+
+		cout << endl << "|V|: " << inst.n << " p: " << inst.p << endl;
+		cout << left << setw(10) << "type" << setw(10) << "MB" << setw(10) << "build" << setw(10) << "is_edge"
+			<< setw(10) << "deg" << setw(10) << "nbrs" << setw(10) << "clq" << endl;
+
+		bench<ugraph>(inst.n, inst.p, "full", NREP);
+		bench<packed_ugraph>(inst.n, inst.p, "packed", NREP);
+	}
+}
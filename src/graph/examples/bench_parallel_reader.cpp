@@ -0,0 +1,205 @@
+/**
+* @file bench_parallel_reader.cpp
+* @brief Benchmark of the memory-mapped, multi-threaded graph readers (gio::par) against the stream readers
+* @details created 17/10/2026
+* @details usage: bench_parallel_reader [<number of vertices> <average degree>] [<max number of threads>]
+*		   A random sparse graph is written to temporary files in DIMACS, MTX and EDGES formats.
+* @details reports, for each format:
+*			- stream: fstream >> / fscanf loops, one (virtual) add_edge per edge into sparse_ugraph (MMI / EDGES classes,
+*			  and the former Graph::read_dimacs loop for DIMACS)
+*			- sparse_ugraph, csr_ugraph: read_dimacs / read_mtx / read_EDGES (parse and bulk assembly of the rows)
+*			- parse(t): parsing only, with t threads
+*			  (time in ms and throughput in MB/s of the file)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include "graph/graph.h"
+#include "graph/formats/parallel_reader.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+enum format_t { DIMACS = 0, MTX, EDGELIST };
+
+//////////////////
+// random sparse graph with locality (as in bench_csr_graph), 1-based edges v > w
+
+vector<pair<int, int>> random_edges(int NV, int avgDeg) {
+
+	std::mt19937 gen(17);
+	std::uniform_int_distribution<int> vertex(0, NV - 1);
+	std::uniform_int_distribution<int> hub(0, 99);
+	std::uniform_int_distribution<int> offset(1, 64);
+
+	const long long NE = static_cast<long long>(NV) * avgDeg / 2;
+	vector<pair<int, int>> edges;
+	edges.reserve(NE);
+	for (long long e = 0; e < NE; ++e) {
+		const int v = vertex(gen);
+		const int kind = static_cast<int>(gen() % 20);
+		const int w = (kind == 0) ? hub(gen) : (kind < 4) ? vertex(gen) : std::min(v + offset(gen), NV - 1);
+		if (v != w) { edges.emplace_back(std::max(v, w) + 1, std::min(v, w) + 1); }
+	}
+	return edges;
+}
+
+void write_file(const string& filename, format_t fmt, int NV, const vector<pair<int, int>>& edges) {
+
+	FILE* f = std::fopen(filename.c_str(), "w");
+	if (f == nullptr) {
+		cerr << "unable to write " << filename << endl;
+		std::exit(EXIT_FAILURE);
+	}
+
+	switch (fmt) {
+	case DIMACS:
+		std::fprintf(f, "c bench_parallel_reader\np edge %d %zu\n", NV, edges.size());
+		for (const auto& e : edges) { std::fprintf(f, "e %d %d\n", e.first, e.second); }
+		break;
+	case MTX:
+		std::fprintf(f, "%%%%MatrixMarket matrix coordinate pattern symmetric\n%d %d %zu\n", NV, NV, edges.size());
+		for (const auto& e : edges) { std::fprintf(f, "%d %d\n", e.first, e.second); }
+		break;
+	default:
+		std::fprintf(f, "%% bench_parallel_reader\n");
+		for (const auto& e : edges) { std::fprintf(f, "%d %d\n", e.first, e.second); }
+	}
+	std::fclose(f);
+}
+
+//////////////////
+// former stream reader of Graph::read_dimacs (fstream >> tokens, add_edge per edge)
+
+int stream_read_dimacs(const string& filename, sparse_ugraph& g) {
+
+	int n = 0, m = 0, v1 = 0, v2 = 0;
+	fstream f(filename.c_str());
+	if (!f || gio::dimacs::read_dimacs_header(f, n, m) == -1) { return -1; }
+
+	g.reset(n);
+	gio::skip_empty_lines(f);
+	string line; char c;
+	for (int e = 0; e < m; e++) {
+		f >> c;
+		if (c != 'e') { return -1; }
+		f >> v1 >> v2;
+		g.add_edge(v1 - 1, v2 - 1);
+		std::getline(f, line);
+	}
+	return 0;
+}
+
+int stream_read(const string& filename, format_t fmt, sparse_ugraph& g) {
+	switch (fmt) {
+	case DIMACS:
+		return stream_read_dimacs(filename, g);
+	case MTX: {
+		MMI<sparse_ugraph> reader(g);
+		return reader.read(filename);
+	}
+	default: {
+		EDGES<sparse_ugraph> reader(filename, g);
+		return reader.read();
+	}
+	}
+}
+
+template<class GraphT>
+int parallel_read(const string& filename, format_t fmt, GraphT& g) {
+	switch (fmt) {
+	case DIMACS:	return g.read_dimacs(filename);
+	case MTX:		return g.read_mtx(filename);
+	default:		return g.read_EDGES(filename);
+	}
+}
+
+int parse(const string& filename, format_t fmt, gio::par::EdgeList& el, int nThreads) {
+	switch (fmt) {
+	case DIMACS:	return gio::par::parse_dimacs(filename, el, nThreads);
+	case MTX:		return gio::par::parse_mtx(filename, el, nThreads);
+	default:		return gio::par::parse_edges(filename, el, nThreads);
+	}
+}
+
+//////////////////
+// timing of f() (ms), exits if f() fails
+
+template<class Func>
+double time_ms(Func f) {
+	PrecisionTimer pt;
+	pt.wall_tic();
+	if (f() == -1) {
+		cerr << "error reading file" << endl;
+		std::exit(EXIT_FAILURE);
+	}
+	return 1.0e3 * pt.wall_toc();
+}
+
+void report(const string& type, double ms, double MB, size_t NE) {
+	cout << left << fixed << setprecision(2) << setw(16) << type << setw(12) << ms << setw(12) << MB / (ms / 1.0e3)
+		<< "[|E|:" << NE << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NV = 1000000, AVG_DEG = 10;
+	int MAX_THREADS = std::max(1u, std::thread::hardware_concurrency());
+
+	if (argc == 3 || argc == 4) {
+		NV = std::stoi(argv[1]);
+		AVG_DEG = std::stoi(argv[2]);
+		if (argc == 4) { MAX_THREADS = std::stoi(argv[3]); }
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_parallel_reader [<number of vertices> <average degree>] [<max number of threads>]" << endl;
+		return -1;
+	}
+
+	const vector<pair<int, int>> edges = random_edges(NV, AVG_DEG);
+	const char* names[] = { "DIMACS", "MTX", "EDGES" };
+	const char* files[] = { "bench_parallel_reader_tmp.clq", "bench_parallel_reader_tmp.mtx", "bench_parallel_reader_tmp.edges" };
+
+	for (format_t fmt : { DIMACS, MTX, EDGELIST }) {
+		const string filename = files[fmt];
+		write_file(filename, fmt, NV, edges);
+		ifstream in(filename, ios::binary | ios::ate);
+		const double MB = static_cast<double>(in.tellg()) / 1.0e6;
+		in.close();
+
+		cout << names[fmt] << " - " << MB << " MB, |V|:" << NV << endl;
+		cout << left << setw(16) << "type" << setw(12) << "ms" << setw(12) << "MB/s" << endl;
+
+		{
+			sparse_ugraph g;
+			const double ms = time_ms([&]() { return stream_read(filename, fmt, g); });
+			report("stream", ms, MB, g.num_edges());
+		}
+		{
+			sparse_ugraph g;
+			const double ms = time_ms([&]() { return parallel_read(filename, fmt, g); });
+			report("sparse_ugraph", ms, MB, g.num_edges());
+		}
+		{
+			csr_ugraph g;
+			const double ms = time_ms([&]() { return parallel_read(filename, fmt, g); });
+			report("csr_ugraph", ms, MB, g.num_edges());
+		}
+		for (int t = 1; t <= MAX_THREADS; t *= 2) {
+			gio::par::EdgeList el;
+			const double ms = time_ms([&]() { return parse(filename, fmt, el, t); });
+			report("parse(" + std::to_string(t) + ")", ms, MB, el.num_edges());
+		}
+		cout << endl;
+
+		std::remove(filename.c_str());
+	}
+}
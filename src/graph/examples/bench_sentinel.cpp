@@ -0,0 +1,141 @@
+/**
+* @file bench_sentinel.cpp
+* @brief Benchmark of undirected graphs with SentinelBitset rows (watched_ugraph) against the ugraph type (BBScan rows)
+*		 on workloads with shrinking candidate sets
+* @details created 17/10/2026
+* @details usage: bench_sentinel [<number of repetitions>]
+* @details workloads (time per repetition in ms), for the first 500 vertices v with candidate set P = N(v):
+*			- greedy: P &= N(w) for w the first vertex of P, destructive bitscanning, until P is empty
+*			- pc: as greedy, also reads |P| and lsb(P) after each step (e.g. for a bound)
+*			- clq: gfunc::clq::find_clique (block-restricted AND from the bitblock of w onwards)
+*			- maxdeg: gfunc::clq::find_clique_max_deg (|P & N(w)| for all w in P at each step), first 50 vertices
+* @details instances: uniform random graphs G(n, p), and random band graphs (edges only between vertices closer than
+*			a bandwidth, e.g. after a bandwidth-reducing relabeling), where the rows are sparse at the block level
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//copies the adjacency matrix of ug (BBScan rows) to g
+void copy_graph(const ugraph& ug, ugraph& g) { g = ug; }
+
+template<class GraphT>
+void copy_graph(const ugraph& ug, GraphT& g) {
+	using bitset_type = typename GraphT::bitset_type;
+	g.reset(ug.num_vertices());
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		g.neighbors(v) = bitset_type(ug.neighbors(v).cview());
+	}
+}
+
+template<class GraphT>
+void bench(const ugraph& ug, const string& type, int nRep) {
+
+	using bitset_type = typename GraphT::bitset_type;
+	volatile int sink = 0;
+
+	GraphT g;
+	copy_graph(ug, g);
+	const int NV = g.num_vertices();
+	const int NROOT = std::min(NV, 500);
+
+	int maxClq = 0;
+	double t_greedy = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		bitset_type cand(NV);
+		for (int v = 0; v < NROOT; ++v) {
+			cand = g.neighbors(v);
+			int size = 1, w = BBObject::noBit;
+			cand.init_scan(BBObject::DESTRUCTIVE);
+			while ((w = cand.next_bit_del()) != BBObject::noBit) {
+				++size;
+				cand &= g.neighbors(w);
+				cand.init_scan(BBObject::DESTRUCTIVE);
+			}
+			maxClq = std::max(maxClq, size);
+		}
+	});
+
+	double t_pc = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		bitset_type cand(NV);
+		int sum = 0;
+		for (int v = 0; v < NROOT; ++v) {
+			cand = g.neighbors(v);
+			int w = BBObject::noBit;
+			while ((w = cand.lsb()) != BBObject::noBit) {
+				cand.erase_bit(w);
+				cand &= g.neighbors(w);
+				sum += cand.count() + cand.lsb();
+			}
+		}
+		sink = sink + sum;
+	});
+
+	double t_clq = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		vector<int> clq;
+		int sum = 0;
+		for (int v = 0; v < NROOT; ++v) {
+			bitset_type cand(g.neighbors(v));
+			sum += gfunc::clq::find_clique(g, clq, cand);
+		}
+		sink = sink + sum;
+	});
+
+	double t_maxdeg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		vector<int> clq;
+		int sum = 0;
+		for (int v = 0; v < std::min(NROOT, 50); ++v) {
+			sum += gfunc::clq::find_clique_max_deg(g, clq, g.neighbors(v));
+		}
+		sink = sink + sum;
+	});
+
+	cout << left << fixed << setprecision(3) << setw(10) << type
+		<< setw(10) << t_greedy << setw(10) << t_pc << setw(10) << t_clq << setw(10) << t_maxdeg
+		<< "[w:" << maxClq << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 5;
+	if (argc == 2) {
+		NREP = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_sentinel [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+
+	struct instance_t { int n; double p; int band; };
+	for (auto inst : { instance_t{ 5000, 0.5, 5000 }, instance_t{ 20000, 0.1, 20000 },
+					   instance_t{ 20000, 0.5, 1000 }, instance_t{ 50000, 0.3, 2000 } }) {
+
+		//random (band) graph: edges (v, w) with w - v < band, with probability p
+		std::mt19937 gen(17);
+		std::bernoulli_distribution edge(inst.p);
+		ugraph ug(inst.n);
+		for (int v = 0; v < inst.n - 1; ++v) {
+			for (int w = v + 1; w < std::min(inst.n, v + inst.band); ++w) {
+				if (edge(gen)) { ug.add_edge(v, w); }
+			}
+		}
+
+		cout << endl << "|V|: " << inst.n << " p: " << inst.p << " band: " << inst.band << endl;
+		cout << left << setw(10) << "type" << setw(10) << "greedy" << setw(10) << "pc"
+			<< setw(10) << "clq" << setw(10) << "maxdeg" << endl;
+
+		bench<ugraph>(ug, "BBScan", NREP);
+		bench<watched_ugraph>(ug, "Sentinel", NREP);
+	}
+}
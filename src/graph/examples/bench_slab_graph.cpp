@@ -0,0 +1,123 @@
+/**
+* @file bench_slab_graph.cpp
+* @brief Benchmark of undirected graphs with the adjacency matrix in one 64-byte aligned slab (slab_ugraph,
+*		 BitsetMatrix of WideBitset<64> rows) against the ugraph type (std::vector of BBScan rows)
+* @details created 17/10/2026
+* @details usage: bench_slab_graph [<number of repetitions>]
+* @details workloads (time per repetition in ms):
+*			- reset: allocation of an empty graph with |V| vertices
+*			- copy: copy of the graph
+*			- deg: degrees of all the vertices
+*			- tri: |N(v) & N(w)| for all the edges (v, w), v < w (row-to-row access)
+*			- kcore: KCore::find_kcore
+*			- clq: gfunc::clq::find_clique from the first 500 vertices
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "bitscan/bbscan_fused.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+template<class GraphT>
+void bench(const vector<pair<int, int>>& edges, int NV, const string& type, int nRep) {
+
+	using bitset_type = typename GraphT::bitset_type;
+	volatile long long sink = 0;
+
+	GraphT g(NV);
+	for (const auto& e : edges) { g.add_edge(e.first, e.second); }
+
+	const double t_reset = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		GraphT h;
+		h.reset(NV);
+		sink = sink + h.num_vertices();
+	});
+
+	const double t_copy = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		GraphT h(g);
+		sink = sink + h.num_vertices();
+	});
+
+	const double t_deg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) { sum += g.degree(v); }
+		sink = sink + sum;
+	});
+
+	const double t_tri = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) {
+			const auto nv = g.neighbors_view(v);
+			for (int w = g.neighbors(v).next_bit(v); w != BBObject::noBit; w = g.neighbors(v).next_bit(w)) {
+				sum += count_and(nv, g.neighbors_view(w));
+			}
+		}
+		sink = sink + sum;
+	});
+
+	int kmax = 0;
+	const double t_kcore = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		KCore<GraphT> kc(g);
+		kc.find_kcore();
+		kmax = kc.max_core_number();
+	});
+
+	const double t_clq = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		vector<int> clq;
+		int sum = 0;
+		for (int v = 0; v < std::min(NV, 500); ++v) {
+			bitset_type cand(g.neighbors(v));
+			sum += gfunc::clq::find_clique(g, clq, cand);
+		}
+		sink = sink + sum;
+	});
+
+	cout << left << fixed << setprecision(3) << setw(10) << type
+		<< setw(10) << t_reset << setw(10) << t_copy << setw(10) << t_deg << setw(10) << t_tri
+		<< setw(10) << t_kcore << setw(10) << t_clq << "[k:" << kmax << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 3;
+	if (argc == 2) {
+		NREP = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_slab_graph [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+
+	struct instance_t { int n; double p; };
+	for (auto inst : { instance_t{ 2000, 0.5 }, instance_t{ 5000, 0.3 }, instance_t{ 20000, 0.05 } }) {
+
+		//uniform random graph G(n, p)
+		std::mt19937 gen(17);
+		std::bernoulli_distribution edge(inst.p);
+		vector<pair<int, int>> edges;
+		for (int v = 0; v < inst.n - 1; ++v) {
+			for (int w = v + 1; w < inst.n; ++w) {
+				if (edge(gen)) { edges.emplace_back(v, w); }
+			}
+		}
+
+		cout << endl << "|V|: " << inst.n << " p: " << inst.p << endl;
+		cout << left << setw(10) << "type" << setw(10) << "reset" << setw(10) << "copy" << setw(10) << "deg"
+			<< setw(10) << "tri" << setw(10) << "kcore" << setw(10) << "clq" << endl;
+
+		bench<ugraph>(edges, inst.n, "BBScan", NREP);
+		bench<slab_ugraph>(edges, inst.n, "Slab", NREP);
+	}
+}
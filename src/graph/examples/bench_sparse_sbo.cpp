@@ -0,0 +1,166 @@
+/**
+* @file bench_sparse_sbo.cpp
+* @brief Benchmark of large sparse graphs (sparse_ugraph, BBScanSp rows) for the storage of the sparse bitsets
+*		 selected by BITSCAN_SPARSE_INLINE_BLOCKS (bbconfig.h): inline blocks (small-buffer optimization) or std::vector
+* @details created 17/10/2026
+* @details usage: bench_sparse_sbo [<file.mtx> | <number of vertices> <average degree>] [<number of repetitions>]
+*		   Without a file, a random graph with locality (most neighbors closer than 64 positions, as in meshes,
+*		   road networks or graphs after a bandwidth-reducing ordering), a few uniform edges and 100 hubs,
+*		   is written to a temporary .mtx file first.
+* @details reports:
+*			- load: time to read the .mtx file into a sparse_ugraph (ms)
+*			- RSS: resident memory added by the graph (MB, VmRSS, Linux only), bytes per vertex
+*			- inline: fraction of rows whose bitblocks are stored in the object
+*			- scan: bitscanning of all the rows, range-based for (ms per repetition)
+*			- deg: degree of all the vertices (ms per repetition)
+*			To compare the two storages, build with -DBITSCAN_SPARSE_INLINE_BLOCKS=0 (CMake cache variable)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "graph/graph.h"
+#include "bitscan/bbscan_iter.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//////////////////
+// RSS of the process in KB (Linux only, -1 otherwise)
+
+long status_kb(const string& key) {
+#ifdef __linux__
+	ifstream f("/proc/self/status");
+	string line;
+	while (getline(f, line)) {
+		if (line.compare(0, key.size(), key) == 0) {
+			return std::stol(line.substr(key.size() + 1));
+		}
+	}
+#endif
+	return -1;
+}
+
+//////////////////
+// random sparse graph with locality and skewed degrees, in MTX format (1-based, symmetric)
+
+void write_random_mtx(const string& filename, int NV, int avgDeg) {
+
+	std::mt19937 gen(17);
+	std::uniform_int_distribution<int> vertex(0, NV - 1);
+	std::uniform_int_distribution<int> hub(0, 99);
+	std::uniform_int_distribution<int> offset(1, 64);
+
+	//80% of the edges are local (offset <= 64), 15% uniform (neighbors spread over the whole range), 5% go to 100 hubs
+	const long long NE = static_cast<long long>(NV) * avgDeg / 2;
+	vector<pair<int, int>> edges;
+	edges.reserve(NE);
+	for (long long e = 0; e < NE; ++e) {
+		const int v = vertex(gen);
+		const int kind = static_cast<int>(gen() % 20);
+		const int w = (kind == 0) ? hub(gen) : (kind < 4) ? vertex(gen) : std::min(v + offset(gen), NV - 1);
+		if (v != w) { edges.emplace_back(std::max(v, w) + 1, std::min(v, w) + 1); }
+	}
+
+	FILE* f = std::fopen(filename.c_str(), "w");
+	if (f == nullptr) {
+		cerr << "unable to write " << filename << endl;
+		std::exit(EXIT_FAILURE);
+	}
+	std::fprintf(f, "%%%%MatrixMarket matrix coordinate pattern symmetric\n");
+	std::fprintf(f, "%d %d %zu\n", NV, NV, edges.size());
+	for (const auto& e : edges) { std::fprintf(f, "%d %d\n", e.first, e.second); }
+	std::fclose(f);
+}
+
+int main(int argc, char** argv) {
+
+	string filename;
+	int NV = 2000000, AVG_DEG = 6, NREP = 5;
+	bool tmp_file = true;
+
+	if (argc == 2 || argc == 3) {
+		if (string(argv[1]).find(".mtx") != string::npos) {
+			filename = argv[1];
+			tmp_file = false;
+			if (argc == 3) { NREP = std::stoi(argv[2]); }
+		}
+		else if (argc == 3) {
+			NV = std::stoi(argv[1]);
+			AVG_DEG = std::stoi(argv[2]);
+		}
+		else {
+			NREP = std::stoi(argv[1]);
+		}
+	}
+	else if (argc == 4) {
+		NV = std::stoi(argv[1]);
+		AVG_DEG = std::stoi(argv[2]);
+		NREP = std::stoi(argv[3]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_sparse_sbo [<file.mtx> | <number of vertices> <average degree>] [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	if (tmp_file) {
+		filename = "bench_sparse_sbo_tmp.mtx";
+		write_random_mtx(filename, NV, AVG_DEG);
+	}
+
+	cout << "storage: " << (BITSCAN_SPARSE_INLINE_BLOCKS > 0 ? "inline blocks (" : "std::vector (")
+		<< BITSCAN_SPARSE_INLINE_BLOCKS << ")\tsizeof(BBScanSp): " << sizeof(BBScanSp) << " bytes" << endl;
+
+	//load
+	const long rss0 = status_kb("VmRSS:");
+	PrecisionTimer pt;
+	pt.wall_tic();
+	sparse_ugraph g;
+	if (g.read_mtx(filename) == -1) {
+		cerr << "unable to read " << filename << endl;
+		return -1;
+	}
+	const double t_load = 1.0e3 * pt.wall_toc();
+	const long rss1 = status_kb("VmRSS:");
+	NV = g.num_vertices();
+
+	int nInline = 0;
+	for (int v = 0; v < NV; ++v) {
+		if (BITSCAN_SPARSE_INLINE_BLOCKS > 0 &&
+			static_cast<int>(g.neighbors(v).bitset().capacity()) <= BITSCAN_SPARSE_INLINE_BLOCKS) { ++nInline; }
+	}
+
+	//scan
+	volatile long long sink = 0;
+	const double t_scan = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) {
+			for (int w : bits(g.neighbors(v))) { sum += w; }
+		}
+		sink = sink + sum;
+	});
+
+	const double t_deg = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long sum = 0;
+		for (int v = 0; v < NV; ++v) { sum += g.degree(v); }
+		sink = sink + sum;
+	});
+
+	const double mb = (rss1 - rss0) / 1024.0;
+	cout << left << fixed << setprecision(2)
+		<< setw(14) << "|V|" << NV << endl
+		<< setw(14) << "|E|" << g.num_edges() << endl
+		<< setw(14) << "load (ms)" << t_load << endl
+		<< setw(14) << "RSS (MB)" << mb << "\t(" << 1024.0 * 1024.0 * mb / NV << " bytes / vertex)" << endl
+		<< setw(14) << "inline rows" << 100.0 * nInline / NV << " %" << endl
+		<< setw(14) << "scan (ms)" << t_scan << endl
+		<< setw(14) << "deg (ms)" << t_deg << endl;
+
+	if (tmp_file) { std::remove(filename.c_str()); }
+}
@@ -0,0 +1,110 @@
+/**
+* @file bench_sparse_soa.cpp
+* @brief Benchmark of the intersections of sparse neighborhoods: rows of sparse_ugraph (BitsetSp, array-of-structs)
+*		 against the same rows in BitsetSpSoA (structure-of-arrays) on a large random sparse graph
+* @details created 17/10/2026
+* @details usage: bench_sparse_soa [<number of vertices> <number of edges> <number of repetitions>]
+* @details the graph mixes uniform edges and edges to a small set of hubs (skewed neighborhood sizes).
+*		   Workloads (time per repetition in ms):
+*			- deg: |N(v) & N(w)| for all edges (v, w) - Ugraph<BBScanSp>::degree(v, N(w)) / count_and
+*			- disj: is_disjoint(N(v), N(w)) for all edges (v, w)
+*			- and: AND(N(v), N(w), res) for all edges (v, w)
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+int main(int argc, char** argv) {
+
+	int NV = 200000;
+	int NE = 1000000;
+	int NREP = 5;
+	if (argc == 4) {
+		NV = std::stoi(argv[1]);
+		NE = std::stoi(argv[2]);
+		NREP = std::stoi(argv[3]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_sparse_soa [<number of vertices> <number of edges> <number of repetitions>]" << endl;
+		return -1;
+	}
+
+	//random sparse graph - one in four edges goes to one of the NV / 1000 hubs
+	sparse_ugraph g(NV);
+	std::mt19937 gen(12345);
+	std::uniform_int_distribution<int> vertex(0, NV - 1);
+	std::uniform_int_distribution<int> hub(0, std::max(1, NV / 1000) - 1);
+	vector<pair<int, int>> edges;
+	edges.reserve(NE);
+	while (static_cast<int>(edges.size()) < NE) {
+		int v = vertex(gen);
+		int w = (edges.size() % 4 == 0) ? hub(gen) : vertex(gen);
+		if (v == w || g.is_edge(v, w)) { continue; }
+		g.add_edge(v, w);
+		edges.emplace_back(v, w);
+	}
+
+	//same rows in structure-of-arrays layout
+	vector<BitsetSpSoA> rows;
+	rows.reserve(NV);
+	std::size_t memAoS = 0, memSoA = 0;
+	for (int v = 0; v < NV; ++v) {
+		rows.emplace_back(g.neighbors(v));
+		memAoS += g.neighbors(v).size() * sizeof(BitsetSp::SparseBlock);
+		memSoA += rows.back().size() * (sizeof(BitsetSpSoA::index_t) + sizeof(BITBOARD));
+	}
+
+	cout << "vertices: " << NV << "\tedges: " << NE << "\trepetitions: " << NREP << endl;
+	cout << "bitblock storage (MB): BitsetSp " << fixed << setprecision(2) << memAoS / 1.0e6
+		<< "\tBitsetSpSoA " << memSoA / 1.0e6 << endl;
+
+	volatile long long sink = 0;
+	cout << left << setw(14) << "type" << setw(10) << "deg" << setw(10) << "disj" << setw(10) << "and" << " (ms)" << endl;
+
+	//BitsetSp
+	BitsetSp res;
+	double t_deg = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += g.degree(e.first, g.neighbors(e.second)); }
+		sink = sink + n;
+	});
+	double t_disj = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += g.neighbors(e.first).is_disjoint(g.neighbors(e.second)); }
+		sink = sink + n;
+	});
+	double t_and = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += AND(g.neighbors(e.first), g.neighbors(e.second), res).size(); }
+		sink = sink + n;
+	});
+	cout << setw(14) << "BitsetSp" << setprecision(1) << setw(10) << t_deg << setw(10) << t_disj << setw(10) << t_and << endl;
+
+	//BitsetSpSoA
+	BitsetSpSoA resS;
+	t_deg = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += count_and(rows[e.first], rows[e.second]); }
+		sink = sink + n;
+	});
+	t_disj = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += rows[e.first].is_disjoint(rows[e.second]); }
+		sink = sink + n;
+	});
+	t_and = 1.0e3 * wall_time_per_rep(NREP, [&]() {
+		long long n = 0;
+		for (auto& e : edges) { n += AND(rows[e.first], rows[e.second], resS).size(); }
+		sink = sink + n;
+	});
+	cout << setw(14) << "BitsetSpSoA" << setw(10) << t_deg << setw(10) << t_disj << setw(10) << t_and << endl;
+}
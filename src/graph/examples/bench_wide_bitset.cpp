@@ -0,0 +1,141 @@
+/**
+* @file bench_wide_bitset.cpp
+* @brief Benchmark of undirected graphs with WideBitset<W> rows (W = 64, 128, 256, 512 bits per block)
+*		 against the ugraph type (BBScan rows) on large dense random graphs
+* @details created 17/10/2026
+* @details usage: bench_wide_bitset [<number of repetitions>]
+* @details workloads (time per repetition in ms):
+*			- deg: degree of every vertex (full popcount of the rows)
+*			- clq: greedy clique from the first 500 vertices (AND + destructive bitscanning of a shrinking candidate set)
+*			- col: greedy sequential coloring (first color class disjoint with N(v), early exit)
+*			- scan: non-destructive bitscanning of N(v) & S for all v, S a sparse random set (1% of the vertices)
+* @details The early-exit loops of WideBitset use one VPTEST per block when compiled for AVX2 / AVX512F
+*			(e.g. cmake -DCMAKE_CXX_FLAGS=-march=native), a constant-bound loop otherwise.
+* @author pss
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph.h"
+#include "utils/prec_timer.h"
+
+using namespace std;
+using namespace bitgraph;
+
+//copies the adjacency matrix of ug (BBScan rows) to g
+void copy_graph(const ugraph& ug, ugraph& g) { g = ug; }
+
+template<class GraphT>
+void copy_graph(const ugraph& ug, GraphT& g) {
+	using bitset_type = typename GraphT::bitset_type;
+	g.reset(ug.num_vertices());
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		g.neighbors(v) = bitset_type(ug.neighbors(v).cview());
+	}
+}
+
+template<class GraphT>
+void bench(const ugraph& ug, const string& type, int nRep) {
+
+	using bitset_type = typename GraphT::bitset_type;
+	volatile int sink = 0;
+
+	GraphT g;
+	copy_graph(ug, g);
+	const int NV = g.num_vertices();
+
+	double t_deg = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		int ndeg = 0;
+		for (int v = 0; v < NV; ++v) {
+			ndeg += g.degree(v);
+		}
+		sink = sink + ndeg;
+	});
+
+	int maxClq = 0;
+	double t_clq = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		bitset_type cand(NV);
+		for (int v = 0; v < std::min(NV, 500); ++v) {
+			cand = g.neighbors(v);
+			int size = 1, w = BBObject::noBit;
+			cand.init_scan(BBObject::DESTRUCTIVE);
+			while ((w = cand.next_bit_del()) != BBObject::noBit) {
+				++size;
+				cand &= g.neighbors(w);
+				cand.init_scan(BBObject::DESTRUCTIVE);
+			}
+			maxClq = std::max(maxClq, size);
+		}
+	});
+
+	int nCol = 0;
+	double t_col = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		vector<bitset_type> colors;
+		for (int v = 0; v < NV; ++v) {
+			std::size_t k = 0;
+			while (k < colors.size() && !colors[k].is_disjoint(g.neighbors(v))) { ++k; }
+			if (k == colors.size()) { colors.emplace_back(NV); }
+			colors[k].set_bit(v);
+		}
+		nCol = static_cast<int>(colors.size());
+	});
+
+	//sparse set S (the same for all the types)
+	bitset_type S(NV);
+	for (int v = 0; v < NV; v += 100) { S.set_bit(v); }
+
+	double t_scan = 1.0e3 * wall_time_per_rep(nRep, [&]() {
+		bitset_type cand(NV);
+		int sum = 0;
+		for (int v = 0; v < NV; ++v) {
+			AND(g.neighbors(v), S, cand);
+			for (int w = cand.next_bit(BBObject::noBit); w != BBObject::noBit; w = cand.next_bit(w)) {
+				sum += w;
+			}
+		}
+		sink = sink + sum;
+	});
+
+	cout << left << fixed << setprecision(3) << setw(12) << NV << setw(10) << type
+		<< setw(10) << t_deg << setw(10) << t_clq << setw(10) << t_col << setw(10) << t_scan
+		<< "[w:" << maxClq << " col:" << nCol << "]" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int NREP = 5;
+	if (argc == 2) {
+		NREP = std::stoi(argv[1]);
+	}
+	else if (argc != 1) {
+		cerr << "usage: bench_wide_bitset [<number of repetitions>]" << endl;
+		return -1;
+	}
+
+	cout << "repetitions: " << NREP << "\ttime per repetition (ms)" << endl;
+	cout << left << setw(12) << "|V|" << setw(10) << "type" << setw(10) << "deg"
+		<< setw(10) << "clq" << setw(10) << "col" << setw(10) << "scan" << endl;
+
+	for (auto inst : { make_pair(5000, 0.5), make_pair(20000, 0.3) }) {
+
+		//random graph G(n, p)
+		const int NV = inst.first;
+		std::mt19937 gen(17);
+		std::bernoulli_distribution edge(inst.second);
+		ugraph ug(NV);
+		for (int v = 0; v < NV - 1; ++v) {
+			for (int w = v + 1; w < NV; ++w) {
+				if (edge(gen)) { ug.add_edge(v, w); }
+			}
+		}
+
+		bench<ugraph>(ug, "BBScan", NREP);
+		bench<wide_ugraph<64>>(ug, "Wide64", NREP);
+		bench<wide_ugraph<128>>(ug, "Wide128", NREP);
+		bench<wide_ugraph<256>>(ug, "Wide256", NREP);
+		bench<wide_ugraph<512>>(ug, "Wide512", NREP);
+	}
+}
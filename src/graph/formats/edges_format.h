@@ -12,6 +12,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include "graph/graph_types.h"
 
 #ifndef _EDGES_READER_H_
 #define	_EDGES_READER_H_
@@ -106,6 +107,8 @@ namespace bitgraph {
 				g.add_edge(v - 1, w - 1);		//0 based
 			}
 
+			bitgraph::build_graph(g);				//graph types built in batch (CsrUgraph)
+
 			if (loops) {
 				LOG_ERROR("loops found and removed - EDGES<T>::read");
 			}
@@ -184,4 +187,4 @@ namespace bitgraph {
 
 }//end namespace bitgraph
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
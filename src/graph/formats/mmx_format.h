@@ -9,6 +9,7 @@
 
 #include "mmio.h"
 #include "utils/logger.h"
+#include "graph/graph_types.h"
 #include <cstdio>
 #include <fstream>
 #include <sstream>
@@ -125,6 +126,7 @@ namespace bitgraph {
 
 			g.add_edge(v - 1, w - 1);		//0 based
 		}
+		bitgraph::build_graph(g);					//graph types built in batch (CsrUgraph)
 
 		//name (remove path)
 		g.set_name(filename);
@@ -166,4 +168,4 @@ namespace bitgraph {
 
 }//end namespace bitgraph
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
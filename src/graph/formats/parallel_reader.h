@@ -0,0 +1,970 @@
+/**
+* @file parallel_reader.h
+* @brief memory-mapped, multi-threaded parsers of the DIMACS, MTX and EDGES graph formats
+* @details created 17/10/2026
+* @details The file is mapped in memory (mmap, POSIX) or read in one block (elsewhere) and the edge section is
+*		   split in line-aligned chunks, parsed in parallel by a hand-written integer scanner. Each thread appends
+*		   the edges of its chunk to its own buffer (EdgeBuffer).
+*
+*		   Graph types assemble their rows in bulk from the parsed edges (e.g. Graph<BitsetT>::add_edges), with
+*		   assemble_rows: the edges of every buffer are partitioned by row ranges, and each thread builds the rows of
+*		   one range - no locks and no per-edge (virtual) add_edge calls.
+*
+* @details Formats:
+*			- DIMACS: 'c' comments, 'p edge <nV> <nE>' header, 'e <v> <w> [<edge-weight>]' edges and
+*			  'n <v> <weight>' (or 'v <v> <weight>') vertex-weights, anywhere after the header
+*			- MTX: coordinate pattern matrices (%%MatrixMarket banner, '%' comments, size line <N> <N> <nz>)
+*			- EDGES: lines <v> <w>, '%' and '#' comments, number of vertices = maximum vertex index
+*		   Vertex indexes are 1-based (0-based for DIMACS if DIMACS_INDEX_0_FORMAT is defined), self-loops are
+*		   discarded and extra tokens at the end of a line are ignored (see the parsers for the differences with
+*		   the stream readers).
+*
+* @details Errors are logged, or kept by an ErrorCapture object in scope (e.g. to probe a file against several formats).
+* @author pss
+**/
+
+#ifndef __PARALLEL_READER_H__
+#define __PARALLEL_READER_H__
+
+#include "utils/logger.h"
+#include "utils/prec_timer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PARALLEL_READER_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bitgraph {
+
+	namespace gio {
+
+		namespace par {
+
+			constexpr std::size_t MIN_CHUNK_BYTES = 1 << 20;			//minimum size of the chunk parsed by a thread
+			constexpr std::size_t MIN_CHUNK_EDGES = 1 << 18;			//minimum number of edges assembled by a thread
+			constexpr int ROW_PART_BITS = 13;							//rows of a partition of assemble_rows (2^13, at least)
+			constexpr int MAX_ROW_PARTS = 1024;							//maximum number of partitions of assemble_rows
+
+			/**
+			* @brief number of threads for a workload of @work units, at least @minWork units per thread
+			* @param nThreads requested number of threads (0 - determined by the workload and the hardware)
+			**/
+			inline int num_threads(std::size_t work, std::size_t minWork, int nThreads = 0) {
+				if (nThreads > 0) { return nThreads; }
+				const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+				return static_cast<int>(std::max<std::size_t>(1, std::min(hw, work / minWork)));
+			}
+
+			/**
+			* @brief runs f(t), t in [0, nThreads), one call per thread (f(0) in the calling thread)
+			* @details: if a thread cannot be created, the remaining calls run in the calling thread
+			**/
+			template<class Func>
+			inline void run_parallel(int nThreads, Func f) {
+				std::vector<std::thread> pool;
+				int t = 1;
+				try {
+					pool.reserve(nThreads - 1);
+					for (; t < nThreads; ++t) { pool.emplace_back(f, t); }
+				}
+				catch (...) {}
+				for (int i = t; i < nThreads; ++i) { f(i); }
+				f(0);
+				for (auto& th : pool) { th.join(); }
+			}
+
+			/**
+			* @brief timing of a parse: bytes, parsing and assembly time (ms) and throughput (MB/s)
+			**/
+			struct ReadStats {
+				std::size_t bytes = 0;
+				std::size_t lines = 0;			//edge lines parsed
+				int nThreads = 1;
+				double parse_ms = 0.0;
+				double build_ms = 0.0;			//set by the readers after the rows are assembled
+
+				double mb_per_s() const {
+					const double ms = parse_ms + build_ms;
+					return (ms > 0.0) ? (bytes / 1.0e6) / (ms / 1.0e3) : 0.0;
+				}
+
+				friend std::ostream& operator<<(std::ostream& o, const ReadStats& s) {
+					o << s.bytes / 1.0e6 << " MB, " << s.lines << " edge lines in " << s.parse_ms + s.build_ms
+						<< " ms (parse " << s.parse_ms << " ms, build " << s.build_ms << " ms) - "
+						<< s.mb_per_s() << " MB/s - " << s.nThreads << " thread(s)";
+					return o;
+				}
+			};
+
+			/**
+			* @brief while in scope, the errors of the parsers run by the calling thread are stored in @msgs
+			*		 instead of logged
+			* @details: used to try a file against several formats, reporting the errors only if all fail
+			**/
+			class ErrorCapture {
+			public:
+				explicit ErrorCapture(std::vector<std::string>& msgs) : prev_(sink()) { sink() = &msgs; }
+				ErrorCapture(const ErrorCapture&) = delete;
+				ErrorCapture& operator=(const ErrorCapture&) = delete;
+				~ErrorCapture() { sink() = prev_; }
+
+				/**
+				* @brief messages of the innermost ErrorCapture of the calling thread, nullptr if none
+				**/
+				static std::vector<std::string>*& sink() {
+					static thread_local std::vector<std::string>* msgs = nullptr;
+					return msgs;
+				}
+
+			private:
+				std::vector<std::string>* prev_;
+			};
+
+			/**
+			* @brief read-only view of the contents of a file: memory-mapped (POSIX) or copied to a buffer
+			**/
+			class MappedFile {
+			public:
+				MappedFile() = default;
+				explicit MappedFile(const std::string& filename) { open(filename); }
+				MappedFile(const MappedFile&) = delete;
+				MappedFile& operator=(const MappedFile&) = delete;
+				~MappedFile() { close(); }
+
+				/**
+				* @brief maps the file @filename
+				* @returns 0 if correct, -1 if the file could not be opened or mapped
+				**/
+				int open(const std::string& filename) noexcept;
+				void close() noexcept;
+
+				const char* begin()	const { return data_; }
+				const char* end()	const { return data_ + size_; }
+				std::size_t size()	const { return size_; }
+				bool is_open()		const { return open_; }
+
+			private:
+				const char* data_ = nullptr;
+				std::size_t size_ = 0;
+				bool open_ = false;
+				bool mapped_ = false;
+				std::vector<char> buf_;				//contents if the file is not mapped
+			};
+
+			/**
+			* @brief edges of a chunk of the file, parsed by one thread
+			**/
+			struct EdgeBuffer {
+				std::vector<std::pair<int, int>> edges;		//(v, w) 0-based, in file order (self-loops discarded)
+				std::size_t nLoops = 0;
+				std::size_t nSkipped = 0;					//unknown lines skipped before an edge line of the chunk (DIMACS)
+				std::size_t nTail = 0;						//unknown lines skipped after the last edge line of the chunk (DIMACS)
+				int maxv = 0;								//maximum vertex index read (1-based)
+				const char* bad = nullptr;					//first line which could not be parsed
+				const char* skipped = nullptr;				//first unknown line skipped before an edge line
+				const char* tail = nullptr;					//first unknown line skipped after the last edge line
+			};
+
+			/**
+			* @brief edges of a file, one buffer per parsing thread (in file order)
+			**/
+			struct EdgeList {
+				int NV = 0;
+				std::size_t NE = 0;							//number of edges declared in the header (0 if none)
+				std::vector<EdgeBuffer> parts;
+				ReadStats stats;
+
+				std::size_t num_edges() const {
+					std::size_t n = 0;
+					for (const auto& p : parts) { n += p.edges.size(); }
+					return n;
+				}
+
+				std::size_t num_loops() const {
+					std::size_t n = 0;
+					for (const auto& p : parts) { n += p.nLoops; }
+					return n;
+				}
+
+				void clear() { NV = 0; NE = 0; parts.clear(); stats = ReadStats(); }
+			};
+
+			/**
+			* @brief edges and weights of a file (DIMACS)
+			* @details: we[t][i] is the weight of parts[t].edges[i] (if edge_weights is TRUE),
+			*			vw[t] are the vertex-weights (v 0-based, weight) read by thread t
+			**/
+			template<class WeightT>
+			struct WeightedEdgeList : EdgeList {
+				bool edge_weights = false;
+				std::vector<std::vector<WeightT>> we;
+				std::vector<std::vector<std::pair<int, WeightT>>> vw;
+			};
+
+			/**
+			* @brief parses a graph in DIMACS format
+			* @param el output edges, vertex-weights are skipped
+			* @param nThreads number of threads (0 - determined by the size of the file)
+			* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+			* @details: differences with the former stream reader (Graph<BitsetT>::read_dimacs):
+			*			- every 'e' line of the file is read, not only the number of edges declared in the header
+			*			  (el.NE). A warning is logged if both numbers differ
+			*			- 'c' comments and empty lines may appear anywhere. Unknown lines are skipped instead of failing,
+			*			  with a warning if they appear among the edges and silently (debug log) if they only follow
+			*			  the last edge line (e.g. the trailing "END" of some benchmark files)
+			*			- extra tokens after 'e <v> <w>' are ignored (edge-weights, unless read by the weighted parser)
+			*			- self-loops 'e <v> <v>' are dropped and counted in el.num_loops()
+			*			- vertex indexes out of range [1, nV] are an error
+			**/
+			inline int parse_dimacs(const std::string& filename, EdgeList& el, int nThreads = 0) noexcept;
+
+			/**
+			* @brief parses a weighted graph in DIMACS format
+			* @param el output edges and vertex-weights
+			* @param edge_weights if TRUE, edge-weights are read if the first edge line has 4 tokens (e <v> <w> <weight>)
+			* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+			**/
+			template<class WeightT>
+			inline int parse_dimacs(const std::string& filename, WeightedEdgeList<WeightT>& el, bool edge_weights,
+									int nThreads = 0) noexcept;
+
+			/**
+			* @brief parses a graph in Matrix Market format (coordinate pattern matrices)
+			* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+			**/
+			inline int parse_mtx(const std::string& filename, EdgeList& el, int nThreads = 0) noexcept;
+
+			/**
+			* @brief parses a graph in list of edges format
+			* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+			* @details: differences with the stream reader (EDGES<T>::read):
+			*			- '%' and '#' comments may appear anywhere, not only before the edges
+			*			- extra tokens after <v> <w> are ignored (e.g. edge-weights)
+			*			- self-loops are dropped with a warning (counted in el.num_loops()), instead of an error message
+			*			- a file without edges is an error
+			**/
+			inline int parse_edges(const std::string& filename, EdgeList& el, int nThreads = 0) noexcept;
+
+			/**
+			* @brief assembles the rows of a graph with NV vertices from the parsed edges
+			* @param undirected if TRUE, each edge (v, w) is added to the rows of v and w, else only to the row of v
+			* @param f row builder f(v, first, last), [first, last) neighbors of v in the parsed edges,
+			*		  called concurrently for different rows
+			* @param nThreads number of threads (0 - determined by the number of edges)
+			* @param sorted if TRUE f is called once per non-empty row, with its neighbors sorted and without duplicates,
+			*		 else once per arc (e.g. for dense rows, which need no order)
+			* @details: the edges of every buffer are partitioned by ranges of rows, then each thread builds the rows of
+			*			its ranges - sorted by row (counting sort) if required. With one thread and no order, the
+			*			buffers are read directly
+			**/
+			template<class RowFn>
+			inline void assemble_rows(const EdgeList& el, int NV, bool undirected, RowFn f, int nThreads = 0, bool sorted = true);
+
+		}//end namespace par
+
+	}//end namespace gio
+
+}//end namespace bitgraph
+
+////////////////////////////////////
+// Necessary implementation of template methods in header file
+
+namespace bitgraph {
+
+	namespace gio {
+
+		namespace par {
+
+			namespace _impl {
+
+				/**
+				* @brief logs an error, or stores it if an ErrorCapture is in scope
+				**/
+				template<typename... T>
+				inline void report_error(const T&... args) {
+					std::vector<std::string>* msgs = ErrorCapture::sink();
+					if (msgs == nullptr) {
+						LOGG_ERROR(args...);
+						return;
+					}
+					std::ostringstream o;
+					using expand = int[];
+					(void)expand { 0, ((void)(o << args), 0)... };
+					msgs->push_back(o.str());
+				}
+
+				inline bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+				inline bool is_digit(char c) { return static_cast<unsigned>(c - '0') <= 9u; }
+
+				inline const char* skip_blanks(const char* p, const char* end) {
+					while (p < end && is_blank(*p)) { ++p; }
+					return p;
+				}
+
+				/**
+				* @brief first position of the next line (end if there is none)
+				**/
+				inline const char* next_line(const char* p, const char* end) {
+					if (p >= end) { return end; }
+					const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+					return (nl == nullptr) ? end : nl + 1;
+				}
+
+				/**
+				* @brief scans a (signed) integer after optional blanks, advances p
+				* @returns FALSE if there is no integer at p or it does not fit in an int
+				**/
+				inline bool scan_int(const char*& p, const char* end, int& val) {
+					p = skip_blanks(p, end);
+					bool neg = false;
+					if (p < end && (*p == '-' || *p == '+')) { neg = (*p == '-'); ++p; }
+					if (p == end || !is_digit(*p)) { return false; }
+
+					long long x = 0;
+					do {
+						x = 10 * x + (*p - '0');
+						if (x > INT_MAX) { return false; }
+						++p;
+					} while (p < end && is_digit(*p));
+
+					val = static_cast<int>(neg ? -x : x);
+					return true;
+				}
+
+				/**
+				* @brief scans a weight after optional blanks, advances p
+				* @details: integral weights are read as integers (as std::istream would, stops at '.'),
+				*			floating point weights by strtod on a copy of the token
+				**/
+				inline bool scan_weight(const char*& p, const char* end, int& val) { return scan_int(p, end, val); }
+
+				inline bool scan_weight(const char*& p, const char* end, double& val) {
+					p = skip_blanks(p, end);
+					const char* q = p;
+					while (q < end && !is_blank(*q) && *q != '\n') { ++q; }
+					char tok[64];
+					const std::size_t len = static_cast<std::size_t>(q - p);
+					if (len == 0 || len >= sizeof(tok)) { return false; }
+					std::memcpy(tok, p, len);
+					tok[len] = '\0';
+					char* last = nullptr;
+					val = std::strtod(tok, &last);
+					if (last == tok) { return false; }
+					p += (last - tok);
+					return true;
+				}
+
+				/**
+				* @brief number of whitespace-separated tokens in the line at p
+				**/
+				inline int number_of_tokens(const char* p, const char* end) {
+					int n = 0;
+					while (true) {
+						p = skip_blanks(p, end);
+						if (p == end || *p == '\n') { return n; }
+						++n;
+						while (p < end && !is_blank(*p) && *p != '\n') { ++p; }
+					}
+				}
+
+				/**
+				* @brief next token of the line at p in lower case, advances p
+				**/
+				inline std::string next_token(const char*& p, const char* end) {
+					p = skip_blanks(p, end);
+					std::string tok;
+					while (p < end && !is_blank(*p) && *p != '\n') {
+						tok += static_cast<char>(std::tolower(static_cast<unsigned char>(*p++)));
+					}
+					return tok;
+				}
+
+				/**
+				* @brief line of text at p (for error messages)
+				**/
+				inline std::string line_at(const char* p, const char* end) {
+					const char* q = p;
+					while (q < end && *q != '\n' && *q != '\r' && q - p < 80) { ++q; }
+					return std::string(p, q);
+				}
+
+				/**
+				* @brief splits [first, last) in n line-aligned chunks, chunk t is [cut[t], cut[t + 1])
+				**/
+				inline std::vector<const char*> split_lines(const char* first, const char* last, int n) {
+					std::vector<const char*> cut(n + 1, last);
+					cut[0] = first;
+					const std::size_t len = static_cast<std::size_t>(last - first);
+					for (int t = 1; t < n; ++t) {
+						const char* p = first + len / n * t;
+						if (p < cut[t - 1]) { p = cut[t - 1]; }
+						if (p > first && p[-1] != '\n') { p = next_line(p, last); }
+						cut[t] = p;
+					}
+					return cut;
+				}
+
+				/**
+				* @brief parses the chunks of the edge section [first, last) in parallel
+				* @param parse_line parse_line(t, p, end) parses the line starting at the first non-blank character p
+				*		 (not empty) for thread t, returns FALSE if it could not be parsed
+				* @returns 0 if correct, -1 if a line could not be parsed (reported) or memory could not be allocated
+				**/
+				template<class LineFn>
+				inline int parse_chunks(const std::string& filename, const char* first, const char* last,
+										EdgeList& el, int nThreads, LineFn parse_line) {
+
+					const int T = num_threads(static_cast<std::size_t>(last - first), MIN_CHUNK_BYTES, nThreads);
+					const std::vector<const char*> cut = split_lines(first, last, T);
+					el.parts.assign(T, EdgeBuffer());
+					el.stats.nThreads = T;
+					std::vector<char> failed(T, 0);
+
+					run_parallel(T, [&](int t) {
+						EdgeBuffer& eb = el.parts[t];
+						try {
+							eb.edges.reserve(static_cast<std::size_t>(cut[t + 1] - cut[t]) / 8);
+							for (const char* p = cut[t]; p < cut[t + 1]; p = next_line(p, cut[t + 1])) {
+								const char* q = skip_blanks(p, cut[t + 1]);
+								if (q == cut[t + 1] || *q == '\n') { continue; }				//empty line
+								if (!parse_line(t, q, cut[t + 1])) { eb.bad = p; break; }
+							}
+						}
+						catch (...) { failed[t] = 1; }
+					});
+
+					for (int t = 0; t < T; ++t) {
+						if (failed[t]) {
+							report_error(filename, ": out of memory - gio::par::parse_chunks");
+							return -1;
+						}
+						if (el.parts[t].bad != nullptr) {
+							report_error(filename, ": bad line \"", line_at(el.parts[t].bad, last), "\" - gio::par::parse_chunks");
+							return -1;
+						}
+					}
+					return 0;
+				}
+
+				/**
+				* @brief parses the header of a DIMACS file (comments, p edge <nV> <nE>)
+				* @returns the first position after the header line, nullptr in case of error
+				**/
+				inline const char* parse_dimacs_header(const std::string& filename, const MappedFile& mf, int& n, std::size_t& m) {
+					const char* end = mf.end();
+					for (const char* p = mf.begin(); p < end; p = next_line(p, end)) {
+						const char* q = skip_blanks(p, end);
+						if (q == end || *q == '\n' || *q == 'c') { continue; }
+						if (*q != 'p') {
+							report_error(filename, ": bad DIMACS protocol, first character of new line is: ", *q,
+										" - gio::par::parse_dimacs_header");
+							return nullptr;
+						}
+
+						++q;
+						const std::string type = next_token(q, end);
+						int nE = 0;
+						if (type != "edge" || !scan_int(q, end, n) || !scan_int(q, end, nE) || n < 0 || nE < 0) {
+							report_error(filename, ": bad DIMACS header found: expecting 'p edge <nV> <nE>' - gio::par::parse_dimacs_header");
+							return nullptr;
+						}
+						m = static_cast<std::size_t>(nE);
+						return next_line(q, end);
+					}
+					report_error(filename, ": DIMACS header not found - gio::par::parse_dimacs_header");
+					return nullptr;
+				}
+
+				/**
+				* @brief parses a DIMACS file, with vertex-weights and edge-weights if @we and @vw are not null
+				**/
+				template<class WeightT>
+				inline int parse_dimacs(const std::string& filename, EdgeList& el, std::vector<std::vector<WeightT>>* we,
+										std::vector<std::vector<std::pair<int, WeightT>>>* vw, bool& edge_weights, int nThreads) noexcept {
+
+					el.clear();
+					PrecisionTimer pt;
+					pt.wall_tic();
+
+					MappedFile mf;
+					if (mf.open(filename) == -1) {
+						report_error(filename, ": file could not be opened reading DIMACS format - gio::par::parse_dimacs");
+						return -1;
+					}
+
+					int n = 0;
+					const char* body = parse_dimacs_header(filename, mf, n, el.NE);
+					if (body == nullptr) { return -1; }
+					el.NV = n;
+
+					//edge-weights: determined by the number of tokens of the first edge line
+					if (edge_weights) {
+						const char* p = body;
+						for (; p < mf.end(); p = next_line(p, mf.end())) {
+							const char* q = skip_blanks(p, mf.end());
+							if (q < mf.end() && *q == 'e') { break; }
+						}
+						const int nw = (p < mf.end()) ? number_of_tokens(p, mf.end()) : 3;
+						if (nw != 3 && nw != 4) {
+							report_error(filename, ": wrong edge format reading the first edge line - gio::par::parse_dimacs");
+							return -1;
+						}
+						edge_weights = (nw == 4);
+					}
+
+#ifdef DIMACS_INDEX_0_FORMAT
+					const int base = 0;
+#else
+					const int base = 1;
+#endif
+
+					const bool weights = (we != nullptr);
+					const bool eweights = edge_weights;
+					const int T = num_threads(static_cast<std::size_t>(mf.end() - body), MIN_CHUNK_BYTES, nThreads);
+					if (weights) {
+						we->assign(T, std::vector<WeightT>());
+						vw->assign(T, std::vector<std::pair<int, WeightT>>());
+					}
+
+					try {
+						const int ret = parse_chunks(filename, body, mf.end(), el, T,
+							[&](int t, const char* p, const char* end) -> bool {
+								EdgeBuffer& eb = el.parts[t];
+								int v = 0, w = 0;
+								switch (*p) {
+								case 'e':
+									if (eb.nTail) {							//unknown lines among the edges
+										if (eb.skipped == nullptr) { eb.skipped = eb.tail; }
+										eb.nSkipped += eb.nTail;
+										eb.nTail = 0;
+									}
+									++p;
+									if (!scan_int(p, end, v) || !scan_int(p, end, w)) { return false; }
+									v -= base; w -= base;
+									if (v < 0 || v >= n || w < 0 || w >= n) { return false; }
+									if (v == w) { ++eb.nLoops; return true; }
+									eb.edges.emplace_back(v, w);
+									if (eweights) {
+										WeightT wt{};
+										if (!scan_weight(p, end, wt)) { return false; }
+										(*we)[t].push_back(wt);
+									}
+									return true;
+								case 'n':
+								case 'v':											// 'v' format used by Zavalnij in evil_W benchmark
+									if (weights) {
+										++p;
+										WeightT wt{};
+										if (!scan_int(p, end, v) || !scan_weight(p, end, wt)) { return false; }
+										v -= base;
+										if (v < 0 || v >= n) { return false; }
+										(*vw)[t].emplace_back(v, wt);
+									}
+									return true;
+								case 'c':
+									return true;
+								default:									//e.g. trailing text after the edges
+									if (eb.nTail++ == 0) { eb.tail = p; }
+									return true;
+								}
+							});
+						if (ret == -1) { return -1; }
+					}
+					catch (...) {
+						report_error(filename, ": out of memory - gio::par::parse_dimacs");
+						return -1;
+					}
+
+					el.stats.bytes = mf.size();
+					el.stats.lines = el.num_edges() + el.num_loops();
+					el.stats.parse_ms = 1.0e3 * pt.wall_toc();
+
+					//unknown lines: among the edges (warning) or after the last edge line of the file (debug)
+					std::size_t nSkipped = 0, nTail = 0;
+					const char* skipped = nullptr;
+					const char* tail = nullptr;
+					for (const auto& eb : el.parts) {
+						const bool edge_lines = !eb.edges.empty() || eb.nLoops || eb.nSkipped;
+						if (edge_lines && nTail) {						//the tail of the former chunks is followed by edges
+							if (skipped == nullptr) { skipped = tail; }
+							nSkipped += nTail;
+							nTail = 0;
+							tail = nullptr;
+						}
+						if (skipped == nullptr) { skipped = eb.skipped; }
+						nSkipped += eb.nSkipped;
+						if (tail == nullptr) { tail = eb.tail; }
+						nTail += eb.nTail;
+					}
+					if (nSkipped) {
+						LOGG_WARNING(filename, ": ", nSkipped, " unknown lines skipped, first \"", line_at(skipped, mf.end()),
+									 "\" - gio::par::parse_dimacs");
+					}
+					if (nTail) {
+						LOGG_DEBUG(filename, ": ", nTail, " unknown lines after the edges skipped, first \"", line_at(tail, mf.end()),
+								   "\" - gio::par::parse_dimacs");
+					}
+					if (el.stats.lines != el.NE) {
+						LOGG_WARNING(filename, ": ", el.stats.lines, " edge lines read, ", el.NE,
+									 " declared in the DIMACS header - gio::par::parse_dimacs");
+					}
+					return 0;
+				}
+
+			}//end namespace _impl
+
+			/////////////////////
+			// MappedFile
+
+			inline int MappedFile::open(const std::string& filename) noexcept {
+				close();
+
+#ifdef PARALLEL_READER_MMAP
+				const int fd = ::open(filename.c_str(), O_RDONLY);
+				if (fd == -1) { return -1; }
+
+				struct stat st;
+				if (::fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+					::close(fd);
+					return -1;
+				}
+
+				size_ = static_cast<std::size_t>(st.st_size);
+				if (size_ > 0) {
+					void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+					if (addr == MAP_FAILED) {
+						::close(fd);
+						size_ = 0;
+						return -1;
+					}
+					::madvise(addr, size_, MADV_WILLNEED);
+					data_ = static_cast<const char*>(addr);
+					mapped_ = true;
+				}
+				::close(fd);										//the mapping remains valid
+#else
+				std::ifstream f(filename, std::ios::in | std::ios::binary);
+				if (!f) { return -1; }
+				try {
+					f.seekg(0, std::ios::end);
+					buf_.resize(static_cast<std::size_t>(f.tellg()));
+					f.seekg(0, std::ios::beg);
+					f.read(buf_.data(), buf_.size());
+				}
+				catch (...) { buf_.clear(); return -1; }
+				if (!f) { buf_.clear(); return -1; }
+				data_ = buf_.data();
+				size_ = buf_.size();
+#endif
+				open_ = true;
+				return 0;
+			}
+
+			inline void MappedFile::close() noexcept {
+#ifdef PARALLEL_READER_MMAP
+				if (mapped_) { ::munmap(const_cast<char*>(data_), size_); }
+#endif
+				std::vector<char>().swap(buf_);
+				data_ = nullptr;
+				size_ = 0;
+				open_ = false;
+				mapped_ = false;
+			}
+
+			/////////////////////
+			// parsers
+
+			inline int parse_dimacs(const std::string& filename, EdgeList& el, int nThreads) noexcept {
+				bool edge_weights = false;
+				return _impl::parse_dimacs<int>(filename, el, nullptr, nullptr, edge_weights, nThreads);
+			}
+
+			template<class WeightT>
+			inline int parse_dimacs(const std::string& filename, WeightedEdgeList<WeightT>& el, bool edge_weights,
+									int nThreads) noexcept {
+				el.edge_weights = edge_weights;
+				el.we.clear();
+				el.vw.clear();
+				return _impl::parse_dimacs<WeightT>(filename, el, &el.we, &el.vw, el.edge_weights, nThreads);
+			}
+
+			inline int parse_mtx(const std::string& filename, EdgeList& el, int nThreads) noexcept {
+				using namespace _impl;
+
+				el.clear();
+				PrecisionTimer pt;
+				pt.wall_tic();
+
+				MappedFile mf;
+				if (mf.open(filename) == -1) {
+					report_error(filename, " not found - gio::par::parse_mtx");
+					return -1;
+				}
+				const char* end = mf.end();
+
+				//banner: %%MatrixMarket matrix coordinate pattern <symmetry>
+				const char* p = mf.begin();
+				const std::string banner = next_token(p, end);
+				const std::string object = next_token(p, end);
+				const std::string format = next_token(p, end);
+				const std::string field = next_token(p, end);
+				if (banner != "%%matrixmarket" || object != "matrix") {
+					report_error("Could not process Matrix Market banner - gio::par::parse_mtx");
+					return -1;
+				}
+				if (format != "coordinate" || field != "pattern") {
+					report_error("Sorry, this application does not support Matrix Market type: ", object, " ", format, " ", field,
+							   " - gio::par::parse_mtx");
+					return -1;
+				}
+
+				//size line: <N> <N> <nz>, after comment lines (%) and empty lines
+				int M = 0, N = 0, nz = 0;
+				for (p = next_line(p, end); p < end; p = next_line(p, end)) {
+					const char* q = skip_blanks(p, end);
+					if (q == end || *q == '\n' || *q == '%') { continue; }
+					if (!scan_int(q, end, M) || !scan_int(q, end, N) || !scan_int(q, end, nz) || M < 0 || nz < 0) {
+						report_error("bad size line - gio::par::parse_mtx");
+						return -1;
+					}
+					p = next_line(q, end);
+					break;
+				}
+				if (M != N) {
+					report_error("non-square adjacency matrix - gio::par::parse_mtx");
+					return -1;
+				}
+				el.NV = N;
+				el.NE = static_cast<std::size_t>(nz);
+
+				try {
+					const int ret = parse_chunks(filename, p, end, el, nThreads,
+						[&el, N](int t, const char* q, const char* last) -> bool {
+							EdgeBuffer& eb = el.parts[t];
+							if (*q == '%') { return true; }
+							int v = 0, w = 0;
+							if (!scan_int(q, last, v) || !scan_int(q, last, w)) { return false; }
+							if (v < 1 || v > N || w < 1 || w > N) { return false; }
+							if (v == w) { ++eb.nLoops; return true; }
+							eb.edges.emplace_back(v - 1, w - 1);			//0 based
+							return true;
+						});
+					if (ret == -1) { return -1; }
+				}
+				catch (...) {
+					report_error(filename, ": out of memory - gio::par::parse_mtx");
+					return -1;
+				}
+
+				el.stats.bytes = mf.size();
+				el.stats.lines = el.num_edges() + el.num_loops();
+				el.stats.parse_ms = 1.0e3 * pt.wall_toc();
+
+				if (el.num_loops()) {
+					LOGG_WARNING(filename, ": ", el.num_loops(), " self-loops found and removed - gio::par::parse_mtx");
+				}
+				if (el.stats.lines != el.NE) {
+					LOGG_WARNING(filename, ": ", el.stats.lines, " entries read, ", el.NE, " declared - gio::par::parse_mtx");
+				}
+				return 0;
+			}
+
+			inline int parse_edges(const std::string& filename, EdgeList& el, int nThreads) noexcept {
+				using namespace _impl;
+
+				el.clear();
+				PrecisionTimer pt;
+				pt.wall_tic();
+
+				MappedFile mf;
+				if (mf.open(filename) == -1) {
+					report_error(filename, " not opened correctly - gio::par::parse_edges");
+					return -1;
+				}
+
+				//%% is discarded as MTX format
+				const char* first = skip_blanks(mf.begin(), mf.end());
+				if (mf.end() - first >= 2 && first[0] == '%' && first[1] == '%') {
+					report_error(filename, ": header not expected - gio::par::parse_edges");
+					return -1;
+				}
+
+				try {
+					const int ret = parse_chunks(filename, mf.begin(), mf.end(), el, nThreads,
+						[&el](int t, const char* q, const char* last) -> bool {
+							EdgeBuffer& eb = el.parts[t];
+							if (*q == '%' || *q == '#') { return true; }	//comments
+							int v = 0, w = 0;
+							if (!scan_int(q, last, v) || !scan_int(q, last, w)) { return false; }
+							if (v < 1 || w < 1) { return false; }
+							eb.maxv = std::max(eb.maxv, std::max(v, w));
+							if (v == w) { ++eb.nLoops; return true; }
+							eb.edges.emplace_back(v - 1, w - 1);			//0 based
+							return true;
+						});
+					if (ret == -1) { return -1; }
+				}
+				catch (...) {
+					report_error(filename, ": out of memory - gio::par::parse_edges");
+					return -1;
+				}
+
+				for (const auto& eb : el.parts) { el.NV = std::max(el.NV, eb.maxv); }
+				el.stats.bytes = mf.size();
+				el.stats.lines = el.num_edges() + el.num_loops();
+				el.NE = el.stats.lines;
+				el.stats.parse_ms = 1.0e3 * pt.wall_toc();
+
+				if (el.stats.lines == 0) {
+					report_error(filename, ": no edges found - gio::par::parse_edges");
+					return -1;
+				}
+				if (el.num_loops()) {
+					LOGG_WARNING(filename, ": ", el.num_loops(), " self-loops found and removed - gio::par::parse_edges");
+				}
+				return 0;
+			}
+
+			/////////////////////
+			// bulk assembly of rows
+
+			template<class RowFn>
+			inline void assemble_rows(const EdgeList& el, int NV, bool undirected, RowFn f, int nThreads, bool sorted) {
+
+				struct Arc { int v, w; };					//trivial - buckets are not value-initialized
+
+				const std::size_t NE = el.num_edges();
+				if (NV <= 0 || NE == 0) { return; }
+
+				//row partition p is [p << shift, (p + 1) << shift): small enough for its counting sort to run in cache,
+				//and at most MAX_ROW_PARTS partitions (write streams of the scatter)
+				int shift = ROW_PART_BITS;
+				while ((static_cast<long long>(NV - 1) >> shift) >= MAX_ROW_PARTS) { ++shift; }
+				const int P = ((NV - 1) >> shift) + 1;
+				const int T = static_cast<int>(el.parts.size());
+				const std::size_t NA = undirected ? 2 * NE : NE;
+				const int A = std::min(P, num_threads(NA, MIN_CHUNK_EDGES, nThreads));
+
+				if (A == 1 && !sorted) {
+					for (const auto& part : el.parts) {
+						for (const auto& e : part.edges) {
+							f(e.first, &e.second, &e.second + 1);
+							if (undirected) { f(e.second, &e.first, &e.first + 1); }
+						}
+					}
+					return;
+				}
+
+				//I. number of arcs of each buffer in each partition
+				std::vector<std::vector<std::size_t>> pos(T, std::vector<std::size_t>(P, 0));
+				run_parallel(T, [&](int t) {
+					std::vector<std::size_t>& cnt = pos[t];
+					for (const auto& e : el.parts[t].edges) {
+						++cnt[e.first >> shift];
+						if (undirected) { ++cnt[e.second >> shift]; }
+					}
+				});
+
+				//first position of each buffer in each partition
+				std::vector<std::size_t> size(P, 0);
+				for (int p = 0; p < P; ++p) {
+					for (int t = 0; t < T; ++t) {
+						const std::size_t n = pos[t][p];
+						pos[t][p] = size[p];
+						size[p] += n;
+					}
+				}
+
+				std::vector<std::unique_ptr<Arc[]>> bucket(P);
+				for (int p = 0; p < P; ++p) { bucket[p].reset(new Arc[size[p]]); }
+
+				//II. scatter of the arcs to the partitions
+				run_parallel(T, [&](int t) {
+					std::vector<std::size_t>& at = pos[t];
+					for (const auto& e : el.parts[t].edges) {
+						int p = e.first >> shift;
+						bucket[p][at[p]++] = Arc{ e.first, e.second };
+						if (undirected) {
+							p = e.second >> shift;
+							bucket[p][at[p]++] = Arc{ e.second, e.first };
+						}
+					}
+				});
+
+				//III. rows of each partition (counting sort by row), consecutive partitions with a similar number of arcs per thread
+				std::vector<int> firstp(A + 1, P);
+				firstp[0] = 0;
+				{
+					std::size_t acc = 0;
+					int a = 1;
+					for (int p = 0; p < P && a < A; ++p) {
+						acc += size[p];
+						while (a < A && acc >= NA / A * a) { firstp[a++] = p + 1; }
+					}
+				}
+
+				run_parallel(A, [&](int a) {
+					std::vector<std::size_t> off;
+					std::vector<int> col;
+					for (int p = firstp[a]; p < firstp[a + 1]; ++p) {
+						const int first = p << shift;
+						const int n = std::min(NV - first, 1 << shift);
+						const Arc* arcs = bucket[p].get();
+						const std::size_t na = size[p];
+
+						if (!sorted) {
+							for (std::size_t i = 0; i < na; ++i) { f(arcs[i].v, &arcs[i].w, &arcs[i].w + 1); }
+							bucket[p].reset();
+							continue;
+						}
+
+						off.assign(n + 1, 0);
+						for (std::size_t i = 0; i < na; ++i) { ++off[arcs[i].v - first + 1]; }
+						for (int r = 0; r < n; ++r) { off[r + 1] += off[r]; }
+
+						col.resize(na);
+						for (std::size_t i = 0; i < na; ++i) { col[off[arcs[i].v - first]++] = arcs[i].w; }
+						bucket[p].reset();
+
+						//off[r] is now the first position of row r + 1
+						std::size_t b = 0;
+						for (int r = 0; r < n; ++r) {
+							const std::size_t e = off[r];
+							if (b == e) { continue; }
+							int* cb = col.data() + b;
+							int* ce = col.data() + e;
+							if (e - b > 1) {
+								std::sort(cb, ce);
+								ce = std::unique(cb, ce);
+							}
+							f(first + r, static_cast<const int*>(cb), static_cast<const int*>(ce));
+							b = e;
+						}
+					}
+				});
+			}
+
+		}//end namespace par
+
+	}//end namespace gio
+
+}//end namespace bitgraph
+
+#endif
@@ -1,30 +1,54 @@
-/** 
- * @file graph_basic.h
- * @brief  
- *		    
- * @comment:  
- *
- * @author: pss
- * @date 01/02/2026 
- **/
-
-#ifndef __GRAPH_BASIC_H__
-#define __GRAPH_BASIC_H__
-
-#include "simple_sparse_graph.h"
-#include "simple_sparse_ugraph.h"
-
-namespace bitgraph {
-
-    // alias facade graph types
-    using graph = Graph<bitarray>;                              // simple graph 
-    using ugraph = Ugraph<bitarray>;                            // simple undirected graph
-    using sparse_graph = Graph<sparse_bitarray>;                // simple sparse graph
-    using sparse_ugraph = Ugraph<sparse_bitarray>;              // simple sparse undirected graph
-}
-
-///////////////////////////////
-// implementation in header file
-
-
-#endif // __GRAPH_BASIC_H__
\ No newline at end of file
+/** 
+ * @file graph_basic.h
+ * @brief  
+ *		    
+ * @comment:  
+ *
+ * @author: pss
+ * @date 01/02/2026 
+ **/
+
+#ifndef __GRAPH_BASIC_H__
+#define __GRAPH_BASIC_H__
+
+#include "simple_sparse_graph.h"
+#include "simple_sparse_ugraph.h"
+#include "simple_hybrid_ugraph.h"
+#include "simple_summary_ugraph.h"
+#include "simple_counted_ugraph.h"
+#include "simple_sentinel_ugraph.h"
+#include "simple_packed_ugraph.h"
+#include "simple_csr_ugraph.h"
+
+namespace bitgraph {
+
+    // alias facade graph types
+    using graph = Graph<bitarray>;                              // simple graph 
+    using ugraph = Ugraph<bitarray>;                            // simple undirected graph
+    using sparse_graph = Graph<sparse_bitarray>;                // simple sparse graph
+    using sparse_ugraph = Ugraph<sparse_bitarray>;              // simple sparse undirected graph
+    using hybrid_graph = Graph<hybrid_bitarray>;                // simple graph with adaptive (array / dense / run) rows
+    using hybrid_ugraph = Ugraph<hybrid_bitarray>;              // simple undirected graph with adaptive rows
+    using summary_graph = Graph<summary_bitarray>;              // simple graph with summary-indexed dense rows
+    using summary_ugraph = Ugraph<summary_bitarray>;            // simple undirected graph with summary-indexed dense rows
+    using counted_graph = Graph<counted_bitarray>;              // simple graph with O(1) degrees and edge counts
+    using counted_ugraph = Ugraph<counted_bitarray>;            // simple undirected graph with O(1) degrees and edge counts
+    using watched_graph = Graph<watched_bitarray>;              // simple graph with rows restricted to their non-empty bitblocks
+    using watched_ugraph = Ugraph<watched_bitarray>;            // simple undirected graph with rows restricted to their non-empty bitblocks
+    using packed_ugraph = PackedUgraph<bitarray>;               // simple undirected graph, upper triangle of the adjacency matrix only
+    using csr_ugraph = CsrUgraph<bitarray>;                     // large sparse undirected graph, compressed sparse rows (no bitset rows)
+
+    template<int WBITS>
+    using wide_graph = Graph<wide_bitarray<WBITS>>;             // simple graph with dense rows in blocks of WBITS bits
+    template<int WBITS>
+    using wide_ugraph = Ugraph<wide_bitarray<WBITS>>;           // simple undirected graph with dense rows in blocks of WBITS bits
+
+    using slab_graph = wide_graph<64>;                          // simple graph with the rows (BBScan layout, no vptr) in one aligned slab
+    using slab_ugraph = wide_ugraph<64>;                        // simple undirected graph with the rows in one aligned slab
+}
+
+///////////////////////////////
+// implementation in header file
+
+
+#endif // __GRAPH_BASIC_H__
\ No newline at end of file
@@ -21,6 +21,21 @@ namespace bitgraph {
 
 		// @todo add more integal global constants as required
 	};
+
+	namespace _impl {
+		template<class GraphT>
+		inline auto build_graph(GraphT& g, int) -> decltype(g.build(), void()) { g.build(); }
+
+		template<class GraphT>
+		inline void build_graph(GraphT&, long) {}
+	}
+
+	/**
+	* @brief completes a graph created edge by edge with add_edge: calls g.build() for the graph
+	*		 types built in batch (e.g. CsrUgraph), no-op for the others
+	**/
+	template<class GraphT>
+	inline void build_graph(GraphT& g) { _impl::build_graph(g, 0); }
 }
 
 #endif // __GRAPH_TYPES_H__
@@ -0,0 +1,71 @@
+/**
+  * @file simple_counted_graph.h
+  * @brief contains specializations the class Graph for graphs with CountedBitset rows
+  *		   (dense bitsets with a maintained popcount)
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_COUNTED_GRAPH_H__
+#define __SIMPLE_COUNTED_GRAPH_H__
+
+#include "simple_graph.h"
+
+////////////////////////
+//
+// Specializations of class Graph<BitsetT> methods for counted graphs
+// with T = CountedBitset
+//
+// note: this is facade type counted_graph
+// 
+// @details: degree_out(v) is O(1) (cached row count). add_edge / remove_edge only update the number of edges NE_
+//			 if the edge actually changes, so that num_edges() and density() remain exact and O(1) after edits.
+//			 NE_ = 0 still means "unknown" (e.g. after reading a file or remove_edges(v)): the next num_edges() adds
+//			 up the cached row counts in O(|V|), without popcounts.
+// @details: rows modified directly through neighbors(v) require num_edges(false) to resynchronize NE_
+
+namespace bitgraph {
+
+	template<>
+	inline void Graph<CountedBitset>::add_edge(int v, int w)
+	{
+		if (v != w && !adj_[v].is_bit(w)) {
+			adj_[v].set_bit(w);
+			if (NE_ != 0) { ++NE_; }
+		}
+	}
+
+	template<>
+	inline void Graph<CountedBitset>::remove_edge(int v, int w)
+	{
+		if (adj_[v].erase_bit_if(w) && NE_ != 0) {
+			--NE_;
+		}
+	}
+
+	template<>
+	inline Graph<CountedBitset>& Graph<CountedBitset>::create_subgraph(int first_k, Graph<CountedBitset>& newg) const
+	{
+		//assertions
+		if (first_k >= NV_ || first_k <= 0) {
+			LOGG_WARNING("Bad new size ", first_k, " - graph remains unchanged - Graph<CountedBitset>::create_subgraph");
+			return newg;
+		}
+
+		//allocates memory for the new graph
+		newg.reset(first_k);
+
+		//copies the first k elements of the adjacency matrix (row counts are updated by the block operations)
+		const int bbh = WDIV(first_k - 1);
+		for (int i = 0; i < newg.NV_; i++) {
+			newg.adj_[i].assign_block(0, bbh, adj_[i]);
+			newg.adj_[i].erase_bit(first_k, -1);
+		}
+
+		return newg;
+	}
+
+}//end namespace bitgraph
+
+#endif
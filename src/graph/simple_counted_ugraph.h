@@ -0,0 +1,63 @@
+/**
+  * @file simple_counted_ugraph.h
+  * @brief contains specializations the class Ugraph for graphs with CountedBitset rows
+  *		   (dense bitsets with a maintained popcount)
+  *
+  * @created 17/10/2026
+  * @author pss
+  *
+  * This code is part of the GRAPH 1.0 C++ library
+  *
+  **/
+
+#ifndef __SIMPLE_COUNTED_UGRAPH_H__
+#define __SIMPLE_COUNTED_UGRAPH_H__
+
+#include "simple_counted_graph.h"
+#include "simple_ugraph.h"
+
+namespace bitgraph {
+
+	////////////////////////
+	//
+	// Specializations of class Ugraph<T> methods for counted graphs
+	//
+	// @brief T = Ugraph<CountedBitset> with alias facade type counted_bitarray
+	// @details degree(v) is O(1) (cached row count), max_graph_degree() O(|V|). NE_ is only updated
+	//			if the edge actually changes, so that num_edges() and density() remain exact and O(1) after edits
+	//			(same policy as Graph<CountedBitset>, NE_ = 0 means unknown)
+	//
+	////////////////////////
+
+	template<>
+	inline
+	void Ugraph<CountedBitset>::add_edge(int v, int w)
+	{
+		if (v != w && !adj_[v].is_bit(w)) {
+			adj_[v].set_bit(w);
+			adj_[w].set_bit(v);
+			if (NE_ != 0) { ++NE_; }
+		}
+	}
+
+	template<>
+	inline
+	void Ugraph<CountedBitset>::remove_edge(int v, int w)
+	{
+		if (v != w && adj_[v].erase_bit_if(w)) {
+			adj_[w].erase_bit(v);
+			if (NE_ != 0) { --NE_; }
+		}
+	}
+
+	template<>
+	inline
+	int Ugraph<CountedBitset>::degree_up(int v) const
+	{
+		//neighbors after v: the cached row count minus the neighbors up to v
+		return adj_[v].count() - adj_[v].count(0, v);
+	}
+
+}//end namespace bitgraph
+
+#endif
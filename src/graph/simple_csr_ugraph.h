@@ -0,0 +1,755 @@
+/**
+  * @file simple_csr_ugraph.h
+  * @brief class CsrUgraph for large sparse simple undirected graphs (no self loops) in compressed sparse
+  *		   row format: an array of offsets and the sorted neighbors of all the vertices, one after the other
+  *
+  * @details Memory is 8 bytes per vertex and 4 bytes per endpoint (8 bytes per edge), independent of how
+  *			 the neighbors are spread over the bitblocks - sparse_ugraph needs one BBScanSp object and one
+  *			 heap buffer per vertex, and a 16-byte SparseBlock for what is often a single bit.
+  * @details - neighbors(v) is a NeighborSpan (sorted vertices, no copy), with the interface of a row
+  *			   used by the generic code: range-based for, bits(...), bits_and(..., bb), count(), is_bit(w)
+  *			 - is_edge(v, w) is a binary search in the shorter of the two rows, degree(v) is O(1)
+  *			 - bitsets are materialized on demand for the subproblem at hand only: neighbors(v, bb) writes N(v)
+  *			   in a dense or sparse bitset, create_subgraph(...) / create_ego_subgraph(...) build the subgraph
+  *			   induced by a set of vertices (e.g. the later neighbors of a vertex in a degeneracy ordering)
+  *			   as a graph with bitset rows (ugraph, sparse_ugraph...) and local vertex indices
+  * @details The graph is built in batch: add_edge(v, w) stages the edge, and build() sorts and merges the
+  *			 staged edges into the arrays (duplicates are removed). The readers (DIMACS/MTX/EDGES) call build().
+  *			 The queries require a built graph (asserted).
+  * @details Supported by KCore and GraphFastRootSort.
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_CSR_UGRAPH_H__
+#define __SIMPLE_CSR_UGRAPH_H__
+
+#include "simple_ugraph.h"
+#include "graph_traits.h"
+#include "bitscan/bbkernel_sparse.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bitgraph {
+
+	//////////////////
+	//
+	// NeighborSpan
+	//
+	// (sorted neighbors of a vertex of a CsrUgraph - a view, valid while the graph is not rebuilt)
+	//
+	//////////////////
+
+	class NeighborSpan {
+	public:
+		using value_type = int;
+		using iterator = const int*;
+		using const_iterator = const int*;
+
+		NeighborSpan() noexcept : first_(nullptr), last_(nullptr) {}
+		NeighborSpan(const int* first, const int* last) noexcept : first_(first), last_(last) {}
+
+		const int* begin()	const noexcept { return first_; }
+		const int* end()	const noexcept { return last_; }
+		const int* data()	const noexcept { return first_; }
+		int operator[] (int i) const noexcept { return first_[i]; }
+
+		int size()			const noexcept { return static_cast<int>(last_ - first_); }
+		int count()			const noexcept { return size(); }
+		bool is_empty()		const noexcept { return first_ == last_; }
+
+		/**
+		* @brief TRUE if w is a neighbor (binary search)
+		**/
+		bool is_bit(int w)	const noexcept { return std::binary_search(first_, last_, w); }
+
+		/**
+		* @brief neighbors greater than w
+		**/
+		NeighborSpan after(int w) const noexcept { return NeighborSpan(std::upper_bound(first_, last_, w), last_); }
+
+	private:
+		const int* first_;
+		const int* last_;
+	};
+
+	/**
+	* @brief range of the neighbors in increasing order (the span itself), as bits(bb) for a bitset row
+	**/
+	inline
+	NeighborSpan bits(const NeighborSpan& nv) noexcept { return nv; }
+
+	namespace _impl {
+
+		/**
+		* @brief range of the neighbors of a NeighborSpan which are in a bitset (is_bit), in increasing order
+		**/
+		template<class BitsetT>
+		class NeighborSpanAnd {
+		public:
+			class iterator {
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = int;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const int*;
+				using reference = int;
+
+				iterator(const int* p, const int* last, const BitsetT* bb) noexcept : p_(p), last_(last), bb_(bb) { skip(); }
+
+				int operator* ()	const noexcept { return *p_; }
+				iterator& operator++ () noexcept { ++p_; skip(); return *this; }
+				iterator operator++ (int) noexcept { iterator it(*this); ++(*this); return it; }
+				bool operator == (const iterator& rhs) const noexcept { return p_ == rhs.p_; }
+				bool operator != (const iterator& rhs) const noexcept { return p_ != rhs.p_; }
+
+			private:
+				void skip() noexcept { while (p_ != last_ && !bb_->is_bit(*p_)) { ++p_; } }
+
+				const int* p_;
+				const int* last_;
+				const BitsetT* bb_;
+			};
+
+			NeighborSpanAnd(const NeighborSpan& nv, const BitsetT& bb) noexcept : nv_(nv), bb_(&bb) {}
+
+			iterator begin() const noexcept { return iterator(nv_.begin(), nv_.end(), bb_); }
+			iterator end() const noexcept { return iterator(nv_.end(), nv_.end(), bb_); }
+
+		private:
+			NeighborSpan nv_;
+			const BitsetT* bb_;
+		};
+	}
+
+	/**
+	* @brief range of the neighbors in nv which are also in the bitset bb, in increasing order
+	*		 usage: for (int w : bits_and(g.neighbors(v), bb)) {...}
+	* @details: bb must not be modified during the scan
+	**/
+	template<class BitsetT>
+	inline
+	_impl::NeighborSpanAnd<BitsetT> bits_and(const NeighborSpan& nv, const BitsetT& bb) noexcept {
+		return _impl::NeighborSpanAnd<BitsetT>(nv, bb);
+	}
+
+	//////////////////
+	//
+	// Generic class CsrUgraph<BitsetT>
+	//
+	// (BitsetT is the type of the vertex sets and of the materialized neighborhoods - Bitset / BitsetSp hierarchy)
+	//
+	//////////////////
+
+	template<class BitsetT = BBScan>
+	class CsrUgraph {
+
+		static_assert(std::is_base_of<Bitset, BitsetT>::value || std::is_base_of<BitsetSp, BitsetT>::value,
+			"CsrUgraph requires vertex sets of the Bitset or BitsetSp hierarchy");
+
+	public:
+
+		using bitset_type = BitsetT;
+		using VertexBitset = bitset_type;
+
+		/////////////
+		//construction / destruction
+		CsrUgraph() noexcept : NV_(0) { off_.assign(1, 0); }
+		explicit CsrUgraph(std::size_t NV) : CsrUgraph() { reset(NV); }
+		explicit CsrUgraph(std::string filename) : CsrUgraph() { reset(filename); }
+
+		/**
+		* @brief compresses the undirected graph ug
+		**/
+		template<class RowT>
+		explicit CsrUgraph(const Ugraph<RowT>& ug);
+
+		//move and copy semantics allowed
+		CsrUgraph(const CsrUgraph&) = default;
+		CsrUgraph& operator = (const CsrUgraph&) = default;
+		CsrUgraph(CsrUgraph&&) noexcept = default;
+		CsrUgraph& operator = (CsrUgraph&&) noexcept = default;
+
+		~CsrUgraph() = default;
+
+		/////////////
+		// setters and getters
+
+		void set_name(std::string instance);
+		std::string name() const noexcept { return name_; }
+
+		void set_path(std::string path_name) { path_ = std::move(path_name); }
+		std::string path() const noexcept { return path_; }
+
+		std::size_t size() const noexcept { return static_cast<std::size_t>(NV_); }
+		int num_vertices() const noexcept { return NV_; }
+
+		/**
+		* @brief number of edges (lazy is kept for compatibility with Graph, the value is always exact)
+		**/
+		std::size_t num_edges(bool /*lazy*/ = true) const noexcept { assert(is_built()); return adj_.size() / 2; }
+
+		double density(bool lazy = true) const noexcept;
+
+		/**
+		* @brief offsets of the rows: the neighbors of v are targets()[offsets()[v], offsets()[v + 1])
+		**/
+		const std::vector<std::size_t>& offsets() const noexcept { return off_; }
+		const std::vector<int>& targets() const noexcept { return adj_; }
+
+		/**
+		* @brief TRUE if there are no staged edges (see add_edge)
+		**/
+		bool is_built() const noexcept { return staged_.empty(); }
+
+		//////////////////////////
+		// memory allocation
+
+		/**
+		* @brief resets to an empty graph with NV vertices
+		* @details: fast-fail policy - exits if failure
+		**/
+		void reset(std::size_t NV, std::string name = "") noexcept;
+
+		/**
+		* @brief reads the graph from file in dimacs/MTX/Edges formats (in this order)
+		* @details: fast-fail policy - exits if failure. The errors of the formats tried are
+		*			only logged if none of them matches the file
+		**/
+		void reset(std::string filename) noexcept;
+
+		/**
+		* @brief resets to an empty graph with no vertices (deallocates memory)
+		**/
+		void reset() noexcept;
+
+		//////////////
+		// Basic operations
+
+		/**
+		* @brief stages the undirected edge (v, w), self loops are ignored.
+		*		 The edge is part of the graph after build()
+		**/
+		void add_edge(int v, int w);
+
+		/**
+		* @brief merges the staged edges into the graph (duplicate edges are removed)
+		* @details: O(|E| + sum of d(v) log d(v)), counting sort by source vertex, then each row is sorted
+		* @details: fast-fail policy - exits if failure
+		**/
+		void build() noexcept;
+
+		/**
+		* @brief adds in bulk the undirected edges parsed from a file (see gio::par readers) and builds the graph
+		* @details: the edges are staged in one pass, without per-edge calls, then merged by build()
+		**/
+		void add_edges(const gio::par::EdgeList& el);
+
+		bool is_edge(int v, int w) const noexcept {
+			assert(is_built());
+			const NeighborSpan nv = neighbors(v), nw = neighbors(w);
+			return (nv.size() <= nw.size()) ? nv.is_bit(w) : nw.is_bit(v);
+		}
+
+		/**
+		* @brief number of neighbors of v (O(1))
+		**/
+		int degree(int v) const noexcept { return static_cast<int>(off_[v + 1] - off_[v]); }
+
+		/**
+		* @brief number of neighbors of v in the set of vertices bbn (dense or sparse bitset)
+		**/
+		template<class U>
+		int degree(int v, const U& bbn) const;
+
+		/**
+		* @brief number of neighbors of v greater than v
+		**/
+		int degree_up(int v) const noexcept { return neighbors(v).after(v).size(); }
+
+		int max_graph_degree() const noexcept;
+
+		/////////////
+		// neighborhoods
+
+		/**
+		* @brief sorted neighbors of v (a view of the row, no copy)
+		**/
+		NeighborSpan neighbors(int v) const noexcept {
+			assert(is_built());
+			return NeighborSpan(adj_.data() + off_[v], adj_.data() + off_[v + 1]);
+		}
+
+		/**
+		* @brief writes the neighborhood of v in the bitset bb (dense or sparse, with num_vertices() bits)
+		* @returns reference to bb
+		**/
+		template<class U>
+		U& neighbors(int v, U& bb) const;
+
+		/////////////
+		// Induced subgraphs
+		//
+		// (the subgraph is any graph type with reset(n) and add_edge(v, w), vertex i of the subgraph is lv[i])
+
+		/**
+		* @brief Computes the subgraph induced by a set of vertices
+		* @param lv input set of vertices (need not be sorted)
+		* @returns 0 if success, -1 if error
+		* @details: one intersection of sorted lists (merge or galloping) per vertex of lv
+		**/
+		template<class GraphT>
+		int create_subgraph(GraphT& g, const VertexList& lv) const;
+
+		/**
+		* @brief Computes the subgraph induced by the neighborhood of a vertex
+		* @returns 0 if success, -1 if error
+		**/
+		template<class GraphT>
+		int create_subgraph(GraphT& g, int v) const;
+
+		/**
+		* @brief Computes the ego-network of v in a vertex ordering: the subgraph induced by the neighbors
+		*		 of v which come after v (rank[w] > rank[v])
+		* @param rank: position of each vertex in the ordering (e.g. the inverse of KCore::kcore_ordering())
+		* @param lv: output vertices of the subgraph, in increasing order
+		* @returns 0 if success, -1 if the set is empty (g is not changed)
+		**/
+		template<class GraphT>
+		int create_ego_subgraph(GraphT& g, int v, const VertexList& rank, VertexList& lv) const;
+
+		/////////////
+		// I/O
+
+		int read_dimacs(const std::string& filename) noexcept;
+		int read_mtx(const std::string& filename) noexcept;
+		int read_EDGES(const std::string& filename) noexcept;
+
+	private:
+		int load_edges(const std::string& filename, gio::par::EdgeList& el) noexcept;
+
+	public:
+		/**
+		* @brief streams the name, size, number of edges, density and memory of the arrays (MB)
+		**/
+		std::ostream& print_data(bool lazy = true, std::ostream& o = std::cout, bool eofl = true) const;
+
+		//////////////////////////
+		// data members
+	private:
+
+		std::vector<std::size_t> off_;					//offsets of the rows in adj_ (NV_ + 1)
+		std::vector<int> adj_;							//sorted neighbors of each vertex, row after row
+		std::vector<std::pair<int, int>> staged_;		//edges (v, w), v < w, added since the last build()
+
+		int NV_;										//number of vertices
+
+		//names
+		std::string name_;								//name of instance, without path
+		std::string path_;								//path of instance
+	};
+
+	/////////////////////
+	// traits
+
+	template<class GraphT>
+	struct is_csr_graph : std::false_type {};
+
+	template<class BitsetT>
+	struct is_csr_graph<CsrUgraph<BitsetT>> : std::true_type {};
+
+	template<class BitsetT>
+	struct graph_traits<CsrUgraph<BitsetT>> {
+		static constexpr bool is_undirected = true;
+	};
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////
+// Necessary implementation of template methods in header file
+
+namespace bitgraph {
+
+	template<class BitsetT>
+	template<class RowT>
+	inline
+	CsrUgraph<BitsetT>::CsrUgraph(const Ugraph<RowT>& ug) : CsrUgraph() {
+
+		reset(ug.num_vertices(), ug.name());
+
+		//rows are already sorted
+		std::size_t nArcs = 0;
+		for (int v = 0; v < NV_; ++v) {
+			nArcs += ug.neighbors(v).count();
+			off_[v + 1] = nArcs;
+		}
+
+		try {
+			adj_.reserve(nArcs);
+		}
+		catch (const std::bad_alloc& e) {
+			LOG_ERROR("memory for graph not allocated - CsrUgraph<BitsetT>::CsrUgraph");
+			LOG_ERROR("%s", e.what());
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+
+		for (int v = 0; v < NV_; ++v) {
+			for (int w : bits(ug.neighbors(v))) {
+				adj_.push_back(w);
+			}
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::set_name(std::string name) {
+
+		auto found = name.find_last_of("/\\");
+		if (found != string::npos) {
+			name_ = name.substr(found + 1);
+			path_ = name.substr(0, found + 1);  //includes slash
+		}
+		else {
+			name_ = std::move(name);
+			path_.clear();
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::reset() noexcept {
+		off_.assign(1, 0);
+		off_.shrink_to_fit();
+		adj_.clear();
+		adj_.shrink_to_fit();
+		staged_.clear();
+		staged_.shrink_to_fit();
+		name_.clear(), path_.clear();
+		NV_ = 0;
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::reset(std::size_t NV, std::string name) noexcept {
+
+		//check size - must fit in int type
+		if (NV > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+			LOGG_ERROR("Invalid graph size ", NV, " - CsrUgraph<BitsetT>::reset");
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+
+		NV_ = static_cast<int>(NV);
+		adj_.clear();
+		staged_.clear();
+
+		try {
+			off_.assign(NV + 1, 0);
+		}
+		catch (const std::bad_alloc& e) {
+			LOG_ERROR("memory for graph not allocated - CsrUgraph<BitsetT>::reset");
+			LOG_ERROR("%s", e.what());
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+
+		set_name(std::move(name));
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::reset(std::string filename) noexcept {
+		//the errors of the formats tried are only reported if none matches
+		std::vector<std::string> errors;
+		int ret = -1;
+		{
+			gio::par::ErrorCapture capture(errors);
+			if ((ret = read_dimacs(filename)) == -1) {
+				if ((ret = read_mtx(filename)) == -1) {
+					ret = read_EDGES(filename);
+				}
+			}
+		}
+
+		if (ret == -1) {
+			for (const auto& msg : errors) {
+				LOGG_ERROR(msg);
+			}
+			LOGG_ERROR("Unable to read a graph from file ", filename, "- CsrUgraph<BitsetT>::reset");
+			LOG_ERROR("Formats considered: DIMACS / MTX / EDGES");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	double CsrUgraph<BitsetT>::density(bool /*lazy*/) const noexcept {
+
+		BITBOARD max_edges = NV_;
+		max_edges *= (max_edges - 1);
+		return (2 * num_edges() / static_cast<double> (max_edges));
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::add_edge(int v, int w) {
+
+		assert(v >= 0 && v < NV_ && w >= 0 && w < NV_);
+		if (v == w) { return; }
+		if (v > w) { std::swap(v, w); }
+		staged_.emplace_back(v, w);
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::add_edges(const gio::par::EdgeList& el) {
+
+		staged_.reserve(staged_.size() + el.num_edges());
+		for (const auto& part : el.parts) {
+			for (const auto& e : part.edges) {
+				staged_.emplace_back(std::min(e.first, e.second), std::max(e.first, e.second));
+			}
+		}
+		build();
+	}
+
+	template<class BitsetT>
+	inline
+	void CsrUgraph<BitsetT>::build() noexcept {
+
+		if (staged_.empty()) { return; }
+
+		try {
+			//new row sizes in off_[v + 1]: current rows and both endpoints of the staged edges
+			std::vector<std::size_t> off(NV_ + 1, 0);
+			for (int v = 0; v < NV_; ++v) {
+				off[v + 1] = off_[v + 1] - off_[v];
+			}
+			for (const auto& e : staged_) {
+				++off[e.first + 1];
+				++off[e.second + 1];
+			}
+			for (int v = 0; v < NV_; ++v) {
+				off[v + 1] += off[v];
+			}
+
+			//fill (off[v] is the insertion point of row v, and ends as the first position of row v + 1)
+			std::vector<int> adj(off[NV_]);
+			for (int v = 0; v < NV_; ++v) {
+				for (std::size_t i = off_[v]; i < off_[v + 1]; ++i) {
+					adj[off[v]++] = adj_[i];
+				}
+			}
+			for (const auto& e : staged_) {
+				adj[off[e.first]++] = e.second;
+				adj[off[e.second]++] = e.first;
+			}
+			std::vector<std::pair<int, int>>().swap(staged_);
+			std::vector<int>().swap(adj_);
+
+			for (int v = NV_; v > 0; --v) {
+				off[v] = off[v - 1];
+			}
+			off[0] = 0;
+
+			//sorts the rows and removes the duplicates (rows are compacted in place)
+			std::size_t first = 0, wr = 0;
+			for (int v = 0; v < NV_; ++v) {
+				const std::size_t last = off[v + 1];
+				std::sort(adj.begin() + first, adj.begin() + last);
+				auto it = std::unique(adj.begin() + first, adj.begin() + last);
+				off[v] = wr;
+				wr = std::move(adj.begin() + first, it, adj.begin() + wr) - adj.begin();
+				first = last;
+			}
+			off[NV_] = wr;
+			adj.resize(wr);
+			adj.shrink_to_fit();
+
+			off_ = std::move(off);
+			adj_ = std::move(adj);
+		}
+		catch (const std::bad_alloc& e) {
+			LOG_ERROR("memory for graph not allocated - CsrUgraph<BitsetT>::build");
+			LOG_ERROR("%s", e.what());
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	template<class BitsetT>
+	template<class U>
+	inline
+	int CsrUgraph<BitsetT>::degree(int v, const U& bbn) const {
+
+		int deg = 0;
+		for (int w : neighbors(v)) {
+			if (bbn.is_bit(w)) { ++deg; }
+		}
+		return deg;
+	}
+
+	template<class BitsetT>
+	inline
+	int CsrUgraph<BitsetT>::max_graph_degree() const noexcept {
+
+		int max_deg = 0;
+		for (int v = 0; v < NV_; ++v) {
+			max_deg = std::max(max_deg, degree(v));
+		}
+		return max_deg;
+	}
+
+	template<class BitsetT>
+	template<class U>
+	inline
+	U& CsrUgraph<BitsetT>::neighbors(int v, U& bb) const {
+
+		bb.erase_bit();
+		for (int w : neighbors(v)) {
+			bb.set_bit(w);
+		}
+		return bb;
+	}
+
+	template<class BitsetT>
+	template<class GraphT>
+	inline
+	int CsrUgraph<BitsetT>::create_subgraph(GraphT& g, const VertexList& lv) const {
+
+		if (lv.empty()) {
+			LOG_ERROR("empty set found while creating an induced graph - CsrUgraph<BitsetT>::create_subgraph");
+			return -1;
+		}
+
+		const int n = static_cast<int>(lv.size());
+		g.reset(n);
+
+		//vertices of lv in increasing order, with their index in lv
+		std::vector<std::pair<int, int>> sorted(n);
+		for (int i = 0; i < n; ++i) {
+			sorted[i] = std::make_pair(lv[i], i);
+		}
+		std::sort(sorted.begin(), sorted.end());
+
+		//edges (u, w), u < w: the neighbors of u greater than u which are in lv
+		for (int k = 0; k < n - 1; ++k) {
+			const NeighborSpan nu = neighbors(sorted[k].first).after(sorted[k].first);
+			const int i = sorted[k].second;
+			const std::pair<int, int>* ps = sorted.data() + k + 1;
+			bbkernel::for_each_common_block(
+				[&nu](int j) { return nu[j]; }, nu.size(),
+				[ps](int j) { return ps[j].first; }, n - k - 1,
+				[&g, ps, i](int, int j) { g.add_edge(i, ps[j].second); return true; });
+		}
+
+		build_graph(g);
+		return 0;
+	}
+
+	template<class BitsetT>
+	template<class GraphT>
+	inline
+	int CsrUgraph<BitsetT>::create_subgraph(GraphT& g, int v) const {
+
+		const NeighborSpan nv = neighbors(v);
+		return create_subgraph(g, VertexList(nv.begin(), nv.end()));
+	}
+
+	template<class BitsetT>
+	template<class GraphT>
+	inline
+	int CsrUgraph<BitsetT>::create_ego_subgraph(GraphT& g, int v, const VertexList& rank, VertexList& lv) const {
+
+		lv.clear();
+		for (int w : neighbors(v)) {
+			if (rank[w] > rank[v]) { lv.push_back(w); }
+		}
+		if (lv.empty()) { return -1; }
+
+		return create_subgraph(g, lv);
+	}
+
+	template<class BitsetT>
+	inline
+	int CsrUgraph<BitsetT>::read_dimacs(const std::string& filename) noexcept {
+
+		gio::par::EdgeList el;
+		if (gio::par::parse_dimacs(filename, el) == -1) {
+			reset();
+			return -1;
+		}
+
+		return load_edges(filename, el);
+	}
+
+	template<class BitsetT>
+	inline
+	int CsrUgraph<BitsetT>::read_mtx(const std::string& filename) noexcept {
+
+		gio::par::EdgeList el;
+		if (gio::par::parse_mtx(filename, el) == -1) {
+			reset();
+			return -1;
+		}
+
+		return load_edges(filename, el);
+	}
+
+	template<class BitsetT>
+	inline
+	int CsrUgraph<BitsetT>::read_EDGES(const std::string& filename) noexcept {
+
+		gio::par::EdgeList el;
+		if (gio::par::parse_edges(filename, el) == -1) {
+			reset();
+			return -1;
+		}
+
+		return load_edges(filename, el);
+	}
+
+	template<class BitsetT>
+	inline
+	int CsrUgraph<BitsetT>::load_edges(const std::string& filename, gio::par::EdgeList& el) noexcept {
+
+		PrecisionTimer pt;
+		pt.wall_tic();
+		try {
+			reset(el.NV);
+			add_edges(el);
+		}
+		catch (...) {
+			LOGG_ERROR(filename, ": out of memory - CsrUgraph<BitsetT>::load_edges");
+			reset();
+			return -1;
+		}
+		el.stats.build_ms = 1.0e3 * pt.wall_toc();
+
+		set_name(filename);
+		LOGG_DEBUG(filename, ": ", el.stats, " - CsrUgraph<BitsetT>::load_edges");
+		return 0;
+	}
+
+	template<class BitsetT>
+	inline
+	std::ostream& CsrUgraph<BitsetT>::print_data(bool lazy, std::ostream& o, bool eofl) const {
+
+		if (!name_.empty()) { o << name_.c_str() << '\t'; }
+		o << "n:" << NV_ << "\tm:" << num_edges(lazy) << "\tp:" << std::fixed << std::setprecision(3) << density(lazy)
+			<< "\tcsr:" << (off_.size() * sizeof(std::size_t) + adj_.size() * sizeof(int)) / (1024.0 * 1024.0) << " MB";
+		if (eofl) { o << std::endl; }
+		return o;
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -16,9 +16,18 @@
   * @details
   * `Graph<BitsetT>` is the fundamental graph abstraction used throughout the
   * BitGraph library. The template parameter `BitsetT` specifies the underlying
-  * adjacency representation and is currently restricted to:
-  *  - `BBScan`   (dense bitset representation)
+  * adjacency representation and must be registered in the `is_graph_bitset` trait
+  * (specialize it to std::true_type to add a row type). The registered types are:
+  *  - `BBScan`   (dense bitset representation, one heap block per row - for the rows in one slab use
+  *    `WideBitset<64>`, same block layout without the vptr, aliased slab_graph / slab_ugraph)
   *  - `BBScanSp` (sparse bitset representation)
+  *  - `FixedBitset<N>` (dense bitset with inline storage, for small graphs |V| <= N)
+  *  - `WideBitset<W>` (dense bitset in blocks of W = 64, 128, 256 or 512 bits, for large dense graphs;
+  *    the adjacency matrix is a BitsetMatrix - all the rows in one 64-byte aligned slab)
+  *  - `HybridBitset` (adaptive array / dense / run chunks, for large graphs with skewed degrees)
+  *  - `SummaryBitset` (dense bitset with summary bitmaps of the non-empty bitblocks, for huge sparse graphs)
+  *  - `CountedBitset` (dense bitset with a maintained popcount, for O(1) degrees and edge counts under edits)
+  *  - `SentinelBitset` (dense bitset restricted to the range of its non-empty bitblocks, for shrinking vertex sets)
   *
   * Higher-level graph abstractions (e.g. undirected graphs, weighted graphs,
   * and facade graph types) are built on top of this class.
@@ -45,6 +54,7 @@
 #include "formats/mmio.h"
 #include "formats/edges_format.h"
 #include "formats/mmx_format.h"
+#include "formats/parallel_reader.h"
 #include "utils/logger.h"
 #include "utils/prec_timer.h"
 
@@ -59,11 +69,73 @@ namespace bitgraph {
 	// forward declaration
 	namespace _impl { class GraphConversion;}
 
+	//////////////////
+	//
+	// Valid bitset types for the adjacency matrix of Graph<BitsetT>
+	// (specialize to std::true_type to register new bitset types)
+	//
+	//////////////////
+
+	template<class BitsetT>
+	struct is_graph_bitset : std::integral_constant<bool,
+								std::is_same<BBScan, BitsetT>::value ||
+								std::is_same<BBScanSp, BitsetT>::value> {};
+
+	template<std::size_t NBITS>
+	struct is_graph_bitset<FixedBitset<NBITS>> : std::true_type {};
+
+	template<int WBITS>
+	struct is_graph_bitset<WideBitset<WBITS>> : std::true_type {};
+
+	template<>
+	struct is_graph_bitset<HybridBitset> : std::true_type {};
+
+	template<>
+	struct is_graph_bitset<SummaryBitset> : std::true_type {};
+
+	template<>
+	struct is_graph_bitset<CountedBitset> : std::true_type {};
+
+	template<>
+	struct is_graph_bitset<SentinelBitset> : std::true_type {};
+
+	namespace _impl {
+
+		/**
+		* @brief container of the rows of the adjacency matrix of Graph<BitsetT>
+		*		 (std::vector<BitsetT>, or a contiguous slab for the row types which can be bound to one)
+		* @details: BBScan rows own their std::vector of bitblocks (exposed by bitset()), so they cannot be bound to a slab
+		**/
+		template<class BitsetT>
+		struct adjacency_storage { using type = std::vector<BitsetT>; };
+
+		template<int WBITS>
+		struct adjacency_storage<WideBitset<WBITS>> { using type = BitsetMatrix<WideBitset<WBITS>>; };
+
+		/**
+		* @brief row types with multi-word PEXT / PDEP (compress / expand), used to project
+		*		 neighborhoods onto induced subgraphs in O(NV/64) per row
+		**/
+		template<class BitsetT>
+		struct has_compress : std::integral_constant<bool,
+									std::is_base_of<Bitset, BitsetT>::value ||
+									std::is_base_of<BitsetSp, BitsetT>::value> {};
+
+		/**
+		* @brief row types built faster by setting their bits in increasing order (sparse blocks, array chunks),
+		*		 used when the rows are assembled in bulk (add_edges)
+		**/
+		template<class BitsetT>
+		struct ordered_rows : std::integral_constant<bool,
+									std::is_base_of<BitsetSp, BitsetT>::value ||
+									std::is_same<HybridBitset, BitsetT>::value> {};
+	}
+
 	//////////////////
 	//
 	// Generic class Graph<BitsetT>
 	// 
-	// (BitsetT is a bitset currently limited to the BBScan and BBScanSP types)
+	// (BitsetT is any row type registered in the is_graph_bitset trait above)
 	// 
 	//////////////////
 
@@ -71,8 +143,7 @@ namespace bitgraph {
 	class Graph {
 
 		//filter out invalid types
-		static_assert(std::is_same<BBScan, BitsetT>::value ||
-							std::is_same<BBScanSp, BitsetT>::value, "is not a valid Graph type");
+		static_assert(is_graph_bitset<BitsetT>::value, "is not a valid Graph type");
 
 		friend class _impl::GraphConversion;
 
@@ -80,6 +151,7 @@ namespace bitgraph {
 						
 		using bitset_type = BitsetT;				// basic type (a type of bitset)
 		using VertexBitset = bitset_type;			// alias for semantic type
+		using AdjacencyMatrix = typename _impl::adjacency_storage<BitsetT>::type;		// rows of the adjacency matrix
 		
 		/////////////			
 		//construction / destruction
@@ -145,10 +217,17 @@ namespace bitgraph {
 		**/
 		virtual	std::size_t num_edges(const VertexBitset& set)	const;
 
-		const vector<VertexBitset>& adjacency_matrix()		const { return adj_; }
+		const AdjacencyMatrix& adjacency_matrix()			const { return adj_; }
 		const VertexBitset& neighbors(int v)					const { return adj_[v]; }
 		VertexBitset& neighbors(int v) { return adj_[v]; }
 
+		/**
+		* @brief non-owning view of the neighborhood of v (non-sparse bitset types only)
+		* @details: invalidated when the graph is reallocated (reset, add_vertex...)
+		**/
+		ConstBitsetView neighbors_view(int v)					const { return adj_[v].view(); }
+		BitsetView neighbors_view(int v) { return adj_[v].view(); }
+
 		//////////////////////////
 		// memory allocation 
 	public:
@@ -165,7 +244,8 @@ namespace bitgraph {
 		/**
 		* @brief sets graph from file in dimacs/MTX/Edges formats (in this order)
 		* @param filename file
-		* @details: fast-fail policy - exits if failure
+		* @details: fast-fail policy - exits if failure. The errors of the formats tried are
+		*			only logged if none of them matches the file
 		**/
 		void reset(std::string filename) noexcept;
 
@@ -267,6 +347,15 @@ namespace bitgraph {
 		**/
 		virtual void add_edge(int v, int w);
 
+		/**
+		* @brief adds in bulk the edges {v -> w} parsed from a file (see gio::par readers),
+		*		 the rows are assembled in parallel (gio::par::assemble_rows)
+		* @param el parsed edges, vertices in [0, NV)
+		* @param nThreads number of threads (0 - determined by the number of edges)
+		* @details: the number of edges is updated (exact, as with add_edge)
+		**/
+		virtual void add_edges(const gio::par::EdgeList& el, int nThreads = 0);
+
 		/**
 		* @brief removes edge {v -> w} from the graph
 		* @param v outgoing endpoint
@@ -334,6 +423,15 @@ namespace bitgraph {
 		**/
 		void remove_vertices(const Bitset& set, Graph& g);
 
+	protected:
+		/**
+		* @brief copies the rows of the vertices in keep onto the rows of g, projected onto keep
+		*		 (compress for Bitset / BitsetSp rows, bit by bit otherwise)
+		**/
+		void project_rows(const VertexBitset& keep, Graph& g, std::true_type) const;
+		void project_rows(const VertexBitset& keep, Graph& g, std::false_type) const;
+	public:
+
 		//////////////	
 		// deleted - CHECK	
 		virtual void remove_vertices(const Bitset& set) = delete;	//commented out implementation - EXPERIMENTAL
@@ -370,22 +468,24 @@ namespace bitgraph {
 		/**
 		* @brief reads a simple directed unweighted graph in DIMACS format
 		* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
-		* @details: iterates on the parsed number of edges
-		*
-		* TODO: iterate on number of lines 'e' and check if it is consistent
-		*		with the parsed number of edges
+		* @details: memory-mapped, parsed and assembled in parallel (see gio::par::parse_dimacs),
+		*			vertex-weights are skipped. Every 'e' line is read, unknown lines are skipped and self-loops
+		*			dropped (see gio::par::parse_dimacs for the differences with the former stream reader).
+		*			The graph is empty after an error, as for read_mtx and read_EDGES
 		**/
 		int read_dimacs(const std::string& filename) noexcept;
 
 		/**
 		* @brief reads a graph matrix exchange format (at the moment only MCPS)
 		* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+		* @details: memory-mapped, parsed and assembled in parallel (see gio::par::parse_mtx)
 		**/
 		int read_mtx(const std::string& filename) noexcept;
 
 		/**
 		* @brief reads a graph in list of edges format
 		* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+		* @details: memory-mapped, parsed and assembled in parallel (see gio::par::parse_edges)
 		**/
 		int read_EDGES(const std::string& filename) noexcept;
 
@@ -395,6 +495,15 @@ namespace bitgraph {
 		**/
 		int read_01(const std::string& filename) noexcept;
 
+	protected:
+		/**
+		* @brief resets the graph to the edges parsed from @filename (parallel readers) and sets its name
+		* @returns 0 if correct, -1 in case of error (error code non-throwing interface)
+		**/
+		int load_edges(const std::string& filename, gio::par::EdgeList& el) noexcept;
+
+	public:
+
 		/*
 		* @brief writes directed graph in dimacs format
 		*
@@ -458,7 +567,7 @@ namespace bitgraph {
 		//////////////////////////
 		// data members
 	protected:
-		std::vector<VertexBitset> adj_;		//adjacency matrix 
+		AdjacencyMatrix adj_;				//adjacency matrix (std::vector<VertexBitset> for most row types)
 
 		int NV_;						// number of vertices
 		std::size_t NE_;				// number of edges (can be very large)
@@ -706,18 +815,28 @@ namespace bitgraph {
 	template<class BitsetT>
 	inline
 		void Graph<BitsetT>::reset(string filename) noexcept {
-		if (read_dimacs(filename) == -1) {
-			if (read_mtx(filename) == -1) {
-				if (read_EDGES(filename) == -1) {
-					if (read_01(filename) == -1) {
-						LOGG_ERROR("Unable to read a graph from file ", filename, "- Graph<BitsetT>::reset");
-						LOG_ERROR("Formats considered: DIMACS / MTX / EDGES / 01");
-						LOG_ERROR("exiting...");
-						std::exit(EXIT_FAILURE);
-					}
+
+		//the errors of the formats tried are only reported if none matches
+		std::vector<std::string> errors;
+		int ret = -1;
+		{
+			gio::par::ErrorCapture capture(errors);
+			if ((ret = read_dimacs(filename)) == -1) {
+				if ((ret = read_mtx(filename)) == -1) {
+					ret = read_EDGES(filename);
 				}
 			}
-		}		
+		}
+
+		if (ret == -1 && read_01(filename) == -1) {
+			for (const auto& msg : errors) {
+				LOGG_ERROR(msg);
+			}
+			LOGG_ERROR("Unable to read a graph from file ", filename, "- Graph<BitsetT>::reset");
+			LOG_ERROR("Formats considered: DIMACS / MTX / EDGES / 01");
+			LOG_ERROR("exiting...");
+			std::exit(EXIT_FAILURE);
+		}
 	}
 
 	template<class BitsetT>
@@ -729,6 +848,23 @@ namespace bitgraph {
 		}
 	}
 
+	template<class BitsetT>
+	inline
+		void Graph<BitsetT>::add_edges(const gio::par::EdgeList& el, int nThreads) {
+
+		gio::par::assemble_rows(el, NV_, false,
+			[this](int v, const int* first, const int* last) {
+				VertexBitset& row = adj_[v];
+				for (; first != last; ++first) { row.set_bit(*first); }
+			}, nThreads, _impl::ordered_rows<BitsetT>::value);
+
+		//exact edge count, so that later edits (add_edge, remove_edge) keep it exact
+		NE_ = 0;
+		for (int v = 0; v < NV_; ++v) {
+			NE_ += adj_[v].count();
+		}
+	}
+
 	template<class BitsetT>
 	inline
 		void Graph<BitsetT>::remove_edge(int v, int w) {
@@ -810,52 +946,13 @@ namespace bitgraph {
 	inline
 		int Graph<BitsetT>::read_dimacs(const string& filename) noexcept{
 
-		int n = 0, m = 0, v1 = 0, v2 = 0;			
-
-		fstream f(filename.c_str());
-		if (!f) {
-			LOG_ERROR("Graph<BitsetT>::read_dimacs-File could not be opened reading DIMACS format");
-			reset();
-			return -1;
-		}
-
-		if (gio::dimacs::read_dimacs_header(f, n, m) == -1) {
+		gio::par::EdgeList el;
+		if (gio::par::parse_dimacs(filename, el) == -1) {
 			reset();
-			f.close();
 			return -1;
 		}
 
-		reset(n);
-		gio::skip_empty_lines(f);   
-		
-		////////////////////////
-		//parse edges directly from the stream
-		string line; char c;
-		for (int e = 0; e < m; e++) {			//iterates on the number of edges, TODO - iterate on lines and check edges
-			f >> c;
-			if (c != 'e') {
-				LOGG_ERROR(filename, ":wrong header for edges reading DIMACS format");
-				reset();
-				f.close();
-				return -1;
-			}
-
-			//read and add edge
-			f >> v1 >> v2;
-#ifdef DIMACS_INDEX_0_FORMAT 
-			add_edge(v1, v2);
-#else
-			add_edge(v1 - 1, v2 - 1);
-#endif
-					
-			//removes remaining part of the line
-			std::getline(f, line);		
-		}
-
-		f.close();
-				
-		set_name(filename);			//removes full path
-		return 0;
+		return load_edges(filename, el);
 	}
 
 	template<class BitsetT>
@@ -904,17 +1001,48 @@ namespace bitgraph {
 	inline
 		int  Graph<BitsetT>::read_mtx(const string& filename) noexcept {
 
+		gio::par::EdgeList el;
+		if (gio::par::parse_mtx(filename, el) == -1) {
+			reset();
+			return -1;
+		}
 
-		MMI<Graph<BitsetT> > myreader(*this);
-		return (myreader.read(filename));
+		return load_edges(filename, el);
 	}
 
 	template<class BitsetT>
 	inline
 		int  Graph<BitsetT>::read_EDGES(const string& filename) noexcept {
 
-		EDGES<Graph<BitsetT> > myreader(filename, *this);
-		return (myreader.read());
+		gio::par::EdgeList el;
+		if (gio::par::parse_edges(filename, el) == -1) {
+			reset();
+			return -1;
+		}
+
+		return load_edges(filename, el);
+	}
+
+	template<class BitsetT>
+	inline
+		int Graph<BitsetT>::load_edges(const string& filename, gio::par::EdgeList& el) noexcept {
+
+		PrecisionTimer pt;
+		pt.wall_tic();
+		try {
+			reset(el.NV);
+			add_edges(el);
+		}
+		catch (...) {
+			LOGG_ERROR(filename, ": out of memory - Graph<BitsetT>::load_edges");
+			reset();
+			return -1;
+		}
+		el.stats.build_ms = 1.0e3 * pt.wall_toc();
+
+		set_name(filename);			//removes full path
+		LOGG_DEBUG(filename, ": ", el.stats, " - Graph<BitsetT>::load_edges");
+		return 0;
 	}
 
 	template<class BitsetT>
@@ -1055,30 +1183,49 @@ namespace bitgraph {
 			return;
 		}
 
-		//initialize new graph
-		if (g.reset(new_size) == -1) {
-			LOG_ERROR("memory for graph not allocated - Graph<BitsetT>::remove_vertices");
-			return;
-		}
+		//initialize new graph (reset exits if memory is not allocated)
+		g.reset(static_cast<std::size_t>(new_size), this->name_);
 
 		//computes the induced graph in g
-		g.name(this->name_);
+
+		VertexBitset keep(NV_);
+		for (int v = 0; v < NV_; ++v) {
+			if (!bbn.is_bit(v)) { keep.set_bit(v); }
+		}
+
+		project_rows(keep, g, _impl::has_compress<VertexBitset>{});
+		g.NE_ = 0;									//recomputed on demand
+	}
+
+	template<class BitsetT>
+	inline
+		void Graph<BitsetT>::project_rows(const VertexBitset& keep, Graph& g, std::true_type) const {
+
 		int l = 0;
+		for (int v = 0; v < NV_; ++v) {
+			if (keep.is_bit(v)) {
+				compress(adj_[v], keep, g.adj_[l++]);
+			}
+		}
+	}
 
-		//adds the edges with endpoints not in the bbn set
-		for (int i = 0; i < NV_ - 1; i++) {
-			if (bbn.is_bit(i)) continue;				//jumps over vertices marked for deletion
-			int m = l + 1;
-			for (int j = i + 1; j < NV_; j++) {
-				if (bbn.is_bit(j)) continue;				//jumps over vertices marked for deletion
+	template<class BitsetT>
+	inline
+		void Graph<BitsetT>::project_rows(const VertexBitset& keep, Graph& g, std::false_type) const {
+
+		int l = 0;
+		for (int i = 0; i < NV_; ++i) {
+			if (!keep.is_bit(i)) continue;				//jumps over vertices marked for deletion
+			int m = 0;
+			for (int j = 0; j < NV_; ++j) {
+				if (!keep.is_bit(j)) continue;
 				if (adj_[i].is_bit(j)) {
-					g.add_edge(l, m);
+					g.adj_[l].set_bit(m);
 				}
-				m++;
+				++m;
 			}
-			l++;
+			++l;
 		}
-
 	}
 
 	//template<class BitsetT>
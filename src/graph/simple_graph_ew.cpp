@@ -15,6 +15,8 @@
 #include "bitscan/bitscan.h"
 #include "graph_types.h"
 #include "graph/formats/dimacs_format.h"
+#include "graph/formats/parallel_reader.h"
+#include "graph/graph_traits.h"
 #include "graph/simple_graph_ew.h"
 #include "utils/common.h"
 #include "utils/logger.h"
@@ -179,178 +181,65 @@ std::vector<WeightT> Base_Graph_EW<GraphT, WeightT>::vertex_weights()  const {
 template<class GraphT, class WeightT>
 int Base_Graph_EW<GraphT, WeightT>::read_dimacs (string filename){
 		
-	string line;	
-		
-	fstream f(filename.c_str());
-	if(!f){
+	//memory-mapped file parsed in parallel - edge-weights are read if the first edge line has 4 tokens
+	gio::par::WeightedEdgeList<WeightT> el;
+	if (gio::par::parse_dimacs(filename, el, true) == -1) {
 		LOGG_ERROR("error when reading file ", filename, " in DIMACS format - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
 		reset();
 		return -1;
 	}
 
-	//read header
-	 int nV = -1, nEdges = -1;
-	 if (gio::dimacs::read_dimacs_header (f, nV, nEdges) == -1)
-	 {
-		 LOG_ERROR("error when reading dimacs header / allocation - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		 reset();
-		 f.close();
-		 return -1;
-	 }
-
 	 //allocates memory for the graph - no allocation for edge-weights
-	 reset(nV);
-
-	 //skips empty lines
-	 gio::skip_empty_lines(f);
+	 reset(el.NV);
 
 	 //////////////
-	//read vertex-weights format <n> <vertex index> <weight> if they exist
-	 int v1 = -1, v2 = -1;
-	 WeightT wv = NO_WEIGHT;
-	 
-	 //peek next non-empty character
-	 int c = f.peek();
-	 if (c == EOF) {
-		 LOG_ERROR("bizarre EOF when peeking for first char - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		 reset();
-		 f.close();
-		 return -1;
-	 }
-	 char next = static_cast<char>(c);
-	 
-	 switch (next) {
-	 case 'n':
-	 case 'v':									// 'v' format used by Zavalnij in evil_W benchmark 
-
-		 for (int n = 0; n < nV; ++n) {
-			 f >> next >> v1 >> wv;
-
-			 //assert
-			 if (f.bad()) {
-				 LOG_ERROR("error when reading vertex-weights - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-				 reset();
-				 f.close();
-				 return -1;
-			 }
+	//vertex-weights format <n> <vertex index> <weight> if they exist
+	 bool weights_found = false;
+	 for (const auto& lvw : el.vw) {
+		 for (const auto& vw : lvw) {
 
 			 //non-positive vertex-weight check
-			 if (wv <= static_cast<WeightT>(0)) {
-				 LOGG_WARNING("non-positive weight read: ", wv, "- Base_Graph_EW<GraphT, WeightT>::read_dimacs");
+			 if (vw.second <= static_cast<WeightT>(0)) {
+				 LOGG_WARNING("non-positive weight read: ", vw.second, "- Base_Graph_EW<GraphT, WeightT>::read_dimacs");
 			 }
 
-			 //////////////////////////
-			 we_[v1 - 1][v1 - 1] = wv;
-			 //////////////////////////
-			 
-			 // Consume rest of line
-			 std::getline(f, line);  
-		 }
+			 //////////////////////////////////
+			 we_[vw.first][vw.first] = vw.second;
+			 //////////////////////////////////
 
-		 // Skip possible empty lines after vertex section
-		 gio::skip_empty_lines(f);
-		 break;
-	 default:
+			 weights_found = true;
+		 }
+	 }
+	 if (!weights_found) {
 		 LOGG_DEBUG("missing vertex-weights in file ", filename, " setting unit weights - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-	 }//end of switch
+	 }
 	 	
 	 /////////////////////	
-	 //read edges
-	 
-	 //read the first edge line - 4 tokens expected (e <v> <w> <edge-weight>)
-	 c = f.peek();
-	 if (c == EOF) {
-		 LOG_ERROR("bizarre EOF when peeking for first char - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		 reset();
-		 f.close();
-		 return -1;
-	 } 
-	 next = static_cast<char>(c);
-	 
-
-	 if (next != 'e') {
-		 LOG_ERROR("Wrong edge format reading edges - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		 reset();
-		 f.close();
-		 return -1;
-	 }
-
-	 // Read first edge line to detect presence of edge weights
-	
-	 std::getline(f, line);
-	 stringstream sstr(line);
-
-	 //determine if edge weights are present
-	 int nw = _count::number_of_words(line);
-	 bool edge_weights_found = true;
-	 switch (nw) {
-	 case 4: edge_weights_found = true;	break; 		//expected: e <v> <w> <edge-weight> 
-	 case 3: edge_weights_found = false;  break;	//expeceted: e <v> <w>  	
-	 default:
-		 LOG_ERROR("Wrong edge format - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		 reset();
-		 f.close();
-		 return -1;
-	 }
-
-	 WeightT we = NO_WEIGHT;
-
-	 //parse the first edge
-	 if (edge_weights_found) {
-
-		 /////////////////////////////
-		 sstr >> next >> v1 >> v2 >> we;
-		 ////////////////////////////
-
-		 g_.add_edge(v1 - 1, v2 - 1);
-		 set_weight (v1 - 1, v2 - 1, we);
-	 }
-	 else {	
-
-		 ///////////////////////
-		 sstr >> next >> v1 >> v2;
-		 ///////////////////////
-
-		 g_.add_edge(v1 - 1, v2 - 1);
-		 set_weight (v1 - 1, v2 - 1, NO_WEIGHT);				//no edge-weights in file - set NO_WEIGHT value
-	 }
-	 
-	 // Parse remaining edges
-	 for (int e = 1; e < nEdges; ++e) {
-		 f >> next;
-		 if ( f.bad() || next != 'e'  ) {
-			 LOG_ERROR("Wrong edge format reading edges - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-			 reset();
-			 f.close();
-			 return -1;
+	 //edges (rows assembled in bulk)
+	 PrecisionTimer pt;
+	 pt.wall_tic();
+
+	 /////////////////
+	 g_.add_edges(el);
+	 /////////////////
+
+	 //edge-weights - NO_WEIGHT if there are no edge-weights in the file
+	 const bool undirected = graph_traits<GraphT>::is_undirected;
+	 for (std::size_t t = 0; t < el.parts.size(); ++t) {
+		 const auto& edges = el.parts[t].edges;
+		 for (std::size_t i = 0; i < edges.size(); ++i) {
+			 const int v = edges[i].first, w = edges[i].second;
+			 const WeightT we = el.edge_weights ? el.we[t][i] : NO_WEIGHT;
+			 we_[v][w] = we;
+			 if (undirected) { we_[w][v] = we; }
 		 }
-
-		 //add weighted edge	
-		 if (edge_weights_found) {
-
-			 /////////////////////
-			 f >> v1 >> v2 >> we;
-			 /////////////////////
-
-			 g_.add_edge (v1 - 1, v2 - 1);
-			 set_weight (v1 - 1, v2 - 1, we);
-		 }
-		 else {
-			 ///////////////
-			 f >> v1 >> v2;
-			 ///////////////
-
-			 g_.add_edge(v1 - 1, v2 - 1);
-			 set_weight (v1 - 1, v2 - 1, NO_WEIGHT);			//no edge-weights in file - set NO_WEIGHT value
-		 }
-
-		 // Consume rest of edge line
-		 std::getline(f, line); 
 	 }
 
+	 el.stats.build_ms = 1.0e3 * pt.wall_toc();
+
 	 //name (removes path)
 	 g_.set_name(filename);
-	 f.close();	
+	 LOGG_DEBUG(filename, ": ", el.stats, " - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
 	 return 0;
 }
 
@@ -14,6 +14,7 @@
 #include "graph/simple_graph_w.h"
 #include "bitscan/bitscan.h"
 #include "graph/formats/dimacs_format.h"			
+#include "graph/formats/parallel_reader.h"
 #include "utils/common.h"
 #include "utils/logger.h"
 #include "utils/prec_timer.h"
@@ -174,80 +175,42 @@ ostream& Base_Graph_W<GraphT, WeightT>::write_dimacs(ostream& o)
 template<class GraphT, class WeightT>
 int Base_Graph_W<GraphT, WeightT>::read_dimacs (string filename, int type)
 {
-	std::string line;
-	
-	fstream f(filename.c_str());
-	if(!f){
+	//memory-mapped file parsed in parallel - edge-weights are not read
+	gio::par::WeightedEdgeList<Weight> el;
+	if (gio::par::parse_dimacs(filename, el, false) == -1) {
 		LOGG_ERROR("error when reading file ", filename, " in DIMACS format - Base_Graph_W<GraphT, WeightT>::read_dimacs");
 		reset();
 		return -1;
 	}
 
-	//read header
-	int nV = -1, nEdges = -1;
-	if(gio::dimacs::read_dimacs_header(f, nV, nEdges) == -1){
-		reset(); 
-		f.close();
-		return -1;
-	}	
-	
 	//allocates memory for the graph, assigns default unit weights
 
 	/////////////
-	reset(nV);
+	reset(el.NV);
 	////////////
-	
-	//skips empty lines
-	gio::skip_empty_lines(f);
-	
+
 	//////////////
-	//read vertex weights format <n> <vertex index> <weight> if they exist
-	int v1 = -1, v2 = -1;
-	Weight wv = -1;
-	int c = f.peek();
-	if(c == EOF){
-		LOG_ERROR("bizarre EOF when peeking for first char - Base_Graph_W<GraphT, WeightT>::read_dimacs");
-		reset();
-		f.close();
-		return -1;
-	}
-	char next = static_cast<char>(c);
-	
-	switch (next) {
-	case 'n':
-	case 'v':						// 'v' format used by Zavalnij in evil_W benchmark 
-
-		for (int n = 0; n < nV; ++n) {
-			f >> next >> v1 >> wv;
-			
-			//assert
-			if (f.bad()) {
-				LOG_ERROR("error when reading vertex-weights - Base_Graph_W<GraphT, WeightT>::read_dimacs");
-				reset();
-				f.close();
-				return -1;
-			}
+	//vertex weights format <n> <vertex index> <weight> if they exist
+	bool weights_found = false;
+	for (const auto& lvw : el.vw) {
+		for (const auto& vw : lvw) {
 
 			//non-positive vertex-weight check
-			if (wv <= 0.0) {
-				LOGG_WARNING("non-positive weight read: ", wv, "- Base_Graph_W<GraphT, WeightT>::read_dimacs");
+			if (vw.second <= 0.0) {
+				LOGG_WARNING("non-positive weight read: ", vw.second, "- Base_Graph_W<GraphT, WeightT>::read_dimacs");
 			}
 
 			////////////////////
-			w_[v1 - 1] = wv;
+			w_[vw.first] = vw.second;
 			////////////////////
-						
-			std::getline(f, line);  //remove remaining part of the line
-		}
-
-		//skip empty lines
-		gio::skip_empty_lines(f);
 
-		break;
-	default:
+			weights_found = true;
+		}
+	}
+	if (!weights_found) {
 		LOGG_DEBUG("Bad weights in file ", filename, " setting unit weights - Base_Graph_W<GraphT, WeightT>::read_dimacs");
 	}
-			
+
 	//read weights from external files if necessary 
 	//( @date 9/10/16, the use of additional weight files is deprecated now (26/09/23) )
 	if (w_.empty()) {
@@ -272,62 +235,19 @@ int Base_Graph_W<GraphT, WeightT>::read_dimacs (string filename, int type)
 	}
 	
 	////////////////	
-	//read edges
+	//edges (rows assembled in bulk)
+	PrecisionTimer pt;
+	pt.wall_tic();
 
-	//read the first edge line - 3 tokens expected (no edge-weights)
-	c = f.peek();
-	if (c == EOF) {
-		LOG_ERROR("bizarre EOF when peeking for first char - Base_Graph_W<GraphT, WeightT>::read_dimacs");
-		reset();
-		f.close();
-		return -1;
-	}
-	next = static_cast<char>(c);
-
-	if (next != 'e') {
-		LOG_ERROR("Wrong edge format reading edges - Base_Graph_EW<GraphT, WeightT>::read_dimacs");
-		reset();
-		f.close();
-		return -1;
-	}
-
-	std::getline(f, line);
-	stringstream sstr(line);
-	int nw = _count::number_of_words (line /*sstr.str()*/);
+	/////////////////
+	g_.add_edges(el);
+	/////////////////
 
-	//assert
-	if(nw != 3){
-		LOGG_ERROR ("Wrong edge format reading first edge line - Base_Graph_W<GraphT, WeightT>::read_dimacs");
-		reset();
-		f.close();
-		return -1;
-	}
-	
-	//parse the first edge
-	if(nw == 3){
-		sstr >> next >> v1 >> v2;
-		g_.add_edge(v1 - 1,v2 - 1);
-	}
-	
-	//remaining edges
-	for(int e = 1; e < nEdges; ++e){
-		f >> next;
-		if(next != 'e' || f.bad()){
-			LOG_ERROR("Wrong edge format reading edges - Base_Graph_W<GraphT, WeightT>::read_dimacs");
-			reset();
-			f.close();
-			return -1;
-		}
-		//add bidirectional edge	
-		f >> v1 >> v2;
-		g_.add_edge(v1 - 1,v2 - 1);
-			
-		std::getline(f, line);  //remove remaining part of the line
-	}
-	f.close();
+	el.stats.build_ms = 1.0e3 * pt.wall_toc();
 	
 	//set name 
 	g_.set_name(filename);
+	LOGG_DEBUG(filename, ": ", el.stats, " - Base_Graph_W<GraphT, WeightT>::read_dimacs");
 		
 	return 0;
 }
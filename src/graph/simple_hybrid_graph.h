@@ -0,0 +1,48 @@
+/**
+  * @file simple_hybrid_graph.h
+  * @brief contains specializations the class Graph for graphs with HybridBitset rows
+  *		   (adaptive array / dense / run chunks)
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_HYBRID_GRAPH_H__
+#define __SIMPLE_HYBRID_GRAPH_H__
+
+#include "simple_graph.h"
+
+////////////////////////
+//
+// Specializations of class Graph<BitsetT> methods for hybrid graphs
+// with T = HybridBitset
+//
+// note: this is facade type hybrid_graph
+
+namespace bitgraph {
+
+	template<>
+	inline Graph<HybridBitset>& Graph<HybridBitset>::create_subgraph(int first_k, Graph<HybridBitset>& newg) const
+	{
+		//assertions
+		if (first_k >= NV_ || first_k <= 0) {
+			LOGG_WARNING("Bad new size ", first_k, " - graph remains unchanged - Graph<HybridBitset>::create_subgraph");
+			return newg;
+		}
+
+		//allocates memory for the new graph
+		newg.reset(first_k);
+
+		//copies first k elements of the adjacency matrix (intersection with the range [0, first_k - 1] - a single run)
+		HybridBitset bbk(first_k);
+		bbk.set_bit(0, first_k - 1);
+		for (int i = 0; i < newg.NV_; i++) {
+			AND(bbk, adj_[i], newg.adj_[i]);
+		}
+
+		return newg;
+	}
+
+}//end namespace bitgraph
+
+#endif
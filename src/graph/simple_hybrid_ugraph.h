@@ -0,0 +1,84 @@
+/**
+  * @file simple_hybrid_ugraph.h
+  * @brief contains specializations the class Ugraph for graphs with HybridBitset rows
+  *		   (adaptive array / dense / run chunks)
+  *
+  * @created 17/10/2026
+  * @author pss
+  *
+  * This code is part of the GRAPH 1.0 C++ library
+  *
+  **/
+
+#ifndef __SIMPLE_HYBRID_UGRAPH_H__
+#define __SIMPLE_HYBRID_UGRAPH_H__
+
+#include "simple_hybrid_graph.h"
+#include "simple_ugraph.h"
+
+namespace bitgraph {
+
+	////////////////////////
+	//
+	// Specializations of class Ugraph<T> methods for hybrid graphs
+	//
+	// @brief T = Ugraph<HybridBitset> with alias facade type hybrid_bitarray
+	// @details the generic versions access the rows bitblock by bitblock (O(log) access per bitblock
+	//			in HybridBitset), the specializations work chunk by chunk
+	//
+	////////////////////////
+
+	template<>
+	inline
+	int Ugraph<HybridBitset>::degree_up(int v) const
+	{
+		return adj_[v].count(v + 1, -1);
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<HybridBitset>::degree<HybridBitset, void>(int v, const HybridBitset& bbn) const
+	{
+		return count_and(adj_[v], bbn);
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<HybridBitset>::degree<HybridBitset, void>(int v, int UB, const HybridBitset& bbn) const
+	{
+		//stops when UB is reached
+		_impl::HybridFusedCursor2<_impl::fused_and> cursor(adj_[v], bbn);
+		int idx = 0, ndeg = 0;
+		BITBOARD bb = 0;
+		while (cursor.next(idx, bb)) {
+			if ((ndeg += bblock::popc64(bb)) >= UB) { return UB; }
+		}
+
+		return ndeg;
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<HybridBitset>::degree_up<HybridBitset, void>(int v, const HybridBitset& bbn) const
+	{
+		_impl::HybridFusedCursor2<_impl::fused_and> cursor(adj_[v], bbn);
+		const int nBB = WDIV(v);
+		int idx = 0, ndeg = 0;
+		BITBOARD bb = 0;
+		while (cursor.next(idx, bb)) {
+			if (idx < nBB) { continue; }
+
+			//truncate the bitblock of v
+			if (idx == nBB) { bb &= ~bblock::MASK_1(0, WMOD(v)); }
+			ndeg += bblock::popc64(bb);
+		}
+
+		return ndeg;
+	}
+
+}//end namespace bitgraph
+
+#endif
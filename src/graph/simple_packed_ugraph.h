@@ -0,0 +1,563 @@
+/**
+  * @file simple_packed_ugraph.h
+  * @brief class PackedUgraph for simple undirected graphs (no self loops) which store only the
+  *		   upper triangle of the adjacency matrix, packed at bitblock granularity
+  *
+  * @details Row v keeps the bitblocks [WDIV(v), NBB) of N(v) (the edges (v, w) with w > v, the bits w <= v
+  *			 of its first bitblock are 0), and the rows are stored one after the other in a single array,
+  *			 about half the memory of Ugraph<BitsetT> for the same graph.
+  * @details - is_edge(v, w) reads one bit
+  *			 - degree(v) is O(1): the degrees are maintained under edits (one int per vertex). degree(v, bbn)
+  *			   counts the upper row and tests bit v in the rows u < v of bbn (a column of the triangle)
+  *			 - neighbors(v) reconstructs N(v) in a small cache of full rows (CACHE_ROWS), which is
+  *			   reused round-robin: a reference is valid until CACHE_ROWS other rows are reconstructed
+  *			   (or the graph is modified). Not thread-safe, use neighbors(v, bb) with a row per thread.
+  * @details Intended for large dense graphs where memory is the bottleneck. Algorithms which scan all the
+  *			 neighborhoods repeatedly should work on the full matrix (to_ugraph).
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_PACKED_UGRAPH_H__
+#define __SIMPLE_PACKED_UGRAPH_H__
+
+#include "simple_ugraph.h"
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace bitgraph {
+
+	//////////////////
+	//
+	// Generic class PackedUgraph<BitsetT>
+	//
+	// (BitsetT is the type of the reconstructed rows - Bitset hierarchy)
+	//
+	//////////////////
+
+	template<class BitsetT = BBScan>
+	class PackedUgraph {
+
+		static_assert(std::is_base_of<Bitset, BitsetT>::value, "PackedUgraph requires rows of the Bitset hierarchy");
+
+	public:
+
+		using bitset_type = BitsetT;
+		using VertexBitset = bitset_type;
+
+		enum : int { CACHE_ROWS = 4 };					//number of reconstructed rows kept by neighbors(v)
+
+		/////////////
+		//construction / destruction
+		PackedUgraph() noexcept : NV_(0), NE_(0), NBB_(0) { invalidate_cache(); }
+		explicit PackedUgraph(std::size_t NV) : PackedUgraph() { reset(NV); }
+		explicit PackedUgraph(std::string filename) : PackedUgraph() { reset(filename); }
+
+		/**
+		* @brief packs the upper triangle of the undirected graph ug
+		**/
+		explicit PackedUgraph(const Ugraph<BitsetT>& ug);
+
+		//move and copy semantics allowed
+		PackedUgraph(const PackedUgraph&) = default;
+		PackedUgraph& operator = (const PackedUgraph&) = default;
+		PackedUgraph(PackedUgraph&&) noexcept = default;
+		PackedUgraph& operator = (PackedUgraph&&) noexcept = default;
+
+		~PackedUgraph() = default;
+
+		/////////////
+		// setters and getters
+
+		void set_name(std::string instance);
+		std::string name() const noexcept { return name_; }
+
+		void set_path(std::string path_name) { path_ = std::move(path_name); }
+		std::string path() const noexcept { return path_; }
+
+		std::size_t size() const noexcept { return static_cast<std::size_t>(NV_); }
+		int num_vertices() const noexcept { return NV_; }
+
+		/**
+		* @brief number of bitblocks of a full row
+		**/
+		int num_blocks() const noexcept { return NBB_; }
+
+		/**
+		* @brief number of bitblocks of the packed triangle (Ugraph<BitsetT> stores num_vertices() * num_blocks())
+		**/
+		std::size_t num_packed_blocks() const noexcept { return tri_.size(); }
+
+		/**
+		* @brief number of edges
+		* @param lazy: if TRUE reads the cached value, otherwise counts the 1-bits of the triangle
+		**/
+		std::size_t num_edges(bool lazy = true);
+
+		double density(bool lazy = true);
+
+		//////////////////////////
+		// memory allocation
+
+		/**
+		* @brief resets to an empty graph with NV vertices
+		* @details: fast-fail policy - exits if failure
+		**/
+		void reset(std::size_t NV, std::string name = "") noexcept;
+
+		/**
+		* @brief reads the graph from file in dimacs/MTX/Edges formats (in this order)
+		* @details: fast-fail policy - exits if failure
+		**/
+		void reset(std::string filename) noexcept;
+
+		/**
+		* @brief resets to an empty graph with no vertices (deallocates memory)
+		**/
+		void reset() noexcept;
+
+		//////////////
+		// Basic operations
+
+		/**
+		* @brief adds the undirected edge (v, w), self loops are ignored
+		**/
+		void add_edge(int v, int w);
+
+		void remove_edge(int v, int w);
+
+		bool is_edge(int v, int w) const {
+			if (v == w) { return false; }
+			if (v > w) { std::swap(v, w); }
+			return tri_[row_offset(v) + (WDIV(w) - WDIV(v))] & bblock::MASK_BIT(WMOD(w));
+		}
+
+		/**
+		* @brief number of neighbors of v (O(1))
+		**/
+		int degree(int v) const { return deg_[v]; }
+
+		/**
+		* @brief number of neighbors of v in the set of vertices bbn
+		**/
+		int degree(int v, const Bitset& bbn) const;
+
+		/**
+		* @brief number of neighbors of v greater than v (one row of the triangle)
+		**/
+		int degree_up(int v) const {
+			const std::size_t off = row_offset(v);
+			return bbkernel::popcount(tri_.data() + off, NBB_ - WDIV(v));
+		}
+
+		/**
+		* @brief number of neighbors of v lesser than v
+		**/
+		int degree_low(int v) const { return deg_[v] - degree_up(v); }
+
+		int max_graph_degree() const;
+
+		/////////////
+		// neighborhoods
+
+		/**
+		* @brief neighborhood of v, reconstructed in the row cache
+		* @details: the reference is valid until CACHE_ROWS other neighborhoods are reconstructed
+		*			 or the graph is modified
+		**/
+		const BitsetT& neighbors(int v) const;
+
+		/**
+		* @brief writes the neighborhood of v in bb (which must have num_vertices() bits)
+		* @returns reference to bb
+		**/
+		BitsetT& neighbors(int v, BitsetT& bb) const;
+
+		/**
+		* @brief writes the full adjacency matrix in ug
+		**/
+		void to_ugraph(Ugraph<BitsetT>& ug) const;
+
+		/////////////
+		// I/O
+
+		int read_dimacs(const std::string& filename) noexcept;
+		int read_mtx(const std::string& filename) noexcept;
+		int read_EDGES(const std::string& filename) noexcept;
+
+		/**
+		* @brief streams the name, size, number of edges, density and memory of the packed triangle (MB)
+		**/
+		std::ostream& print_data(bool lazy = true, std::ostream& o = std::cout, bool eofl = true);
+
+		//////////////////////////
+		// data members
+	private:
+
+		/**
+		* @brief offset of row v in the packed array (O(1))
+		* @details the 64 rows of the j-th group of vertices [64j, 64j + 64) have NBB_ - j bitblocks
+		**/
+		std::size_t row_offset(int v) const noexcept {
+			const std::size_t b = WDIV(v), r = WMOD(v), nBB = NBB_;
+			return WORD_SIZE * (b * nBB - b * (b - 1) / 2) + r * (nBB - b);
+		}
+
+		void invalidate_cache() const noexcept {
+			cacheV_.fill(static_cast<int>(BBObject::noBit));
+			next_ = 0;
+		}
+
+		//updates the cached rows of v and w after adding / removing the edge (v, w)
+		void update_cache(int v, int w, bool add) const;
+
+		std::vector<BITBOARD> tri_;						//upper triangle, row v has the bitblocks [WDIV(v), NBB_)
+		std::vector<int> deg_;							//degrees of the vertices
+
+		int NV_;										//number of vertices
+		std::size_t NE_;								//number of edges
+		int NBB_;										//number of bitblocks of a full row
+
+		mutable std::array<BitsetT, CACHE_ROWS> cache_;	//reconstructed rows
+		mutable std::array<int, CACHE_ROWS> cacheV_;	//vertex of each cached row, noBit if empty
+		mutable int next_;								//next row of the cache to be replaced
+
+		//names
+		std::string name_;								//name of instance, without path
+		std::string path_;								//path of instance
+	};
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////
+// Necessary implementation of template methods in header file
+
+namespace bitgraph {
+
+	template<class BitsetT>
+	inline
+	PackedUgraph<BitsetT>::PackedUgraph(const Ugraph<BitsetT>& ug) : PackedUgraph() {
+
+		reset(ug.num_vertices(), ug.name());
+		for (int v = 0; v < NV_; ++v) {
+			const int bv = WDIV(v);
+			const std::size_t off = row_offset(v);
+			const auto& nv = ug.neighbors(v);
+			for (int k = bv; k < NBB_; ++k) {
+				tri_[off + (k - bv)] = nv.block(k);
+			}
+			tri_[off] &= Tables::mask_high[WMOD(v)];		//bits w > v
+			deg_[v] = nv.count();
+		}
+		num_edges(false);
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::set_name(std::string name) {
+
+		auto found = name.find_last_of("/\\");
+		if (found != string::npos) {
+			name_ = name.substr(found + 1);
+			path_ = name.substr(0, found + 1);  //includes slash
+		}
+		else {
+			name_ = std::move(name);
+			path_.clear();
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::reset() noexcept {
+		tri_.clear();
+		tri_.shrink_to_fit();
+		deg_.clear();
+		deg_.shrink_to_fit();
+		name_.clear(), path_.clear();
+		NV_ = 0, NBB_ = 0, NE_ = 0;
+		invalidate_cache();
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::reset(std::size_t NV, std::string name) noexcept {
+
+		//check size - must fit in int type
+		if (NV > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+			LOGG_ERROR("Invalid graph size ", NV, " - PackedUgraph<BitsetT>::reset");
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+
+		NV_ = static_cast<int>(NV);
+		NBB_ = INDEX_1TO1(NV_);
+		NE_ = 0;
+
+		try {
+			tri_.assign(row_offset(NV_), ZERO);
+			deg_.assign(NV, 0);
+			for (auto& bb : cache_) { bb.reset(NV); }
+		}
+		catch (const std::bad_alloc& e) {
+			LOG_ERROR("memory for graph not allocated - PackedUgraph<BitsetT>::reset");
+			LOG_ERROR("%s", e.what());
+			LOG_ERROR("exiting... ");
+			std::exit(EXIT_FAILURE);
+		}
+
+		invalidate_cache();
+		set_name(std::move(name));
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::reset(std::string filename) noexcept {
+		if (read_dimacs(filename) == -1) {
+			if (read_mtx(filename) == -1) {
+				if (read_EDGES(filename) == -1) {
+					LOGG_ERROR("Unable to read a graph from file ", filename, "- PackedUgraph<BitsetT>::reset");
+					LOG_ERROR("Formats considered: DIMACS / MTX / EDGES");
+					LOG_ERROR("exiting...");
+					std::exit(EXIT_FAILURE);
+				}
+			}
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	std::size_t PackedUgraph<BitsetT>::num_edges(bool lazy) {
+
+		if (!lazy || NE_ == 0) {
+			NE_ = 0;
+			const std::size_t CHUNK = 1 << 24;				//popcount takes an int number of bitblocks
+			for (std::size_t i = 0; i < tri_.size(); i += CHUNK) {
+				NE_ += bbkernel::popcount(tri_.data() + i, static_cast<int>(std::min(CHUNK, tri_.size() - i)));
+			}
+		}
+		return NE_;
+	}
+
+	template<class BitsetT>
+	inline
+	double PackedUgraph<BitsetT>::density(bool lazy) {
+
+		BITBOARD max_edges = NV_;
+		max_edges *= (max_edges - 1);
+		return (2 * num_edges(lazy) / static_cast<double> (max_edges));
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::add_edge(int v, int w) {
+
+		if (v == w) { return; }
+		if (v > w) { std::swap(v, w); }
+
+		BITBOARD& bb = tri_[row_offset(v) + (WDIV(w) - WDIV(v))];
+		const BITBOARD mask = bblock::MASK_BIT(WMOD(w));
+		if (!(bb & mask)) {
+			bb |= mask;
+			++NE_, ++deg_[v], ++deg_[w];
+			update_cache(v, w, true);
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::remove_edge(int v, int w) {
+
+		if (v == w) { return; }
+		if (v > w) { std::swap(v, w); }
+
+		BITBOARD& bb = tri_[row_offset(v) + (WDIV(w) - WDIV(v))];
+		const BITBOARD mask = bblock::MASK_BIT(WMOD(w));
+		if (bb & mask) {
+			bb &= ~mask;
+			--NE_, --deg_[v], --deg_[w];
+			update_cache(v, w, false);
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::update_cache(int v, int w, bool add) const {
+
+		for (int i = 0; i < CACHE_ROWS; ++i) {
+			if (cacheV_[i] == v) {
+				if (add) { cache_[i].set_bit(w); }
+				else { cache_[i].erase_bit(w); }
+			}
+			else if (cacheV_[i] == w) {
+				if (add) { cache_[i].set_bit(v); }
+				else { cache_[i].erase_bit(v); }
+			}
+		}
+	}
+
+	template<class BitsetT>
+	inline
+	int PackedUgraph<BitsetT>::degree(int v, const Bitset& bbn) const {
+
+		//upper row
+		const int bv = WDIV(v);
+		int deg = bbkernel::popcount_and(tri_.data() + row_offset(v), bbn.bitset().data() + bv, NBB_ - bv);
+
+		//column v restricted to the vertices of bbn lesser than v
+		const BITBOARD mask = bblock::MASK_BIT(WMOD(v));
+		for (int u = bbn.next_bit(BBObject::noBit); u != BBObject::noBit && u < v; u = bbn.next_bit(u)) {
+			if (tri_[row_offset(u) + (bv - WDIV(u))] & mask) { ++deg; }
+		}
+		return deg;
+	}
+
+	template<class BitsetT>
+	inline
+	int PackedUgraph<BitsetT>::max_graph_degree() const {
+
+		return deg_.empty() ? 0 : *std::max_element(deg_.begin(), deg_.end());
+	}
+
+	template<class BitsetT>
+	inline
+	BitsetT& PackedUgraph<BitsetT>::neighbors(int v, BitsetT& bb) const {
+
+		assert(bb.num_blocks() == NBB_);
+		const int bv = WDIV(v);
+		const int pos = WMOD(v);
+		const BITBOARD* p = tri_.data() + bv;			//bitblock of v in row 0
+
+		//lower part: column v, one bitblock of the result per group of 64 rows (branchless)
+		for (int k = 0; k < bv; ++k) {
+			const std::size_t len = NBB_ - k;
+			BITBOARD col = ZERO;
+			for (int r = 0; r < WORD_SIZE; ++r, p += len) {
+				col |= ((*p >> pos) & 1ULL) << r;
+			}
+			--p;
+			bb.block(k) = col;
+		}
+
+		//rows of the group of v lesser than v, then the upper part (row v)
+		BITBOARD col = ZERO;
+		for (int r = 0; r < pos; ++r, p += NBB_ - bv) {
+			col |= ((*p >> pos) & 1ULL) << r;
+		}
+
+		const BITBOARD* row = tri_.data() + row_offset(v);
+		bb.block(bv) = col | row[0];
+		for (int k = bv + 1; k < NBB_; ++k) {
+			bb.block(k) = row[k - bv];
+		}
+
+		return bb;
+	}
+
+	template<class BitsetT>
+	inline
+	const BitsetT& PackedUgraph<BitsetT>::neighbors(int v) const {
+
+		for (int i = 0; i < CACHE_ROWS; ++i) {
+			if (cacheV_[i] == v) { return cache_[i]; }
+		}
+
+		const int i = next_;
+		next_ = (next_ + 1) % CACHE_ROWS;
+		cacheV_[i] = v;
+		return neighbors(v, cache_[i]);
+	}
+
+	template<class BitsetT>
+	inline
+	void PackedUgraph<BitsetT>::to_ugraph(Ugraph<BitsetT>& ug) const {
+
+		ug.reset(NV_, name_);
+		for (int v = 0; v < NV_; ++v) {
+			neighbors(v, ug.neighbors(v));
+		}
+		ug.num_edges(false);
+	}
+
+	template<class BitsetT>
+	inline
+	int PackedUgraph<BitsetT>::read_dimacs(const std::string& filename) noexcept {
+
+		int n = 0, m = 0, v1 = 0, v2 = 0;
+
+		fstream f(filename.c_str());
+		if (!f) {
+			LOG_ERROR("PackedUgraph<BitsetT>::read_dimacs-File could not be opened reading DIMACS format");
+			reset();
+			return -1;
+		}
+
+		if (gio::dimacs::read_dimacs_header(f, n, m) == -1) {
+			reset();
+			f.close();
+			return -1;
+		}
+
+		reset(n);
+		gio::skip_empty_lines(f);
+
+		//parse edges directly from the stream
+		string line; char c;
+		for (int e = 0; e < m; e++) {
+			f >> c;
+			if (c != 'e') {
+				LOGG_ERROR(filename, ":wrong header for edges reading DIMACS format");
+				reset();
+				f.close();
+				return -1;
+			}
+
+			f >> v1 >> v2;
+#ifdef DIMACS_INDEX_0_FORMAT
+			add_edge(v1, v2);
+#else
+			add_edge(v1 - 1, v2 - 1);
+#endif
+			std::getline(f, line);
+		}
+
+		f.close();
+
+		set_name(filename);
+		return 0;
+	}
+
+	template<class BitsetT>
+	inline
+	int PackedUgraph<BitsetT>::read_mtx(const std::string& filename) noexcept {
+
+		MMI<PackedUgraph<BitsetT> > myreader(*this);
+		return (myreader.read(filename));
+	}
+
+	template<class BitsetT>
+	inline
+	int PackedUgraph<BitsetT>::read_EDGES(const std::string& filename) noexcept {
+
+		EDGES<PackedUgraph<BitsetT> > myreader(filename, *this);
+		return (myreader.read());
+	}
+
+	template<class BitsetT>
+	inline
+	std::ostream& PackedUgraph<BitsetT>::print_data(bool lazy, std::ostream& o, bool eofl) {
+
+		if (!name_.empty()) { o << name_.c_str() << '\t'; }
+		o << "n:" << NV_ << "\tm:" << num_edges(lazy) << "\tp:" << std::fixed << std::setprecision(3) << density(lazy)
+			<< "\tpacked:" << (tri_.size() * sizeof(BITBOARD)) / (1024.0 * 1024.0) << " MB";
+		if (eofl) { o << std::endl; }
+		return o;
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,51 @@
+/**
+  * @file simple_sentinel_graph.h
+  * @brief contains specializations the class Graph for graphs with SentinelBitset rows
+  *		   (dense bitsets restricted to the range of their non-empty bitblocks)
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_SENTINEL_GRAPH_H__
+#define __SIMPLE_SENTINEL_GRAPH_H__
+
+#include "simple_graph.h"
+
+////////////////////////
+//
+// Specializations of class Graph<BitsetT> methods for sentinel graphs
+// with T = SentinelBitset
+//
+// note: this is facade type watched_graph
+// 
+// @details: the rows are read-only bitblock-wise (the sentinels cannot be bypassed),
+//			 the generic create_subgraph, which writes the bitblocks of the rows, is replaced by block operations
+
+namespace bitgraph {
+
+	template<>
+	inline Graph<SentinelBitset>& Graph<SentinelBitset>::create_subgraph(int first_k, Graph<SentinelBitset>& newg) const
+	{
+		//assertions
+		if (first_k >= NV_ || first_k <= 0) {
+			LOGG_WARNING("Bad new size ", first_k, " - graph remains unchanged - Graph<SentinelBitset>::create_subgraph");
+			return newg;
+		}
+
+		//allocates memory for the new graph
+		newg.reset(first_k);
+
+		//copies the first k elements of the adjacency matrix (sentinels are updated by the block operations)
+		const int bbh = WDIV(first_k - 1);
+		for (int i = 0; i < newg.NV_; i++) {
+			newg.adj_[i].assign_block(0, bbh, adj_[i]);
+			newg.adj_[i].erase_bit(first_k, -1);
+		}
+
+		return newg;
+	}
+
+}//end namespace bitgraph
+
+#endif
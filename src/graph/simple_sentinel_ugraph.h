@@ -0,0 +1,84 @@
+/**
+  * @file simple_sentinel_ugraph.h
+  * @brief contains specializations the class Ugraph for graphs with SentinelBitset rows
+  *		   (dense bitsets restricted to the range of their non-empty bitblocks)
+  *
+  * @created 17/10/2026
+  * @author pss
+  *
+  * This code is part of the GRAPH 1.0 C++ library
+  *
+  **/
+
+#ifndef __SIMPLE_SENTINEL_UGRAPH_H__
+#define __SIMPLE_SENTINEL_UGRAPH_H__
+
+#include "simple_sentinel_graph.h"
+#include "simple_ugraph.h"
+
+namespace bitgraph {
+
+	////////////////////////
+	//
+	// Specializations of class Ugraph<T> methods for sentinel graphs
+	//
+	// @brief T = Ugraph<SentinelBitset> with alias facade type watched_bitarray
+	// @details the generic versions visit every bitblock of the rows, the specializations
+	//			only the intersection of the ranges of the row and the set of vertices
+	//
+	////////////////////////
+
+	template<>
+	inline
+	int Ugraph<SentinelBitset>::degree_up(int v) const
+	{
+		return (v + 1 < WMUL(NBB_)) ? adj_[v].count(v + 1, -1) : 0;
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SentinelBitset>::degree<SentinelBitset, void>(int v, const SentinelBitset& bbn) const
+	{
+		return count_and(adj_[v], bbn);
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SentinelBitset>::degree<SentinelBitset, void>(int v, int UB, const SentinelBitset& bbn) const
+	{
+		const int lo = std::max(adj_[v].sentinel_low(), bbn.sentinel_low());
+		const int hi = std::min(adj_[v].sentinel_high(), bbn.sentinel_high());
+
+		//stops when UB is reached
+		int ndeg = 0;
+		for (int i = lo; i <= hi; ++i) {
+			if ((ndeg += bblock::popc64(adj_[v].block(i) & bbn.block(i))) >= UB) { return UB; }
+		}
+		return ndeg;
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SentinelBitset>::degree_up<SentinelBitset, void>(int v, const SentinelBitset& bbn) const
+	{
+		const int nBB = WDIV(v);
+		int ndeg = 0;
+
+		//bitblock of v (truncated)
+		ndeg += bblock::popc64(adj_[v].block(nBB) & bbn.block(nBB) & ~bblock::MASK_1(0, WMOD(v)));
+
+		//bitblocks after v within both ranges
+		const int lo = std::max({ nBB + 1, adj_[v].sentinel_low(), bbn.sentinel_low() });
+		const int hi = std::min(adj_[v].sentinel_high(), bbn.sentinel_high());
+		for (int i = lo; i <= hi; ++i) {
+			ndeg += bblock::popc64(adj_[v].block(i) & bbn.block(i));
+		}
+		return ndeg;
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -65,7 +65,7 @@ namespace bitgraph {
 		}
 
 		//truncate the bitblock of v and count the number of neighbors
-		nDeg += bblock::popc64(bblock::MASK_1(WMOD(v) + 1, 63) & it->bb_);
+		nDeg += bblock::popc64(bblock::MASK_0_LOW(WMOD(v)) & it->bb_);
 
 		//add the rest of neighbours in the bitblocks that follow
 		++it;
@@ -99,23 +99,14 @@ namespace bitgraph {
 	inline
 	int Ugraph<BBScanSp>::degree(int v, const BitsetSp& bbs) const 
 	{
+		//merge of the block indices, galloping if the sizes are skewed (bbkernel_sparse.h)
+		const BitsetSp::SparseBlock* pv = adj_[v].bitset().data();
+		const BitsetSp::SparseBlock* pb = bbs.bitset().data();
 		int ndeg = 0;
-		auto itv = adj_[v].cbegin();
-		auto itbb = bbs.cbegin();
-
-		while (itv != adj_[v].cend() && itbb != bbs.cend()) {
-
-			if (itv->idx_ < itbb->idx_) {
-				++itv;
-			}
-			else if (itv->idx_ > itbb->idx_) {
-				++itbb;
-			}
-			else { //same index
-				ndeg += bblock::popc64(itv->bb_ & itbb->bb_);
-				++itv; ++itbb;
-			}
-		}
+		bbkernel::for_each_common_block(
+			[pv](int i) { return pv[i].idx_; }, static_cast<int>(adj_[v].size()),
+			[pb](int j) { return pb[j].idx_; }, static_cast<int>(bbs.size()),
+			[pv, pb, &ndeg](int i, int j) { ndeg += bblock::popc64(pv[i].bb_ & pb[j].bb_); return true; });
 		return ndeg;
 	}
 
@@ -136,26 +127,16 @@ namespace bitgraph {
 	inline
 	int Ugraph<BBScanSp>::degree(int v, int UB, const BitsetSp& bbs) const
 	{
+		//merge of the block indices, stops when UB is reached (bbkernel_sparse.h)
+		const BitsetSp::SparseBlock* pv = adj_[v].bitset().data();
+		const BitsetSp::SparseBlock* pb = bbs.bitset().data();
 		int ndeg = 0;
-		auto itv = adj_[v].cbegin();
-		auto itbb = bbs.cbegin();
-
-		while (itv != adj_[v].cend() && itbb != bbs.cend()) {
+		bool completed = bbkernel::for_each_common_block(
+			[pv](int i) { return pv[i].idx_; }, static_cast<int>(adj_[v].size()),
+			[pb](int j) { return pb[j].idx_; }, static_cast<int>(bbs.size()),
+			[pv, pb, &ndeg, UB](int i, int j) { ndeg += bblock::popc64(pv[i].bb_ & pb[j].bb_); return ndeg < UB; });
 
-			if (itv->idx_ < itbb->idx_) {
-				++itv;
-			}
-			else if (itv->idx_ > itbb->idx_) {
-				++itbb;
-			}
-			else { //same index
-				ndeg += bblock::popc64(itv->bb_ & itbb->bb_);
-				if (ndeg >= UB) return UB;
-				++itv; ++itbb;
-			}
-		}
-
-		return ndeg;
+		return completed ? ndeg : UB;
 	}
 	
 	template<>
@@ -0,0 +1,47 @@
+/**
+  * @file simple_summary_graph.h
+  * @brief contains specializations the class Graph for graphs with SummaryBitset rows
+  *		   (dense bitsets with summary bitmaps of their non-empty bitblocks)
+  *
+  * @date 17/10/2026
+  * @author pss
+  */
+
+#ifndef __SIMPLE_SUMMARY_GRAPH_H__
+#define __SIMPLE_SUMMARY_GRAPH_H__
+
+#include "simple_graph.h"
+
+////////////////////////
+//
+// Specializations of class Graph<BitsetT> methods for summary graphs
+// with T = SummaryBitset
+//
+// note: this is facade type summary_graph
+
+namespace bitgraph {
+
+	template<>
+	inline Graph<SummaryBitset>& Graph<SummaryBitset>::create_subgraph(int first_k, Graph<SummaryBitset>& newg) const
+	{
+		//assertions
+		if (first_k >= NV_ || first_k <= 0) {
+			LOGG_WARNING("Bad new size ", first_k, " - graph remains unchanged - Graph<SummaryBitset>::create_subgraph");
+			return newg;
+		}
+
+		//allocates memory for the new graph
+		newg.reset(first_k);
+
+		//copies first k elements of the adjacency matrix (only the non-empty bitblocks of each row are visited)
+		for (int i = 0; i < newg.NV_; i++) {
+			newg.adj_[i] = adj_[i];
+			newg.adj_[i].erase_bit(first_k, -1);
+		}
+
+		return newg;
+	}
+
+}//end namespace bitgraph
+
+#endif
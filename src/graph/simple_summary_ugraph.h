@@ -0,0 +1,85 @@
+/**
+  * @file simple_summary_ugraph.h
+  * @brief contains specializations the class Ugraph for graphs with SummaryBitset rows
+  *		   (dense bitsets with summary bitmaps of their non-empty bitblocks)
+  *
+  * @created 17/10/2026
+  * @author pss
+  *
+  * This code is part of the GRAPH 1.0 C++ library
+  *
+  **/
+
+#ifndef __SIMPLE_SUMMARY_UGRAPH_H__
+#define __SIMPLE_SUMMARY_UGRAPH_H__
+
+#include "simple_summary_graph.h"
+#include "simple_ugraph.h"
+
+namespace bitgraph {
+
+	////////////////////////
+	//
+	// Specializations of class Ugraph<T> methods for summary graphs
+	//
+	// @brief T = Ugraph<SummaryBitset> with alias facade type summary_bitarray
+	// @details the generic versions visit every bitblock of the rows, the specializations
+	//			only the bitblocks which are non-empty in both operands (AND of the summary words)
+	//
+	////////////////////////
+
+	template<>
+	inline
+	int Ugraph<SummaryBitset>::degree_up(int v) const
+	{
+		return adj_[v].count(v + 1, -1);
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SummaryBitset>::degree<SummaryBitset, void>(int v, const SummaryBitset& bbn) const
+	{
+		return count_and(adj_[v], bbn);
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SummaryBitset>::degree<SummaryBitset, void>(int v, int UB, const SummaryBitset& bbn) const
+	{
+		//stops when UB is reached
+		_impl::SummaryFusedCursor2<_impl::fused_and> cursor(adj_[v], bbn);
+		int idx = 0, ndeg = 0;
+		BITBOARD bb = 0;
+		while (cursor.next(idx, bb)) {
+			if ((ndeg += bblock::popc64(bb)) >= UB) { return UB; }
+		}
+
+		return ndeg;
+	}
+
+	template<>
+	template<>
+	inline
+	int Ugraph<SummaryBitset>::degree_up<SummaryBitset, void>(int v, const SummaryBitset& bbn) const
+	{
+		const int nBB = WDIV(v);
+		int ndeg = 0;
+
+		//bitblock of v (truncated)
+		const BITBOARD bbv = adj_[v].block(nBB) & bbn.block(nBB) & ~bblock::MASK_1(0, WMOD(v));
+		ndeg += bblock::popc64(bbv);
+
+		//common non-empty bitblocks after v
+		_impl::for_each_common_block(adj_[v], bbn, [&](int i) {
+			if (i > nBB) { ndeg += bblock::popc64(adj_[v].block(i) & bbn.block(i)); }
+			return false;
+		});
+
+		return ndeg;
+	}
+
+}//end namespace bitgraph
+
+#endif
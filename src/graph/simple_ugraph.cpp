@@ -300,7 +300,7 @@ int Ugraph<T>::degree_up (int v, const BitSet& bbn) const	{
 	}
 
 	//truncate the bitblock of v
-	nDeg += bblock::popc64 ( bblock::MASK_1( WMOD(v) + 1, 63 ) &
+	nDeg += bblock::popc64 ( bblock::MASK_0_LOW(WMOD(v)) &
 							   ptype::adj_[v].block(nBB) & bbn.block(nBB)	
 							 );
 	
@@ -317,7 +317,7 @@ int Ugraph<T>::degree_up(int v) const
 	}
 
 	//truncate the bitblock of v
-	nDeg += bblock::popc64( bblock::MASK_1(WMOD(v) + 1, 63) &
+	nDeg += bblock::popc64( bblock::MASK_0_LOW(WMOD(v)) &
 							  ptype::adj_[v].block(nBB)	   );
 
 	return nDeg;
@@ -18,6 +18,9 @@
 #include "utils/prec_timer.h"
 #include "graph_types.h"
 
+#include <algorithm>
+#include <functional>
+
 
 namespace bitgraph {
 	
@@ -49,6 +52,12 @@ namespace bitgraph {
 		using bitset_type = typename BaseT::bitset_type;
 		using VertexBitset = typename BaseT::VertexBitset;											// alias for semantic type
 
+		//SFINAE filter - bitsets of the graph type outside the Bitset / BitsetSp hierarchies
+		template<class U>
+		using enable_if_native_bitset_t = typename std::enable_if<	std::is_same<U, BitsetT>::value &&
+																	!std::is_base_of<Bitset, U>::value &&
+																	!std::is_base_of<BitsetSp, U>::value	>::type;
+
 		//constructors - cannot all be inherited	
 		Ugraph() : Graph<BitsetT>() {}																// creates empty graph
 		explicit Ugraph(std::size_t n) : Graph<BitsetT>(n) {}										// creates empty graph of size n=|V|	
@@ -162,6 +171,22 @@ namespace bitgraph {
 		**/
 		int degree_up(int v, const Bitset& bbn)	const;  //TODO: test (27/4/2016)
 
+		/**
+		*  @brief overloads of degree(v, bbn), degree(v, UB, bbn) and degree_up(v, bbn) for a set of vertices
+		*		  of the same type as the rows of the adjacency matrix, when the type is
+		*		  outside the Bitset / BitsetSp hierarchies (e.g. FixedBitset<N>)
+		*
+		* @details: created 17/10/2026
+		**/
+		template<class U, class = enable_if_native_bitset_t<U>>
+		int degree(int v, const U& bbn) const;
+
+		template<class U, class = enable_if_native_bitset_t<U>>
+		int degree(int v, int UB, const U& bbn) const;
+
+		template<class U, class = enable_if_native_bitset_t<U>>
+		int degree_up(int v, const U& bbn) const;
+
 		/**
 		* @brief number of neighbors of v that come after v
 		*
@@ -209,6 +234,13 @@ namespace bitgraph {
 		**/
 		void add_edge(int v, int w)	override;
 
+		/**
+		* @brief Adds in bulk the bidirectional edges {v, w} parsed from a file (see gio::par readers),
+		*		 the rows are assembled in parallel (gio::par::assemble_rows)
+		* @details: the number of edges is updated (exact, as with add_edge)
+		**/
+		void add_edges(const gio::par::EdgeList& el, int nThreads = 0) override;
+
 		/**
 		* @brief Removes bidirectional edge {v, w}
 		*		 a) if self_loop (v = w), graph remains unchanged
@@ -248,6 +280,15 @@ namespace bitgraph {
 		**/
 		int create_subgraph(Ugraph& g, int v) const;
 
+	protected:
+		/**
+		* @brief rows of the subgraph induced by lv, projected with compress (lv strictly increasing)
+		* @returns false if the row type has no compress (caller falls back to is_edge)
+		**/
+		bool create_subgraph_compress(Ugraph& g, const VertexList& lv, std::true_type) const;
+		bool create_subgraph_compress(Ugraph& /*g*/, const VertexList& /*lv*/, std::false_type) const { return false; }
+	public:
+
 
 		////////////
 		// Write basic operations
@@ -521,6 +562,24 @@ namespace bitgraph {
 		}
 	}
 
+	template<class BitsetT>
+	inline
+		void Ugraph<BitsetT>::add_edges(const gio::par::EdgeList& el, int nThreads) {
+
+		gio::par::assemble_rows(el, this->NV_, true,
+			[this](int v, const int* first, const int* last) {
+				auto& row = this->adj_[v];
+				for (; first != last; ++first) { row.set_bit(*first); }
+			}, nThreads, _impl::ordered_rows<BitsetT>::value);
+
+		//exact edge count (each edge is in two rows), so that later edits keep it exact
+		std::size_t nEdges = 0;
+		for (int v = 0; v < this->NV_; ++v) {
+			nEdges += this->adj_[v].count();
+		}
+		this->NE_ = nEdges / 2;
+	}
+
 	template<class BitsetT>
 	inline
 		void Ugraph<BitsetT>::remove_edge(int v, int w) {
@@ -714,7 +773,55 @@ namespace bitgraph {
 		}
 
 		//truncate the bitblock of v
-		nDeg += bblock::popc64(bblock::MASK_1(WMOD(v) + 1, 63) &
+		nDeg += bblock::popc64(bblock::MASK_0_LOW(WMOD(v)) &
+			this->adj_[v].block(nBB) & bbn.block(nBB)
+		);
+
+		return nDeg;
+	}
+
+	template<class BitsetT>
+	template<class U, class>
+	inline
+		int Ugraph<BitsetT>::degree(int v, const U& bbn) const {
+
+		int ndeg = 0;
+		for (auto i = 0; i < this->NBB_; i++) {
+			ndeg += bblock::popc64(this->adj_[v].block(i) & bbn.block(i));
+		}
+
+		return ndeg;
+	}
+
+	template<class BitsetT>
+	template<class U, class>
+	inline
+		int Ugraph<BitsetT>::degree(int v, int UB, const U& bbn) const {
+
+		int nDeg = 0;
+		for (int i = 0; i < this->NBB_; ++i) {
+
+			nDeg += bblock::popc64(this->adj_[v].block(i) & bbn.block(i));
+
+			if (nDeg >= UB) { return UB; }
+		}
+
+		return nDeg;
+	}
+
+	template<class BitsetT>
+	template<class U, class>
+	inline
+		int Ugraph<BitsetT>::degree_up(int v, const U& bbn) const {
+
+		int nDeg = 0, nBB = WDIV(v);
+
+		for (int i = nBB + 1; i < this->NBB_; ++i) {
+			nDeg += bblock::popc64(this->adj_[v].block(i) & bbn.block(i));
+		}
+
+		//truncate the bitblock of v
+		nDeg += bblock::popc64(bblock::MASK_0_LOW(WMOD(v)) &
 			this->adj_[v].block(nBB) & bbn.block(nBB)
 		);
 
@@ -732,7 +839,7 @@ namespace bitgraph {
 		}
 
 		//truncate the bitblock of v
-		nDeg += bblock::popc64(bblock::MASK_1(WMOD(v) + 1, 63) &
+		nDeg += bblock::popc64(bblock::MASK_0_LOW(WMOD(v)) &
 			this->adj_[v].block(nBB));
 
 		return nDeg;
@@ -801,6 +908,12 @@ namespace bitgraph {
 		///////////////
 		ug.reset(lv.size());
 		///////////////
+
+		//sorted lists: one compress per row, O(|lv|*NV/64)
+		if (std::adjacent_find(lv.begin(), lv.end(), std::greater_equal<int>()) == lv.end() &&
+			create_subgraph_compress(ug, lv, _impl::has_compress<BitsetT>{})) {
+			return 0;
+		}
 		
 		//add appropiate edges
 		const int nV = static_cast<int>(lv.size());
@@ -816,6 +929,22 @@ namespace bitgraph {
 		return 0;
 	}
 
+	template<class BitsetT>
+	bool Ugraph<BitsetT>::create_subgraph_compress(Ugraph& ug, const VertexList& lv, std::true_type) const
+	{
+		BitsetT mask(this->NV_);
+		for (auto v : lv) {
+			mask.set_bit(v);
+		}
+
+		for (std::size_t i = 0; i < lv.size(); ++i) {
+			compress(this->adj_[lv[i]], mask, ug.adj_[i]);
+		}
+		ug.NE_ = 0;															//recomputed on demand
+
+		return true;
+	}
+
 }//end namespace bitgraph
 
 
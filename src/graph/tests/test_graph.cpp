@@ -286,6 +286,29 @@ TEST(Graph, neighbors){
 	///////////////////////////////////////
 }
 
+TEST(Graph, neighbors_view) {
+
+	const int NV = 130;
+
+	graph g(NV);
+	g.add_edge(0, 1);
+	g.add_edge(0, 129);
+	g.add_edge(1, 129);
+
+	//read-only view of N(0)
+	const graph& cg = g;
+	ConstBitsetView nv = cg.neighbors_view(0);
+	EXPECT_EQ(3, nv.num_blocks());
+	EXPECT_EQ(2, nv.count());
+	EXPECT_EQ(129, nv.msb());
+	EXPECT_EQ(1, nv.count_and(cg.neighbors_view(1)));
+
+	//writable view - modifies the adjacency matrix
+	g.neighbors_view(0).erase_bit(129);
+	EXPECT_FALSE(g.is_edge(0, 129));
+	EXPECT_EQ(1, g.neighbors(0).count());
+}
+
 TEST(Graph, is_edge){
 	
 	string path= PATH_GRAPH_TESTS_CMAKE_SRC_CODE;
@@ -421,6 +444,49 @@ TEST(Graph, create_subgraph){
 	
 }
 
+TEST(Graph, remove_vertices) {
+
+	const int NV = 130;
+
+	graph g(NV);
+	g.add_edge(0, 1);
+	g.add_edge(3, 0);						//backward edge
+	g.add_edge(2, 3);
+	g.add_edge(70, 129);
+	g.add_edge(129, 65);					//backward edge across blocks
+	g.add_edge(64, 65);
+
+	bitarray bbn(NV);
+	bbn.set_bit(1);
+	bbn.set_bit(64);
+
+	graph g1;
+	g.remove_vertices(bbn, g1);
+
+	////////////////////////////////////////
+	EXPECT_EQ(128, g1.num_vertices());
+	EXPECT_EQ(4, g1.num_edges());
+	EXPECT_TRUE(g1.is_edge(2, 0));			//3->0
+	EXPECT_TRUE(g1.is_edge(1, 2));			//2->3
+	EXPECT_TRUE(g1.is_edge(68, 127));		//70->129
+	EXPECT_TRUE(g1.is_edge(127, 63));		//129->65
+	EXPECT_FALSE(g1.is_edge(0, 2));
+	////////////////////////////////////////
+
+	//same result through the sparse rows
+	sparse_graph gs(NV);
+	gs.add_edge(3, 0);
+	gs.add_edge(129, 65);
+	gs.add_edge(64, 65);
+
+	sparse_graph gs1;
+	gs.remove_vertices(bbn, gs1);
+	EXPECT_EQ(128, gs1.num_vertices());
+	EXPECT_EQ(2, gs1.num_edges());
+	EXPECT_TRUE(gs1.is_edge(2, 0));
+	EXPECT_TRUE(gs1.is_edge(127, 63));
+}
+
 //////////////////
 //
 // CHECK THE FOLLOWING TESTS
@@ -0,0 +1,83 @@
+/**
+* @file test_graph_counted.cpp
+* @brief Unit tests specific to graphs with CountedBitset rows: the edge count is kept exact under all the edits
+* @details The tests shared by all the row types are in test_graph_rows.cpp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphCounted, edge_count_under_edits) {
+
+	counted_graph g(100);
+	g.add_edge(0, 1);
+	g.add_edge(1, 99);
+	g.add_edge(99, 0);
+
+	EXPECT_EQ(3u, g.num_edges());
+	EXPECT_EQ(1, g.degree_out(0));
+
+	//repeated and missing edges do not change the edge count
+	g.add_edge(0, 1);
+	g.remove_edge(5, 6);
+	EXPECT_EQ(3u, g.num_edges());
+	EXPECT_EQ(3u, g.num_edges(false));
+
+	g.remove_edge(0, 1);
+	EXPECT_EQ(2u, g.num_edges());
+	EXPECT_DOUBLE_EQ(2.0 / (100 * 99), g.density());
+
+	counted_ugraph ug(5);
+	ug.add_edge(0, 1);
+	ug.add_edge(0, 2);
+	ug.add_edge(0, 3);
+	ug.add_edge(1, 3);
+
+	EXPECT_EQ(4u, ug.num_edges());
+
+	ug.add_edge(3, 0);								//already in the graph
+	ug.remove_edge(2, 4);							//not in the graph
+	EXPECT_EQ(4u, ug.num_edges());
+	EXPECT_EQ(3, ug.degree(0));
+	EXPECT_EQ(2, ug.degree(3));
+	EXPECT_EQ(2, ug.degree_up(1) + ug.degree_up(3) + 1);
+	EXPECT_EQ(3, ug.max_graph_degree());
+
+	ug.remove_edge(3, 0);
+	EXPECT_EQ(3u, ug.num_edges());
+	EXPECT_EQ(3u, ug.num_edges(false));
+	EXPECT_EQ(2, ug.degree(0));
+
+	ug.remove_edges(1);
+	EXPECT_EQ(1u, ug.num_edges());
+}
+
+TEST(GraphCounted, edits_brock) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	counted_ugraph ugc(filename);
+
+	//edits keep the lazy edge count exact
+	for (int v = 1; v < 100; ++v) {
+		ug.remove_edge(0, v);
+		ugc.remove_edge(0, v);
+	}
+	EXPECT_EQ(ug.num_edges(false), ugc.num_edges());
+
+	//subgraph
+	counted_ugraph ugs;
+	ugc.counted_graph::create_subgraph(150, ugs);
+	EXPECT_EQ(150, ugs.num_vertices());
+	for (int v = 0; v < 150; ++v) {
+		EXPECT_EQ(ugc.neighbors(v).count(0, 149), ugs.degree(v));
+	}
+}
@@ -0,0 +1,245 @@
+/**
+* @file test_graph_csr.cpp
+* @brief Unit tests of the CsrUgraph class (compressed sparse rows) and of its use in KCore and GraphFastRootSort
+* @details Compares the CSR rows with the bitset rows of ugraph (BBScan) and sparse_ugraph (BBScanSp)
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphCsr, construction) {
+
+	csr_ugraph g(130);
+	g.add_edge(0, 1);
+	g.add_edge(1, 0);										//duplicate
+	g.add_edge(5, 5);										//self loop - ignored
+	g.add_edge(129, 0);
+	g.add_edge(64, 63);
+	EXPECT_FALSE(g.is_built());
+	g.build();
+
+	EXPECT_TRUE(g.is_built());
+	EXPECT_EQ(130, g.num_vertices());
+	EXPECT_EQ(3u, g.num_edges());
+	EXPECT_TRUE(g.is_edge(0, 129));
+	EXPECT_TRUE(g.is_edge(129, 0));
+	EXPECT_TRUE(g.is_edge(63, 64));
+	EXPECT_FALSE(g.is_edge(5, 5));
+	EXPECT_FALSE(g.is_edge(1, 2));
+	EXPECT_EQ(2, g.degree(0));
+	EXPECT_EQ(1, g.degree_up(63));
+	EXPECT_EQ(0, g.degree_up(64));
+	EXPECT_EQ(2, g.max_graph_degree());
+	EXPECT_EQ(vector<int>({ 1, 129 }), vector<int>(g.neighbors(0).begin(), g.neighbors(0).end()));
+
+	//edges staged on a built graph are merged
+	g.add_edge(0, 64);
+	g.add_edge(129, 0);
+	g.build();
+	EXPECT_EQ(4u, g.num_edges());
+	EXPECT_EQ(vector<int>({ 1, 64, 129 }), vector<int>(g.neighbors(0).begin(), g.neighbors(0).end()));
+	EXPECT_EQ(vector<int>({ 0, 63 }), vector<int>(g.neighbors(64).begin(), g.neighbors(64).end()));
+	EXPECT_EQ(8u, g.targets().size());
+
+	//materialized neighborhoods
+	BBScan bb(130);
+	BBScanSp bbs(130);
+	EXPECT_EQ(bitpos_list({ 1, 64, 129 }), bitpos_list(g.neighbors(0, bb)));
+	EXPECT_EQ(bitpos_list({ 1, 64, 129 }), bitpos_list(g.neighbors(0, bbs)));
+	EXPECT_EQ(bitpos_list({ 0, 63 }), bitpos_list(g.neighbors(64, bb)));
+
+	//neighbors in a set of vertices
+	BBScan bbn(130, { 1, 63, 129 });
+	EXPECT_EQ(2, g.degree(0, bbn));
+	vector<int> lw;
+	for (int w : bits_and(g.neighbors(0), bbn)) { lw.push_back(w); }
+	EXPECT_EQ(vector<int>({ 1, 129 }), lw);
+}
+
+TEST(GraphCsr, read_brock) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	csr_ugraph cg(filename);
+	const int NV = ug.num_vertices();
+
+	EXPECT_EQ(ug.num_vertices(), cg.num_vertices());
+	EXPECT_EQ(ug.num_edges(), cg.num_edges());
+	EXPECT_DOUBLE_EQ(ug.density(), cg.density());
+	EXPECT_EQ(ug.max_graph_degree(), cg.max_graph_degree());
+	EXPECT_EQ(ug.name(), cg.name());
+
+	//subgraph induced by the vertices in [70, 140) and the odd vertices
+	vector<int> lv;
+	for (int v = 0; v < NV; ++v) {
+		if ((v >= 70 && v < 140) || v % 2) { lv.push_back(v); }
+	}
+	ugraph::bitset_type bbs(NV, lv);
+
+	ugraph::bitset_type bb(NV);
+	for (int v = 0; v < NV; ++v) {
+		EXPECT_EQ(ug.degree(v), cg.degree(v));
+		EXPECT_EQ(ug.degree(v, bbs), cg.degree(v, bbs));
+		EXPECT_TRUE(ug.neighbors(v) == cg.neighbors(v, bb));
+		for (int w = 0; w < NV; ++w) {
+			EXPECT_EQ(ug.is_edge(v, w), cg.is_edge(v, w));
+		}
+	}
+
+	//from the full matrix
+	csr_ugraph cg2(ug);
+	EXPECT_EQ(cg.offsets(), cg2.offsets());
+	EXPECT_EQ(cg.targets(), cg2.targets());
+
+	//induced subgraphs in a graph with bitset rows
+	ugraph sg, sg_csr;
+	EXPECT_EQ(0, ug.create_subgraph(sg, lv));
+	EXPECT_EQ(0, cg.create_subgraph(sg_csr, lv));
+	EXPECT_TRUE(sg == sg_csr);
+
+	//unsorted set of vertices
+	vector<int> lv2 = { 150, 3, 77, 12, 199, 0, 64 };
+	EXPECT_EQ(0, ug.create_subgraph(sg, lv2));
+	EXPECT_EQ(0, cg.create_subgraph(sg_csr, lv2));
+	EXPECT_TRUE(sg == sg_csr);
+
+	//and in a CSR graph
+	csr_ugraph csg;
+	EXPECT_EQ(0, cg.create_subgraph(csg, lv2));
+	EXPECT_EQ(sg.num_edges(), csg.num_edges());
+}
+
+TEST(GraphCsr, readers) {
+
+	for (string file : { "bio-yeast.mtx", "ia-southernwomen.edges" }) {
+		string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE + file;
+		sparse_ugraph sg(filename);
+		csr_ugraph cg(filename);
+
+		EXPECT_TRUE(cg.is_built());
+		EXPECT_EQ(sg.num_vertices(), cg.num_vertices());
+		EXPECT_EQ(sg.num_edges(), cg.num_edges());
+		for (int v = 0; v < sg.num_vertices(); ++v) {
+			EXPECT_EQ(sg.degree(v), cg.degree(v));
+		}
+	}
+}
+
+TEST(GraphCsr, kcore) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq";
+	ugraph ug(filename);
+	csr_ugraph cg(filename);
+	const int NV = ug.num_vertices();
+
+	KCore<ugraph> kc(ug);
+	KCore<csr_ugraph> kcc(cg);
+	EXPECT_EQ(0, kc.find_kcore());
+	EXPECT_EQ(0, kcc.find_kcore());
+	EXPECT_EQ(kc.coreness_numbers(), kcc.coreness_numbers());
+	EXPECT_EQ(kc.max_core_number(), kcc.max_core_number());
+	EXPECT_EQ(kc.minimum_width(), kcc.minimum_width());
+
+	//induced subgraph
+	vector<int> lv;
+	for (int v = 0; v < NV; v += 3) { lv.push_back(v); }
+	KCore<ugraph> kcs(ug, lv);
+	KCore<csr_ugraph> kccs(cg, lv);
+	EXPECT_EQ(0, kcs.find_kcore(true));
+	EXPECT_EQ(0, kccs.find_kcore(true));
+	for (int v : lv) {
+		EXPECT_EQ(kcs.coreness(v), kccs.coreness(v));
+	}
+
+	//ego-networks of the vertices in degeneracy order: the later neighbors of v (at most the core number of v)
+	const VertexList& ord = kcc.kcore_ordering();
+	VertexList rank(NV);
+	for (int i = 0; i < NV; ++i) { rank[ord[i]] = i; }
+
+	ugraph ego;
+	VertexList lw;
+	for (int v = 0; v < NV; ++v) {
+		if (cg.create_ego_subgraph(ego, v, rank, lw) == -1) { continue; }
+		EXPECT_LE(ego.num_vertices(), kcc.max_core_number());
+		for (int i = 0; i < ego.num_vertices(); ++i) {
+			EXPECT_TRUE(cg.is_edge(v, lw[i]));
+			EXPECT_GT(rank[lw[i]], rank[v]);
+			for (int j = i + 1; j < ego.num_vertices(); ++j) {
+				EXPECT_EQ(cg.is_edge(lw[i], lw[j]), ego.is_edge(i, j));
+			}
+		}
+	}
+}
+
+TEST(GraphCsr, minimum_width) {
+
+	//K4 {0, 1, 2, 3}, pendant vertex 4 on 0 and path 5-6-7: width 3 (the K4 is the 3-core)
+	ugraph ug(8);
+	csr_ugraph cg(8);
+	for (auto e : vector<pair<int, int>>{ {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {0, 4}, {5, 6}, {6, 7} }) {
+		ug.add_edge(e.first, e.second);
+		cg.add_edge(e.first, e.second);
+	}
+	cg.build();
+
+	KCore<ugraph> kc(ug);
+	KCore<csr_ugraph> kcc(cg);
+	kc.find_kcore();
+	kcc.find_kcore();
+	EXPECT_EQ(3, kc.minimum_width());
+	EXPECT_EQ(3, kcc.minimum_width());
+
+	//5-cycle: width 2
+	ugraph uc(5);
+	for (int v = 0; v < 5; ++v) { uc.add_edge(v, (v + 1) % 5); }
+	KCore<ugraph> kcc5(uc);
+	kcc5.find_kcore();
+	EXPECT_EQ(2, kcc5.minimum_width());
+
+	//star K1,4: width 1, but 4 if the center goes first (reversed degeneracy ordering)
+	ugraph us(5);
+	for (int v = 1; v < 5; ++v) { us.add_edge(0, v); }
+	KCore<ugraph> kcs(us);
+	kcs.find_kcore();
+	EXPECT_EQ(1, kcs.minimum_width());
+	EXPECT_EQ(4, kcs.minimum_width(true));
+}
+
+TEST(GraphCsr, fast_sort) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	csr_ugraph cg(filename);
+
+	for (int alg : { GraphFastRootSort<ugraph>::MIN_DEGEN, GraphFastRootSort<ugraph>::MAX_DEGEN,
+		GraphFastRootSort<ugraph>::MAX, GraphFastRootSort<ugraph>::MIN_WITH_SUPPORT }) {
+
+		GraphFastRootSort<ugraph> gfs(ug);
+		GraphFastRootSort<csr_ugraph> gfsc(cg);
+		VertexOrdering o2n = gfs.new_order(alg);
+		EXPECT_EQ(o2n, gfsc.new_order(alg));
+
+		//isomorphism
+		ugraph ugn;
+		csr_ugraph cgn;
+		gfs.reorder(o2n, ugn);
+		gfsc.reorder(o2n, cgn);
+		EXPECT_EQ(ugn.num_edges(), cgn.num_edges());
+		EXPECT_EQ(cgn.num_edges(), GraphFastRootSort<csr_ugraph>::reorder(cg, o2n).num_edges());
+		ugraph::bitset_type bb(ugn.num_vertices());
+		for (int v = 0; v < ugn.num_vertices(); ++v) {
+			EXPECT_EQ(ugn.degree(v), cgn.degree(v));
+			EXPECT_TRUE(ugn.neighbors(v) == cgn.neighbors(v, bb));
+		}
+	}
+}
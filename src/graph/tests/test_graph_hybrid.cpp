@@ -0,0 +1,72 @@
+/**
+* @file test_graph_hybrid.cpp
+* @brief Unit tests specific to graphs with HybridBitset rows: large sparse instances (MTX / EDGES formats),
+*		 against the sparse_ugraph (BBScanSp) type
+* @details The tests shared by all the row types are in test_graph_rows.cpp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/kcore.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphHybrid, read_mtx_edges) {
+
+	for (string name : { "bio-yeast.mtx", "bio-yeast-protein-inter.edges", "ia-southernwomen.edges" }) {
+		string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE + name;
+		ugraph ug(filename);
+		sparse_ugraph ugs(filename);
+		hybrid_ugraph ugh(filename);
+
+		EXPECT_EQ(ugs.num_vertices(), ugh.num_vertices());
+		EXPECT_EQ(ug.num_edges(false), ugh.num_edges(false));
+		for (int v = 0; v < ugs.num_vertices(); ++v) {
+			EXPECT_EQ(ugs.degree(v), ugh.degree(v));
+
+			int nDegUp = 0;
+			for (int w = v + 1; w < ug.num_vertices(); ++w) {
+				nDegUp += ug.is_edge(v, w);
+			}
+			EXPECT_EQ(nDegUp, ugh.degree_up(v));
+		}
+	}
+}
+
+TEST(GraphHybrid, kcore_sparse) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "bio-yeast.mtx";
+	ugraph ug(filename);
+	hybrid_ugraph ugh(filename);
+
+	//full graph
+	KCore<ugraph> kc(ug);
+	KCore<hybrid_ugraph> kch(ugh);
+	kc.find_kcore();
+	kch.find_kcore();
+
+	EXPECT_EQ(kc.max_core_number(), kch.max_core_number());
+	EXPECT_EQ(kc.coreness_numbers(), kch.coreness_numbers());
+	EXPECT_EQ(kc.kcore_ordering(), kch.kcore_ordering());
+
+	//degrees in the subgraph induced by the even vertices
+	vector<int> lv;
+	for (int v = 0; v < ug.num_vertices(); v += 2) {
+		lv.push_back(v);
+	}
+	ugraph::bitset_type bbs(ug.num_vertices(), lv);
+	hybrid_ugraph::bitset_type bbsh(ugh.num_vertices(), lv);
+
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		EXPECT_EQ(ug.degree(v, bbs), ugh.degree(v, bbsh));
+		EXPECT_EQ(ug.degree(v, 3, bbs), ugh.degree(v, 3, bbsh));
+
+		EXPECT_EQ(ug.degree_up(v, bbs), ugh.degree_up(v, bbsh));
+	}
+}
@@ -0,0 +1,126 @@
+/**
+* @file test_graph_packed.cpp
+* @brief Unit tests of the PackedUgraph class (upper triangle of the adjacency matrix)
+* @details Every query is checked against the ugraph (BBScan) type, on brock200_1 and on random graphs
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "gtest/gtest.h"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphPacked, construction) {
+
+	packed_ugraph g(130);
+	g.add_edge(0, 1);
+	g.add_edge(1, 0);										//already in the graph
+	g.add_edge(5, 5);										//self loop - ignored
+	g.add_edge(129, 0);
+	g.add_edge(64, 63);
+	g.add_edge(64, 127);
+
+	EXPECT_EQ(130, g.num_vertices());
+	EXPECT_EQ(3, g.num_blocks());
+	EXPECT_EQ(4u, g.num_edges());
+	EXPECT_EQ(4u, g.num_edges(false));
+	EXPECT_TRUE(g.is_edge(0, 129));
+	EXPECT_TRUE(g.is_edge(129, 0));
+	EXPECT_TRUE(g.is_edge(63, 64));
+	EXPECT_FALSE(g.is_edge(5, 5));
+	EXPECT_FALSE(g.is_edge(1, 2));
+	EXPECT_EQ(2, g.degree(0));
+	EXPECT_EQ(2, g.degree(64));
+	EXPECT_EQ(1, g.degree_up(64));
+	EXPECT_EQ(1, g.degree_low(64));
+
+	//upper triangle: 64 rows of 3 bitblocks, 64 of 2, 2 of 1
+	EXPECT_EQ(64u * 3 + 64u * 2 + 2u, g.num_packed_blocks());
+
+	//reconstructed neighborhoods
+	EXPECT_EQ(bitpos_list({ 1, 129 }), bitpos_list(g.neighbors(0)));
+	EXPECT_EQ(bitpos_list({ 63, 127 }), bitpos_list(g.neighbors(64)));
+
+	//the cached rows follow the edits
+	const auto& n64 = g.neighbors(64);
+	g.remove_edge(127, 64);
+	g.add_edge(64, 100);
+	EXPECT_EQ(bitpos_list({ 63, 100 }), bitpos_list(n64));
+	EXPECT_EQ(bitpos_list({ 64 }), bitpos_list(g.neighbors(100)));
+	EXPECT_EQ(4u, g.num_edges());
+}
+
+TEST(GraphPacked, read_brock) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	packed_ugraph pg(filename);
+	const int NV = ug.num_vertices();
+
+	EXPECT_EQ(ug.num_vertices(), pg.num_vertices());
+	EXPECT_EQ(ug.num_edges(), pg.num_edges());
+	EXPECT_EQ(ug.num_edges(), pg.num_edges(false));
+	EXPECT_DOUBLE_EQ(ug.density(), pg.density());
+	EXPECT_EQ(ug.max_graph_degree(), pg.max_graph_degree());
+	EXPECT_LT(pg.num_packed_blocks(), static_cast<std::size_t>(NV * ug.num_blocks()) / 2 + NV);
+
+	//subgraph induced by the vertices in [70, 140) and the odd vertices
+	vector<int> lv;
+	for (int v = 0; v < NV; ++v) {
+		if ((v >= 70 && v < 140) || v % 2) { lv.push_back(v); }
+	}
+	ugraph::bitset_type bbs(NV, lv);
+
+	for (int v = 0; v < NV; ++v) {
+		EXPECT_EQ(ug.degree(v), pg.degree(v));
+		EXPECT_EQ(ug.degree(v, bbs), pg.degree(v, bbs));
+		EXPECT_TRUE(ug.neighbors(v) == pg.neighbors(v));
+		for (int w = 0; w < NV; ++w) {
+			EXPECT_EQ(ug.is_edge(v, w), pg.is_edge(v, w));
+		}
+	}
+
+	//from / to the full matrix
+	packed_ugraph pg2(ug);
+	EXPECT_EQ(ug.num_edges(), pg2.num_edges());
+	ugraph ug2;
+	pg2.to_ugraph(ug2);
+	EXPECT_TRUE(ug == ug2);
+}
+
+TEST(GraphPacked, random) {
+
+	//random graph with a number of vertices not multiple of 64, random edits
+	const int NV = 301;
+	std::mt19937 gen(7);
+	std::uniform_int_distribution<int> vertex(0, NV - 1);
+
+	ugraph ug(NV);
+	packed_ugraph pg(NV);
+	for (int i = 0; i < 20000; ++i) {
+		const int v = vertex(gen), w = vertex(gen);
+		if (i % 3 == 2) {
+			if (ug.is_edge(v, w)) { ug.remove_edge(v, w); }
+			pg.remove_edge(v, w);
+		}
+		else {
+			if (v != w && !ug.is_edge(v, w)) { ug.add_edge(v, w); }
+			pg.add_edge(v, w);
+		}
+	}
+
+	EXPECT_EQ(ug.num_edges(false), pg.num_edges());
+	EXPECT_EQ(pg.num_edges(), pg.num_edges(false));
+
+	ugraph::bitset_type bb(NV);
+	for (int v = 0; v < NV; ++v) {
+		EXPECT_EQ(ug.degree(v), pg.degree(v));
+		EXPECT_TRUE(ug.neighbors(v) == pg.neighbors(v, bb));
+	}
+}
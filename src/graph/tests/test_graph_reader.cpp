@@ -0,0 +1,471 @@
+/**
+* @file test_graph_reader.cpp
+* @brief Unit tests of the memory-mapped, multi-threaded graph readers (gio::par) for DIMACS, MTX and EDGES formats
+* @details Results are checked against the stream readers of PackedUgraph (DIMACS) and MMI / EDGES (MTX, EDGES formats),
+*		   and against single-threaded parsing (chunks split at every line boundary case)
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/formats/parallel_reader.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+using edge_list = vector<pair<int, int>>;
+
+//////////////////
+// all the parsed edges, in file order
+
+edge_list all_edges(const gio::par::EdgeList& el) {
+	edge_list le;
+	for (const auto& p : el.parts) { le.insert(le.end(), p.edges.begin(), p.edges.end()); }
+	return le;
+}
+
+//////////////////
+// TRUE if both graphs have the same edges
+
+template<class G1, class G2>
+bool same_edges(const G1& g1, const G2& g2) {
+	if (g1.num_vertices() != g2.num_vertices()) { return false; }
+	for (int v = 0; v < g1.num_vertices(); ++v) {
+		for (int w = 0; w < g1.num_vertices(); ++w) {
+			if (g1.is_edge(v, w) != g2.is_edge(v, w)) { return false; }
+		}
+	}
+	return true;
+}
+
+TEST(GraphReader, parse_dimacs_threads) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+
+	gio::par::EdgeList el1;
+	EXPECT_EQ(0, gio::par::parse_dimacs(filename, el1, 1));
+	EXPECT_EQ(200, el1.NV);
+	EXPECT_EQ(14834u, el1.NE);
+	EXPECT_EQ(el1.NE, el1.num_edges());
+	EXPECT_EQ(1, el1.stats.nThreads);
+	EXPECT_LT(0u, el1.stats.bytes);
+
+	//chunks are line-aligned: same edges, in the same order, for any number of threads
+	for (int nThreads : { 2, 3, 7, 64 }) {
+		gio::par::EdgeList el;
+		EXPECT_EQ(0, gio::par::parse_dimacs(filename, el, nThreads));
+		EXPECT_EQ(nThreads, static_cast<int>(el.parts.size()));
+		EXPECT_EQ(all_edges(el1), all_edges(el));
+	}
+}
+
+TEST(GraphReader, dimacs) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq";
+	ugraph ug(filename);
+	sparse_ugraph sg(filename);
+	packed_ugraph pg(filename);								//stream reader
+	csr_ugraph cg(filename);
+
+	EXPECT_EQ(pg.num_edges(), ug.num_edges());
+	EXPECT_EQ(pg.num_edges(), sg.num_edges());
+	EXPECT_EQ(pg.num_edges(), cg.num_edges());
+	EXPECT_TRUE(same_edges(pg, ug));
+	EXPECT_TRUE(same_edges(pg, sg));
+	EXPECT_TRUE(same_edges(pg, cg));
+	EXPECT_EQ(pg.name(), ug.name());
+
+	//rows assembled by several threads
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(filename, el, 3));
+	for (int nThreads : { 1, 2, 5 }) {
+		ugraph ug2(el.NV);
+		sparse_ugraph sg2(el.NV);
+		ug2.add_edges(el, nThreads);
+		sg2.add_edges(el, nThreads);
+		EXPECT_TRUE(ug == ug2);
+		EXPECT_TRUE(same_edges(ug, sg2));
+		EXPECT_EQ(ug.num_edges(), ug2.num_edges());
+	}
+
+	//directed graph: only {v -> w} for the lines e <v> <w>
+	graph g(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "sample.clq");
+	EXPECT_EQ(7, g.num_vertices());
+	EXPECT_EQ(11u, g.num_edges());
+	EXPECT_TRUE(g.is_edge(1, 0));
+	EXPECT_FALSE(g.is_edge(0, 1));
+}
+
+TEST(GraphReader, assemble_rows) {
+
+	//several parsing buffers and row partitions (2^13 rows each)
+	const int NV = 40000;
+	gio::par::EdgeList el;
+	el.NV = NV;
+	el.parts.resize(3);
+	for (int i = 0; i < 60000; ++i) {
+		const int v = (i * 7919) % NV;
+		const int w = (v + 1 + (i % 97) * 331) % NV;
+		el.parts[i % 3].edges.emplace_back(v, w);
+	}
+	el.parts[1].edges.emplace_back(5, 39999);						//duplicate edges
+	el.parts[2].edges.emplace_back(39999, 5);
+
+	ugraph ug(NV);
+	for (const auto& p : el.parts) {
+		for (const auto& e : p.edges) { ug.add_edge(e.first, e.second); }
+	}
+
+	for (int nThreads : { 1, 2, 4 }) {
+		ugraph ug2(NV);
+		sparse_ugraph sg(NV);
+		ug2.add_edges(el, nThreads);
+		sg.add_edges(el, nThreads);
+		EXPECT_TRUE(ug == ug2);
+		EXPECT_EQ(ug.num_edges(false), ug2.num_edges());
+		EXPECT_EQ(ug.num_edges(false), sg.num_edges());
+		for (int v = 0; v < NV; v += 101) {
+			EXPECT_EQ(ug.degree(v), sg.degree(v));
+		}
+
+		//sorted rows, without duplicates
+		vector<int> deg(NV, 0);
+		bool ordered = true;
+		gio::par::assemble_rows(el, NV, true, [&](int v, const int* first, const int* last) {
+			deg[v] += static_cast<int>(last - first);
+			ordered = ordered && std::adjacent_find(first, last, [](int a, int b) { return a >= b; }) == last;
+		}, nThreads);
+		EXPECT_TRUE(ordered);
+		for (int v = 0; v < NV; v += 101) {
+			EXPECT_EQ(ug.degree(v), deg[v]);
+		}
+
+		//directed
+		graph g(NV), g2(NV);
+		for (const auto& p : el.parts) {
+			for (const auto& e : p.edges) { g.add_edge(e.first, e.second); }
+		}
+		g2.add_edges(el, nThreads);
+		EXPECT_TRUE(g == g2);
+	}
+}
+
+TEST(GraphReader, mtx_edges) {
+
+	for (string file : { "bio-yeast.mtx", "ia-southernwomen.edges", "bio-MUTAG_g1.edges" }) {
+		string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE + file;
+		const bool mtx = (file.find(".mtx") != string::npos);
+
+		//stream readers
+		packed_ugraph pg;
+		if (mtx) {
+			MMI<packed_ugraph> reader(pg);
+			EXPECT_EQ(0, reader.read(filename));
+		}
+		else {
+			EDGES<packed_ugraph> reader(filename, pg);
+			EXPECT_EQ(0, reader.read());
+		}
+
+		sparse_ugraph sg(filename);
+		csr_ugraph cg(filename);
+		EXPECT_EQ(pg.num_vertices(), sg.num_vertices());
+		EXPECT_EQ(pg.num_edges(), sg.num_edges());
+		EXPECT_EQ(pg.num_edges(), cg.num_edges());
+		EXPECT_TRUE(same_edges(pg, sg));
+
+		gio::par::EdgeList el1, el4;
+		EXPECT_EQ(0, mtx ? gio::par::parse_mtx(filename, el1, 1) : gio::par::parse_edges(filename, el1, 1));
+		EXPECT_EQ(0, mtx ? gio::par::parse_mtx(filename, el4, 4) : gio::par::parse_edges(filename, el4, 4));
+		EXPECT_EQ(el1.NV, el4.NV);
+		EXPECT_EQ(all_edges(el1), all_edges(el4));
+	}
+
+	//bad banner (%MatrixMarket)
+	gio::par::EdgeList el;
+	EXPECT_EQ(-1, gio::par::parse_mtx(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "bio-yeast_bad_header.mtx", el));
+	EXPECT_EQ(-1, gio::par::parse_mtx(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "not_a_file.mtx", el));
+}
+
+TEST(GraphReader, format_details) {
+
+	//CRLF line endings, comments, blank lines, vertex-weights, a self-loop, trailing text
+	//and no end of line at the end of the file
+	string filename = "test_graph_reader_tmp.clq";
+	{
+		ofstream f(filename, ios::binary);
+		f << "c test file\r\n\r\np edge 6 5\r\nc comment\r\nn 1 4\r\n  e 1 2\r\n\te 2 3 \r\ne 4 4\r\n"
+			<< "e 6 1\r\n\r\nc another comment\r\ne 5 6\r\nEND";
+	}
+
+	for (int nThreads : { 1, 2, 3, 5, 50 }) {
+		gio::par::EdgeList el;
+		EXPECT_EQ(0, gio::par::parse_dimacs(filename, el, nThreads));
+		EXPECT_EQ(6, el.NV);
+		EXPECT_EQ(5u, el.NE);
+		EXPECT_EQ(edge_list({ {0, 1}, {1, 2}, {5, 0}, {4, 5} }), all_edges(el));
+		EXPECT_EQ(1u, el.num_loops());
+	}
+
+	ugraph ug(filename);
+	EXPECT_EQ(6, ug.num_vertices());
+	EXPECT_EQ(4u, ug.num_edges());
+	EXPECT_TRUE(ug.is_edge(0, 5));
+
+	//vertex out of range
+	{
+		ofstream f(filename, ios::binary);
+		f << "p edge 3 2\ne 1 2\ne 2 4\n";
+	}
+	gio::par::EdgeList el;
+	EXPECT_EQ(-1, gio::par::parse_dimacs(filename, el));
+
+	//edge lists: number of vertices is the maximum vertex index
+	{
+		ofstream f(filename, ios::binary);
+		f << "# comment\n% comment\n1 2\n2 9 1.5\n\n3 3";
+	}
+	EXPECT_EQ(0, gio::par::parse_edges(filename, el, 2));
+	EXPECT_EQ(9, el.NV);
+	EXPECT_EQ(edge_list({ {0, 1}, {1, 8} }), all_edges(el));
+	EXPECT_EQ(1u, el.num_loops());
+
+	std::remove(filename.c_str());
+}
+
+TEST(GraphReader, weighted_dimacs) {
+
+	//vertex and edge-weights
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "toy_ew_dimacs.txt";
+	ugraph_ewi ugew(filename);
+
+	EXPECT_EQ(5, ugew.num_vertices());
+	EXPECT_EQ(5u, ugew.num_edges());
+	EXPECT_EQ(10, ugew.weight(0));
+	EXPECT_EQ(50, ugew.weight(4));
+	EXPECT_EQ(27, ugew.weight(0, 1));
+	EXPECT_EQ(27, ugew.weight(1, 0));
+	EXPECT_EQ(57, ugew.weight(2, 4));
+	EXPECT_EQ(67, ugew.weight(4, 3));
+
+	gio::par::WeightedEdgeList<double> el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(filename, el, true, 3));
+	EXPECT_TRUE(el.edge_weights);
+	EXPECT_EQ(3u, el.we.size());
+
+	//vertex-weights only
+	ugraph_wi ugw(filename);
+	EXPECT_EQ(5u, ugw.graph().num_edges());
+	EXPECT_EQ(10, ugw.weight(0));
+	EXPECT_EQ(40, ugw.weight(3));
+
+	//no edge-weights in the file
+	ugraph_ewi ugew2(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "sample.clq");
+	EXPECT_EQ(11u, ugew2.num_edges());
+	EXPECT_EQ(ugraph_ewi::NO_WEIGHT, ugew2.weight(1, 0));
+	EXPECT_EQ(ugraph_ewi::NO_WEIGHT, ugew2.weight(0, 1));
+}
+
+TEST(GraphReader, edge_count_after_read) {
+
+	//the edge count after reading is exact, so that later edits keep it exact
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	graph g(filename);
+	ugraph_wi ugw(filename);
+	EXPECT_EQ(14834u, ug.num_edges());
+	EXPECT_EQ(g.num_edges(false), g.num_edges());
+	EXPECT_EQ(14834u, ugw.graph().num_edges());
+
+	int v = 0, w = ug.neighbors(0).lsb();
+	ug.remove_edge(v, w);
+	ug.remove_edge(v, ug.neighbors(0).lsb());
+	EXPECT_EQ(14832u, ug.num_edges());
+	ug.add_edge(v, w);
+	EXPECT_EQ(14833u, ug.num_edges());
+	EXPECT_EQ(ug.num_edges(false), ug.num_edges());
+
+	const size_t NE = g.num_edges();
+	int u = 0;
+	while (g.neighbors(u).is_empty()) { ++u; }
+	g.remove_edge(u, g.neighbors(u).lsb());
+	EXPECT_EQ(NE - 1, g.num_edges());
+	EXPECT_EQ(g.num_edges(false), g.num_edges());
+
+	ugw.graph().remove_edge(v, w);
+	EXPECT_EQ(14833u, ugw.graph().num_edges());
+
+	//MTX and EDGES formats
+	for (string file : { "bio-yeast.mtx", "ia-southernwomen.edges" }) {
+		sparse_ugraph sg(PATH_GRAPH_TESTS_CMAKE_SRC_CODE + file);
+		const size_t NES = sg.num_edges(false);
+		EXPECT_EQ(NES, sg.num_edges());
+		u = 0;
+		while (sg.neighbors(u).is_empty()) { ++u; }
+		sg.remove_edge(u, sg.neighbors(u).lsb());
+		EXPECT_EQ(NES - 1, sg.num_edges());
+		int x = sg.num_vertices() - 1;
+		while (x == u || sg.is_edge(u, x)) { --x; }
+		sg.add_edge(u, x);
+		EXPECT_EQ(NES, sg.num_edges());
+		EXPECT_EQ(sg.num_edges(false), sg.num_edges());
+	}
+}
+
+//////////////////
+// reading behavior of the parallel parsers (differences with the stream readers)
+
+namespace {
+
+	const string TMP_FILE = "test_graph_reader_tmp.txt";
+
+	void write_tmp(const string& contents) {
+		ofstream f(TMP_FILE, ios::binary);
+		f << contents;
+	}
+}
+
+TEST(GraphReader, dimacs_reads_all_edge_lines) {
+
+	//more 'e' lines than declared in the header: all of them are read (warning)
+	write_tmp("p edge 4 1\ne 1 2\ne 3 4\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(TMP_FILE, el));
+	EXPECT_EQ(1u, el.NE);
+	EXPECT_EQ(edge_list({ {0, 1}, {2, 3} }), all_edges(el));
+
+	ugraph ug(TMP_FILE);
+	EXPECT_EQ(2u, ug.num_edges());
+	EXPECT_TRUE(ug.is_edge(2, 3));
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, dimacs_unknown_lines_skipped) {
+
+	//unknown lines are skipped: with a warning among the edges, silently after the last edge line,
+	//comments may appear among the edges
+	write_tmp("p edge 3 2\ne 1 2\nx unknown line\nc comment\ne 2 3\nEOF\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(TMP_FILE, el, 1));
+	EXPECT_EQ(edge_list({ {0, 1}, {1, 2} }), all_edges(el));
+	EXPECT_EQ(1u, el.parts[0].nSkipped);
+	EXPECT_EQ(1u, el.parts[0].nTail);
+
+	//trailing "END" of the brock instances, in the last chunk only
+	gio::par::EdgeList elb;
+	EXPECT_EQ(0, gio::par::parse_dimacs(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq", elb, 4));
+	std::size_t nSkipped = 0, nTail = 0;
+	for (const auto& eb : elb.parts) {
+		nSkipped += eb.nSkipped;
+		nTail += eb.nTail;
+	}
+	EXPECT_EQ(0u, nSkipped);
+	EXPECT_EQ(1u, nTail);
+	EXPECT_EQ(1u, elb.parts.back().nTail);
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, dimacs_extra_tokens_ignored) {
+
+	//tokens after 'e <v> <w>' are ignored by the unweighted parser
+	write_tmp("p edge 3 2\ne 1 2 99 trailing text\ne 2 3 7\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(TMP_FILE, el));
+	EXPECT_EQ(edge_list({ {0, 1}, {1, 2} }), all_edges(el));
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, dimacs_self_loops_dropped) {
+
+	write_tmp("p edge 3 3\ne 1 1\ne 1 2\ne 3 3\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_dimacs(TMP_FILE, el));
+	EXPECT_EQ(edge_list({ {0, 1} }), all_edges(el));
+	EXPECT_EQ(2u, el.num_loops());
+
+	ugraph ug(TMP_FILE);
+	EXPECT_EQ(1u, ug.num_edges());
+	EXPECT_FALSE(ug.is_edge(0, 0));
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, edges_comments_anywhere) {
+
+	//'%' and '#' comments among the edges (the stream reader only skips them before the edges)
+	write_tmp("1 2\n# comment\n2 3\n% comment\n3 4\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_edges(TMP_FILE, el));
+	EXPECT_EQ(4, el.NV);
+	EXPECT_EQ(edge_list({ {0, 1}, {1, 2}, {2, 3} }), all_edges(el));
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, edges_extra_tokens_and_loops) {
+
+	//edge-weights are ignored, self-loops dropped (warning)
+	write_tmp("1 2 0.5\n2 2 1.0\n2 3 7 timestamp\n");
+	gio::par::EdgeList el;
+	EXPECT_EQ(0, gio::par::parse_edges(TMP_FILE, el));
+	EXPECT_EQ(3, el.NV);
+	EXPECT_EQ(edge_list({ {0, 1}, {1, 2} }), all_edges(el));
+	EXPECT_EQ(1u, el.num_loops());
+
+	//no edges
+	write_tmp("# only comments\n");
+	EXPECT_EQ(-1, gio::par::parse_edges(TMP_FILE, el));
+
+	std::remove(TMP_FILE.c_str());
+}
+
+TEST(GraphReader, readers_reset_on_error) {
+
+	//all the readers leave an empty graph if the file cannot be parsed
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	EXPECT_EQ(-1, ug.read_mtx(filename));
+	EXPECT_EQ(0, ug.num_vertices());
+
+	ug.reset(filename);
+	EXPECT_EQ(-1, ug.read_EDGES(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "bio-yeast.mtx"));
+	EXPECT_EQ(0, ug.num_vertices());
+
+	ug.reset(filename);
+	EXPECT_EQ(-1, ug.read_dimacs(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "bio-yeast.mtx"));
+	EXPECT_EQ(0, ug.num_vertices());
+
+	csr_ugraph cg(filename);
+	EXPECT_EQ(-1, cg.read_mtx(filename));
+	EXPECT_EQ(0, cg.num_vertices());
+}
+
+TEST(GraphReader, error_capture) {
+
+	//errors are kept while an ErrorCapture is in scope, and logged again after
+	vector<string> errors;
+	gio::par::EdgeList el;
+	{
+		gio::par::ErrorCapture capture(errors);
+		EXPECT_EQ(-1, gio::par::parse_dimacs(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "bio-yeast.mtx", el));
+		EXPECT_EQ(-1, gio::par::parse_mtx(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq", el));
+	}
+	EXPECT_EQ(2u, errors.size());
+	EXPECT_NE(string::npos, errors[1].find("Matrix Market banner"));
+	EXPECT_EQ(nullptr, gio::par::ErrorCapture::sink());
+
+	//format detection by reset(filename) is not affected
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "ia-southernwomen.edges");
+	EXPECT_LT(0, ug.num_vertices());
+	EXPECT_EQ(nullptr, gio::par::ErrorCapture::sink());
+}
@@ -0,0 +1,148 @@
+/**
+* @file test_graph_rows.cpp
+* @brief Typed unit tests shared by all the row types of Graph / Ugraph (construction, readers, KCore, GraphFastRootSort)
+* @details Results are checked against the ugraph (BBScan) type on the same instances. Tests specific to a row type
+*			are in its own file (test_graph_wide.cpp, test_graph_hybrid.cpp...)
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+template<class UgraphT>
+class GraphRowsTest : public ::testing::Test {
+protected:
+	using bitset_type = typename UgraphT::bitset_type;
+	using graph_type = Graph<bitset_type>;
+};
+
+using RowGraphTypes = ::testing::Types<Ugraph<FixedBitset<256>>, wide_ugraph<128>, wide_ugraph<512>, slab_ugraph,
+									   hybrid_ugraph, summary_ugraph, counted_ugraph, watched_ugraph>;
+TYPED_TEST_SUITE(GraphRowsTest, RowGraphTypes);
+
+TYPED_TEST(GraphRowsTest, construction) {
+
+	typename TestFixture::graph_type g(200);
+	g.add_edge(0, 1);
+	g.add_edge(1, 199);
+	g.add_edge(199, 0);
+
+	EXPECT_EQ(200, g.num_vertices());
+	EXPECT_EQ(3u, g.num_edges());
+	EXPECT_TRUE(g.is_edge(1, 199));
+	EXPECT_FALSE(g.is_edge(199, 1));
+
+	TypeParam ug(5);
+	ug.add_edge(0, 1);
+	ug.add_edge(0, 2);
+	ug.add_edge(0, 3);
+	ug.add_edge(1, 3);
+
+	EXPECT_EQ(4u, ug.num_edges());
+	EXPECT_EQ(3, ug.degree(0));
+	EXPECT_EQ(2, ug.degree(3));
+	EXPECT_EQ(1, ug.degree_up(1));
+
+	typename TestFixture::bitset_type bbs(5, { 1, 2, 4 });
+	EXPECT_EQ(2, ug.degree(0, bbs));
+	EXPECT_EQ(1, ug.degree(0, 1, bbs));
+	EXPECT_EQ(2, ug.degree_up(0, bbs));
+	EXPECT_EQ(0, ug.degree_up(2, bbs));
+}
+
+TYPED_TEST(GraphRowsTest, degree_up_block_boundary) {
+
+	//v = 63 and v = 127 are the last bits of their bitblocks
+	ugraph ug(200);
+	TypeParam ugt(200);
+	for (int w : { 0, 62, 64, 100, 127, 128, 199 }) {
+		ug.add_edge(63, w);
+		ugt.add_edge(63, w);
+	}
+	for (int w : { 5, 126, 128, 191 }) {
+		ug.add_edge(127, w);
+		ugt.add_edge(127, w);
+	}
+
+	BBScan bbn(200, { 64, 128, 191, 199 });
+	typename TestFixture::bitset_type bbnt(200, { 64, 128, 191, 199 });
+
+	EXPECT_EQ(5, ug.degree_up(63));
+	EXPECT_EQ(5, ugt.degree_up(63));
+	EXPECT_EQ(3, ug.degree_up(63, bbn));
+	EXPECT_EQ(3, ugt.degree_up(63, bbnt));
+
+	EXPECT_EQ(2, ug.degree_up(127));
+	EXPECT_EQ(2, ugt.degree_up(127));
+	EXPECT_EQ(2, ug.degree_up(127, bbn));
+	EXPECT_EQ(2, ugt.degree_up(127, bbnt));
+}
+
+TYPED_TEST(GraphRowsTest, read_brock) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	TypeParam ugt(filename);
+
+	EXPECT_EQ(ug.num_vertices(), ugt.num_vertices());
+	EXPECT_EQ(ug.num_edges(), ugt.num_edges());
+	EXPECT_EQ(ug.max_graph_degree(), ugt.max_graph_degree());
+	EXPECT_DOUBLE_EQ(ug.density(), ugt.density());
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		EXPECT_EQ(ug.degree(v), ugt.degree(v));
+		EXPECT_EQ(ug.degree_up(v), ugt.degree_up(v));
+	}
+}
+
+TYPED_TEST(GraphRowsTest, kcore) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq";
+	ugraph ug(filename);
+	TypeParam ugt(filename);
+
+	//full graph
+	KCore<ugraph> kc(ug);
+	KCore<TypeParam> kct(ugt);
+	kc.find_kcore();
+	kct.find_kcore();
+
+	EXPECT_EQ(kc.max_core_number(), kct.max_core_number());
+	EXPECT_EQ(kc.coreness_numbers(), kct.coreness_numbers());
+	EXPECT_EQ(kc.kcore_ordering(), kct.kcore_ordering());
+
+	//degrees in the subgraph induced by the even vertices
+	vector<int> lv;
+	for (int v = 0; v < ug.num_vertices(); v += 2) {
+		lv.push_back(v);
+	}
+	ugraph::bitset_type bbs(ug.num_vertices(), lv);
+	typename TestFixture::bitset_type bbst(ugt.num_vertices(), lv);
+
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		EXPECT_EQ(ug.degree(v, bbs), ugt.degree(v, bbst));
+		EXPECT_EQ(ug.degree(v, 20, bbs), ugt.degree(v, 20, bbst));
+		EXPECT_EQ(ug.degree_up(v, bbs), ugt.degree_up(v, bbst));
+	}
+}
+
+TYPED_TEST(GraphRowsTest, fast_sort) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_3.clq";
+	ugraph ug(filename);
+	TypeParam ugt(filename);
+
+	GraphFastRootSort<ugraph> gfs(ug);
+	GraphFastRootSort<TypeParam> gfst(ugt);
+
+	EXPECT_EQ(gfs.new_order(GraphFastRootSort<ugraph>::MIN_DEGEN, GraphFastRootSort<ugraph>::LAST_TO_FIRST),
+			  gfst.new_order(GraphFastRootSort<TypeParam>::MIN_DEGEN, GraphFastRootSort<TypeParam>::LAST_TO_FIRST));
+}
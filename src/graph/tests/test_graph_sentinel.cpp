@@ -0,0 +1,107 @@
+/**
+* @file test_graph_sentinel.cpp
+* @brief Unit tests specific to graphs with SentinelBitset rows: sentinels of the rows and of the candidate sets,
+*		 clique heuristics (clq_func.h) on candidate sets which shrink
+* @details The tests shared by all the row types are in test_graph_rows.cpp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/clique/clq_func.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphSentinel, sentinels_brock) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	watched_ugraph ugw(filename);
+
+	//degrees in the subgraph induced by the vertices in [70, 140)
+	vector<int> lv;
+	for (int v = 70; v < 140; ++v) {
+		lv.push_back(v);
+	}
+	ugraph::bitset_type bbs(ug.num_vertices(), lv);
+	watched_ugraph::bitset_type bbsw(ugw.num_vertices(), lv);
+	EXPECT_EQ(1, bbsw.sentinel_low());
+	EXPECT_EQ(2, bbsw.sentinel_high());
+
+	for (int v = 0; v < ug.num_vertices(); ++v) {
+		EXPECT_EQ(ug.degree(v, bbs), ugw.degree(v, bbsw));
+		EXPECT_EQ(ug.degree(v, 20, bbs), ugw.degree(v, 20, bbsw));
+		EXPECT_EQ(ug.degree_up(v, bbs), ugw.degree_up(v, bbsw));
+	}
+
+	//edits keep the sentinels of the rows exact
+	for (int v = 1; v < 200; ++v) {
+		ugw.remove_edge(0, v);
+	}
+	EXPECT_TRUE(ugw.neighbors(0).is_empty());
+	EXPECT_EQ(-1, ugw.neighbors(0).sentinel_high());
+
+	//subgraph
+	watched_ugraph ugs;
+	ugw.watched_graph::create_subgraph(150, ugs);
+	EXPECT_EQ(150, ugs.num_vertices());
+	for (int v = 0; v < 150; ++v) {
+		EXPECT_EQ(ugw.neighbors(v).count(0, 149), ugs.degree(v));
+		EXPECT_LE(ugs.neighbors(v).sentinel_high(), WDIV(149));
+	}
+}
+
+TEST(GraphSentinel, clique_heuristics) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_3.clq";
+	ugraph ug(filename);
+	watched_ugraph ugw(filename);
+	const int NV = ug.num_vertices();
+
+	//candidate sets: all the vertices and a range in the middle of the graph
+	vector<int> lv;
+	for (int v = 70; v < 150; ++v) {
+		lv.push_back(v);
+	}
+
+	for (int rep = 0; rep < 2; ++rep) {
+		ugraph::bitset_type bbs(NV, rep == 0);
+		watched_ugraph::bitset_type bbsw(NV, rep == 0);
+		if (rep == 1) {
+			bbs = ugraph::bitset_type(NV, lv);
+			bbsw = watched_ugraph::bitset_type(NV, lv);
+		}
+
+		vector<int> clq, clqw;
+		gfunc::clq::find_clique<ugraph, false>(ug, clq, bbs);
+		gfunc::clq::find_clique<watched_ugraph, false>(ugw, clqw, bbsw);
+		EXPECT_EQ(clq, clqw);
+		for (auto i = 0u; i < clqw.size(); ++i) {
+			for (auto j = i + 1; j < clqw.size(); ++j) {
+				EXPECT_TRUE(ugw.is_edge(clqw[i], clqw[j]));
+			}
+		}
+
+		gfunc::clq::find_clique<ugraph, true>(ug, clq, bbs);
+		gfunc::clq::find_clique<watched_ugraph, true>(ugw, clqw, bbsw);
+		EXPECT_EQ(clq, clqw);
+
+		gfunc::clq::find_clique_max_deg<ugraph, false>(ug, clq, bbs);
+		gfunc::clq::find_clique_max_deg<watched_ugraph, false>(ugw, clqw, bbsw);
+		EXPECT_EQ(clq, clqw);
+
+		gfunc::clq::find_clique_from_pool(ug, clq, bbs);
+		gfunc::clq::find_clique_from_pool(ugw, clqw, bbsw);
+		EXPECT_EQ(clq.size(), clqw.size());
+
+		EXPECT_EQ(gfunc::clq::find_clique_lb(ug, bbs), gfunc::clq::find_clique_lb(ugw, bbsw));
+		EXPECT_EQ((gfunc::clq::find_clique_lb<ugraph, true>(ug, bbs)), (gfunc::clq::find_clique_lb<watched_ugraph, true>(ugw, bbsw)));
+	}
+
+	EXPECT_EQ(gfunc::clq::find_clique_lb(ug), gfunc::clq::find_clique_lb(ugw));
+}
@@ -0,0 +1,104 @@
+/**
+* @file test_graph_summary.cpp
+* @brief Unit tests of graphs with SummaryBitset rows: scanning and degrees on rows whose
+*		 neighbors lie far apart, so that the two summary levels skip empty summary words
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/kcore.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//10000 vertices: 157 bitblocks per row, 3 words in level 0 and one in level 1
+	const int NV = 10000;
+
+	//neighbors of 0 in the first and last bitblocks, neighbors of 5000 in the middle and last words of level 0
+	template<class GraphT>
+	void add_far_edges(GraphT& g) {
+		for (int w : { 1, 63, 9999 }) { g.add_edge(0, w); }
+		for (int w : { 4100, 4101, 9990 }) { g.add_edge(5000, w); }
+		g.add_edge(4100, 9990);
+	}
+}
+
+TEST(GraphSummary, rows_skip_empty_summary_words) {
+
+	summary_ugraph ug(NV);
+	add_far_edges(ug);
+
+	const SummaryBitset& row0 = ug.neighbors(0);
+	EXPECT_EQ(2, row0.num_levels());
+	EXPECT_EQ(3, row0.summary_size(0));
+	EXPECT_EQ(0, row0.next_block(0));
+	EXPECT_EQ(WDIV(9999), row0.next_block(1));							//skips the empty word 1 of level 0
+	EXPECT_EQ(0, row0.prev_block(WDIV(9999) - 1));
+	EXPECT_EQ(bitpos_list({ 1, 63, 9999 }), static_cast<bitpos_list>(row0));
+
+	//reverse scanning across the empty words of level 0
+	const SummaryBitset& row5000 = ug.neighbors(5000);
+	bitpos_list lr;
+	for (int w = row5000.prev_bit(BBObject::noBit); w != BBObject::noBit; w = row5000.prev_bit(w)) { lr.push_back(w); }
+	EXPECT_EQ(bitpos_list({ 9990, 4101, 4100 }), lr);
+	EXPECT_EQ(4101, row5000.prev_bit(9990));
+	EXPECT_EQ(-1, row0.prev_bit(1));
+
+	//degrees
+	EXPECT_EQ(3, ug.degree(0));
+	EXPECT_EQ(3, ug.degree_up(0));
+	EXPECT_EQ(0, ug.degree_up(9999));
+	EXPECT_EQ(2, ug.degree(9990));
+
+	SummaryBitset bbn(NV, { 63, 4101, 9990, 9999 });
+	EXPECT_EQ(2, ug.degree(0, bbn));
+	EXPECT_EQ(2, ug.degree(5000, bbn));
+	EXPECT_EQ(1, ug.degree(5000, 1, bbn));
+	EXPECT_EQ(1, ug.degree_up(4100, bbn));
+	EXPECT_EQ(0, ug.degree_up(9990, bbn));
+}
+
+TEST(GraphSummary, edits_update_summaries) {
+
+	summary_ugraph ug(NV);
+	add_far_edges(ug);
+
+	//the last word of level 0 empties in row 0
+	ug.remove_edge(0, 9999);
+	EXPECT_EQ(-1, ug.neighbors(0).next_block(1));
+	EXPECT_EQ(0, ug.neighbors(0).prev_block(WDIV(NV - 1)));
+	EXPECT_EQ(63, ug.neighbors(0).msb());
+	EXPECT_EQ(2, ug.degree(0));
+
+	//and fills again
+	ug.add_edge(9999, 0);
+	EXPECT_EQ(WDIV(9999), ug.neighbors(0).next_block(1));
+	EXPECT_EQ(9999, ug.neighbors(0).msb());
+	EXPECT_TRUE(ug.is_edge(0, 9999));
+}
+
+TEST(GraphSummary, kcore_far_triangles) {
+
+	//triangles {4100, 5000, 9990} and {0, 1, 63} + edges (0, 9999), (5000, 4101)
+	summary_ugraph ug(NV);
+	add_far_edges(ug);
+	ug.add_edge(1, 63);
+
+	KCore<summary_ugraph> kc(ug);
+	EXPECT_EQ(0, kc.find_kcore());
+	EXPECT_EQ(2, kc.max_core_number());
+	for (int v : { 0, 1, 63, 4100, 5000, 9990 }) {
+		EXPECT_EQ(2, kc.coreness(v));
+	}
+	EXPECT_EQ(1, kc.coreness(9999));
+	EXPECT_EQ(1, kc.coreness(4101));
+	EXPECT_EQ(0, kc.coreness(2));
+	EXPECT_EQ(6, kc.core_size(2));
+}
@@ -0,0 +1,86 @@
+/**
+* @file test_graph_wide.cpp
+* @brief Unit tests specific to graphs with WideBitset<W> rows: row size and slab_ugraph (all the rows in one aligned slab)
+* @details The tests shared by all the row types are in test_graph_rows.cpp
+* @created 17/10/2026
+* @author pss
+**/
+
+#include "graph/graph.h"				//	facade types
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "gtest/gtest.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphWide, row_blocks) {
+
+	//rows are rounded up to whole blocks of WBITS bits
+	wide_graph<512> g(1000);
+	EXPECT_EQ(1024, g.neighbors(0).num_blocks() * 64);
+	wide_graph<256> g4(1000);
+	EXPECT_EQ(1024, g4.neighbors(0).num_blocks() * 64);
+	wide_graph<128> g2(1000);
+	EXPECT_EQ(1024, g2.neighbors(0).num_blocks() * 64);
+	wide_graph<512> g8(1025);
+	EXPECT_EQ(1536, g8.neighbors(0).num_blocks() * 64);
+}
+
+TEST(GraphWide, slab) {
+
+	string filename = PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq";
+	ugraph ug(filename);
+	slab_ugraph ugs(filename);
+	const int NV = ug.num_vertices();
+
+	//all the rows in one slab, aligned to cache lines
+	const auto& adj = ugs.adjacency_matrix();
+	EXPECT_EQ(static_cast<std::size_t>(NV), adj.size());
+	EXPECT_EQ(8, adj.stride());
+	for (int v = 0; v < NV; ++v) {
+		EXPECT_TRUE(adj.is_in_slab(v));
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(ugs.neighbors(v).data()) % 64);
+		EXPECT_EQ(ug.degree(v), ugs.degree(v));
+	}
+	EXPECT_EQ(ug.num_edges(), ugs.num_edges());
+
+	//copies are deep
+	slab_ugraph ugc(ugs);
+	EXPECT_TRUE(ugc == ugs);
+	EXPECT_NE(ugc.neighbors(0).data(), ugs.neighbors(0).data());
+	ugc.remove_edge(0, ugc.neighbors(0).lsb());
+	EXPECT_FALSE(ugc == ugs);
+
+	//subgraph
+	slab_ugraph ugsub;
+	ugs.slab_graph::create_subgraph(100, ugsub);
+	for (int v = 0; v < 100; ++v) {
+		EXPECT_TRUE(ugsub.adjacency_matrix().is_in_slab(v));
+		EXPECT_EQ(ugs.neighbors(v).count(0, 99), ugsub.degree(v));
+	}
+
+	//clique heuristics
+	vector<int> clq, clqs;
+	ugraph::bitset_type bbs(NV, true);
+	slab_ugraph::bitset_type bbss(NV, true);
+	gfunc::clq::find_clique(ug, clq, bbs);
+	gfunc::clq::find_clique(ugs, clqs, bbss);
+	EXPECT_EQ(clq, clqs);
+	EXPECT_EQ(gfunc::clq::find_clique_lb(ug), gfunc::clq::find_clique_lb(ugs));
+
+	//KCore
+	KCore<ugraph> kc(ug);
+	KCore<slab_ugraph> kcs(ugs);
+	kc.find_kcore();
+	kcs.find_kcore();
+	EXPECT_EQ(kc.coreness_numbers(), kcs.coreness_numbers());
+
+	//reset
+	ugs.reset(1000);
+	EXPECT_EQ(1000, ugs.num_vertices());
+	EXPECT_EQ(0u, ugs.num_edges(false));
+}
@@ -350,6 +350,46 @@ TEST(Ugraph, create_subgraph) {
 
 }
 
+TEST(Ugraph, create_subgraph_compress) {
+
+	const int NV = 300;
+
+	ugraph g(NV);
+	sparse_ugraph gs(NV);
+	for (int i = 0; i < NV; ++i) {
+		for (int j = i + 1; j < NV; ++j) {
+			if ((i * 7 + j * 13) % 5 == 0) {
+				g.add_edge(i, j);
+				gs.add_edge(i, j);
+			}
+		}
+	}
+
+	//sorted list (compress path) and the same list unsorted (is_edge path)
+	std::vector<int> lv;
+	for (int v = 1; v < NV; v += 3) { lv.push_back(v); }
+	std::vector<int> lvr(lv.rbegin(), lv.rend());
+
+	ugraph ugi, ugr;
+	sparse_ugraph ugs;
+	ASSERT_EQ(0, g.create_subgraph(ugi, lv));
+	ASSERT_EQ(0, g.create_subgraph(ugr, lvr));
+	ASSERT_EQ(0, gs.create_subgraph(ugs, lv));
+
+	const int k = static_cast<int>(lv.size());
+	ASSERT_EQ(k, ugi.num_vertices());
+	ASSERT_EQ(k, ugs.num_vertices());
+	for (int i = 0; i < k; ++i) {
+		for (int j = 0; j < k; ++j) {
+			EXPECT_EQ(g.is_edge(lv[i], lv[j]), ugi.is_edge(i, j));
+			EXPECT_EQ(g.is_edge(lv[i], lv[j]), ugs.is_edge(i, j));
+			EXPECT_EQ(ugi.is_edge(i, j), ugr.is_edge(k - 1 - i, k - 1 - j));
+		}
+	}
+	EXPECT_EQ(ugr.num_edges(), ugi.num_edges());
+	EXPECT_EQ(ugi.num_edges(), ugs.num_edges());
+}
+
 
 TEST(Ugraph, complement_graph){
 		
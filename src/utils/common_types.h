@@ -13,6 +13,11 @@
 #include <vector>
 #include <set>
 #include <memory>
+#include <iterator>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
 #include <cassert>
 
 
@@ -272,9 +277,239 @@ namespace bitgraph {
 
 		};
 
+		////////////////////////
+		//
+		// class SmallVector
+		//
+		// Contiguous vector with inline storage for the first N elements (small-buffer optimization).
+		// Spills to the heap only when the size exceeds N.
+		// Intended for TRIVIALLY COPYABLE types only (elements are relocated with memcpy / memmove).
+		//
+		////////////////////////
+
+		/**
+		 * @brief Subset of the std::vector interface (iterators are pointers) with N elements
+		 *		  stored in the object itself
+		 *
+		 * @tparam T Trivially copyable and trivially destructible element type
+		 * @tparam N Number of elements stored inline (N > 0)
+		 *
+		 * @details
+		 * - No allocation while size() <= N: a small collection costs no heap block and no pointer chase
+		 *	 to a different cache line.
+		 * - On overflow the capacity doubles (heap), as in std::vector. clear() keeps the capacity,
+		 *	 shrink_to_fit() moves the elements back inline if they fit.
+		 * - Iterators and pointers are invalidated by any growth and by moves of an inline vector.
+		 */
+		template <class T, std::size_t N>
+		class SmallVector {
+
+			static_assert(N > 0, "SmallVector<T, N> requires N > 0 - use std::vector otherwise");
+			static_assert(std::is_trivially_copyable<T>::value,
+				"SmallVector<T, N> relocates elements with memcpy / memmove - T must be trivially copyable");
+			static_assert(std::is_trivially_destructible<T>::value,
+				"SmallVector<T, N> never runs element destructors");
+
+		public:
+
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = const T&;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using iterator = T*;
+			using const_iterator = const T*;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+			static constexpr size_type inline_capacity() noexcept { return N; }
+
+			///////
+			//construction / destruction
+
+			SmallVector() noexcept : data_(inline_data()), size_(0), cap_(N) {}
+
+			SmallVector(const SmallVector& rhs) : SmallVector() { copy_from(rhs); }
+			SmallVector(SmallVector&& rhs) noexcept : SmallVector() { steal(rhs); }
+
+			SmallVector& operator = (const SmallVector& rhs) {
+				if (this != &rhs) {
+					size_ = 0;
+					copy_from(rhs);
+				}
+				return *this;
+			}
+
+			SmallVector& operator = (SmallVector&& rhs) noexcept {
+				if (this != &rhs) {
+					release();
+					data_ = inline_data();
+					cap_ = N;
+					steal(rhs);
+				}
+				return *this;
+			}
+
+			~SmallVector() { release(); }
+
+			//setters and getters
+
+			size_type size() const noexcept { return size_; }
+			size_type capacity() const noexcept { return cap_; }
+			bool empty() const noexcept { return size_ == 0; }
+
+			/**
+			* @brief TRUE if the elements are stored in the object (no heap block)
+			**/
+			bool is_inline() const noexcept { return data_ == inline_data(); }
+
+			T* data() noexcept { return data_; }
+			const T* data() const noexcept { return data_; }
+
+			T& operator [] (size_type pos) { return data_[pos]; }
+			const T& operator [] (size_type pos) const { return data_[pos]; }
+
+			T& front() { return data_[0]; }
+			const T& front() const { return data_[0]; }
+			T& back() { return data_[size_ - 1]; }
+			const T& back() const { return data_[size_ - 1]; }
+
+			//iterators
+			iterator begin() noexcept { return data_; }
+			iterator end() noexcept { return data_ + size_; }
+			const_iterator begin() const noexcept { return data_; }
+			const_iterator end() const noexcept { return data_ + size_; }
+			const_iterator cbegin() const noexcept { return data_; }
+			const_iterator cend() const noexcept { return data_ + size_; }
+			reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+			reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+			const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+			const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+			////////////
+			// allocation
+
+			/**
+			* @brief ensures room for n elements (no-op if n <= capacity())
+			**/
+			void reserve(size_type n) {
+				if (n > cap_) { grow_to(n); }
+			}
+
+			/**
+			* @brief releases unused heap capacity - the elements return inline if size() <= N
+			**/
+			void shrink_to_fit();
+
+			void clear() noexcept { size_ = 0; }
+
+			void swap(SmallVector& rhs) noexcept {
+				SmallVector tmp(std::move(rhs));
+				rhs = std::move(*this);
+				*this = std::move(tmp);
+			}
+
+			////////////
+			// modifiers
+
+			template<class... Args>
+			T& emplace_back(Args&&... args) {
+				const T val(std::forward<Args>(args)...);			//args may refer to an element of this vector
+				if (size_ == cap_) { grow_to(2 * size_type(cap_)); }
+				std::memcpy(static_cast<void*>(data_ + size_), &val, sizeof(T));
+				return data_[size_++];
+			}
+
+			void push_back(const T& val) { emplace_back(val); }
+
+			void pop_back() noexcept {
+				assert(size_ > 0);
+				--size_;
+			}
+
+			/**
+			* @brief inserts val before pos
+			* @returns iterator to the inserted element
+			**/
+			iterator insert(const_iterator pos, const T& val);
+
+			/**
+			* @brief inserts the elements in [first, last) before pos (the range may not belong to this vector)
+			* @returns iterator to the first inserted element
+			**/
+			template<class ForwardIt, class = typename std::enable_if<!std::is_integral<ForwardIt>::value>::type>
+			iterator insert(const_iterator pos, ForwardIt first, ForwardIt last);
+
+			/**
+			* @brief removes the element at pos
+			* @returns iterator to the element after the removed one
+			**/
+			iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+			/**
+			* @brief removes the elements in [first, last)
+			* @returns iterator to the element after the removed ones
+			**/
+			iterator erase(const_iterator first, const_iterator last);
+
+			////////////
+			// operators
+
+			friend bool operator == (const SmallVector& lhs, const SmallVector& rhs) {
+				return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+			}
+			friend bool operator != (const SmallVector& lhs, const SmallVector& rhs) { return !(lhs == rhs); }
+
+		private:
+
+			T* inline_data() noexcept { return reinterpret_cast<T*>(buf_); }
+			const T* inline_data() const noexcept { return reinterpret_cast<const T*>(buf_); }
+
+			//moves the elements to a new heap block of n elements
+			void grow_to(size_type n);
+
+			//frees the heap block, if any (the state is not updated)
+			void release() noexcept {
+				if (!is_inline()) { ::operator delete(data_); }
+			}
+
+			//appends the elements of rhs (enough room is reserved)
+			void copy_from(const SmallVector& rhs) {
+				reserve(rhs.size_);
+				if (rhs.size_) { std::memcpy(static_cast<void*>(data_), rhs.data_, rhs.size_ * sizeof(T)); }
+				size_ = rhs.size_;
+			}
+
+			//takes the elements of rhs, which is left empty and inline - requires this to be empty and inline
+			void steal(SmallVector& rhs) noexcept {
+				if (rhs.is_inline()) {
+					if (rhs.size_) { std::memcpy(static_cast<void*>(data_), rhs.data_, rhs.size_ * sizeof(T)); }
+				}
+				else {
+					data_ = rhs.data_;
+					cap_ = rhs.cap_;
+					rhs.data_ = rhs.inline_data();
+					rhs.cap_ = N;
+				}
+				size_ = rhs.size_;
+				rhs.size_ = 0;
+			}
+
+			/////////////////////
+			// data members
+
+			T* data_;												//inline buffer or heap block
+			std::uint32_t size_;									//number of elements
+			std::uint32_t cap_;										//capacity (N if inline)
+			alignas(T) unsigned char buf_[N * sizeof(T)];			//inline buffer
+		};
+
 	}//end namespace com
 			
 	using com::FixedStack;
+	using com::SmallVector;
 		
 }//end namespace bitgraph
 
@@ -287,6 +522,88 @@ namespace bitgraph {
 }
 
 
+namespace bitgraph {
+	namespace com {
+
+		template<class T, std::size_t N>
+		inline
+		void SmallVector<T, N>::grow_to(size_type n) {
+
+			assert(n >= size_);
+			T* p = static_cast<T*>(::operator new(n * sizeof(T)));
+			if (size_) { std::memcpy(static_cast<void*>(p), data_, std::min<size_type>(n, size_) * sizeof(T)); }	//n >= size_ (bound for -Wstringop-overflow)
+			release();
+			data_ = p;
+			cap_ = static_cast<std::uint32_t>(n);
+		}
+
+		template<class T, std::size_t N>
+		inline
+		void SmallVector<T, N>::shrink_to_fit() {
+
+			if (is_inline() || size_ == cap_) { return; }
+
+			if (size_ <= N) {
+				T* p = data_;
+				if (size_) { std::memcpy(static_cast<void*>(inline_data()), p, size_ * sizeof(T)); }
+				::operator delete(p);
+				data_ = inline_data();
+				cap_ = N;
+			}
+			else {
+				grow_to(size_);
+			}
+		}
+
+		template<class T, std::size_t N>
+		inline
+		typename SmallVector<T, N>::iterator SmallVector<T, N>::insert(const_iterator pos, const T& val) {
+
+			assert(pos >= data_ && pos <= data_ + size_);
+
+			const size_type idx = pos - data_;
+			const T tmp(val);										//val may be an element of this vector
+			if (size_ == cap_) { grow_to(2 * size_type(cap_)); }
+			std::memmove(static_cast<void*>(data_ + idx + 1), data_ + idx, (size_ - idx) * sizeof(T));
+			std::memcpy(static_cast<void*>(data_ + idx), &tmp, sizeof(T));
+			++size_;
+			return data_ + idx;
+		}
+
+		template<class T, std::size_t N>
+		template<class ForwardIt, class>
+		inline
+		typename SmallVector<T, N>::iterator SmallVector<T, N>::insert(const_iterator pos, ForwardIt first, ForwardIt last) {
+
+			assert(pos >= data_ && pos <= data_ + size_);
+
+			const size_type idx = pos - data_;
+			const size_type n = static_cast<size_type>(std::distance(first, last));
+			if (n == 0) { return data_ + idx; }
+
+			if (size_ + n > cap_) { grow_to(std::max<size_type>(size_ + n, 2 * size_type(cap_))); }
+			std::memmove(static_cast<void*>(data_ + idx + n), data_ + idx, (size_ - idx) * sizeof(T));
+			std::copy(first, last, data_ + idx);
+			size_ += static_cast<std::uint32_t>(n);
+			return data_ + idx;
+		}
+
+		template<class T, std::size_t N>
+		inline
+		typename SmallVector<T, N>::iterator SmallVector<T, N>::erase(const_iterator first, const_iterator last) {
+
+			assert(first >= data_ && first <= last && last <= data_ + size_);
+
+			const size_type idx = first - data_;
+			const size_type n = last - first;
+			std::memmove(static_cast<void*>(data_ + idx), data_ + idx + n, (size_ - idx - n) * sizeof(T));
+			size_ -= static_cast<std::uint32_t>(n);
+			return data_ + idx;
+		}
+
+	}//end namespace com
+}//end namespace bitgraph
+
 namespace bitgraph {
 	namespace detail
 	{
@@ -343,4 +660,4 @@ namespace bitgraph {
 
 
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
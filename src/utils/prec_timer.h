@@ -54,9 +54,23 @@ namespace bitgraph {
 			wall_timepoint_t wall_time;
 		};
 
+		/**
+		* @brief Wall time of nRep repetitions of f (timing loop of the benchmarks)
+		* @returns seconds per repetition
+		**/
+		template<class Func>
+		inline
+		double wall_time_per_rep(int nRep, Func f) {
+			PrecisionTimer pt;
+			pt.wall_tic();
+			for (int r = 0; r < nRep; ++r) { f(); }
+			return pt.wall_toc() / nRep;
+		}
+
 	}//end namespace _impl
 
 	using _impl::PrecisionTimer;
+	using _impl::wall_time_per_rep;
 
 }//end namespace bitgraph
 
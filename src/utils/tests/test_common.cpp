@@ -10,6 +10,7 @@
 **/
 
 #include "utils/common.h"
+#include "utils/common_types.h"
 #include "gtest/gtest.h"
 #include "utils/logger.h"
 #include <iostream>
@@ -197,6 +198,87 @@ TEST(Common, fixed_stack_pop){
 
 }
 
+TEST(Common, small_vector_inline_and_spill) {
+
+	bitgraph::com::SmallVector<int, 2> v;
+	EXPECT_TRUE(v.empty());
+	EXPECT_TRUE(v.is_inline());
+	EXPECT_EQ(2, v.capacity());
+
+	v.push_back(10);
+	v.emplace_back(30);
+	EXPECT_TRUE(v.is_inline());
+
+	//insertion in the middle spills to the heap
+	v.insert(v.begin() + 1, 20);
+	EXPECT_FALSE(v.is_inline());
+	EXPECT_EQ(vector<int>({ 10, 20, 30 }), vector<int>(v.begin(), v.end()));
+
+	//range insertion and erasure
+	vector<int> lv = { 1, 2 };
+	v.insert(v.begin(), lv.begin(), lv.end());
+	EXPECT_EQ(vector<int>({ 1, 2, 10, 20, 30 }), vector<int>(v.begin(), v.end()));
+	v.erase(v.begin() + 1, v.begin() + 4);
+	EXPECT_EQ(vector<int>({ 1, 30 }), vector<int>(v.begin(), v.end()));
+	v.erase(v.begin());
+	EXPECT_EQ(30, v.front());
+	EXPECT_EQ(30, v.back());
+
+	//back inline
+	v.shrink_to_fit();
+	EXPECT_TRUE(v.is_inline());
+	EXPECT_EQ(1, v.size());
+	EXPECT_EQ(30, v[0]);
+
+	//an element of the vector as argument of a growing insertion
+	v.push_back(40);
+	v.push_back(v[0]);
+	EXPECT_EQ(vector<int>({ 30, 40, 30 }), vector<int>(v.begin(), v.end()));
+
+	v.clear();
+	EXPECT_TRUE(v.empty());
+}
+
+TEST(Common, small_vector_copy_move) {
+
+	using svec = bitgraph::com::SmallVector<int, 3>;
+
+	svec small, large;
+	small.push_back(1);
+	for (int i = 0; i < 10; ++i) { large.push_back(i); }
+
+	//copies
+	svec c1(small), c2(large);
+	EXPECT_TRUE(c1 == small);
+	EXPECT_TRUE(c2 == large);
+	EXPECT_TRUE(c1.is_inline());
+	EXPECT_NE(c2.data(), large.data());
+
+	c1 = large;
+	c2 = small;
+	EXPECT_TRUE(c1 == large);
+	EXPECT_TRUE(c2 == small);
+	EXPECT_TRUE(c1 != c2);
+
+	//moves: the heap block is taken, the source is left empty and inline
+	const int* p = large.data();
+	svec m1(std::move(large));
+	EXPECT_EQ(p, m1.data());
+	EXPECT_TRUE(large.empty());
+	EXPECT_TRUE(large.is_inline());
+
+	svec m2;
+	m2 = std::move(small);
+	EXPECT_TRUE(m2.is_inline());
+	EXPECT_EQ(1, m2.size());
+	EXPECT_TRUE(small.empty());
+
+	m1.swap(m2);
+	EXPECT_EQ(1, m1.size());
+	EXPECT_EQ(10, m2.size());
+	EXPECT_EQ(p, m2.data());
+}
+
 TEST(Common_dir, path){
 
 	string path_1("c:/kk/");		//POSIX